@@ -281,6 +281,60 @@ Vc_INTRINSIC __m128i convert(__m256d v, ConvertTag<double, ushort>) { return con
 Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<short , ushort>) { return v; }
 Vc_INTRINSIC __m256i convert(__m256i v, ConvertTag<ushort, ushort>) { return v; }
 
+Vc_INTRINSIC __m256i convert(__m128i v, ConvertTag<schar , short >) {
+#ifdef Vc_IMPL_AVX2
+    return _mm256_cvtepi8_epi16(v);
+#else
+    return concat(_mm_cvtepi8_epi16(v), _mm_cvtepi8_epi16(_mm_srli_si128(v, 8)));
+#endif
+}
+Vc_INTRINSIC __m256i convert(__m128i v, ConvertTag<uchar , short >) {
+#ifdef Vc_IMPL_AVX2
+    return _mm256_cvtepu8_epi16(v);
+#else
+    return concat(_mm_cvtepu8_epi16(v), _mm_cvtepu8_epi16(_mm_srli_si128(v, 8)));
+#endif
+}
+Vc_INTRINSIC __m256i convert(__m128i v, ConvertTag<schar , ushort>) { return convert(v, ConvertTag<schar, short>()); }
+Vc_INTRINSIC __m256i convert(__m128i v, ConvertTag<uchar , ushort>) { return convert(v, ConvertTag<uchar, short>()); }
+Vc_INTRINSIC __m256i convert(__m128i v, ConvertTag<schar , int   >) {
+#ifdef Vc_IMPL_AVX2
+    return _mm256_cvtepi8_epi32(v);
+#else
+    return concat(_mm_cvtepi8_epi32(v), _mm_cvtepi8_epi32(_mm_srli_si128(v, 4)));
+#endif
+}
+Vc_INTRINSIC __m256i convert(__m128i v, ConvertTag<uchar , int   >) {
+#ifdef Vc_IMPL_AVX2
+    return _mm256_cvtepu8_epi32(v);
+#else
+    return concat(_mm_cvtepu8_epi32(v), _mm_cvtepu8_epi32(_mm_srli_si128(v, 4)));
+#endif
+}
+Vc_INTRINSIC __m256i convert(__m128i v, ConvertTag<schar , uint  >) { return convert(v, ConvertTag<schar, int>()); }
+Vc_INTRINSIC __m256i convert(__m128i v, ConvertTag<uchar , uint  >) { return convert(v, ConvertTag<uchar, int>()); }
+Vc_INTRINSIC __m256  convert(__m128i v, ConvertTag<schar , float >) { return _mm256_cvtepi32_ps(convert(v, ConvertTag<schar, int>())); }
+Vc_INTRINSIC __m256  convert(__m128i v, ConvertTag<uchar , float >) { return _mm256_cvtepi32_ps(convert(v, ConvertTag<uchar, int>())); }
+Vc_INTRINSIC __m256d convert(__m128i v, ConvertTag<schar , double>) { return _mm256_cvtepi32_pd(_mm_cvtepi8_epi32(v)); }
+Vc_INTRINSIC __m256d convert(__m128i v, ConvertTag<uchar , double>) { return _mm256_cvtepi32_pd(_mm_cvtepu8_epi32(v)); }
+
+// conversions to 8-bit integers truncate and zero the remaining entries (cf. SSE::convert)
+Vc_INTRINSIC __m128i convert(__m256i v, ConvertTag<short , schar >) {
+    const __m128i mask = _mm_srli_epi16(_mm_setallone_si128(), 8);
+    return _mm_packus_epi16(_mm_and_si128(lo128(v), mask), _mm_and_si128(hi128(v), mask));
+}
+Vc_INTRINSIC __m128i convert(__m256i v, ConvertTag<ushort, schar >) { return convert(v, ConvertTag<short, schar>()); }
+Vc_INTRINSIC __m128i convert(__m256i v, ConvertTag<int   , schar >) { return convert(convert(v, ConvertTag<int, short>()), SSE::ConvertTag<short, schar>()); }
+Vc_INTRINSIC __m128i convert(__m256i v, ConvertTag<uint  , schar >) { return convert(v, ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m128i convert(__m256  v, ConvertTag<float , schar >) { return convert(convert(v, ConvertTag<float, int>()), ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m128i convert(__m256d v, ConvertTag<double, schar >) { return convert(convert(v, ConvertTag<double, int>()), SSE::ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m128i convert(__m256i v, ConvertTag<short , uchar >) { return convert(v, ConvertTag<short, schar>()); }
+Vc_INTRINSIC __m128i convert(__m256i v, ConvertTag<ushort, uchar >) { return convert(v, ConvertTag<short, schar>()); }
+Vc_INTRINSIC __m128i convert(__m256i v, ConvertTag<int   , uchar >) { return convert(v, ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m128i convert(__m256i v, ConvertTag<uint  , uchar >) { return convert(v, ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m128i convert(__m256  v, ConvertTag<float , uchar >) { return convert(v, ConvertTag<float, schar>()); }
+Vc_INTRINSIC __m128i convert(__m256d v, ConvertTag<double, uchar >) { return convert(v, ConvertTag<double, schar>()); }
+
 template <typename From, typename To>
 Vc_INTRINSIC auto convert(
     typename std::conditional<(sizeof(From) < sizeof(To)),
@@ -297,6 +351,24 @@ Vc_INTRINSIC auto convert(typename AVX::VectorTypeHelper<From>::Type v)
 {
     return convert(lo128(v), ConvertTag<From, To>());
 }
+
+// half-precision conversions of eight entries
+Vc_INTRINSIC __m256 cvtph_ps(__m128i h)
+{
+#ifdef Vc_IMPL_F16C
+    return _mm256_cvtph_ps(h);
+#else
+    return concat(SSE::cvtph_ps(h), SSE::cvtph_ps(_mm_srli_si128(h, 8)));
+#endif
+}
+Vc_INTRINSIC __m128i cvtps_ph(__m256 x)
+{
+#ifdef Vc_IMPL_F16C
+    return _mm256_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT);
+#else
+    return _mm_unpacklo_epi64(SSE::cvtps_ph(lo128(x)), SSE::cvtps_ph(hi128(x)));
+#endif
+}
 }  // namespace AVX
 }  // namespace Vc
 
@@ -59,6 +59,20 @@ namespace AVX
     template<> struct IndexesFromZeroData<unsigned char> {
         static Vc_ALWAYS_INLINE Vc_CONST const unsigned char *address() { return &_IndexesFromZero8[0]; }
     };
+    template<> struct IndexesFromZeroData<long long> {
+        static Vc_ALWAYS_INLINE Vc_CONST const long long *address() { return reinterpret_cast<const long long *>(&_IndexesFromZero64[0]); }
+    };
+    template<> struct IndexesFromZeroData<unsigned long long> {
+        static Vc_ALWAYS_INLINE Vc_CONST const unsigned long long *address() { return &_IndexesFromZero64[0]; }
+    };
+#if defined __LP64__ || defined _LP64
+    template<> struct IndexesFromZeroData<long> {
+        static Vc_ALWAYS_INLINE Vc_CONST const long *address() { return reinterpret_cast<const long *>(&_IndexesFromZero64[0]); }
+    };
+    template<> struct IndexesFromZeroData<unsigned long> {
+        static Vc_ALWAYS_INLINE Vc_CONST const unsigned long *address() { return reinterpret_cast<const unsigned long *>(&_IndexesFromZero64[0]); }
+    };
+#endif
 
     template<typename _T> struct Const
     {
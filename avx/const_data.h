@@ -36,6 +36,7 @@ namespace Vc_VERSIONED_NAMESPACE
 namespace AVX
 {
 
+alignas(32) extern const unsigned long long _IndexesFromZero64[4];
 alignas(64) extern const unsigned int   _IndexesFromZero32[ 8];
 alignas(16) extern const unsigned short _IndexesFromZero16[16];
 alignas(16) extern const unsigned char  _IndexesFromZero8 [32];
@@ -84,6 +85,7 @@ namespace AVX2
     using AVX::_IndexesFromZero8;
     using AVX::_IndexesFromZero16;
     using AVX::_IndexesFromZero32;
+    using AVX::_IndexesFromZero64;
     using AVX::c_general;
     using AVX::c_trig;
     using AVX::c_log;
@@ -431,6 +431,11 @@ Vc_INTRINSIC __m256 load(const short *mem, Flags f, LoadTag<__m256, float>)
 {
     return AVX::convert<short, float>(load16(mem, f));
 }
+template <typename Flags>
+Vc_INTRINSIC __m256 load(const half *mem, Flags f, LoadTag<__m256, float>)
+{
+    return AVX::cvtph_ps(load16(reinterpret_cast<const ushort *>(mem), f));
+}
 /*
 template<typename Flags> struct LoadHelper<float, unsigned char, Flags> {
     static __m256 load(const unsigned char *mem, Flags)
@@ -583,6 +588,48 @@ template<> Vc_INTRINSIC Vc_CONST __m256 mask_cast<16, 4, __m256>(__m256i k)
     return _mm256_castsi256_ps(AVX::concat(_mm_unpacklo_epi32(tmp, tmp), _mm_unpackhi_epi32(tmp, tmp)));
 }
 
+// 32 -> 16
+template<> Vc_INTRINSIC Vc_CONST __m256 mask_cast<32, 16, __m256>(__m256i k)
+{
+    // abcd efgh ijkl mnop ... -> aabb ccdd eeff gghh iijj kkll mmnn oopp
+    const auto lo = AVX::lo128(k);
+    return _mm256_castsi256_ps(AVX::concat(_mm_unpacklo_epi8(lo, lo), _mm_unpackhi_epi8(lo, lo)));
+}
+
+// 32 -> 8
+template<> Vc_INTRINSIC Vc_CONST __m256 mask_cast<32, 8, __m256>(__m256i k)
+{
+    // abcd efgh ... -> aaaa bbbb cccc dddd eeee ffff gggg hhhh
+    const auto lo = AVX::lo128(k);
+    const auto tmp = _mm_unpacklo_epi8(lo, lo);
+    return _mm256_castsi256_ps(AVX::concat(_mm_unpacklo_epi16(tmp, tmp), _mm_unpackhi_epi16(tmp, tmp)));
+}
+
+// 32 -> 4
+template<> Vc_INTRINSIC Vc_CONST __m256 mask_cast<32, 4, __m256>(__m256i k)
+{
+    return mask_cast<16, 4, __m256>(_mm256_castps_si256(mask_cast<32, 16, __m256>(k)));
+}
+
+// 16 -> 32
+template<> Vc_INTRINSIC Vc_CONST __m256 mask_cast<16, 32, __m256>(__m256i k)
+{
+    // aabb ccdd eeff gghh iijj kkll mmnn oopp -> abcd efgh ijkl mnop 0000 0000 0000 0000
+    return AVX::zeroExtend(_mm_castsi128_ps(_mm_packs_epi16(AVX::lo128(k), AVX::hi128(k))));
+}
+
+// 8 -> 32
+template<> Vc_INTRINSIC Vc_CONST __m256 mask_cast<8, 32, __m256>(__m256i k)
+{
+    return mask_cast<16, 32, __m256>(_mm256_castps_si256(mask_cast<8, 16, __m256>(k)));
+}
+
+// 4 -> 32
+template<> Vc_INTRINSIC Vc_CONST __m256 mask_cast<4, 32, __m256>(__m256i k)
+{
+    return mask_cast<16, 32, __m256>(_mm256_castps_si256(mask_cast<4, 16, __m256>(k)));
+}
+
 // allone{{{1
 template<> Vc_INTRINSIC Vc_CONST __m256  allone<__m256 >() { return AVX::setallone_ps(); }
 template<> Vc_INTRINSIC Vc_CONST __m256i allone<__m256i>() { return AVX::setallone_si256(); }
@@ -602,6 +649,10 @@ Vc_INTRINSIC Vc_CONST __m256i one( short) { return AVX::setone_epi16(); }
 Vc_INTRINSIC Vc_CONST __m256i one(ushort) { return AVX::setone_epu16(); }
 Vc_INTRINSIC Vc_CONST __m256i one( schar) { return AVX::setone_epi8 (); }
 Vc_INTRINSIC Vc_CONST __m256i one( uchar) { return AVX::setone_epu8 (); }
+#ifdef Vc_IMPL_AVX2
+template <typename T>
+Vc_INTRINSIC Vc_CONST enable_if<is_int64<T>::value, __m256i> one(T) { return _mm256_set1_epi64x(1); }
+#endif
 
 // negate{{{1
 Vc_ALWAYS_INLINE Vc_CONST __m256 negate(__m256 v, std::integral_constant<std::size_t, 4>)
@@ -612,6 +663,12 @@ Vc_ALWAYS_INLINE Vc_CONST __m256d negate(__m256d v, std::integral_constant<std::
 {
     return _mm256_xor_pd(v, AVX::setsignmask_pd());
 }
+#ifdef Vc_IMPL_AVX2
+Vc_ALWAYS_INLINE Vc_CONST __m256i negate(__m256i v, std::integral_constant<std::size_t, 8>)
+{
+    return _mm256_sub_epi64(_mm256_setzero_si256(), v);
+}
+#endif
 Vc_ALWAYS_INLINE Vc_CONST __m256i negate(__m256i v, std::integral_constant<std::size_t, 4>)
 {
     return AVX::sign_epi32(v, Detail::allone<__m256i>());
@@ -620,6 +677,10 @@ Vc_ALWAYS_INLINE Vc_CONST __m256i negate(__m256i v, std::integral_constant<std::
 {
     return AVX::sign_epi16(v, Detail::allone<__m256i>());
 }
+Vc_ALWAYS_INLINE Vc_CONST __m256i negate(__m256i v, std::integral_constant<std::size_t, 1>)
+{
+    return AVX::sign_epi8(v, Detail::allone<__m256i>());
+}
 
 // xor_{{{1
 Vc_INTRINSIC __m256 xor_(__m256 a, __m256 b) { return _mm256_xor_ps(a, b); }
@@ -691,6 +752,14 @@ Vc_INTRINSIC __m256i abs(__m256i a,  short) { return AVX::abs_epi16(a); }
 Vc_INTRINSIC __m256i abs(__m256i a, ushort) { return a; }
 Vc_INTRINSIC __m256i abs(__m256i a,  schar) { return AVX::abs_epi8 (a); }
 Vc_INTRINSIC __m256i abs(__m256i a,  uchar) { return a; }
+#ifdef Vc_IMPL_AVX2
+template <typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, __m256i> abs(__m256i a, T)
+{
+    return std::is_signed<T>::value ? AVX::max_epi64(a, _mm256_sub_epi64(_mm256_setzero_si256(), a))
+                                    : a;
+}
+#endif
 
 // add{{{1
 Vc_INTRINSIC __m256  add(__m256  a, __m256  b,  float) { return _mm256_add_ps(a, b); }
@@ -699,6 +768,12 @@ Vc_INTRINSIC __m256i add(__m256i a, __m256i b,    int) { return AVX::add_epi32(a
 Vc_INTRINSIC __m256i add(__m256i a, __m256i b,   uint) { return AVX::add_epi32(a, b); }
 Vc_INTRINSIC __m256i add(__m256i a, __m256i b,  short) { return AVX::add_epi16(a, b); }
 Vc_INTRINSIC __m256i add(__m256i a, __m256i b, ushort) { return AVX::add_epi16(a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b,  schar) { return AVX::add_epi8 (a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b,  uchar) { return AVX::add_epi8 (a, b); }
+#ifdef Vc_IMPL_AVX2
+template <typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, __m256i> add(__m256i a, __m256i b, T) { return _mm256_add_epi64(a, b); }
+#endif
 
 // sub{{{1
 Vc_INTRINSIC __m256  sub(__m256  a, __m256  b,  float) { return _mm256_sub_ps(a, b); }
@@ -707,6 +782,12 @@ Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,    int) { return AVX::sub_epi32(a
 Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,   uint) { return AVX::sub_epi32(a, b); }
 Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,  short) { return AVX::sub_epi16(a, b); }
 Vc_INTRINSIC __m256i sub(__m256i a, __m256i b, ushort) { return AVX::sub_epi16(a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,  schar) { return AVX::sub_epi8 (a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,  uchar) { return AVX::sub_epi8 (a, b); }
+#ifdef Vc_IMPL_AVX2
+template <typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, __m256i> sub(__m256i a, __m256i b, T) { return _mm256_sub_epi64(a, b); }
+#endif
 
 // mul{{{1
 Vc_INTRINSIC __m256  mul(__m256  a, __m256  b,  float) { return _mm256_mul_ps(a, b); }
@@ -715,6 +796,35 @@ Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,    int) { return AVX::mullo_epi32
 Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,   uint) { return AVX::mullo_epi32(a, b); }
 Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  short) { return AVX::mullo_epi16(a, b); }
 Vc_INTRINSIC __m256i mul(__m256i a, __m256i b, ushort) { return AVX::mullo_epi16(a, b); }
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  schar) {
+    // there is no 8-bit multiplication: multiply the even and odd bytes as 16-bit words
+    using namespace AVX;
+    const __m256i even = and_(mullo_epi16(a, b), srli_epi16<8>(allone<__m256i>()));
+    const __m256i odd = mullo_epi16(srli_epi16<8>(a), srli_epi16<8>(b));
+    return or_(even, slli_epi16<8>(odd));
+}
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  uchar) { return mul(a, b, schar()); }
+#ifdef Vc_IMPL_AVX2
+template <typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, __m256i> mul(__m256i a, __m256i b, T) { return AVX::mullo_epi64(a, b); }
+#endif
+
+// mulhi{{{1
+#ifdef Vc_IMPL_AVX2
+// the high half of the double-width products (for Vc::divider)
+Vc_INTRINSIC __m256i mulhi(__m256i a, __m256i b,    int) {
+    const __m256i ab02 = _mm256_srli_epi64(_mm256_mul_epi32(a, b), 32);
+    const __m256i ab13 = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    return _mm256_blend_epi32(ab02, ab13, 0xaa);
+}
+Vc_INTRINSIC __m256i mulhi(__m256i a, __m256i b,   uint) {
+    const __m256i ab02 = _mm256_srli_epi64(_mm256_mul_epu32(a, b), 32);
+    const __m256i ab13 = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    return _mm256_blend_epi32(ab02, ab13, 0xaa);
+}
+Vc_INTRINSIC __m256i mulhi(__m256i a, __m256i b,  short) { return _mm256_mulhi_epi16(a, b); }
+Vc_INTRINSIC __m256i mulhi(__m256i a, __m256i b, ushort) { return _mm256_mulhi_epu16(a, b); }
+#endif
 
 // mul{{{1
 Vc_INTRINSIC __m256  div(__m256  a, __m256  b,  float) { return _mm256_div_ps(a, b); }
@@ -756,6 +866,43 @@ Vc_INTRINSIC __m256i div(__m256i a, __m256i b,  short) {
         _mm256_div_ps(convert<short, float>(hi128(a)), convert<short, float>(hi128(b)));
     return concat(convert<float, short>(lo), convert<float, short>(hi));
 }
+template <typename T>
+Vc_INTRINSIC enable_if<sizeof(T) == 1, __m256i> div(__m256i a, __m256i b, T)
+{
+    // divide the four quarters as floats (exact for 8-bit operands)
+    using namespace AVX;
+    using W = typename std::conditional<std::is_signed<T>::value, short, ushort>::type;
+    const auto widen = [](__m128i x) {
+        return std::is_signed<T>::value ? cvtepi8_epi16(x) : cvtepu8_epi16(x);
+    };
+    const __m256i a0 = widen(lo128(a));
+    const __m256i a1 = widen(hi128(a));
+    const __m256i b0 = widen(lo128(b));
+    const __m256i b1 = widen(hi128(b));
+    const __m256 q0 = _mm256_div_ps(convert<W, float>(lo128(a0)), convert<W, float>(lo128(b0)));
+    const __m256 q1 = _mm256_div_ps(convert<W, float>(hi128(a0)), convert<W, float>(hi128(b0)));
+    const __m256 q2 = _mm256_div_ps(convert<W, float>(lo128(a1)), convert<W, float>(lo128(b1)));
+    const __m256 q3 = _mm256_div_ps(convert<W, float>(hi128(a1)), convert<W, float>(hi128(b1)));
+    const __m256i w0 = concat(convert<float, short>(q0), convert<float, short>(q1));
+    const __m256i w1 = concat(convert<float, short>(q2), convert<float, short>(q3));
+    // the quotients fit into 16 bits: drop the high bytes and pack per 128-bit lane
+    const __m256i mask = srli_epi16<8>(allone<__m256i>());
+    return concat(_mm_packus_epi16(lo128(and_(w0, mask)), hi128(and_(w0, mask))),
+                  _mm_packus_epi16(lo128(and_(w1, mask)), hi128(and_(w1, mask))));
+}
+
+#ifdef Vc_IMPL_AVX2
+template <typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, __m256i> div(__m256i a, __m256i b, T)
+{
+    // there is no SIMD division for 64-bit integers
+    alignas(32) T x[4];
+    alignas(32) T y[4];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(x), a);
+    _mm256_store_si256(reinterpret_cast<__m256i *>(y), b);
+    return _mm256_setr_epi64x(x[0] / y[0], x[1] / y[1], x[2] / y[2], x[3] / y[3]);
+}
+#endif
 
 // horizontal add{{{1
 template <typename T> Vc_INTRINSIC T add(Common::IntrinsicType<T, 32 / sizeof(T)> a, T)
@@ -787,6 +934,15 @@ Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,    int) { return AvxIntrinsics:
 Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,   uint) { return AvxIntrinsics::cmpeq_epi32(a, b); }
 Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,  short) { return AvxIntrinsics::cmpeq_epi16(a, b); }
 Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b, ushort) { return AvxIntrinsics::cmpeq_epi16(a, b); }
+Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,  schar) { return AvxIntrinsics::cmpeq_epi8 (a, b); }
+Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,  uchar) { return AvxIntrinsics::cmpeq_epi8 (a, b); }
+#ifdef Vc_IMPL_AVX2
+template <typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, __m256i> cmpeq(__m256i a, __m256i b, T)
+{
+    return _mm256_cmpeq_epi64(a, b);
+}
+#endif
 
 // cmpneq{{{1
 Vc_INTRINSIC __m256  cmpneq(__m256  a, __m256  b,  float) { return AvxIntrinsics::cmpneq_ps(a, b); }
@@ -797,6 +953,13 @@ Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b,  short) { return not_(AvxIntri
 Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b, ushort) { return not_(AvxIntrinsics::cmpeq_epi16(a, b)); }
 Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b,  schar) { return not_(AvxIntrinsics::cmpeq_epi8 (a, b)); }
 Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b,  uchar) { return not_(AvxIntrinsics::cmpeq_epi8 (a, b)); }
+#ifdef Vc_IMPL_AVX2
+template <typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, __m256i> cmpneq(__m256i a, __m256i b, T)
+{
+    return not_(_mm256_cmpeq_epi64(a, b));
+}
+#endif
 
 // cmpgt{{{1
 Vc_INTRINSIC __m256  cmpgt(__m256  a, __m256  b,  float) { return AVX::cmpgt_ps(a, b); }
@@ -807,6 +970,13 @@ Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b,  short) { return AVX::cmpgt_epi
 Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b, ushort) { return AVX::cmpgt_epu16(a, b); }
 Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b,  schar) { return AVX::cmpgt_epi8 (a, b); }
 Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b,  uchar) { return AVX::cmpgt_epu8 (a, b); }
+#ifdef Vc_IMPL_AVX2
+template <typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, __m256i> cmpgt(__m256i a, __m256i b, T)
+{
+    return std::is_signed<T>::value ? _mm256_cmpgt_epi64(a, b) : AVX::cmpgt_epu64(a, b);
+}
+#endif
 
 // cmpge{{{1
 Vc_INTRINSIC __m256  cmpge(__m256  a, __m256  b,  float) { return AVX::cmpge_ps(a, b); }
@@ -817,6 +987,13 @@ Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b,  short) { return not_(AVX::cmpg
 Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b, ushort) { return not_(AVX::cmpgt_epu16(b, a)); }
 Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b,  schar) { return not_(AVX::cmpgt_epi8 (b, a)); }
 Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b,  uchar) { return not_(AVX::cmpgt_epu8 (b, a)); }
+#ifdef Vc_IMPL_AVX2
+template <typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, __m256i> cmpge(__m256i a, __m256i b, T)
+{
+    return not_(cmpgt(b, a, T()));
+}
+#endif
 
 // cmple{{{1
 Vc_INTRINSIC __m256  cmple(__m256  a, __m256  b,  float) { return AVX::cmple_ps(a, b); }
@@ -827,6 +1004,13 @@ Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b,  short) { return not_(AVX::cmpg
 Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b, ushort) { return not_(AVX::cmpgt_epu16(a, b)); }
 Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b,  schar) { return not_(AVX::cmpgt_epi8 (a, b)); }
 Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b,  uchar) { return not_(AVX::cmpgt_epu8 (a, b)); }
+#ifdef Vc_IMPL_AVX2
+template <typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, __m256i> cmple(__m256i a, __m256i b, T)
+{
+    return not_(cmpgt(a, b, T()));
+}
+#endif
 
 // cmplt{{{1
 Vc_INTRINSIC __m256  cmplt(__m256  a, __m256  b,  float) { return AVX::cmplt_ps(a, b); }
@@ -837,6 +1021,13 @@ Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b,  short) { return AVX::cmpgt_epi
 Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b, ushort) { return AVX::cmpgt_epu16(b, a); }
 Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b,  schar) { return AVX::cmpgt_epi8 (b, a); }
 Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b,  uchar) { return AVX::cmpgt_epu8 (b, a); }
+#ifdef Vc_IMPL_AVX2
+template <typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, __m256i> cmplt(__m256i a, __m256i b, T)
+{
+    return cmpgt(b, a, T());
+}
+#endif
 
 // fma{{{1
 Vc_INTRINSIC __m256 fma(__m256  a, __m256  b, __m256  c,  float) {
@@ -890,30 +1081,85 @@ template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,    int) { return
 template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,   uint) { return AVX::srli_epi32<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  short) { return AVX::srai_epi16<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a, ushort) { return AVX::srli_epi16<shift>(a); }
-//template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  schar) { return AVX::srai_epi8 <shift>(a); }
-//template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  uchar) { return AVX::srli_epi8 <shift>(a); }
+// there are no 8-bit shifts: shift 16-bit words and fix up the bits that crossed bytes
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  schar)
+{
+    using namespace AVX;
+    return or_(and_(srai_epi16<shift>(a), _mm256_set1_epi16(short(0xff00))),
+               srli_epi16<8>(srai_epi16<shift>(slli_epi16<8>(a))));
+}
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  uchar)
+{
+    return and_(AVX::srli_epi16<shift>(a), _mm256_set1_epi8(char(0xff >> shift)));
+}
+#ifdef Vc_IMPL_AVX2
+template <int shift, typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, __m256i> shiftRight(__m256i a, T)
+{
+    return std::is_signed<T>::value ? AVX::sra_epi64(a, shift) : _mm256_srli_epi64(a, shift);
+}
+#endif
 
 Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,    int) { return AVX::sra_epi32(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,   uint) { return AVX::srl_epi32(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  short) { return AVX::sra_epi16(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift, ushort) { return AVX::srl_epi16(a, _mm_cvtsi32_si128(shift)); }
-//Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  schar) { return AVX::sra_epi8 (a, _mm_cvtsi32_si128(shift)); }
-//Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  uchar) { return AVX::srl_epi8 (a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  schar)
+{
+    using namespace AVX;
+    const __m128i s = _mm_cvtsi32_si128(shift);
+    return or_(and_(sra_epi16(a, s), _mm256_set1_epi16(short(0xff00))),
+               srli_epi16<8>(sra_epi16(slli_epi16<8>(a), s)));
+}
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  uchar)
+{
+    return and_(AVX::srl_epi16(a, _mm_cvtsi32_si128(shift)),
+                _mm256_set1_epi8(char(0xff >> shift)));
+}
+#ifdef Vc_IMPL_AVX2
+template <typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, __m256i> shiftRight(__m256i a, int shift, T)
+{
+    return std::is_signed<T>::value ? AVX::sra_epi64(a, shift)
+                                    : _mm256_srl_epi64(a, _mm_cvtsi32_si128(shift));
+}
+#endif
 
 // shiftLeft{{{1
 template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,    int) { return AVX::slli_epi32<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,   uint) { return AVX::slli_epi32<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  short) { return AVX::slli_epi16<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a, ushort) { return AVX::slli_epi16<shift>(a); }
-//template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  schar) { return AVX::slli_epi8 <shift>(a); }
-//template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  uchar) { return AVX::slli_epi8 <shift>(a); }
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  schar)
+{
+    return and_(AVX::slli_epi16<shift>(a), _mm256_set1_epi8(char(0xff << shift)));
+}
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  uchar) { return shiftLeft<shift>(a, schar()); }
+#ifdef Vc_IMPL_AVX2
+template <int shift, typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, __m256i> shiftLeft(__m256i a, T)
+{
+    return _mm256_slli_epi64(a, shift);
+}
+#endif
 
 Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,    int) { return AVX::sll_epi32(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,   uint) { return AVX::sll_epi32(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  short) { return AVX::sll_epi16(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift, ushort) { return AVX::sll_epi16(a, _mm_cvtsi32_si128(shift)); }
-//Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  schar) { return AVX::sll_epi8 (a, _mm_cvtsi32_si128(shift)); }
-//Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  uchar) { return AVX::sll_epi8 (a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  schar)
+{
+    return and_(AVX::sll_epi16(a, _mm_cvtsi32_si128(shift)),
+                _mm256_set1_epi8(char(0xff << shift)));
+}
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  uchar) { return shiftLeft(a, shift, schar()); }
+#ifdef Vc_IMPL_AVX2
+template <typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, __m256i> shiftLeft(__m256i a, int shift, T)
+{
+    return _mm256_sll_epi64(a, _mm_cvtsi32_si128(shift));
+}
+#endif
 
 // zeroExtendIfNeeded{{{1
 Vc_INTRINSIC __m256  zeroExtendIfNeeded(__m256  x) { return x; }
@@ -933,10 +1179,14 @@ Vc_INTRINSIC __m256i avx_broadcast(ushort x) { return _mm256_set1_epi16(x); }
 Vc_INTRINSIC __m256i avx_broadcast(  char x) { return _mm256_set1_epi8(x); }
 Vc_INTRINSIC __m256i avx_broadcast( schar x) { return _mm256_set1_epi8(x); }
 Vc_INTRINSIC __m256i avx_broadcast( uchar x) { return _mm256_set1_epi8(x); }
+#ifdef Vc_IMPL_AVX2
+template <typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, __m256i> avx_broadcast(T x) { return _mm256_set1_epi64x(x); }
+#endif
 
 // sorted{{{1
 template <Vc::Implementation Impl, typename T,
-          typename = enable_if<(Impl >= AVXImpl && Impl <= AVX2Impl)>>
+          typename = enable_if<(Impl == AVXImpl || Impl == AVX2Impl || Impl == AVX512Impl)>>
 Vc_CONST_L AVX2::Vector<T> sorted(AVX2::Vector<T> x) Vc_CONST_R;
 template <typename T> Vc_INTRINSIC Vc_CONST AVX2::Vector<T> sorted(AVX2::Vector<T> x)
 {
@@ -1202,8 +1452,8 @@ template <size_t N, typename Flags>
 Vc_INTRINSIC void mask_store(__m256i k, bool *mem, Flags)
 {
     static_assert(
-        N == 4 || N == 8 || N == 16,
-        "mask_store(__m256i, bool *) is only implemented for 4, 8, and 16 entries");
+        N == 4 || N == 8 || N == 16 || N == 32,
+        "mask_store(__m256i, bool *) is only implemented for 4, 8, 16, and 32 entries");
     switch (N) {
     case 4:
         *reinterpret_cast<MayAlias<int32_t> *>(mem) =
@@ -1230,6 +1480,14 @@ Vc_INTRINSIC void mask_store(__m256i k, bool *mem, Flags)
             _mm_storeu_si128(reinterpret_cast<__m128i *>(mem), bools);
         }
     } break;
+    case 32: {
+        const auto bools = Detail::and_(_mm256_set1_epi8(1), k);
+        if (Flags::IsAligned) {
+            _mm256_store_si256(reinterpret_cast<__m256i *>(mem), bools);
+        } else {
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(mem), bools);
+        }
+    } break;
     default:
         Vc_UNREACHABLE();
     }
@@ -1270,8 +1528,8 @@ Vc_INTRINSIC R mask_load(const bool *mem, Flags,
                          enable_if<std::is_same<R, __m256>::value> = nullarg)
 {
     static_assert(
-        N == 4 || N == 8 || N == 16,
-        "mask_load<__m256>(const bool *) is only implemented for 4, 8, and 16 entries");
+        N == 4 || N == 8 || N == 16 || N == 32,
+        "mask_load<__m256>(const bool *) is only implemented for 4, 8, 16, and 32 entries");
     switch (N) {
     case 4: {
         __m128i k = AVX::avx_cast<__m128i>(_mm_and_ps(
@@ -1300,6 +1558,13 @@ Vc_INTRINSIC R mask_load(const bool *mem, Flags,
         return AVX::avx_cast<__m256>(
             AVX::concat(_mm_unpacklo_epi8(k128, k128), _mm_unpackhi_epi8(k128, k128)));
     }
+#ifdef Vc_IMPL_AVX2
+    case 32:
+        return AVX::avx_cast<__m256>(_mm256_cmpgt_epi8(
+            Flags::IsAligned ? _mm256_load_si256(reinterpret_cast<const __m256i *>(mem))
+                             : _mm256_loadu_si256(reinterpret_cast<const __m256i *>(mem)),
+            _mm256_setzero_si256()));
+#endif
     default:
         Vc_UNREACHABLE();
     }
@@ -550,6 +550,57 @@ static Vc_INTRINSIC m256i cmpgt_epu8(__m256i a, __m256i b) {
     }
 #endif
 
+#ifdef Vc_IMPL_AVX2
+// 64-bit integers: AVX2 has neither min/max nor a multiplication or an arithmetic right
+// shift for 64-bit lanes (AVX-512VL adds the latter two)
+static Vc_INTRINSIC m256i Vc_CONST cmpgt_epu64(__m256i a, __m256i b) {
+    const m256i min = _mm256_set1_epi64x(0x8000000000000000ll);
+    return _mm256_cmpgt_epi64(_mm256_xor_si256(a, min), _mm256_xor_si256(b, min));
+}
+static Vc_INTRINSIC m256i Vc_CONST min_epi64(__m256i a, __m256i b) {
+    return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b));
+}
+static Vc_INTRINSIC m256i Vc_CONST max_epi64(__m256i a, __m256i b) {
+    return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b));
+}
+static Vc_INTRINSIC m256i Vc_CONST min_epu64(__m256i a, __m256i b) {
+    return _mm256_blendv_epi8(a, b, cmpgt_epu64(a, b));
+}
+static Vc_INTRINSIC m256i Vc_CONST max_epu64(__m256i a, __m256i b) {
+    return _mm256_blendv_epi8(b, a, cmpgt_epu64(a, b));
+}
+static Vc_INTRINSIC m256i Vc_CONST mullo_epi64(__m256i a, __m256i b) {
+#ifdef Vc_IMPL_AVX512
+    return _mm256_mullo_epi64(a, b);
+#else
+    // a * b mod 2^64 = lo(a) * lo(b) + ((hi(a) * lo(b) + lo(a) * hi(b)) << 32)
+    const m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b),
+                                         _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
+    return _mm256_add_epi64(_mm256_mul_epu32(a, b), _mm256_slli_epi64(cross, 32));
+#endif
+}
+static Vc_INTRINSIC m256i Vc_CONST sra_epi64(__m256i a, int shift) {
+#ifdef Vc_IMPL_AVX512
+    return _mm256_sra_epi64(a, _mm_cvtsi32_si128(shift));
+#else
+    // shift logically and fill the vacated bits with the sign; the count of 64 for
+    // shift == 0 makes _mm256_sll_epi64 return zero
+    const m256i sign = _mm256_srai_epi32(_mm256_shuffle_epi32(a, 0xf5), 31);
+    return _mm256_or_si256(_mm256_srl_epi64(a, _mm_cvtsi32_si128(shift)),
+                           _mm256_sll_epi64(sign, _mm_cvtsi32_si128(64 - shift)));
+#endif
+}
+static Vc_INTRINSIC m256i Vc_CONST srav_epi64(__m256i a, __m256i shift) {
+#ifdef Vc_IMPL_AVX512
+    return _mm256_srav_epi64(a, shift);
+#else
+    // flip negative lanes, shift logically, and flip back
+    const m256i sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), a);
+    return _mm256_xor_si256(_mm256_srlv_epi64(_mm256_xor_si256(a, sign), shift), sign);
+#endif
+}
+#endif  // Vc_IMPL_AVX2
+
 static Vc_INTRINSIC void _mm256_maskstore(float *mem, const __m256 mask, const __m256 v) {
     _mm256_maskstore_ps(mem, _mm256_castps_si256(mask), v);
 }
@@ -40,10 +40,28 @@ Vc_ALWAYS_INLINE AVX2::int_v    min(const AVX2::int_v    &x, const AVX2::int_v
 Vc_ALWAYS_INLINE AVX2::uint_v   min(const AVX2::uint_v   &x, const AVX2::uint_v   &y) { return _mm256_min_epu32(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::short_v  min(const AVX2::short_v  &x, const AVX2::short_v  &y) { return _mm256_min_epi16(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::ushort_v min(const AVX2::ushort_v &x, const AVX2::ushort_v &y) { return _mm256_min_epu16(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::schar_v  min(const AVX2::schar_v  &x, const AVX2::schar_v  &y) { return _mm256_min_epi8 (x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::uchar_v  min(const AVX2::uchar_v  &x, const AVX2::uchar_v  &y) { return _mm256_min_epu8 (x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::int_v    max(const AVX2::int_v    &x, const AVX2::int_v    &y) { return _mm256_max_epi32(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::uint_v   max(const AVX2::uint_v   &x, const AVX2::uint_v   &y) { return _mm256_max_epu32(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::short_v  max(const AVX2::short_v  &x, const AVX2::short_v  &y) { return _mm256_max_epi16(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::ushort_v max(const AVX2::ushort_v &x, const AVX2::ushort_v &y) { return _mm256_max_epu16(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::schar_v  max(const AVX2::schar_v  &x, const AVX2::schar_v  &y) { return _mm256_max_epi8 (x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::uchar_v  max(const AVX2::uchar_v  &x, const AVX2::uchar_v  &y) { return _mm256_max_epu8 (x.data(), y.data()); }
+template <typename T>
+Vc_ALWAYS_INLINE enable_if<Detail::is_int64<T>::value, AVX2::Vector<T>> min(
+    const AVX2::Vector<T> &x, const AVX2::Vector<T> &y)
+{
+    return std::is_signed<T>::value ? AVX::min_epi64(x.data(), y.data())
+                                    : AVX::min_epu64(x.data(), y.data());
+}
+template <typename T>
+Vc_ALWAYS_INLINE enable_if<Detail::is_int64<T>::value, AVX2::Vector<T>> max(
+    const AVX2::Vector<T> &x, const AVX2::Vector<T> &y)
+{
+    return std::is_signed<T>::value ? AVX::max_epi64(x.data(), y.data())
+                                    : AVX::max_epu64(x.data(), y.data());
+}
 #endif
 Vc_ALWAYS_INLINE AVX2::float_v  min(const AVX2::float_v  &x, const AVX2::float_v  &y) { return _mm256_min_ps(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::double_v min(const AVX2::double_v &x, const AVX2::double_v &y) { return _mm256_min_pd(x.data(), y.data()); }
@@ -96,6 +114,10 @@ Vc_INTRINSIC Vc_CONST AVX2::short_v abs(AVX2::short_v x)
 {
     return _mm256_abs_epi16(x.data());
 }
+Vc_INTRINSIC Vc_CONST AVX2::schar_v abs(AVX2::schar_v x)
+{
+    return _mm256_abs_epi8(x.data());
+}
 #endif
 
 // isfinite {{{1
@@ -169,7 +191,7 @@ inline AVX2::double_v frexp(AVX2::double_v::AsArg v, SimdArray<int, 4, SSE::int_
     AVX2::double_v ret =
         _mm256_and_pd(exponentMaximized,
                       _mm256_broadcast_sd(reinterpret_cast<const double *>(&AVX::c_general::frexpMask)));
-    const double_m zeroMask = v == AVX2::double_v::Zero();
+    const AVX2::double_m zeroMask = v == AVX2::double_v::Zero();
     ret(isnan(v) || !isfinite(v) || zeroMask) = v;
     exponent.setZero(simd_cast<SSE::int_m>(zeroMask));
     internal_data(*e) = exponent;
@@ -218,7 +240,7 @@ namespace Detail
 {
 Vc_INTRINSIC AVX2::float_v::IndexType extractExponent(__m256 e)
 {
-    SimdArray<uint, float_v::Size> exponentPart;
+    SimdArray<uint, AVX2::float_v::Size> exponentPart;
     const auto ee = AVX::avx_cast<__m256i>(e);
 #ifdef Vc_IMPL_AVX2
     exponentPart = AVX2::uint_v(ee);
@@ -393,6 +393,265 @@ Vc_SIMD_CAST_1(AVX2::ushort_v, SSE::ushort_v);
 Vc_SIMD_CAST_2(AVX2::double_v, SSE:: short_v);
 Vc_SIMD_CAST_2(AVX2::double_v, SSE::ushort_v);
 
+// 8-bit integer Vectors {{{2
+// AVX2::schar_v/uchar_v only exist with AVX2; AVX uses the SSE types for all integers
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2::double_v);
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2:: float_v);
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2::double_v);
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2:: float_v);
+Vc_SIMD_CAST_1(AVX2::double_v, SSE:: schar_v);
+Vc_SIMD_CAST_1(AVX2:: float_v, SSE:: schar_v);
+Vc_SIMD_CAST_2(AVX2::double_v, SSE:: schar_v);
+Vc_SIMD_CAST_2(AVX2:: float_v, SSE:: schar_v);
+Vc_SIMD_CAST_3(AVX2::double_v, SSE:: schar_v);
+Vc_SIMD_CAST_4(AVX2::double_v, SSE:: schar_v);
+Vc_SIMD_CAST_1(AVX2::double_v, SSE:: uchar_v);
+Vc_SIMD_CAST_1(AVX2:: float_v, SSE:: uchar_v);
+Vc_SIMD_CAST_2(AVX2::double_v, SSE:: uchar_v);
+Vc_SIMD_CAST_2(AVX2:: float_v, SSE:: uchar_v);
+Vc_SIMD_CAST_3(AVX2::double_v, SSE:: uchar_v);
+Vc_SIMD_CAST_4(AVX2::double_v, SSE:: uchar_v);
+
+#ifdef Vc_IMPL_AVX2
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2::   int_v);
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2::  uint_v);
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2:: short_v);
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2::ushort_v);
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2::   int_v);
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2::  uint_v);
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2:: short_v);
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2::ushort_v);
+Vc_SIMD_CAST_1(AVX2::   int_v, SSE:: schar_v);
+Vc_SIMD_CAST_1(AVX2::  uint_v, SSE:: schar_v);
+Vc_SIMD_CAST_1(AVX2:: short_v, SSE:: schar_v);
+Vc_SIMD_CAST_1(AVX2::ushort_v, SSE:: schar_v);
+Vc_SIMD_CAST_2(AVX2::   int_v, SSE:: schar_v);
+Vc_SIMD_CAST_2(AVX2::  uint_v, SSE:: schar_v);
+Vc_SIMD_CAST_1(AVX2::   int_v, SSE:: uchar_v);
+Vc_SIMD_CAST_1(AVX2::  uint_v, SSE:: uchar_v);
+Vc_SIMD_CAST_1(AVX2:: short_v, SSE:: uchar_v);
+Vc_SIMD_CAST_1(AVX2::ushort_v, SSE:: uchar_v);
+Vc_SIMD_CAST_2(AVX2::   int_v, SSE:: uchar_v);
+Vc_SIMD_CAST_2(AVX2::  uint_v, SSE:: uchar_v);
+
+Vc_SIMD_CAST_AVX_1(schar_v, double_v);
+Vc_SIMD_CAST_AVX_1(schar_v,  float_v);
+Vc_SIMD_CAST_AVX_1(schar_v,    int_v);
+Vc_SIMD_CAST_AVX_1(schar_v,   uint_v);
+Vc_SIMD_CAST_AVX_1(schar_v,  short_v);
+Vc_SIMD_CAST_AVX_1(schar_v, ushort_v);
+Vc_SIMD_CAST_AVX_1(uchar_v, double_v);
+Vc_SIMD_CAST_AVX_1(uchar_v,  float_v);
+Vc_SIMD_CAST_AVX_1(uchar_v,    int_v);
+Vc_SIMD_CAST_AVX_1(uchar_v,   uint_v);
+Vc_SIMD_CAST_AVX_1(uchar_v,  short_v);
+Vc_SIMD_CAST_AVX_1(uchar_v, ushort_v);
+Vc_SIMD_CAST_AVX_1(schar_v, uchar_v);
+Vc_SIMD_CAST_AVX_1(uchar_v, schar_v);
+Vc_SIMD_CAST_AVX_1(double_v, schar_v);
+Vc_SIMD_CAST_AVX_1( float_v, schar_v);
+Vc_SIMD_CAST_AVX_1(   int_v, schar_v);
+Vc_SIMD_CAST_AVX_1(  uint_v, schar_v);
+Vc_SIMD_CAST_AVX_1( short_v, schar_v);
+Vc_SIMD_CAST_AVX_1(ushort_v, schar_v);
+Vc_SIMD_CAST_AVX_2(double_v, schar_v);
+Vc_SIMD_CAST_AVX_2( float_v, schar_v);
+Vc_SIMD_CAST_AVX_2(   int_v, schar_v);
+Vc_SIMD_CAST_AVX_2(  uint_v, schar_v);
+Vc_SIMD_CAST_AVX_2( short_v, schar_v);
+Vc_SIMD_CAST_AVX_2(ushort_v, schar_v);
+Vc_SIMD_CAST_AVX_3(double_v, schar_v);
+Vc_SIMD_CAST_AVX_3( float_v, schar_v);
+Vc_SIMD_CAST_AVX_3(   int_v, schar_v);
+Vc_SIMD_CAST_AVX_3(  uint_v, schar_v);
+Vc_SIMD_CAST_AVX_4(double_v, schar_v);
+Vc_SIMD_CAST_AVX_4( float_v, schar_v);
+Vc_SIMD_CAST_AVX_4(   int_v, schar_v);
+Vc_SIMD_CAST_AVX_4(  uint_v, schar_v);
+Vc_SIMD_CAST_5(AVX2::double_v, AVX2::schar_v);
+Vc_SIMD_CAST_6(AVX2::double_v, AVX2::schar_v);
+Vc_SIMD_CAST_7(AVX2::double_v, AVX2::schar_v);
+Vc_SIMD_CAST_8(AVX2::double_v, AVX2::schar_v);
+Vc_SIMD_CAST_AVX_1(double_v, uchar_v);
+Vc_SIMD_CAST_AVX_1( float_v, uchar_v);
+Vc_SIMD_CAST_AVX_1(   int_v, uchar_v);
+Vc_SIMD_CAST_AVX_1(  uint_v, uchar_v);
+Vc_SIMD_CAST_AVX_1( short_v, uchar_v);
+Vc_SIMD_CAST_AVX_1(ushort_v, uchar_v);
+Vc_SIMD_CAST_AVX_2(double_v, uchar_v);
+Vc_SIMD_CAST_AVX_2( float_v, uchar_v);
+Vc_SIMD_CAST_AVX_2(   int_v, uchar_v);
+Vc_SIMD_CAST_AVX_2(  uint_v, uchar_v);
+Vc_SIMD_CAST_AVX_2( short_v, uchar_v);
+Vc_SIMD_CAST_AVX_2(ushort_v, uchar_v);
+Vc_SIMD_CAST_AVX_3(double_v, uchar_v);
+Vc_SIMD_CAST_AVX_3( float_v, uchar_v);
+Vc_SIMD_CAST_AVX_3(   int_v, uchar_v);
+Vc_SIMD_CAST_AVX_3(  uint_v, uchar_v);
+Vc_SIMD_CAST_AVX_4(double_v, uchar_v);
+Vc_SIMD_CAST_AVX_4( float_v, uchar_v);
+Vc_SIMD_CAST_AVX_4(   int_v, uchar_v);
+Vc_SIMD_CAST_AVX_4(  uint_v, uchar_v);
+Vc_SIMD_CAST_5(AVX2::double_v, AVX2::uchar_v);
+Vc_SIMD_CAST_6(AVX2::double_v, AVX2::uchar_v);
+Vc_SIMD_CAST_7(AVX2::double_v, AVX2::uchar_v);
+Vc_SIMD_CAST_8(AVX2::double_v, AVX2::uchar_v);
+
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2::schar_v);
+Vc_SIMD_CAST_2(SSE:: schar_v, AVX2::schar_v);
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2::uchar_v);
+Vc_SIMD_CAST_2(SSE:: schar_v, AVX2::uchar_v);
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2::schar_v);
+Vc_SIMD_CAST_2(SSE:: uchar_v, AVX2::schar_v);
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2::uchar_v);
+Vc_SIMD_CAST_2(SSE:: uchar_v, AVX2::uchar_v);
+Vc_SIMD_CAST_1(AVX2::schar_v, SSE::double_v);
+Vc_SIMD_CAST_1(AVX2::schar_v, SSE:: float_v);
+Vc_SIMD_CAST_1(AVX2::schar_v, SSE::   int_v);
+Vc_SIMD_CAST_1(AVX2::schar_v, SSE::  uint_v);
+Vc_SIMD_CAST_1(AVX2::schar_v, SSE:: short_v);
+Vc_SIMD_CAST_1(AVX2::schar_v, SSE::ushort_v);
+Vc_SIMD_CAST_1(AVX2::schar_v, SSE:: schar_v);
+Vc_SIMD_CAST_1(AVX2::schar_v, SSE:: uchar_v);
+Vc_SIMD_CAST_1(AVX2::uchar_v, SSE::double_v);
+Vc_SIMD_CAST_1(AVX2::uchar_v, SSE:: float_v);
+Vc_SIMD_CAST_1(AVX2::uchar_v, SSE::   int_v);
+Vc_SIMD_CAST_1(AVX2::uchar_v, SSE::  uint_v);
+Vc_SIMD_CAST_1(AVX2::uchar_v, SSE:: short_v);
+Vc_SIMD_CAST_1(AVX2::uchar_v, SSE::ushort_v);
+Vc_SIMD_CAST_1(AVX2::uchar_v, SSE:: schar_v);
+Vc_SIMD_CAST_1(AVX2::uchar_v, SSE:: uchar_v);
+#endif
+
+// 64-bit integer Vectors {{{2
+// AVX2::Vector<T> with 64-bit T only exists with AVX2; with AVX the 64-bit integer Vectors
+// are SSE::Vector<T> and only need casts from and to the AVX floating-point Vectors. The
+// casts are shared between long, long long, and their unsigned variants and mostly use
+// the SSE casts of the 128-bit halves.
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(SSE::Vector<T> x,
+          enable_if<Detail::is_int64<T>::value && AVX2::is_vector<To>::value &&
+                    !Detail::is_int64<typename To::EntryType>::value> = nullarg);
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(SSE::Vector<T> x0, SSE::Vector<T> x1,
+          enable_if<Detail::is_int64<T>::value && AVX2::is_vector<To>::value &&
+                    !Detail::is_int64<typename To::EntryType>::value> = nullarg);
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(SSE::Vector<T> x0, SSE::Vector<T> x1, SSE::Vector<T> x2,
+          enable_if<Detail::is_int64<T>::value && AVX2::is_vector<To>::value &&
+                    !Detail::is_int64<typename To::EntryType>::value &&
+                    (To::Size >= 8)> = nullarg);
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(SSE::Vector<T> x0, SSE::Vector<T> x1, SSE::Vector<T> x2, SSE::Vector<T> x3,
+          enable_if<Detail::is_int64<T>::value && AVX2::is_vector<To>::value &&
+                    !Detail::is_int64<typename To::EntryType>::value &&
+                    (To::Size >= 8)> = nullarg);
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(AVX2::Vector<T> x,
+          enable_if<!Detail::is_int64<T>::value && SSE::is_vector<To>::value &&
+                    Detail::is_int64<typename To::EntryType>::value> = nullarg);
+
+#ifdef Vc_IMPL_AVX2
+namespace AVX2
+{
+template <typename T> struct is_int64_vector : public std::false_type {};
+template <typename T>
+struct is_int64_vector<Vc::Vector<T, VectorAbi::Avx>> : public Detail::is_int64<T> {};
+}  // namespace AVX2
+
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(AVX2::Vector<T> x,
+          enable_if<AVX2::is_vector<To>::value && !std::is_same<To, AVX2::Vector<T>>::value &&
+                    (AVX2::is_int64_vector<To>::value || Detail::is_int64<T>::value)> =
+              nullarg);
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1,
+          enable_if<Detail::is_int64<T>::value && AVX2::is_vector<To>::value &&
+                    (To::Size >= 8)> = nullarg);
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1, AVX2::Vector<T> x2,
+          enable_if<Detail::is_int64<T>::value && AVX2::is_vector<To>::value &&
+                    (To::Size >= 16)> = nullarg);
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1, AVX2::Vector<T> x2, AVX2::Vector<T> x3,
+          enable_if<Detail::is_int64<T>::value && AVX2::is_vector<To>::value &&
+                    (To::Size >= 16)> = nullarg);
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1, AVX2::Vector<T> x2, AVX2::Vector<T> x3,
+          AVX2::Vector<T> x4,
+          enable_if<Detail::is_int64<T>::value && AVX2::is_vector<To>::value &&
+                    (To::Size >= 32)> = nullarg);
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1, AVX2::Vector<T> x2, AVX2::Vector<T> x3,
+          AVX2::Vector<T> x4, AVX2::Vector<T> x5,
+          enable_if<Detail::is_int64<T>::value && AVX2::is_vector<To>::value &&
+                    (To::Size >= 32)> = nullarg);
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1, AVX2::Vector<T> x2, AVX2::Vector<T> x3,
+          AVX2::Vector<T> x4, AVX2::Vector<T> x5, AVX2::Vector<T> x6,
+          enable_if<Detail::is_int64<T>::value && AVX2::is_vector<To>::value &&
+                    (To::Size >= 32)> = nullarg);
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1, AVX2::Vector<T> x2, AVX2::Vector<T> x3,
+          AVX2::Vector<T> x4, AVX2::Vector<T> x5, AVX2::Vector<T> x6, AVX2::Vector<T> x7,
+          enable_if<Detail::is_int64<T>::value && AVX2::is_vector<To>::value &&
+                    (To::Size >= 32)> = nullarg);
+
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(From x, enable_if<AVX2::is_int64_vector<To>::value && SSE::is_vector<From>::value> =
+                      nullarg);
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(From x0, From x1, enable_if<AVX2::is_int64_vector<To>::value &&
+                                      SSE::is_vector<From>::value && From::Size == 2> =
+                                nullarg);
+
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(AVX2::Vector<T> x,
+          enable_if<Detail::is_int64<T>::value && SSE::is_vector<To>::value> = nullarg);
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1,
+          enable_if<Detail::is_int64<T>::value && SSE::is_vector<To>::value &&
+                    (To::Size >= 8)> = nullarg);
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1, AVX2::Vector<T> x2, AVX2::Vector<T> x3,
+          enable_if<Detail::is_int64<T>::value && SSE::is_vector<To>::value &&
+                    (To::Size >= 16)> = nullarg);
+
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, enable_if<AVX2::is_int64_vector<Return>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
+          enable_if<AVX2::is_int64_vector<Return>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
+          enable_if<AVX2::is_int64_vector<Return>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
+          Scalar::Vector<T> x3, enable_if<AVX2::is_int64_vector<Return>::value> = nullarg);
+#endif
+
 // 1 Scalar::Vector to 1 AVX2::Vector {{{2
 template <typename Return, typename T>
 Vc_INTRINSIC Vc_CONST Return
@@ -795,6 +1054,16 @@ Vc_INTRINSIC Vc_CONST To simd_cast(AVX2::Vector<FromT> x,
                                    enable_if<Scalar::is_vector<To>::value> = nullarg);
 
 // Declarations: Mask casts without offset {{{1
+namespace AVX2
+{
+// Masks with 8-bit or 64-bit entries are converted by the generic simd_cast overloads
+// below instead of one overload per type combination.
+template <typename T, typename U>
+using is_generic_mask_cast =
+    std::integral_constant<bool, (sizeof(T) == 1 || Detail::is_int64<T>::value ||
+                                  sizeof(U) == 1 || Detail::is_int64<U>::value)>;
+}  // namespace AVX2
+
 // 1 AVX2::Mask to 1 AVX2::Mask {{{2
 template <typename Return, typename T>
 Vc_INTRINSIC Vc_CONST Return
@@ -816,12 +1085,38 @@ Vc_SIMD_CAST_AVX_2(   int_m, ushort_m);
 
 Vc_SIMD_CAST_AVX_2(  uint_m,  short_m);
 Vc_SIMD_CAST_AVX_2(  uint_m, ushort_m);
+
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX2::Mask<T> x0, AVX2::Mask<T> x1,
+          enable_if<AVX2::is_mask<Return>::value &&
+                    AVX2::is_generic_mask_cast<T, typename Return::EntryType>::value &&
+                    (AVX2::Mask<T>::Size < 16)> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX2::Mask<T> x0, AVX2::Mask<T> x1,
+          enable_if<AVX2::is_mask<Return>::value &&
+                    AVX2::is_generic_mask_cast<T, typename Return::EntryType>::value &&
+                    AVX2::Mask<T>::Size == 16> = nullarg);
 #endif
 
 // 4 AVX2::Mask to 1 AVX2::Mask {{{2
 #ifdef Vc_IMPL_AVX2
 Vc_SIMD_CAST_AVX_4(double_m,  short_m);
 Vc_SIMD_CAST_AVX_4(double_m, ushort_m);
+
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX2::Mask<T> x0, AVX2::Mask<T> x1, AVX2::Mask<T> x2, AVX2::Mask<T> x3,
+          enable_if<AVX2::is_mask<Return>::value &&
+                    AVX2::is_generic_mask_cast<T, typename Return::EntryType>::value &&
+                    AVX2::Mask<T>::Size == 4> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX2::Mask<T> x0, AVX2::Mask<T> x1, AVX2::Mask<T> x2, AVX2::Mask<T> x3,
+          enable_if<AVX2::is_mask<Return>::value &&
+                    AVX2::is_generic_mask_cast<T, typename Return::EntryType>::value &&
+                    AVX2::Mask<T>::Size == 8> = nullarg);
 #endif
 
 // 1 SSE::Mask to 1 AVX2::Mask {{{2
@@ -904,6 +1199,12 @@ Vc_SIMD_CAST_2(SSE::ushort_m, AVX2:: short_m);
 Vc_SIMD_CAST_2(SSE::ushort_m, AVX2::ushort_m);
 #endif
 
+// masks with 64-bit entries have the same layout as double_m
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(SSE::Mask<T> x0, SSE::Mask<T> x1,
+          enable_if<AVX2::is_mask<Return>::value && Detail::is_int64<T>::value> = nullarg);
+
 // 4 SSE::Mask to 1 AVX2::Mask {{{2
 Vc_SIMD_CAST_4(SSE::double_m, AVX2:: float_m);
 #ifdef Vc_IMPL_AVX2
@@ -918,6 +1219,10 @@ Vc_SIMD_CAST_4(SSE::   int_m, AVX2::ushort_m);
 Vc_SIMD_CAST_4(SSE::  uint_m, AVX2:: short_m);
 Vc_SIMD_CAST_4(SSE::  uint_m, AVX2::ushort_m);
 #endif
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(SSE::Mask<T> x0, SSE::Mask<T> x1, SSE::Mask<T> x2, SSE::Mask<T> x3,
+          enable_if<AVX2::is_mask<Return>::value && Detail::is_int64<T>::value> = nullarg);
 
 // 1 Scalar::Mask to 1 AVX2::Mask {{{2
 template <typename Return, typename T>
@@ -1003,6 +1308,33 @@ Vc_SIMD_CAST_1(AVX2::ushort_m, SSE::ushort_m);
 Vc_SIMD_CAST_2(AVX2::double_m, SSE:: short_m);
 Vc_SIMD_CAST_2(AVX2::double_m, SSE::ushort_m);
 
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX2::Mask<T> x0, AVX2::Mask<T> x1,
+          enable_if<SSE::is_mask<Return>::value &&
+                    AVX2::is_generic_mask_cast<T, typename Return::EntryType>::value &&
+                    AVX2::Mask<T>::Size * 2 <= Return::Size> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX2::Mask<T> x0, AVX2::Mask<T> x1, AVX2::Mask<T> x2, AVX2::Mask<T> x3,
+          enable_if<SSE::is_mask<Return>::value &&
+                    AVX2::is_generic_mask_cast<T, typename Return::EntryType>::value &&
+                    AVX2::Mask<T>::Size * 4 <= Return::Size> = nullarg);
+
+// 1 SSE::Mask to/from 1 AVX2::Mask with 8-bit or 64-bit entries {{{2
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(SSE::Mask<T> k,
+          enable_if<AVX2::is_mask<Return>::value &&
+                    AVX2::is_generic_mask_cast<T, typename Return::EntryType>::value> =
+              nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX2::Mask<T> k,
+          enable_if<SSE::is_mask<Return>::value &&
+                    AVX2::is_generic_mask_cast<T, typename Return::EntryType>::value> =
+              nullarg);
+
 // 1 AVX2::Mask to 1 Scalar::Mask {{{2
 template <typename To, typename FromT>
 Vc_INTRINSIC Vc_CONST To simd_cast(AVX2::Mask<FromT> x,
@@ -1048,6 +1380,11 @@ simd_cast(AVX2::Vector<T> x);
 // SSE to AVX2 {{{2
 Vc_SIMD_CAST_OFFSET(SSE:: short_v, AVX2::double_v, 1);
 Vc_SIMD_CAST_OFFSET(SSE::ushort_v, AVX2::double_v, 1);
+template <typename Return, int offset, typename T>
+Vc_INTRINSIC Vc_CONST enable_if<(offset != 0 && AVX2::is_vector<Return>::value &&
+                                 sizeof(T) == 1),
+                                Return>
+simd_cast(SSE::Vector<T> x);
 
 // Declarations: Mask casts with offset {{{1
 // 1 AVX2::Mask to N AVX2::Mask {{{2
@@ -1078,6 +1415,11 @@ simd_cast(const AVX2::Mask<T> &k,
 // 1 SSE::Mask to N AVX2(2)::Mask {{{2
 Vc_SIMD_CAST_OFFSET(SSE:: short_m, AVX2::double_m, 1);
 Vc_SIMD_CAST_OFFSET(SSE::ushort_m, AVX2::double_m, 1);
+template <typename Return, int offset, typename T>
+Vc_INTRINSIC Vc_CONST enable_if<(offset != 0 && AVX2::is_mask<Return>::value &&
+                                 sizeof(T) == 1),
+                                Return>
+simd_cast(SSE::Mask<T> k);
 
 // AVX2 to SSE (Mask<T>) {{{2
 template <typename Return, int offset, typename T>
@@ -1619,6 +1961,550 @@ Vc_SIMD_CAST_2(AVX2::double_v, SSE::ushort_v) {
     return _mm_packs_epi32(tmp0, tmp1);
 }
 
+// 8-bit integer Vectors {{{2
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2::double_v) { return AVX::convert<schar, double>(x.data()); }
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2:: float_v) { return AVX::convert<schar, float>(x.data()); }
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2::double_v) { return AVX::convert<uchar, double>(x.data()); }
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2:: float_v) { return AVX::convert<uchar, float>(x.data()); }
+Vc_SIMD_CAST_1(AVX2::double_v, SSE:: schar_v) { return AVX::convert<double, schar>(x.data()); }
+Vc_SIMD_CAST_1(AVX2:: float_v, SSE:: schar_v) { return AVX::convert< float, schar>(x.data()); }
+Vc_SIMD_CAST_2(AVX2::double_v, SSE:: schar_v) { return simd_cast<SSE:: schar_v>(SSE::int_v(_mm256_cvttpd_epi32(x0.data())), SSE::int_v(_mm256_cvttpd_epi32(x1.data()))); }
+Vc_SIMD_CAST_2(AVX2:: float_v, SSE:: schar_v)
+{
+    return simd_cast<SSE::schar_v>(SSE::short_v(AVX::convert<float, short>(x0.data())),
+                                  SSE::short_v(AVX::convert<float, short>(x1.data())));
+}
+Vc_SIMD_CAST_3(AVX2::double_v, SSE:: schar_v)
+{
+    return simd_cast<SSE:: schar_v>(SSE::int_v(_mm256_cvttpd_epi32(x0.data())),
+                                  SSE::int_v(_mm256_cvttpd_epi32(x1.data())),
+                                  SSE::int_v(_mm256_cvttpd_epi32(x2.data())));
+}
+Vc_SIMD_CAST_4(AVX2::double_v, SSE:: schar_v)
+{
+    return simd_cast<SSE:: schar_v>(
+        SSE::int_v(_mm256_cvttpd_epi32(x0.data())), SSE::int_v(_mm256_cvttpd_epi32(x1.data())),
+        SSE::int_v(_mm256_cvttpd_epi32(x2.data())), SSE::int_v(_mm256_cvttpd_epi32(x3.data())));
+}
+Vc_SIMD_CAST_1(AVX2::double_v, SSE:: uchar_v) { return AVX::convert<double, uchar>(x.data()); }
+Vc_SIMD_CAST_1(AVX2:: float_v, SSE:: uchar_v) { return AVX::convert< float, uchar>(x.data()); }
+Vc_SIMD_CAST_2(AVX2::double_v, SSE:: uchar_v) { return simd_cast<SSE:: uchar_v>(SSE::int_v(_mm256_cvttpd_epi32(x0.data())), SSE::int_v(_mm256_cvttpd_epi32(x1.data()))); }
+Vc_SIMD_CAST_2(AVX2:: float_v, SSE:: uchar_v)
+{
+    return simd_cast<SSE::uchar_v>(SSE::short_v(AVX::convert<float, short>(x0.data())),
+                                  SSE::short_v(AVX::convert<float, short>(x1.data())));
+}
+Vc_SIMD_CAST_3(AVX2::double_v, SSE:: uchar_v)
+{
+    return simd_cast<SSE:: uchar_v>(SSE::int_v(_mm256_cvttpd_epi32(x0.data())),
+                                  SSE::int_v(_mm256_cvttpd_epi32(x1.data())),
+                                  SSE::int_v(_mm256_cvttpd_epi32(x2.data())));
+}
+Vc_SIMD_CAST_4(AVX2::double_v, SSE:: uchar_v)
+{
+    return simd_cast<SSE:: uchar_v>(
+        SSE::int_v(_mm256_cvttpd_epi32(x0.data())), SSE::int_v(_mm256_cvttpd_epi32(x1.data())),
+        SSE::int_v(_mm256_cvttpd_epi32(x2.data())), SSE::int_v(_mm256_cvttpd_epi32(x3.data())));
+}
+
+#ifdef Vc_IMPL_AVX2
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2::   int_v) { return AVX::convert<schar,    int>(x.data()); }
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2::  uint_v) { return AVX::convert<schar,   uint>(x.data()); }
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2:: short_v) { return AVX::convert<schar,  short>(x.data()); }
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2::ushort_v) { return AVX::convert<schar, ushort>(x.data()); }
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2::   int_v) { return AVX::convert<uchar,    int>(x.data()); }
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2::  uint_v) { return AVX::convert<uchar,   uint>(x.data()); }
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2:: short_v) { return AVX::convert<uchar,  short>(x.data()); }
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2::ushort_v) { return AVX::convert<uchar, ushort>(x.data()); }
+Vc_SIMD_CAST_1(AVX2::   int_v, SSE:: schar_v) { return AVX::convert<   int, schar>(x.data()); }
+Vc_SIMD_CAST_1(AVX2::  uint_v, SSE:: schar_v) { return AVX::convert<  uint, schar>(x.data()); }
+Vc_SIMD_CAST_1(AVX2:: short_v, SSE:: schar_v) { return AVX::convert< short, schar>(x.data()); }
+Vc_SIMD_CAST_1(AVX2::ushort_v, SSE:: schar_v) { return AVX::convert<ushort, schar>(x.data()); }
+Vc_SIMD_CAST_2(AVX2::   int_v, SSE:: schar_v)
+{
+    return simd_cast<SSE::schar_v>(SSE::short_v(AVX::convert<int, short>(x0.data())),
+                                  SSE::short_v(AVX::convert<int, short>(x1.data())));
+}
+Vc_SIMD_CAST_2(AVX2::  uint_v, SSE:: schar_v)
+{
+    return simd_cast<SSE::schar_v>(SSE::short_v(AVX::convert<uint, short>(x0.data())),
+                                  SSE::short_v(AVX::convert<uint, short>(x1.data())));
+}
+Vc_SIMD_CAST_1(AVX2::   int_v, SSE:: uchar_v) { return AVX::convert<   int, uchar>(x.data()); }
+Vc_SIMD_CAST_1(AVX2::  uint_v, SSE:: uchar_v) { return AVX::convert<  uint, uchar>(x.data()); }
+Vc_SIMD_CAST_1(AVX2:: short_v, SSE:: uchar_v) { return AVX::convert< short, uchar>(x.data()); }
+Vc_SIMD_CAST_1(AVX2::ushort_v, SSE:: uchar_v) { return AVX::convert<ushort, uchar>(x.data()); }
+Vc_SIMD_CAST_2(AVX2::   int_v, SSE:: uchar_v)
+{
+    return simd_cast<SSE::uchar_v>(SSE::short_v(AVX::convert<int, short>(x0.data())),
+                                  SSE::short_v(AVX::convert<int, short>(x1.data())));
+}
+Vc_SIMD_CAST_2(AVX2::  uint_v, SSE:: uchar_v)
+{
+    return simd_cast<SSE::uchar_v>(SSE::short_v(AVX::convert<uint, short>(x0.data())),
+                                  SSE::short_v(AVX::convert<uint, short>(x1.data())));
+}
+
+Vc_SIMD_CAST_AVX_1(schar_v, double_v) { return AVX::convert<schar, double>(x.data()); }
+Vc_SIMD_CAST_AVX_1(schar_v,  float_v) { return AVX::convert<schar,  float>(x.data()); }
+Vc_SIMD_CAST_AVX_1(schar_v,    int_v) { return AVX::convert<schar,    int>(x.data()); }
+Vc_SIMD_CAST_AVX_1(schar_v,   uint_v) { return AVX::convert<schar,   uint>(x.data()); }
+Vc_SIMD_CAST_AVX_1(schar_v,  short_v) { return AVX::convert<schar,  short>(x.data()); }
+Vc_SIMD_CAST_AVX_1(schar_v, ushort_v) { return AVX::convert<schar, ushort>(x.data()); }
+Vc_SIMD_CAST_AVX_1(uchar_v, double_v) { return AVX::convert<uchar, double>(x.data()); }
+Vc_SIMD_CAST_AVX_1(uchar_v,  float_v) { return AVX::convert<uchar,  float>(x.data()); }
+Vc_SIMD_CAST_AVX_1(uchar_v,    int_v) { return AVX::convert<uchar,    int>(x.data()); }
+Vc_SIMD_CAST_AVX_1(uchar_v,   uint_v) { return AVX::convert<uchar,   uint>(x.data()); }
+Vc_SIMD_CAST_AVX_1(uchar_v,  short_v) { return AVX::convert<uchar,  short>(x.data()); }
+Vc_SIMD_CAST_AVX_1(uchar_v, ushort_v) { return AVX::convert<uchar, ushort>(x.data()); }
+Vc_SIMD_CAST_AVX_1(schar_v, uchar_v) { return x.data(); }
+Vc_SIMD_CAST_AVX_1(uchar_v, schar_v) { return x.data(); }
+Vc_SIMD_CAST_AVX_1(double_v, schar_v) { return AVX::zeroExtend(simd_cast<SSE::schar_v>(x).data()); }
+Vc_SIMD_CAST_AVX_1( float_v, schar_v) { return AVX::zeroExtend(simd_cast<SSE::schar_v>(x).data()); }
+Vc_SIMD_CAST_AVX_1(   int_v, schar_v) { return AVX::zeroExtend(simd_cast<SSE::schar_v>(x).data()); }
+Vc_SIMD_CAST_AVX_1(  uint_v, schar_v) { return AVX::zeroExtend(simd_cast<SSE::schar_v>(x).data()); }
+Vc_SIMD_CAST_AVX_1( short_v, schar_v) { return AVX::zeroExtend(simd_cast<SSE::schar_v>(x).data()); }
+Vc_SIMD_CAST_AVX_1(ushort_v, schar_v) { return AVX::zeroExtend(simd_cast<SSE::schar_v>(x).data()); }
+Vc_SIMD_CAST_AVX_2(double_v, schar_v) { return AVX::zeroExtend(simd_cast<SSE::schar_v>(x0, x1).data()); }
+Vc_SIMD_CAST_AVX_2( float_v, schar_v) { return AVX::zeroExtend(simd_cast<SSE::schar_v>(x0, x1).data()); }
+Vc_SIMD_CAST_AVX_2(   int_v, schar_v) { return AVX::zeroExtend(simd_cast<SSE::schar_v>(x0, x1).data()); }
+Vc_SIMD_CAST_AVX_2(  uint_v, schar_v) { return AVX::zeroExtend(simd_cast<SSE::schar_v>(x0, x1).data()); }
+Vc_SIMD_CAST_AVX_2( short_v, schar_v)
+{
+    // the in-lane pack needs the 64-bit quarters reordered afterwards
+    const __m256i mask = AVX::srli_epi16<8>(Detail::allone<__m256i>());
+    return Mem::permute4x64<X0, X2, X1, X3>(
+        _mm256_packus_epi16(Detail::and_(x0.data(), mask), Detail::and_(x1.data(), mask)));
+}
+Vc_SIMD_CAST_AVX_2(ushort_v, schar_v)
+{
+    // the in-lane pack needs the 64-bit quarters reordered afterwards
+    const __m256i mask = AVX::srli_epi16<8>(Detail::allone<__m256i>());
+    return Mem::permute4x64<X0, X2, X1, X3>(
+        _mm256_packus_epi16(Detail::and_(x0.data(), mask), Detail::and_(x1.data(), mask)));
+}
+Vc_SIMD_CAST_AVX_3(double_v, schar_v) { return AVX::zeroExtend(simd_cast<SSE::schar_v>(x0, x1, x2, AVX2::double_v::Zero()).data()); }
+Vc_SIMD_CAST_AVX_3( float_v, schar_v) { return AVX::concat(simd_cast<SSE::schar_v>(x0, x1).data(), simd_cast<SSE::schar_v>(x2).data()); }
+Vc_SIMD_CAST_AVX_3(   int_v, schar_v) { return AVX::concat(simd_cast<SSE::schar_v>(x0, x1).data(), simd_cast<SSE::schar_v>(x2).data()); }
+Vc_SIMD_CAST_AVX_3(  uint_v, schar_v) { return AVX::concat(simd_cast<SSE::schar_v>(x0, x1).data(), simd_cast<SSE::schar_v>(x2).data()); }
+Vc_SIMD_CAST_AVX_4(double_v, schar_v) { return AVX::zeroExtend(simd_cast<SSE::schar_v>(x0, x1, x2, x3).data()); }
+Vc_SIMD_CAST_AVX_4( float_v, schar_v)
+{
+    return AVX::concat(simd_cast<SSE::schar_v>(x0, x1).data(), simd_cast<SSE::schar_v>(x2, x3).data());
+}
+Vc_SIMD_CAST_AVX_4(   int_v, schar_v)
+{
+    return AVX::concat(simd_cast<SSE::schar_v>(x0, x1).data(), simd_cast<SSE::schar_v>(x2, x3).data());
+}
+Vc_SIMD_CAST_AVX_4(  uint_v, schar_v)
+{
+    return AVX::concat(simd_cast<SSE::schar_v>(x0, x1).data(), simd_cast<SSE::schar_v>(x2, x3).data());
+}
+Vc_SIMD_CAST_5(AVX2::double_v, AVX2::schar_v)
+{
+    return AVX::concat(simd_cast<SSE::schar_v>(x0, x1, x2, x3).data(),
+                       simd_cast<SSE::schar_v>(x4).data());
+}
+Vc_SIMD_CAST_6(AVX2::double_v, AVX2::schar_v)
+{
+    return AVX::concat(simd_cast<SSE::schar_v>(x0, x1, x2, x3).data(),
+                       simd_cast<SSE::schar_v>(x4, x5).data());
+}
+Vc_SIMD_CAST_7(AVX2::double_v, AVX2::schar_v)
+{
+    return AVX::concat(simd_cast<SSE::schar_v>(x0, x1, x2, x3).data(),
+                       simd_cast<SSE::schar_v>(x4, x5, x6, AVX2::double_v::Zero()).data());
+}
+Vc_SIMD_CAST_8(AVX2::double_v, AVX2::schar_v)
+{
+    return AVX::concat(simd_cast<SSE::schar_v>(x0, x1, x2, x3).data(),
+                       simd_cast<SSE::schar_v>(x4, x5, x6, x7).data());
+}
+Vc_SIMD_CAST_AVX_1(double_v, uchar_v) { return AVX::zeroExtend(simd_cast<SSE::uchar_v>(x).data()); }
+Vc_SIMD_CAST_AVX_1( float_v, uchar_v) { return AVX::zeroExtend(simd_cast<SSE::uchar_v>(x).data()); }
+Vc_SIMD_CAST_AVX_1(   int_v, uchar_v) { return AVX::zeroExtend(simd_cast<SSE::uchar_v>(x).data()); }
+Vc_SIMD_CAST_AVX_1(  uint_v, uchar_v) { return AVX::zeroExtend(simd_cast<SSE::uchar_v>(x).data()); }
+Vc_SIMD_CAST_AVX_1( short_v, uchar_v) { return AVX::zeroExtend(simd_cast<SSE::uchar_v>(x).data()); }
+Vc_SIMD_CAST_AVX_1(ushort_v, uchar_v) { return AVX::zeroExtend(simd_cast<SSE::uchar_v>(x).data()); }
+Vc_SIMD_CAST_AVX_2(double_v, uchar_v) { return AVX::zeroExtend(simd_cast<SSE::uchar_v>(x0, x1).data()); }
+Vc_SIMD_CAST_AVX_2( float_v, uchar_v) { return AVX::zeroExtend(simd_cast<SSE::uchar_v>(x0, x1).data()); }
+Vc_SIMD_CAST_AVX_2(   int_v, uchar_v) { return AVX::zeroExtend(simd_cast<SSE::uchar_v>(x0, x1).data()); }
+Vc_SIMD_CAST_AVX_2(  uint_v, uchar_v) { return AVX::zeroExtend(simd_cast<SSE::uchar_v>(x0, x1).data()); }
+Vc_SIMD_CAST_AVX_2( short_v, uchar_v)
+{
+    // the in-lane pack needs the 64-bit quarters reordered afterwards
+    const __m256i mask = AVX::srli_epi16<8>(Detail::allone<__m256i>());
+    return Mem::permute4x64<X0, X2, X1, X3>(
+        _mm256_packus_epi16(Detail::and_(x0.data(), mask), Detail::and_(x1.data(), mask)));
+}
+Vc_SIMD_CAST_AVX_2(ushort_v, uchar_v)
+{
+    // the in-lane pack needs the 64-bit quarters reordered afterwards
+    const __m256i mask = AVX::srli_epi16<8>(Detail::allone<__m256i>());
+    return Mem::permute4x64<X0, X2, X1, X3>(
+        _mm256_packus_epi16(Detail::and_(x0.data(), mask), Detail::and_(x1.data(), mask)));
+}
+Vc_SIMD_CAST_AVX_3(double_v, uchar_v) { return AVX::zeroExtend(simd_cast<SSE::uchar_v>(x0, x1, x2, AVX2::double_v::Zero()).data()); }
+Vc_SIMD_CAST_AVX_3( float_v, uchar_v) { return AVX::concat(simd_cast<SSE::uchar_v>(x0, x1).data(), simd_cast<SSE::uchar_v>(x2).data()); }
+Vc_SIMD_CAST_AVX_3(   int_v, uchar_v) { return AVX::concat(simd_cast<SSE::uchar_v>(x0, x1).data(), simd_cast<SSE::uchar_v>(x2).data()); }
+Vc_SIMD_CAST_AVX_3(  uint_v, uchar_v) { return AVX::concat(simd_cast<SSE::uchar_v>(x0, x1).data(), simd_cast<SSE::uchar_v>(x2).data()); }
+Vc_SIMD_CAST_AVX_4(double_v, uchar_v) { return AVX::zeroExtend(simd_cast<SSE::uchar_v>(x0, x1, x2, x3).data()); }
+Vc_SIMD_CAST_AVX_4( float_v, uchar_v)
+{
+    return AVX::concat(simd_cast<SSE::uchar_v>(x0, x1).data(), simd_cast<SSE::uchar_v>(x2, x3).data());
+}
+Vc_SIMD_CAST_AVX_4(   int_v, uchar_v)
+{
+    return AVX::concat(simd_cast<SSE::uchar_v>(x0, x1).data(), simd_cast<SSE::uchar_v>(x2, x3).data());
+}
+Vc_SIMD_CAST_AVX_4(  uint_v, uchar_v)
+{
+    return AVX::concat(simd_cast<SSE::uchar_v>(x0, x1).data(), simd_cast<SSE::uchar_v>(x2, x3).data());
+}
+Vc_SIMD_CAST_5(AVX2::double_v, AVX2::uchar_v)
+{
+    return AVX::concat(simd_cast<SSE::uchar_v>(x0, x1, x2, x3).data(),
+                       simd_cast<SSE::uchar_v>(x4).data());
+}
+Vc_SIMD_CAST_6(AVX2::double_v, AVX2::uchar_v)
+{
+    return AVX::concat(simd_cast<SSE::uchar_v>(x0, x1, x2, x3).data(),
+                       simd_cast<SSE::uchar_v>(x4, x5).data());
+}
+Vc_SIMD_CAST_7(AVX2::double_v, AVX2::uchar_v)
+{
+    return AVX::concat(simd_cast<SSE::uchar_v>(x0, x1, x2, x3).data(),
+                       simd_cast<SSE::uchar_v>(x4, x5, x6, AVX2::double_v::Zero()).data());
+}
+Vc_SIMD_CAST_8(AVX2::double_v, AVX2::uchar_v)
+{
+    return AVX::concat(simd_cast<SSE::uchar_v>(x0, x1, x2, x3).data(),
+                       simd_cast<SSE::uchar_v>(x4, x5, x6, x7).data());
+}
+
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2::schar_v) { return AVX::zeroExtend(x.data()); }
+Vc_SIMD_CAST_2(SSE:: schar_v, AVX2::schar_v) { return AVX::concat(x0.data(), x1.data()); }
+Vc_SIMD_CAST_1(SSE:: schar_v, AVX2::uchar_v) { return AVX::zeroExtend(x.data()); }
+Vc_SIMD_CAST_2(SSE:: schar_v, AVX2::uchar_v) { return AVX::concat(x0.data(), x1.data()); }
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2::schar_v) { return AVX::zeroExtend(x.data()); }
+Vc_SIMD_CAST_2(SSE:: uchar_v, AVX2::schar_v) { return AVX::concat(x0.data(), x1.data()); }
+Vc_SIMD_CAST_1(SSE:: uchar_v, AVX2::uchar_v) { return AVX::zeroExtend(x.data()); }
+Vc_SIMD_CAST_2(SSE:: uchar_v, AVX2::uchar_v) { return AVX::concat(x0.data(), x1.data()); }
+Vc_SIMD_CAST_1(AVX2::schar_v, SSE::double_v) { return simd_cast<SSE::double_v>(SSE::schar_v(AVX::lo128(x.data()))); }
+Vc_SIMD_CAST_1(AVX2::schar_v, SSE:: float_v) { return simd_cast<SSE:: float_v>(SSE::schar_v(AVX::lo128(x.data()))); }
+Vc_SIMD_CAST_1(AVX2::schar_v, SSE::   int_v) { return simd_cast<SSE::   int_v>(SSE::schar_v(AVX::lo128(x.data()))); }
+Vc_SIMD_CAST_1(AVX2::schar_v, SSE::  uint_v) { return simd_cast<SSE::  uint_v>(SSE::schar_v(AVX::lo128(x.data()))); }
+Vc_SIMD_CAST_1(AVX2::schar_v, SSE:: short_v) { return simd_cast<SSE:: short_v>(SSE::schar_v(AVX::lo128(x.data()))); }
+Vc_SIMD_CAST_1(AVX2::schar_v, SSE::ushort_v) { return simd_cast<SSE::ushort_v>(SSE::schar_v(AVX::lo128(x.data()))); }
+Vc_SIMD_CAST_1(AVX2::schar_v, SSE:: schar_v) { return AVX::lo128(x.data()); }
+Vc_SIMD_CAST_1(AVX2::schar_v, SSE:: uchar_v) { return AVX::lo128(x.data()); }
+Vc_SIMD_CAST_1(AVX2::uchar_v, SSE::double_v) { return simd_cast<SSE::double_v>(SSE::uchar_v(AVX::lo128(x.data()))); }
+Vc_SIMD_CAST_1(AVX2::uchar_v, SSE:: float_v) { return simd_cast<SSE:: float_v>(SSE::uchar_v(AVX::lo128(x.data()))); }
+Vc_SIMD_CAST_1(AVX2::uchar_v, SSE::   int_v) { return simd_cast<SSE::   int_v>(SSE::uchar_v(AVX::lo128(x.data()))); }
+Vc_SIMD_CAST_1(AVX2::uchar_v, SSE::  uint_v) { return simd_cast<SSE::  uint_v>(SSE::uchar_v(AVX::lo128(x.data()))); }
+Vc_SIMD_CAST_1(AVX2::uchar_v, SSE:: short_v) { return simd_cast<SSE:: short_v>(SSE::uchar_v(AVX::lo128(x.data()))); }
+Vc_SIMD_CAST_1(AVX2::uchar_v, SSE::ushort_v) { return simd_cast<SSE::ushort_v>(SSE::uchar_v(AVX::lo128(x.data()))); }
+Vc_SIMD_CAST_1(AVX2::uchar_v, SSE:: schar_v) { return AVX::lo128(x.data()); }
+Vc_SIMD_CAST_1(AVX2::uchar_v, SSE:: uchar_v) { return AVX::lo128(x.data()); }
+#endif
+
+// 64-bit integer Vectors {{{2
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(SSE::Vector<T> x,
+          enable_if<Detail::is_int64<T>::value && AVX2::is_vector<To>::value &&
+                    !Detail::is_int64<typename To::EntryType>::value>)
+{
+    return simd_cast<To>(simd_cast<SSE::Vector<typename To::EntryType>>(x));
+}
+namespace Detail
+{
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To sse_int64_to_avx(SSE::Vector<T> x0, SSE::Vector<T> x1,
+                                          std::true_type)
+{
+    // two SSE::double_v fill one AVX2::double_v
+    return simd_cast<To>(simd_cast<SSE::double_v>(x0), simd_cast<SSE::double_v>(x1));
+}
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To sse_int64_to_avx(SSE::Vector<T> x0, SSE::Vector<T> x1,
+                                          std::false_type)
+{
+    return simd_cast<To>(simd_cast<SSE::Vector<typename To::EntryType>>(x0, x1));
+}
+}  // namespace Detail
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(SSE::Vector<T> x0, SSE::Vector<T> x1,
+          enable_if<Detail::is_int64<T>::value && AVX2::is_vector<To>::value &&
+                    !Detail::is_int64<typename To::EntryType>::value>)
+{
+    return Detail::sse_int64_to_avx<To>(
+        x0, x1, std::integral_constant<bool, sizeof(typename To::EntryType) == 8>());
+}
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(SSE::Vector<T> x0, SSE::Vector<T> x1, SSE::Vector<T> x2,
+          enable_if<Detail::is_int64<T>::value && AVX2::is_vector<To>::value &&
+                    !Detail::is_int64<typename To::EntryType>::value && (To::Size >= 8)>)
+{
+    using V = SSE::Vector<typename std::conditional<
+        std::is_floating_point<typename To::EntryType>::value, float, int>::type>;
+    return simd_cast<To>(simd_cast<V>(x0, x1), simd_cast<V>(x2));
+}
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(SSE::Vector<T> x0, SSE::Vector<T> x1, SSE::Vector<T> x2, SSE::Vector<T> x3,
+          enable_if<Detail::is_int64<T>::value && AVX2::is_vector<To>::value &&
+                    !Detail::is_int64<typename To::EntryType>::value && (To::Size >= 8)>)
+{
+    using V = SSE::Vector<typename std::conditional<
+        std::is_floating_point<typename To::EntryType>::value, float, int>::type>;
+    return simd_cast<To>(simd_cast<V>(x0, x1), simd_cast<V>(x2, x3));
+}
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(AVX2::Vector<T> x,
+          enable_if<!Detail::is_int64<T>::value && SSE::is_vector<To>::value &&
+                    Detail::is_int64<typename To::EntryType>::value>)
+{
+    return simd_cast<To>(simd_cast<SSE::Vector<T>>(x));
+}
+
+#ifdef Vc_IMPL_AVX2
+namespace Detail
+{
+// the 128-bit halves of an AVX2 int64 Vector as SSE Vectors
+template <typename T> Vc_INTRINSIC SSE::Vector<T> lo_int64(AVX2::Vector<T> x)
+{
+    return AVX::lo128(x.data());
+}
+template <typename T> Vc_INTRINSIC SSE::Vector<T> hi_int64(AVX2::Vector<T> x)
+{
+    return AVX::hi128(x.data());
+}
+// AVX2 int64 to AVX2 double_v, float_v, or int_v (the latter two with the upper half
+// zeroed): the SSE casts do the work on the halves
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST enable_if<std::is_same<typename To::EntryType, double>::value, To>
+int64_to_avx(AVX2::Vector<T> x)
+{
+    return AVX::concat(SSE::convert<T, double>(lo_int64(x).data()),
+                       SSE::convert<T, double>(hi_int64(x).data()));
+}
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST enable_if<is_int64<typename To::EntryType>::value, To> int64_to_avx(
+    AVX2::Vector<T> x)
+{
+    return x.data();
+}
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST enable_if<(sizeof(typename To::EntryType) <= 4), To> int64_to_avx(
+    AVX2::Vector<T> x)
+{
+    using U = typename std::conditional<
+        std::is_floating_point<typename To::EntryType>::value, float, int>::type;
+    return simd_cast<To>(AVX2::Vector<U>(AVX::zeroExtend(
+        simd_cast<SSE::Vector<U>>(lo_int64(x), hi_int64(x)).data())));
+}
+// AVX2 Vector with at least four entries to AVX2 int64
+template <typename T, typename U>
+Vc_INTRINSIC Vc_CONST enable_if<std::is_same<U, double>::value, __m256i> avx_to_int64(
+    AVX2::Vector<U> x)
+{
+    return AVX::concat(SSE::convert<double, T>(AVX::lo128(x.data())),
+                       SSE::convert<double, T>(AVX::hi128(x.data())));
+}
+template <typename T, typename U>
+Vc_INTRINSIC Vc_CONST enable_if<std::is_same<U, float>::value, __m256i> avx_to_int64(
+    AVX2::Vector<U> x)
+{
+    return avx_to_int64<T>(simd_cast<AVX2::double_v>(x));
+}
+template <typename T, typename U>
+Vc_INTRINSIC Vc_CONST enable_if<(std::is_integral<U>::value && sizeof(U) == 4), __m256i>
+avx_to_int64(AVX2::Vector<U> x)
+{
+    return std::is_signed<U>::value ? _mm256_cvtepi32_epi64(AVX::lo128(x.data()))
+                                    : _mm256_cvtepu32_epi64(AVX::lo128(x.data()));
+}
+template <typename T, typename U>
+Vc_INTRINSIC Vc_CONST enable_if<(std::is_integral<U>::value && sizeof(U) < 4), __m256i>
+avx_to_int64(AVX2::Vector<U> x)
+{
+    // sign or zero extend to 32 bits first
+    using I = typename std::conditional<std::is_signed<U>::value, int, uint>::type;
+    return avx_to_int64<T>(simd_cast<AVX2::Vector<I>>(x));
+}
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To int64_cast(AVX2::Vector<T> x, std::true_type)
+{
+    return int64_to_avx<To>(x);
+}
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To int64_cast(AVX2::Vector<T> x, std::false_type)
+{
+    return avx_to_int64<typename To::EntryType>(x);
+}
+}  // namespace Detail
+
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(AVX2::Vector<T> x,
+          enable_if<AVX2::is_vector<To>::value && !std::is_same<To, AVX2::Vector<T>>::value &&
+                    (AVX2::is_int64_vector<To>::value || Detail::is_int64<T>::value)>)
+{
+    return Detail::int64_cast<To>(x, Detail::is_int64<T>());
+}
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1,
+          enable_if<Detail::is_int64<T>::value && AVX2::is_vector<To>::value &&
+                    (To::Size >= 8)>)
+{
+    using U = typename std::conditional<
+        std::is_floating_point<typename To::EntryType>::value, float, int>::type;
+    using SseV = SSE::Vector<U>;
+    return simd_cast<To>(AVX2::Vector<U>(
+        AVX::concat(simd_cast<SseV>(Detail::lo_int64(x0), Detail::hi_int64(x0)).data(),
+                    simd_cast<SseV>(Detail::lo_int64(x1), Detail::hi_int64(x1)).data())));
+}
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1, AVX2::Vector<T> x2,
+          enable_if<Detail::is_int64<T>::value && AVX2::is_vector<To>::value &&
+                    (To::Size >= 16)>)
+{
+    return simd_cast<To>(simd_cast<AVX2::int_v>(x0, x1), simd_cast<AVX2::int_v>(x2));
+}
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1, AVX2::Vector<T> x2, AVX2::Vector<T> x3,
+          enable_if<Detail::is_int64<T>::value && AVX2::is_vector<To>::value &&
+                    (To::Size >= 16)>)
+{
+    return simd_cast<To>(simd_cast<AVX2::int_v>(x0, x1), simd_cast<AVX2::int_v>(x2, x3));
+}
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1, AVX2::Vector<T> x2, AVX2::Vector<T> x3,
+          AVX2::Vector<T> x4,
+          enable_if<Detail::is_int64<T>::value && AVX2::is_vector<To>::value &&
+                    (To::Size >= 32)>)
+{
+    return simd_cast<To>(simd_cast<AVX2::int_v>(x0, x1), simd_cast<AVX2::int_v>(x2, x3),
+                         simd_cast<AVX2::int_v>(x4));
+}
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1, AVX2::Vector<T> x2, AVX2::Vector<T> x3,
+          AVX2::Vector<T> x4, AVX2::Vector<T> x5,
+          enable_if<Detail::is_int64<T>::value && AVX2::is_vector<To>::value &&
+                    (To::Size >= 32)>)
+{
+    return simd_cast<To>(simd_cast<AVX2::int_v>(x0, x1), simd_cast<AVX2::int_v>(x2, x3),
+                         simd_cast<AVX2::int_v>(x4, x5));
+}
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1, AVX2::Vector<T> x2, AVX2::Vector<T> x3,
+          AVX2::Vector<T> x4, AVX2::Vector<T> x5, AVX2::Vector<T> x6,
+          enable_if<Detail::is_int64<T>::value && AVX2::is_vector<To>::value &&
+                    (To::Size >= 32)>)
+{
+    return simd_cast<To>(simd_cast<AVX2::int_v>(x0, x1), simd_cast<AVX2::int_v>(x2, x3),
+                         simd_cast<AVX2::int_v>(x4, x5), simd_cast<AVX2::int_v>(x6));
+}
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1, AVX2::Vector<T> x2, AVX2::Vector<T> x3,
+          AVX2::Vector<T> x4, AVX2::Vector<T> x5, AVX2::Vector<T> x6, AVX2::Vector<T> x7,
+          enable_if<Detail::is_int64<T>::value && AVX2::is_vector<To>::value &&
+                    (To::Size >= 32)>)
+{
+    return simd_cast<To>(simd_cast<AVX2::int_v>(x0, x1), simd_cast<AVX2::int_v>(x2, x3),
+                         simd_cast<AVX2::int_v>(x4, x5), simd_cast<AVX2::int_v>(x6, x7));
+}
+
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(From x, enable_if<AVX2::is_int64_vector<To>::value && SSE::is_vector<From>::value>)
+{
+    using SseV = SSE::Vector<typename To::EntryType>;
+    return AVX::concat(simd_cast<SseV>(x).data(),
+                       From::Size > 2 ? simd_cast<SseV, 1>(x).data() : _mm_setzero_si128());
+}
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST To simd_cast(From x0, From x1,
+                                   enable_if<AVX2::is_int64_vector<To>::value &&
+                                             SSE::is_vector<From>::value && From::Size == 2>)
+{
+    using SseV = SSE::Vector<typename To::EntryType>;
+    return AVX::concat(simd_cast<SseV>(x0).data(), simd_cast<SseV>(x1).data());
+}
+
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(AVX2::Vector<T> x,
+          enable_if<Detail::is_int64<T>::value && SSE::is_vector<To>::value>)
+{
+    return To::Size > 2 ? simd_cast<To>(Detail::lo_int64(x), Detail::hi_int64(x))
+                        : simd_cast<To>(Detail::lo_int64(x));
+}
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1,
+          enable_if<Detail::is_int64<T>::value && SSE::is_vector<To>::value &&
+                    (To::Size >= 8)>)
+{
+    return simd_cast<To>(Detail::lo_int64(x0), Detail::hi_int64(x0), Detail::lo_int64(x1),
+                         Detail::hi_int64(x1));
+}
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(AVX2::Vector<T> x0, AVX2::Vector<T> x1, AVX2::Vector<T> x2, AVX2::Vector<T> x3,
+          enable_if<Detail::is_int64<T>::value && SSE::is_vector<To>::value &&
+                    (To::Size >= 16)>)
+{
+    return simd_cast<To>(Detail::lo_int64(x0), Detail::hi_int64(x0), Detail::lo_int64(x1),
+                         Detail::hi_int64(x1), Detail::lo_int64(x2), Detail::hi_int64(x2),
+                         Detail::lo_int64(x3), Detail::hi_int64(x3));
+}
+
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, enable_if<AVX2::is_int64_vector<Return>::value>)
+{
+    using U = typename Return::EntryType;
+    return _mm256_setr_epi64x(static_cast<U>(x0.data()), 0, 0, 0);
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
+                                       enable_if<AVX2::is_int64_vector<Return>::value>)
+{
+    using U = typename Return::EntryType;
+    return _mm256_setr_epi64x(static_cast<U>(x0.data()), static_cast<U>(x1.data()), 0, 0);
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
+                                       Scalar::Vector<T> x2,
+                                       enable_if<AVX2::is_int64_vector<Return>::value>)
+{
+    using U = typename Return::EntryType;
+    return _mm256_setr_epi64x(static_cast<U>(x0.data()), static_cast<U>(x1.data()),
+                              static_cast<U>(x2.data()), 0);
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
+                                       Scalar::Vector<T> x2, Scalar::Vector<T> x3,
+                                       enable_if<AVX2::is_int64_vector<Return>::value>)
+{
+    using U = typename Return::EntryType;
+    return _mm256_setr_epi64x(static_cast<U>(x0.data()), static_cast<U>(x1.data()),
+                              static_cast<U>(x2.data()), static_cast<U>(x3.data()));
+}
+#endif
+
 // 1 Scalar::Vector to 1 AVX2::Vector {{{2
 template <typename Return, typename T>
 Vc_INTRINSIC Vc_CONST Return
@@ -2279,6 +3165,31 @@ Vc_SIMD_CAST_AVX_2(   int_m, ushort_m) { return Mem::permute4x64<X0, X2, X1, X3>
 
 Vc_SIMD_CAST_AVX_2(  uint_m,  short_m) { return Mem::permute4x64<X0, X2, X1, X3>(_mm256_packs_epi16(x0.dataI(), x1.dataI())); }
 Vc_SIMD_CAST_AVX_2(  uint_m, ushort_m) { return Mem::permute4x64<X0, X2, X1, X3>(_mm256_packs_epi16(x0.dataI(), x1.dataI())); }
+
+// masks with 64-bit entries have the same layout as double_m; 8-bit entries are
+// reached via short_m
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX2::Mask<T> x0, AVX2::Mask<T> x1,
+          enable_if<AVX2::is_mask<Return>::value &&
+                    AVX2::is_generic_mask_cast<T, typename Return::EntryType>::value &&
+                    (AVX2::Mask<T>::Size < 16)>)
+{
+    using M = AVX2::Mask<
+        typename std::conditional<Detail::is_int64<T>::value, double, T>::type>;
+    using R = typename std::conditional<sizeof(typename Return::EntryType) == 1,
+                                        AVX2::short_m, Return>::type;
+    return simd_cast<Return>(simd_cast<R>(simd_cast<M>(x0), simd_cast<M>(x1)));
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX2::Mask<T> x0, AVX2::Mask<T> x1,
+          enable_if<AVX2::is_mask<Return>::value &&
+                    AVX2::is_generic_mask_cast<T, typename Return::EntryType>::value &&
+                    AVX2::Mask<T>::Size == 16>)
+{
+    return {Mem::permute4x64<X0, X2, X1, X3>(_mm256_packs_epi16(x0.dataI(), x1.dataI()))};
+}
 #endif
 
 // 4 AVX2::Mask to 1 AVX2::Mask {{{2
@@ -2295,6 +3206,28 @@ Vc_SIMD_CAST_AVX_4(double_m, short_m)
                   _mm_unpackhi_epi32(lo128(tmp), hi128(tmp)));  // c0 c1 c2 c3 d0 d1 d2 d3
 }
 Vc_SIMD_CAST_AVX_4(double_m, ushort_m) { return simd_cast<AVX2::short_m>(x0, x1, x2, x3).data(); }
+
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX2::Mask<T> x0, AVX2::Mask<T> x1, AVX2::Mask<T> x2, AVX2::Mask<T> x3,
+          enable_if<AVX2::is_mask<Return>::value &&
+                    AVX2::is_generic_mask_cast<T, typename Return::EntryType>::value &&
+                    AVX2::Mask<T>::Size == 4>)
+{
+    using M = AVX2::double_m;
+    return simd_cast<Return>(simd_cast<AVX2::short_m>(simd_cast<M>(x0), simd_cast<M>(x1),
+                                                      simd_cast<M>(x2), simd_cast<M>(x3)));
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX2::Mask<T> x0, AVX2::Mask<T> x1, AVX2::Mask<T> x2, AVX2::Mask<T> x3,
+          enable_if<AVX2::is_mask<Return>::value &&
+                    AVX2::is_generic_mask_cast<T, typename Return::EntryType>::value &&
+                    AVX2::Mask<T>::Size == 8>)
+{
+    return simd_cast<Return>(simd_cast<AVX2::short_m>(x0, x1),
+                             simd_cast<AVX2::short_m>(x2, x3));
+}
 #endif
 
 // 1 SSE::Mask to 1 AVX2::Mask {{{2
@@ -2379,6 +3312,15 @@ Vc_SIMD_CAST_2(SSE::ushort_m, AVX2:: short_m) { return AVX::concat(x0.data(), x1
 Vc_SIMD_CAST_2(SSE::ushort_m, AVX2::ushort_m) { return AVX::concat(x0.data(), x1.data()); }
 #endif
 
+// masks with 64-bit entries have the same layout as double_m
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(SSE::Mask<T> x0, SSE::Mask<T> x1,
+          enable_if<AVX2::is_mask<Return>::value && Detail::is_int64<T>::value>)
+{
+    return simd_cast<Return>(simd_cast<SSE::double_m>(x0), simd_cast<SSE::double_m>(x1));
+}
+
 // 4 SSE::Mask to 1 AVX2::Mask {{{2
 Vc_SIMD_CAST_4(SSE::double_m, AVX2:: float_m) { return AVX::concat(_mm_packs_epi32(x0.dataI(), x1.dataI()), _mm_packs_epi32(x2.dataI(), x3.dataI())); }
 #ifdef Vc_IMPL_AVX2
@@ -2393,6 +3335,14 @@ Vc_SIMD_CAST_4(SSE::   int_m, AVX2::ushort_m) { return AVX::concat(_mm_packs_epi
 Vc_SIMD_CAST_4(SSE::  uint_m, AVX2:: short_m) { return AVX::concat(_mm_packs_epi16(x0.dataI(), x1.dataI()), _mm_packs_epi16(x2.dataI(), x3.dataI())); }
 Vc_SIMD_CAST_4(SSE::  uint_m, AVX2::ushort_m) { return AVX::concat(_mm_packs_epi16(x0.dataI(), x1.dataI()), _mm_packs_epi16(x2.dataI(), x3.dataI())); }
 #endif
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(SSE::Mask<T> x0, SSE::Mask<T> x1, SSE::Mask<T> x2, SSE::Mask<T> x3,
+          enable_if<AVX2::is_mask<Return>::value && Detail::is_int64<T>::value>)
+{
+    return simd_cast<Return>(simd_cast<SSE::double_m>(x0), simd_cast<SSE::double_m>(x1),
+                             simd_cast<SSE::double_m>(x2), simd_cast<SSE::double_m>(x3));
+}
 
 // 1 Scalar::Mask to 1 AVX2::Mask {{{2
 template <typename Return, typename T>
@@ -2528,6 +3478,52 @@ Vc_SIMD_CAST_1(AVX2::ushort_m, SSE::ushort_m) { return simd_cast<SSE::ushort_m>(
 Vc_SIMD_CAST_2(AVX2::double_m, SSE:: short_m) { return _mm_packs_epi16(_mm_packs_epi32(AVX::lo128(x0.dataI()), AVX::hi128(x0.dataI())), _mm_packs_epi32(AVX::lo128(x1.dataI()), AVX::hi128(x1.dataI()))); }
 Vc_SIMD_CAST_2(AVX2::double_m, SSE::ushort_m) { return _mm_packs_epi16(_mm_packs_epi32(AVX::lo128(x0.dataI()), AVX::hi128(x0.dataI())), _mm_packs_epi32(AVX::lo128(x1.dataI()), AVX::hi128(x1.dataI()))); }
 
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX2::Mask<T> x0, AVX2::Mask<T> x1,
+          enable_if<SSE::is_mask<Return>::value &&
+                    AVX2::is_generic_mask_cast<T, typename Return::EntryType>::value &&
+                    AVX2::Mask<T>::Size * 2 <= Return::Size>)
+{
+    using M = SSE::Mask<
+        typename std::conditional<AVX2::Mask<T>::Size == 4, float, short>::type>;
+    return simd_cast<Return>(simd_cast<M>(x0), simd_cast<M>(x1));
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX2::Mask<T> x0, AVX2::Mask<T> x1, AVX2::Mask<T> x2, AVX2::Mask<T> x3,
+          enable_if<SSE::is_mask<Return>::value &&
+                    AVX2::is_generic_mask_cast<T, typename Return::EntryType>::value &&
+                    AVX2::Mask<T>::Size * 4 <= Return::Size>)
+{
+    using M = SSE::Mask<
+        typename std::conditional<AVX2::Mask<T>::Size == 4, float, short>::type>;
+    return simd_cast<Return>(simd_cast<M>(x0), simd_cast<M>(x1), simd_cast<M>(x2),
+                             simd_cast<M>(x3));
+}
+
+// 1 SSE::Mask to/from 1 AVX2::Mask with 8-bit or 64-bit entries {{{2
+// An SSE::Mask<T> is the low half of an AVX2::Mask<T> with twice the entries. Therefore,
+// these casts need no dedicated implementation for every type combination.
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(SSE::Mask<T> k,
+          enable_if<AVX2::is_mask<Return>::value &&
+                    AVX2::is_generic_mask_cast<T, typename Return::EntryType>::value>)
+{
+    return {Detail::mask_cast<SSE::Mask<T>::Size * 2, Return::Size,
+                              typename Return::VectorTypeF>(AVX::zeroExtend(k.dataI()))};
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX2::Mask<T> k,
+          enable_if<SSE::is_mask<Return>::value &&
+                    AVX2::is_generic_mask_cast<T, typename Return::EntryType>::value>)
+{
+    return {AVX::lo128(
+        Detail::mask_cast<AVX2::Mask<T>::Size, Return::Size * 2, __m256>(k.dataI()))};
+}
+
 // 1 AVX2::Mask to 1 Scalar::Mask {{{2
 template <typename To, typename FromT>
 Vc_INTRINSIC Vc_CONST To
@@ -2629,6 +3625,16 @@ Vc_INTRINSIC Vc_CONST enable_if<(offset != 0 && SSE::is_vector<Return>::value &&
 // SSE to AVX2 {{{2
 Vc_SIMD_CAST_OFFSET(SSE:: short_v, AVX2::double_v, 1) { return simd_cast<AVX2::double_v>(simd_cast<SSE::int_v, 1>(x)); }
 Vc_SIMD_CAST_OFFSET(SSE::ushort_v, AVX2::double_v, 1) { return simd_cast<AVX2::double_v>(simd_cast<SSE::int_v, 1>(x)); }
+template <typename Return, int offset, typename T>
+Vc_INTRINSIC Vc_CONST enable_if<(offset != 0 && AVX2::is_vector<Return>::value &&
+                                 sizeof(T) == 1),
+                                Return>
+    simd_cast(SSE::Vector<T> x)
+{
+    constexpr int shift = offset * Return::Size;
+    static_assert(shift > 0 && shift < 16, "");
+    return simd_cast<Return>(SSE::Vector<T>(_mm_srli_si128(x.data(), shift)));
+}
 
 // Mask casts with offset {{{1
 // 1 AVX2::Mask to N AVX2::Mask {{{2
@@ -2676,11 +3682,32 @@ simd_cast(const AVX2::Mask<T> &k,
     tmp = _mm_unpackhi_epi8(tmp, tmp);
     return AVX::concat(_mm_unpacklo_epi16(tmp, tmp), _mm_unpackhi_epi16(tmp, tmp));
 }
+// 32 -> 4 (8-bit entries to double or 64-bit integer entries), offset can be 1 to 7
+template <typename Return, int offset, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(const AVX2::Mask<T> &k,
+          enable_if<(AVX2::is_mask<Return>::value && offset != 0 &&
+                     AVX2::Mask<T>::Size == Return::Size * 8)> = nullarg)
+{
+    const auto tmp = _mm_srli_si128(offset < 4 ? AVX::lo128(k.dataI()) : AVX::hi128(k.dataI()),
+                                    (offset % 4) * 4);
+    return {Detail::mask_cast<32, 4, typename Return::VectorTypeF>(AVX::zeroExtend(tmp))};
+}
 
 // 1 SSE::Mask to N AVX2::Mask {{{2
 Vc_SIMD_CAST_OFFSET(SSE:: short_m, AVX2::double_m, 1) { auto tmp = _mm_unpackhi_epi16(x.dataI(), x.dataI()); return AVX::concat(_mm_unpacklo_epi32(tmp, tmp), _mm_unpackhi_epi32(tmp, tmp)); }
 Vc_SIMD_CAST_OFFSET(SSE::ushort_m, AVX2::double_m, 1) { auto tmp = _mm_unpackhi_epi16(x.dataI(), x.dataI()); return AVX::concat(_mm_unpacklo_epi32(tmp, tmp), _mm_unpackhi_epi32(tmp, tmp)); }
 
+template <typename Return, int offset, typename T>
+Vc_INTRINSIC Vc_CONST enable_if<(offset != 0 && AVX2::is_mask<Return>::value &&
+                                 sizeof(T) == 1),
+                                Return>
+simd_cast(SSE::Mask<T> k)
+{
+    return simd_cast<Return>(SSE::Mask<T>(
+        SSE::sse_cast<__m128>(_mm_srli_si128(k.dataI(), offset * Return::Size))));
+}
+
 // AVX2 to SSE (Mask<T>) {{{2
 template <typename Return, int offset, typename T>
 Vc_INTRINSIC Vc_CONST enable_if<(offset != 0 && SSE::is_mask<Return>::value &&
@@ -39,6 +39,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define Vc_UINT_V_SIZE 8
 #define Vc_SHORT_V_SIZE 16
 #define Vc_USHORT_V_SIZE 16
+#define Vc_SCHAR_V_SIZE 32
+#define Vc_UCHAR_V_SIZE 32
+#define Vc_LLONG_V_SIZE 4
+#define Vc_ULLONG_V_SIZE 4
 #elif defined Vc_DEFAULT_IMPL_AVX
 #define Vc_DOUBLE_V_SIZE 4
 #define Vc_FLOAT_V_SIZE 8
@@ -46,6 +50,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define Vc_UINT_V_SIZE 4
 #define Vc_SHORT_V_SIZE 8
 #define Vc_USHORT_V_SIZE 8
+#define Vc_SCHAR_V_SIZE 16
+#define Vc_UCHAR_V_SIZE 16
+#define Vc_LLONG_V_SIZE 2
+#define Vc_ULLONG_V_SIZE 2
 #endif
 
 namespace Vc_VERSIONED_NAMESPACE
@@ -59,6 +67,8 @@ typedef Vector<int>               int_v;
 typedef Vector<unsigned int>     uint_v;
 typedef Vector<short>           short_v;
 typedef Vector<unsigned short> ushort_v;
+typedef Vector<signed char>     schar_v;
+typedef Vector<unsigned char>   uchar_v;
 
 template <typename T> using Mask = Vc::Mask<T, VectorAbi::Avx1Abi<T>>;
 typedef Mask<double>         double_m;
@@ -67,6 +77,8 @@ typedef Mask<int>               int_m;
 typedef Mask<unsigned int>     uint_m;
 typedef Mask<short>           short_m;
 typedef Mask<unsigned short> ushort_m;
+typedef Mask<signed char>     schar_m;
+typedef Mask<unsigned char>   uchar_m;
 
 template <typename T> struct Const;
 
@@ -85,6 +97,8 @@ using    int_v = Vector<   int>;
 using   uint_v = Vector<  uint>;
 using  short_v = Vector< short>;
 using ushort_v = Vector<ushort>;
+using  schar_v = Vector< schar>;
+using  uchar_v = Vector< uchar>;
 
 template <typename T> using Mask = Vc::Mask<T, VectorAbi::Avx>;
 using double_m = Mask<double>;
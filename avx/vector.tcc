@@ -44,6 +44,8 @@ Vc_INTRINSIC AVX2::   int_m operator==(AVX2::   int_v a, AVX2::   int_v b) { ret
 Vc_INTRINSIC AVX2::  uint_m operator==(AVX2::  uint_v a, AVX2::  uint_v b) { return AVX::cmpeq_epi32(a.data(), b.data()); }
 Vc_INTRINSIC AVX2:: short_m operator==(AVX2:: short_v a, AVX2:: short_v b) { return AVX::cmpeq_epi16(a.data(), b.data()); }
 Vc_INTRINSIC AVX2::ushort_m operator==(AVX2::ushort_v a, AVX2::ushort_v b) { return AVX::cmpeq_epi16(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: schar_m operator==(AVX2:: schar_v a, AVX2:: schar_v b) { return AVX::cmpeq_epi8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: uchar_m operator==(AVX2:: uchar_v a, AVX2:: uchar_v b) { return AVX::cmpeq_epi8(a.data(), b.data()); }
 
 Vc_INTRINSIC AVX2::double_m operator!=(AVX2::double_v a, AVX2::double_v b) { return AVX::cmpneq_pd(a.data(), b.data()); }
 Vc_INTRINSIC AVX2:: float_m operator!=(AVX2:: float_v a, AVX2:: float_v b) { return AVX::cmpneq_ps(a.data(), b.data()); }
@@ -51,6 +53,8 @@ Vc_INTRINSIC AVX2::   int_m operator!=(AVX2::   int_v a, AVX2::   int_v b) { ret
 Vc_INTRINSIC AVX2::  uint_m operator!=(AVX2::  uint_v a, AVX2::  uint_v b) { return not_(AVX::cmpeq_epi32(a.data(), b.data())); }
 Vc_INTRINSIC AVX2:: short_m operator!=(AVX2:: short_v a, AVX2:: short_v b) { return not_(AVX::cmpeq_epi16(a.data(), b.data())); }
 Vc_INTRINSIC AVX2::ushort_m operator!=(AVX2::ushort_v a, AVX2::ushort_v b) { return not_(AVX::cmpeq_epi16(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: schar_m operator!=(AVX2:: schar_v a, AVX2:: schar_v b) { return not_(AVX::cmpeq_epi8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: uchar_m operator!=(AVX2:: uchar_v a, AVX2:: uchar_v b) { return not_(AVX::cmpeq_epi8(a.data(), b.data())); }
 
 Vc_INTRINSIC AVX2::double_m operator>=(AVX2::double_v a, AVX2::double_v b) { return AVX::cmpnlt_pd(a.data(), b.data()); }
 Vc_INTRINSIC AVX2:: float_m operator>=(AVX2:: float_v a, AVX2:: float_v b) { return AVX::cmpnlt_ps(a.data(), b.data()); }
@@ -58,6 +62,8 @@ Vc_INTRINSIC AVX2::   int_m operator>=(AVX2::   int_v a, AVX2::   int_v b) { ret
 Vc_INTRINSIC AVX2::  uint_m operator>=(AVX2::  uint_v a, AVX2::  uint_v b) { return not_(AVX::cmplt_epu32(a.data(), b.data())); }
 Vc_INTRINSIC AVX2:: short_m operator>=(AVX2:: short_v a, AVX2:: short_v b) { return not_(AVX::cmplt_epi16(a.data(), b.data())); }
 Vc_INTRINSIC AVX2::ushort_m operator>=(AVX2::ushort_v a, AVX2::ushort_v b) { return not_(AVX::cmplt_epu16(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: schar_m operator>=(AVX2:: schar_v a, AVX2:: schar_v b) { return not_(AVX::cmplt_epi8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: uchar_m operator>=(AVX2:: uchar_v a, AVX2:: uchar_v b) { return not_(AVX::cmplt_epu8(a.data(), b.data())); }
 
 Vc_INTRINSIC AVX2::double_m operator<=(AVX2::double_v a, AVX2::double_v b) { return AVX::cmple_pd(a.data(), b.data()); }
 Vc_INTRINSIC AVX2:: float_m operator<=(AVX2:: float_v a, AVX2:: float_v b) { return AVX::cmple_ps(a.data(), b.data()); }
@@ -65,6 +71,8 @@ Vc_INTRINSIC AVX2::   int_m operator<=(AVX2::   int_v a, AVX2::   int_v b) { ret
 Vc_INTRINSIC AVX2::  uint_m operator<=(AVX2::  uint_v a, AVX2::  uint_v b) { return not_(AVX::cmpgt_epu32(a.data(), b.data())); }
 Vc_INTRINSIC AVX2:: short_m operator<=(AVX2:: short_v a, AVX2:: short_v b) { return not_(AVX::cmpgt_epi16(a.data(), b.data())); }
 Vc_INTRINSIC AVX2::ushort_m operator<=(AVX2::ushort_v a, AVX2::ushort_v b) { return not_(AVX::cmpgt_epu16(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: schar_m operator<=(AVX2:: schar_v a, AVX2:: schar_v b) { return not_(AVX::cmpgt_epi8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: uchar_m operator<=(AVX2:: uchar_v a, AVX2:: uchar_v b) { return not_(AVX::cmpgt_epu8(a.data(), b.data())); }
 
 Vc_INTRINSIC AVX2::double_m operator> (AVX2::double_v a, AVX2::double_v b) { return AVX::cmpgt_pd(a.data(), b.data()); }
 Vc_INTRINSIC AVX2:: float_m operator> (AVX2:: float_v a, AVX2:: float_v b) { return AVX::cmpgt_ps(a.data(), b.data()); }
@@ -72,6 +80,8 @@ Vc_INTRINSIC AVX2::   int_m operator> (AVX2::   int_v a, AVX2::   int_v b) { ret
 Vc_INTRINSIC AVX2::  uint_m operator> (AVX2::  uint_v a, AVX2::  uint_v b) { return AVX::cmpgt_epu32(a.data(), b.data()); }
 Vc_INTRINSIC AVX2:: short_m operator> (AVX2:: short_v a, AVX2:: short_v b) { return AVX::cmpgt_epi16(a.data(), b.data()); }
 Vc_INTRINSIC AVX2::ushort_m operator> (AVX2::ushort_v a, AVX2::ushort_v b) { return AVX::cmpgt_epu16(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: schar_m operator> (AVX2:: schar_v a, AVX2:: schar_v b) { return AVX::cmpgt_epi8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: uchar_m operator> (AVX2:: uchar_v a, AVX2:: uchar_v b) { return AVX::cmpgt_epu8(a.data(), b.data()); }
 
 Vc_INTRINSIC AVX2::double_m operator< (AVX2::double_v a, AVX2::double_v b) { return AVX::cmplt_pd(a.data(), b.data()); }
 Vc_INTRINSIC AVX2:: float_m operator< (AVX2:: float_v a, AVX2:: float_v b) { return AVX::cmplt_ps(a.data(), b.data()); }
@@ -79,6 +89,25 @@ Vc_INTRINSIC AVX2::   int_m operator< (AVX2::   int_v a, AVX2::   int_v b) { ret
 Vc_INTRINSIC AVX2::  uint_m operator< (AVX2::  uint_v a, AVX2::  uint_v b) { return AVX::cmplt_epu32(a.data(), b.data()); }
 Vc_INTRINSIC AVX2:: short_m operator< (AVX2:: short_v a, AVX2:: short_v b) { return AVX::cmplt_epi16(a.data(), b.data()); }
 Vc_INTRINSIC AVX2::ushort_m operator< (AVX2::ushort_v a, AVX2::ushort_v b) { return AVX::cmplt_epu16(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: schar_m operator< (AVX2:: schar_v a, AVX2:: schar_v b) { return AVX::cmplt_epi8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: uchar_m operator< (AVX2:: uchar_v a, AVX2:: uchar_v b) { return AVX::cmplt_epu8(a.data(), b.data()); }
+
+#ifdef Vc_IMPL_AVX2
+#define Vc_OP_(op_, fun_)                                                                \
+    template <typename T>                                                                \
+    Vc_INTRINSIC enable_if<is_int64<T>::value, AVX2::Mask<T>> operator op_(              \
+        AVX2::Vector<T> a, AVX2::Vector<T> b)                                            \
+    {                                                                                    \
+        return fun_(a.data(), b.data(), T());                                            \
+    }
+Vc_OP_(==, cmpeq)
+Vc_OP_(!=, cmpneq)
+Vc_OP_(>=, cmpge)
+Vc_OP_(<=, cmple)
+Vc_OP_(> , cmpgt)
+Vc_OP_(< , cmplt)
+#undef Vc_OP_
+#endif
 
 // bitwise operators {{{1
 template <typename T>
@@ -231,6 +260,40 @@ template <> template <typename G> Vc_INTRINSIC AVX2::ushort_v AVX2::ushort_v::ge
     const auto tmp15 = gen(15);
     return _mm256_setr_epi16(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9, tmp10, tmp11, tmp12, tmp13, tmp14, tmp15);
 }
+#define Vc_INT64_GENERATE_(T_)                                                           \
+    template <>                                                                          \
+    template <typename G>                                                                \
+    Vc_INTRINSIC AVX2::Vector<T_> AVX2::Vector<T_>::generate(G gen)                      \
+    {                                                                                    \
+        const auto tmp0 = gen(0);                                                        \
+        const auto tmp1 = gen(1);                                                        \
+        const auto tmp2 = gen(2);                                                        \
+        const auto tmp3 = gen(3);                                                        \
+        return _mm256_setr_epi64x(tmp0, tmp1, tmp2, tmp3);                               \
+    }
+Vc_INT64_GENERATE_(long long)
+Vc_INT64_GENERATE_(unsigned long long)
+#if defined __LP64__ || defined _LP64
+Vc_INT64_GENERATE_(long)
+Vc_INT64_GENERATE_(unsigned long)
+#endif
+#undef Vc_INT64_GENERATE_
+template <> template <typename G> Vc_INTRINSIC AVX2::schar_v AVX2::schar_v::generate(G gen)
+{
+    alignas(32) schar tmp[32];
+    for (int i = 0; i < 32; ++i) {
+        tmp[i] = gen(i);
+    }
+    return _mm256_load_si256(reinterpret_cast<const __m256i *>(tmp));
+}
+template <> template <typename G> Vc_INTRINSIC AVX2::uchar_v AVX2::uchar_v::generate(G gen)
+{
+    alignas(32) uchar tmp[32];
+    for (int i = 0; i < 32; ++i) {
+        tmp[i] = gen(i);
+    }
+    return _mm256_load_si256(reinterpret_cast<const __m256i *>(tmp));
+}
 #endif
 
 // constants {{{1
@@ -245,6 +308,12 @@ template <> Vc_INTRINSIC Vector< short, VectorAbi::Avx>::Vector(VectorSpecialIni
 template <> Vc_INTRINSIC Vector<ushort, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(AVX::setone_epu16()) {}
 template <> Vc_INTRINSIC Vector< schar, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(AVX::setone_epi8()) {}
 template <> Vc_INTRINSIC Vector< uchar, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(AVX::setone_epu8()) {}
+template <> Vc_INTRINSIC Vector<long long, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(_mm256_set1_epi64x(1)) {}
+template <> Vc_INTRINSIC Vector<unsigned long long, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(_mm256_set1_epi64x(1)) {}
+#if defined __LP64__ || defined _LP64
+template <> Vc_INTRINSIC Vector<long, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(_mm256_set1_epi64x(1)) {}
+template <> Vc_INTRINSIC Vector<unsigned long, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(_mm256_set1_epi64x(1)) {}
+#endif
 #endif
 
 template <typename T>
@@ -334,6 +403,22 @@ Vc_INTRINSIC void Vector<T, VectorAbi::Avx>::store(U *mem, Mask mask, Flags flag
     HV::template store<Flags>(mem, data(), AVX::avx_cast<VectorType>(mask.data()));
 }
 
+template <typename T>
+template <typename Flags, typename>
+Vc_INTRINSIC void Vector<T, VectorAbi::Avx>::store(half *mem, Flags flags) const
+{
+    static_assert(std::is_same<T, float>::value, "only float vectors convert to half");
+    Common::handleStorePrefetches(mem, flags);
+    const __m128i h = AVX::cvtps_ph(data());
+    if (Flags::IsStreaming) {
+        _mm_stream_si128(reinterpret_cast<__m128i *>(mem), h);
+    } else if (Flags::IsUnaligned) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(mem), h);
+    } else {
+        _mm_store_si128(reinterpret_cast<__m128i *>(mem), h);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////
 // integer ops {{{1
 #ifdef Vc_IMPL_AVX2
@@ -345,6 +430,31 @@ template <> Vc_ALWAYS_INLINE AVX2::Vector< short> Vector< short, VectorAbi::Avx>
 template <> Vc_ALWAYS_INLINE AVX2::Vector<ushort> Vector<ushort, VectorAbi::Avx>::operator<<(AsArg x) const { return generate([&](int i) { return get(*this, i) << get(x, i); }); }
 template <> Vc_ALWAYS_INLINE AVX2::Vector< short> Vector< short, VectorAbi::Avx>::operator>>(AsArg x) const { return generate([&](int i) { return get(*this, i) >> get(x, i); }); }
 template <> Vc_ALWAYS_INLINE AVX2::Vector<ushort> Vector<ushort, VectorAbi::Avx>::operator>>(AsArg x) const { return generate([&](int i) { return get(*this, i) >> get(x, i); }); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< schar> Vector< schar, VectorAbi::Avx>::operator<<(AsArg x) const { return generate([&](int i) { return get(*this, i) << get(x, i); }); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< uchar> Vector< uchar, VectorAbi::Avx>::operator<<(AsArg x) const { return generate([&](int i) { return get(*this, i) << get(x, i); }); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< schar> Vector< schar, VectorAbi::Avx>::operator>>(AsArg x) const { return generate([&](int i) { return get(*this, i) >> get(x, i); }); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< uchar> Vector< uchar, VectorAbi::Avx>::operator>>(AsArg x) const { return generate([&](int i) { return get(*this, i) >> get(x, i); }); }
+#define Vc_INT64_SHIFTS_(T_)                                                             \
+    template <>                                                                          \
+    Vc_ALWAYS_INLINE AVX2::Vector<T_> Vector<T_, VectorAbi::Avx>::operator<<(AsArg x)    \
+        const                                                                            \
+    {                                                                                    \
+        return _mm256_sllv_epi64(d.v(), x.d.v());                                        \
+    }                                                                                    \
+    template <>                                                                          \
+    Vc_ALWAYS_INLINE AVX2::Vector<T_> Vector<T_, VectorAbi::Avx>::operator>>(AsArg x)    \
+        const                                                                            \
+    {                                                                                    \
+        return std::is_signed<T_>::value ? AVX::srav_epi64(d.v(), x.d.v())               \
+                                         : _mm256_srlv_epi64(d.v(), x.d.v());            \
+    }
+Vc_INT64_SHIFTS_(long long)
+Vc_INT64_SHIFTS_(unsigned long long)
+#if defined __LP64__ || defined _LP64
+Vc_INT64_SHIFTS_(long)
+Vc_INT64_SHIFTS_(unsigned long)
+#endif
+#undef Vc_INT64_SHIFTS_
 template <typename T>
 Vc_ALWAYS_INLINE AVX2::Vector<T> &Vector<T, VectorAbi::Avx>::operator<<=(AsArg x)
 {
@@ -388,10 +498,227 @@ Vc_INTRINSIC Vc_CONST AVX2::double_m isnegative(AVX2::double_v x)
         AVX::avx_cast<__m256i>(_mm256_and_pd(AVX::setsignmask_pd(), x.data())))));
 }
 // gathers {{{1
+#ifdef Vc_HARDWARE_GATHERS
+namespace Detail
+{
+// gatherIndexes returns the index register of the gather instructions if the index object
+// holds one, and nullptr otherwise. hardwareGather returns false for all combinations of
+// memory and index types without a gather instruction, which then use the emulation.
+// The unmasked gathers use the masked instructions with a zero source to break the
+// dependency on the previous value of the register.
+// Four 64-bit indexes are wrapped in Indexes64 to tell them apart from eight 32-bit ones.
+// The instructions sign-extend 32-bit indexes. Therefore unsigned 32-bit indexes are
+// zero-extended to 64 bits, eight of them into the two halves of Indexes64x2.
+struct Indexes64 {
+    __m256i v;
+};
+struct Indexes64x2 {
+    __m256i lo, hi;
+};
+template <typename IT> Vc_INTRINSIC std::nullptr_t gatherIndexes(const IT &) { return nullptr; }
+Vc_INTRINSIC __m128i gatherIndexes(const SSE::int_v &i) { return i.data(); }
+Vc_INTRINSIC Indexes64 gatherIndexes(const SSE::uint_v &i)
+{
+    return {_mm256_cvtepu32_epi64(i.data())};
+}
+Vc_INTRINSIC __m256i gatherIndexes(const AVX2::int_v &i) { return i.data(); }
+Vc_INTRINSIC Indexes64x2 gatherIndexes(const AVX2::uint_v &i)
+{
+    return {_mm256_cvtepu32_epi64(AVX::lo128(i.data())),
+            _mm256_cvtepu32_epi64(AVX::hi128(i.data()))};
+}
+template <typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, Indexes64> gatherIndexes(const AVX2::Vector<T> &i)
+{
+    return {i.data()};
+}
+template <typename T, std::size_t N, typename V>
+Vc_INTRINSIC auto gatherIndexes(const SimdArray<T, N, V, N> &i)
+    -> decltype(gatherIndexes(internal_data(i)))
+{
+    return gatherIndexes(internal_data(i));
+}
+
+template <typename R, typename MT, typename I>
+Vc_INTRINSIC bool hardwareGather(R &, const MT *, I)
+{
+    return false;
+}
+Vc_INTRINSIC bool hardwareGather(__m256d &r, const double *mem, __m128i i)
+{
+    r = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), mem, i, AVX::setallone_pd(), 8);
+    return true;
+}
+Vc_INTRINSIC bool hardwareGather(__m256 &r, const float *mem, __m256i i)
+{
+    r = _mm256_mask_i32gather_ps(_mm256_setzero_ps(), mem, i, AVX::setallone_ps(), 4);
+    return true;
+}
+Vc_INTRINSIC bool hardwareGather(__m256i &r, const int *mem, __m256i i)
+{
+    r = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), mem, i,
+                                   AVX::setallone_si256(), 4);
+    return true;
+}
+Vc_INTRINSIC bool hardwareGather(__m256i &r, const uint *mem, __m256i i)
+{
+    r = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(),
+                                   reinterpret_cast<const int *>(mem), i,
+                                   AVX::setallone_si256(), 4);
+    return true;
+}
+Vc_INTRINSIC bool hardwareGather(__m256d &r, const double *mem, Indexes64 i)
+{
+    r = _mm256_mask_i64gather_pd(_mm256_setzero_pd(), mem, i.v, AVX::setallone_pd(), 8);
+    return true;
+}
+template <typename MT>
+Vc_INTRINSIC enable_if<is_int64<MT>::value, bool> hardwareGather(__m256i &r, const MT *mem,
+                                                                 __m128i i)
+{
+    r = _mm256_mask_i32gather_epi64(_mm256_setzero_si256(),
+                                   reinterpret_cast<const long long *>(mem), i,
+                                   AVX::setallone_si256(), 8);
+    return true;
+}
+template <typename MT>
+Vc_INTRINSIC enable_if<is_int64<MT>::value, bool> hardwareGather(__m256i &r, const MT *mem,
+                                                                 Indexes64 i)
+{
+    r = _mm256_mask_i64gather_epi64(_mm256_setzero_si256(),
+                                   reinterpret_cast<const long long *>(mem), i.v,
+                                   AVX::setallone_si256(), 8);
+    return true;
+}
+Vc_INTRINSIC bool hardwareGather(__m256 &r, const float *mem, Indexes64x2 i)
+{
+    r = AVX::concat(
+        _mm256_mask_i64gather_ps(_mm_setzero_ps(), mem, i.lo, AVX::_mm_setallone_ps(), 4),
+        _mm256_mask_i64gather_ps(_mm_setzero_ps(), mem, i.hi, AVX::_mm_setallone_ps(), 4));
+    return true;
+}
+template <typename MT>
+Vc_INTRINSIC enable_if<(std::is_same<MT, int>::value || std::is_same<MT, uint>::value), bool>
+hardwareGather(__m256i &r, const MT *mem, Indexes64x2 i)
+{
+    const int *m = reinterpret_cast<const int *>(mem);
+    r = AVX::concat(_mm256_mask_i64gather_epi32(_mm_setzero_si128(), m, i.lo,
+                                                AVX::_mm_setallone_si128(), 4),
+                    _mm256_mask_i64gather_epi32(_mm_setzero_si128(), m, i.hi,
+                                                AVX::_mm_setallone_si128(), 4));
+    return true;
+}
+
+// the masked gathers leave the inactive entries of r unchanged and return false if the
+// policy in Common::HardwareGatherThreshold selects the emulation
+template <typename R, typename MT, typename I, typename M>
+Vc_INTRINSIC bool hardwareGather(R &, const MT *, I, const M &)
+{
+    return false;
+}
+template <typename M>
+Vc_INTRINSIC bool hardwareGather(__m256d &r, const double *mem, __m128i i, const M &k)
+{
+    if (!Common::useHardwareGather<double>(k)) {
+        return false;
+    }
+    r = _mm256_mask_i32gather_pd(r, mem, i, k.dataD(), 8);
+    return true;
+}
+template <typename M>
+Vc_INTRINSIC bool hardwareGather(__m256 &r, const float *mem, __m256i i, const M &k)
+{
+    if (!Common::useHardwareGather<float>(k)) {
+        return false;
+    }
+    r = _mm256_mask_i32gather_ps(r, mem, i, k.data(), 4);
+    return true;
+}
+template <typename M>
+Vc_INTRINSIC bool hardwareGather(__m256i &r, const int *mem, __m256i i, const M &k)
+{
+    if (!Common::useHardwareGather<int>(k)) {
+        return false;
+    }
+    r = _mm256_mask_i32gather_epi32(r, mem, i, k.dataI(), 4);
+    return true;
+}
+template <typename M>
+Vc_INTRINSIC bool hardwareGather(__m256i &r, const uint *mem, __m256i i, const M &k)
+{
+    if (!Common::useHardwareGather<uint>(k)) {
+        return false;
+    }
+    r = _mm256_mask_i32gather_epi32(r, reinterpret_cast<const int *>(mem), i, k.dataI(), 4);
+    return true;
+}
+template <typename M>
+Vc_INTRINSIC bool hardwareGather(__m256d &r, const double *mem, Indexes64 i, const M &k)
+{
+    if (!Common::useHardwareGather<double>(k)) {
+        return false;
+    }
+    r = _mm256_mask_i64gather_pd(r, mem, i.v, k.dataD(), 8);
+    return true;
+}
+template <typename MT, typename M>
+Vc_INTRINSIC enable_if<is_int64<MT>::value, bool> hardwareGather(__m256i &r, const MT *mem,
+                                                                 __m128i i, const M &k)
+{
+    if (!Common::useHardwareGather<MT>(k)) {
+        return false;
+    }
+    r = _mm256_mask_i32gather_epi64(r, reinterpret_cast<const long long *>(mem), i,
+                                   k.dataI(), 8);
+    return true;
+}
+template <typename MT, typename M>
+Vc_INTRINSIC enable_if<is_int64<MT>::value, bool> hardwareGather(__m256i &r, const MT *mem,
+                                                                 Indexes64 i, const M &k)
+{
+    if (!Common::useHardwareGather<MT>(k)) {
+        return false;
+    }
+    r = _mm256_mask_i64gather_epi64(r, reinterpret_cast<const long long *>(mem), i.v,
+                                   k.dataI(), 8);
+    return true;
+}
+template <typename M>
+Vc_INTRINSIC bool hardwareGather(__m256 &r, const float *mem, Indexes64x2 i, const M &k)
+{
+    if (!Common::useHardwareGather<float>(k)) {
+        return false;
+    }
+    r = AVX::concat(
+        _mm256_mask_i64gather_ps(AVX::lo128(r), mem, i.lo, AVX::lo128(k.data()), 4),
+        _mm256_mask_i64gather_ps(AVX::hi128(r), mem, i.hi, AVX::hi128(k.data()), 4));
+    return true;
+}
+template <typename MT, typename M>
+Vc_INTRINSIC enable_if<(std::is_same<MT, int>::value || std::is_same<MT, uint>::value), bool>
+hardwareGather(__m256i &r, const MT *mem, Indexes64x2 i, const M &k)
+{
+    if (!Common::useHardwareGather<MT>(k)) {
+        return false;
+    }
+    const int *m = reinterpret_cast<const int *>(mem);
+    r = AVX::concat(
+        _mm256_mask_i64gather_epi32(AVX::lo128(r), m, i.lo, AVX::lo128(k.dataI()), 4),
+        _mm256_mask_i64gather_epi32(AVX::hi128(r), m, i.hi, AVX::hi128(k.dataI()), 4));
+    return true;
+}
+}  // namespace Detail
+#endif  // Vc_HARDWARE_GATHERS
+
 template <>
 template <typename MT, typename IT>
 inline void AVX2::double_v::gatherImplementation(const MT *mem, IT &&indexes)
 {
+#ifdef Vc_HARDWARE_GATHERS
+    if (Detail::hardwareGather(d.v(), mem, Detail::gatherIndexes(indexes))) {
+        return;
+    }
+#endif
     d.v() = _mm256_setr_pd(mem[indexes[0]], mem[indexes[1]], mem[indexes[2]], mem[indexes[3]]);
 }
 
@@ -399,6 +726,11 @@ template <>
 template <typename MT, typename IT>
 inline void AVX2::float_v::gatherImplementation(const MT *mem, IT &&indexes)
 {
+#ifdef Vc_HARDWARE_GATHERS
+    if (Detail::hardwareGather(d.v(), mem, Detail::gatherIndexes(indexes))) {
+        return;
+    }
+#endif
     d.v() = _mm256_setr_ps(mem[indexes[0]],
                            mem[indexes[1]],
                            mem[indexes[2]],
@@ -414,6 +746,11 @@ template <>
 template <typename MT, typename IT>
 inline void AVX2::int_v::gatherImplementation(const MT *mem, IT &&indexes)
 {
+#ifdef Vc_HARDWARE_GATHERS
+    if (Detail::hardwareGather(d.v(), mem, Detail::gatherIndexes(indexes))) {
+        return;
+    }
+#endif
     d.v() = _mm256_setr_epi32(mem[indexes[0]], mem[indexes[1]], mem[indexes[2]],
                               mem[indexes[3]], mem[indexes[4]], mem[indexes[5]],
                               mem[indexes[6]], mem[indexes[7]]);
@@ -423,11 +760,54 @@ template <>
 template <typename MT, typename IT>
 inline void AVX2::uint_v::gatherImplementation(const MT *mem, IT &&indexes)
 {
+#ifdef Vc_HARDWARE_GATHERS
+    if (Detail::hardwareGather(d.v(), mem, Detail::gatherIndexes(indexes))) {
+        return;
+    }
+#endif
     d.v() = _mm256_setr_epi32(mem[indexes[0]], mem[indexes[1]], mem[indexes[2]],
                               mem[indexes[3]], mem[indexes[4]], mem[indexes[5]],
                               mem[indexes[6]], mem[indexes[7]]);
 }
 
+#define Vc_INT64_GATHER_(T_)                                                             \
+    template <>                                                                          \
+    template <typename MT, typename IT>                                                  \
+    inline void AVX2::Vector<T_>::gatherImplementation(const MT *mem, IT &&indexes)      \
+    {                                                                                    \
+        Vc_INT64_HARDWARE_GATHER_                                                        \
+        d.v() = _mm256_setr_epi64x(mem[indexes[0]], mem[indexes[1]], mem[indexes[2]],    \
+                                   mem[indexes[3]]);                                     \
+    }
+#ifdef Vc_HARDWARE_GATHERS
+#define Vc_INT64_HARDWARE_GATHER_                                                        \
+    if (Detail::hardwareGather(d.v(), mem, Detail::gatherIndexes(indexes))) {            \
+        return;                                                                          \
+    }
+#else
+#define Vc_INT64_HARDWARE_GATHER_
+#endif
+Vc_INT64_GATHER_(long long)
+Vc_INT64_GATHER_(unsigned long long)
+#if defined __LP64__ || defined _LP64
+Vc_INT64_GATHER_(long)
+Vc_INT64_GATHER_(unsigned long)
+#endif
+#undef Vc_INT64_GATHER_
+#undef Vc_INT64_HARDWARE_GATHER_
+
+#define Vc_INT8_GATHER_(T_)                                                              \
+    template <>                                                                          \
+    template <typename MT, typename IT>                                                  \
+    inline void AVX2::Vector<T_>::gatherImplementation(const MT *mem, IT &&indexes)      \
+    {                                                                                    \
+        Common::unrolled_loop<std::size_t, 0, Size>(                                     \
+            [&](std::size_t i) { d.set(i, mem[indexes[i]]); });                          \
+    }
+Vc_INT8_GATHER_(signed char)
+Vc_INT8_GATHER_(unsigned char)
+#undef Vc_INT8_GATHER_
+
 template <>
 template <typename MT, typename IT>
 inline void AVX2::short_v::gatherImplementation(const MT *mem, IT &&indexes)
@@ -469,6 +849,11 @@ inline void Vector<T, VectorAbi::Avx>::gatherImplementation(const MT *mem, IT &&
               Common::GatherScatterImplementation::SimpleLoop
 #endif
                                                 > ;
+#ifdef Vc_HARDWARE_GATHERS
+    if (Detail::hardwareGather(d.v(), mem, Detail::gatherIndexes(indexes), mask)) {
+        return;
+    }
+#endif
     Common::executeGather(Selector(), *this, mem, std::forward<IT>(indexes), mask);
 }
 
@@ -558,7 +943,7 @@ template <> Vc_INTRINSIC std::pair<AVX2::float_v, int> AVX2::float_v::minIndex()
 
     // 28 cycles Latency:
     __m256 x = d.v();
-    __m256 idx = Vector<float>::IndexesFromZero().data();
+    __m256 idx = AVX2::float_v::IndexesFromZero().data();
     __m256 y = Mem::permute128<X1, X0>(x);
     __m256 idy = Mem::permute128<X1, X0>(idx);
     __m256 less = AVX::cmplt_ps(x, y);
@@ -679,62 +1064,9 @@ Vc_INTRINSIC Vc_CONST AVX2::double_v exponent(AVX2::double_v x)
 }
 // }}}1
 // Random {{{1
-static Vc_ALWAYS_INLINE __m256i _doRandomStep()
-{
-    using Detail::operator*;
-    using Detail::operator+;
-#ifdef Vc_IMPL_AVX2
-    using AVX2::uint_v;
-    uint_v state0(&Common::RandomState[0]);
-    uint_v state1(&Common::RandomState[uint_v::Size]);
-    (state1 * uint_v(0xdeece66du) + uint_v(11)).store(&Common::RandomState[uint_v::Size]);
-    uint_v(Detail::xor_((state0 * uint_v(0xdeece66du) + uint_v(11)).data(),
-                        _mm256_srli_epi32(state1.data(), 16)))
-        .store(&Common::RandomState[0]);
-    return state0.data();
-#else
-    using SSE::uint_v;
-    uint_v state0(&Common::RandomState[0]);
-    uint_v state1(&Common::RandomState[uint_v::Size]);
-    uint_v state2(&Common::RandomState[2 * uint_v::Size]);
-    uint_v state3(&Common::RandomState[3 * uint_v::Size]);
-    (state2 * uint_v(0xdeece66du) + uint_v(11))
-        .store(&Common::RandomState[2 * uint_v::Size]);
-    (state3 * uint_v(0xdeece66du) + uint_v(11))
-        .store(&Common::RandomState[3 * uint_v::Size]);
-    uint_v(Detail::xor_((state0 * uint_v(0xdeece66du) + uint_v(11)).data(),
-                        _mm_srli_epi32(state2.data(), 16)))
-        .store(&Common::RandomState[0]);
-    uint_v(Detail::xor_((state1 * uint_v(0xdeece66du) + uint_v(11)).data(),
-                        _mm_srli_epi32(state3.data(), 16)))
-        .store(&Common::RandomState[uint_v::Size]);
-    return AVX::concat(state0.data(), state1.data());
-#endif
-}
-
-#ifdef Vc_IMPL_AVX2
 template<typename T> Vc_ALWAYS_INLINE AVX2::Vector<T> Vector<T, VectorAbi::Avx>::Random()
 {
-    return {_doRandomStep()};
-}
-#endif
-
-template <> Vc_ALWAYS_INLINE AVX2::float_v AVX2::float_v::Random()
-{
-    return HT::sub(Detail::or_(_cast(AVX::srli_epi32<2>(_doRandomStep())), HT::one()),
-                   HT::one());
-}
-
-template<> Vc_ALWAYS_INLINE AVX2::double_v AVX2::double_v::Random()
-{
-    const __m256i state = Detail::load(&Common::RandomState[0], Vc::Aligned,
-                                       Detail::LoadTag<__m256i, int>());
-    for (size_t k = 0; k < 8; k += 2) {
-        typedef unsigned long long uint64 Vc_MAY_ALIAS;
-        const uint64 stateX = *reinterpret_cast<const uint64 *>(&Common::RandomState[k]);
-        *reinterpret_cast<uint64 *>(&Common::RandomState[k]) = (stateX * 0x5deece66dull + 11);
-    }
-    return HT::sub(Detail::or_(_cast(AVX::srli_epi64<12>(state)), HT::one()), HT::one());
+    return Common::randomVector<Vector>();
 }
 // }}}1
 // shifted / rotated {{{1
@@ -836,6 +1168,44 @@ template <> Vc_INTRINSIC AVX2::ushort_v AVX2::ushort_v::interleaveHigh(AVX2::ush
     return Mem::shuffle128<X1, Y1>(_mm256_unpacklo_epi16(data(), x.data()),
                                    _mm256_unpackhi_epi16(data(), x.data()));
 }
+template <> Vc_INTRINSIC  AVX2::schar_v  AVX2::schar_v::interleaveLow ( AVX2::schar_v x) const {
+    return Mem::shuffle128<X0, Y0>(_mm256_unpacklo_epi8(data(), x.data()),
+                                   _mm256_unpackhi_epi8(data(), x.data()));
+}
+template <> Vc_INTRINSIC  AVX2::schar_v  AVX2::schar_v::interleaveHigh( AVX2::schar_v x) const {
+    return Mem::shuffle128<X1, Y1>(_mm256_unpacklo_epi8(data(), x.data()),
+                                   _mm256_unpackhi_epi8(data(), x.data()));
+}
+template <> Vc_INTRINSIC  AVX2::uchar_v  AVX2::uchar_v::interleaveLow ( AVX2::uchar_v x) const {
+    return Mem::shuffle128<X0, Y0>(_mm256_unpacklo_epi8(data(), x.data()),
+                                   _mm256_unpackhi_epi8(data(), x.data()));
+}
+template <> Vc_INTRINSIC  AVX2::uchar_v  AVX2::uchar_v::interleaveHigh( AVX2::uchar_v x) const {
+    return Mem::shuffle128<X1, Y1>(_mm256_unpacklo_epi8(data(), x.data()),
+                                   _mm256_unpackhi_epi8(data(), x.data()));
+}
+#define Vc_INT64_INTERLEAVE_(T_)                                                         \
+    template <>                                                                          \
+    Vc_INTRINSIC AVX2::Vector<T_> AVX2::Vector<T_>::interleaveLow(AVX2::Vector<T_> x)    \
+        const                                                                            \
+    {                                                                                    \
+        return Mem::shuffle128<X0, Y0>(_mm256_unpacklo_epi64(data(), x.data()),          \
+                                       _mm256_unpackhi_epi64(data(), x.data()));         \
+    }                                                                                    \
+    template <>                                                                          \
+    Vc_INTRINSIC AVX2::Vector<T_> AVX2::Vector<T_>::interleaveHigh(AVX2::Vector<T_> x)   \
+        const                                                                            \
+    {                                                                                    \
+        return Mem::shuffle128<X1, Y1>(_mm256_unpacklo_epi64(data(), x.data()),          \
+                                       _mm256_unpackhi_epi64(data(), x.data()));         \
+    }
+Vc_INT64_INTERLEAVE_(long long)
+Vc_INT64_INTERLEAVE_(unsigned long long)
+#if defined __LP64__ || defined _LP64
+Vc_INT64_INTERLEAVE_(long)
+Vc_INT64_INTERLEAVE_(unsigned long)
+#endif
+#undef Vc_INT64_INTERLEAVE_
 #endif
 // permutation via operator[] {{{1
 template <> Vc_INTRINSIC Vc_PURE AVX2::double_v AVX2::double_v::operator[](Permutation::ReversedTag) const
@@ -873,6 +1243,36 @@ Vc_INTRINSIC Vc_PURE AVX2::ushort_v AVX2::ushort_v::operator[](
         AVX::avx_cast<__m256d>(Mem::permuteHi<X7, X6, X5, X4>(d.v())),
         AVX::avx_cast<__m256d>(Mem::permuteLo<X3, X2, X1, X0>(d.v())))));
 }
+template <>
+Vc_INTRINSIC Vc_PURE AVX2::schar_v AVX2::schar_v::operator[](
+    Permutation::ReversedTag) const
+{
+    return Mem::permute128<X1, X0>(_mm256_shuffle_epi8(
+        d.v(), _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14,
+                                13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)));
+}
+template <>
+Vc_INTRINSIC Vc_PURE AVX2::uchar_v AVX2::uchar_v::operator[](
+    Permutation::ReversedTag) const
+{
+    return Mem::permute128<X1, X0>(_mm256_shuffle_epi8(
+        d.v(), _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14,
+                                13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)));
+}
+#define Vc_INT64_REVERSED_(T_)                                                           \
+    template <>                                                                          \
+    Vc_INTRINSIC Vc_PURE AVX2::Vector<T_> AVX2::Vector<T_>::operator[](                  \
+        Permutation::ReversedTag) const                                                  \
+    {                                                                                    \
+        return _mm256_permute4x64_epi64(d.v(), 0x1b);                                    \
+    }
+Vc_INT64_REVERSED_(long long)
+Vc_INT64_REVERSED_(unsigned long long)
+#if defined __LP64__ || defined _LP64
+Vc_INT64_REVERSED_(long)
+Vc_INT64_REVERSED_(unsigned long)
+#endif
+#undef Vc_INT64_REVERSED_
 #endif
 template <> Vc_INTRINSIC AVX2::float_v Vector<float, VectorAbi::Avx>::operator[](const IndexType &/*perm*/) const
 {
@@ -0,0 +1,390 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_AVX512_DETAIL_H_
+#define VC_AVX512_DETAIL_H_
+
+#include "../avx/detail.h"
+#include "intrinsics.h"
+#include "types.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// (converting) load functions {{{1
+template <typename Flags>
+Vc_INTRINSIC Vc_PURE __m512 load(const float *x, Flags, LoadTag<__m512, float>,
+                                 typename Flags::EnableIfAligned = nullptr)
+{
+    return _mm512_load_ps(x);
+}
+template <typename Flags>
+Vc_INTRINSIC Vc_PURE __m512 load(const float *x, Flags, LoadTag<__m512, float>,
+                                 typename Flags::EnableIfUnaligned = nullptr)
+{
+    return _mm512_loadu_ps(x);
+}
+template <typename Flags>
+Vc_INTRINSIC Vc_PURE __m512 load(const float *x, Flags, LoadTag<__m512, float>,
+                                 typename Flags::EnableIfStreaming = nullptr)
+{
+    return _mm512_castsi512_ps(_mm512_stream_load_si512(const_cast<float *>(x)));
+}
+
+template <typename Flags>
+Vc_INTRINSIC Vc_PURE __m512d load(const double *x, Flags, LoadTag<__m512d, double>,
+                                  typename Flags::EnableIfAligned = nullptr)
+{
+    return _mm512_load_pd(x);
+}
+template <typename Flags>
+Vc_INTRINSIC Vc_PURE __m512d load(const double *x, Flags, LoadTag<__m512d, double>,
+                                  typename Flags::EnableIfUnaligned = nullptr)
+{
+    return _mm512_loadu_pd(x);
+}
+template <typename Flags>
+Vc_INTRINSIC Vc_PURE __m512d load(const double *x, Flags, LoadTag<__m512d, double>,
+                                  typename Flags::EnableIfStreaming = nullptr)
+{
+    return _mm512_castsi512_pd(_mm512_stream_load_si512(const_cast<double *>(x)));
+}
+
+template <typename Flags, typename T, typename = enable_if<std::is_integral<T>::value>>
+Vc_INTRINSIC Vc_PURE __m512i
+load(const T *x, Flags, LoadTag<__m512i, T>, typename Flags::EnableIfAligned = nullptr)
+{
+    return _mm512_load_si512(x);
+}
+template <typename Flags, typename T, typename = enable_if<std::is_integral<T>::value>>
+Vc_INTRINSIC Vc_PURE __m512i
+load(const T *x, Flags, LoadTag<__m512i, T>, typename Flags::EnableIfUnaligned = nullptr)
+{
+    return _mm512_loadu_si512(x);
+}
+template <typename Flags, typename T, typename = enable_if<std::is_integral<T>::value>>
+Vc_INTRINSIC Vc_PURE __m512i
+load(const T *x, Flags, LoadTag<__m512i, T>, typename Flags::EnableIfStreaming = nullptr)
+{
+    return _mm512_stream_load_si512(const_cast<T *>(x));
+}
+
+// the converting loads combine two converting AVX loads{{{2
+template <typename SrcT, typename Flags, typename DstT,
+          typename = enable_if<!std::is_same<SrcT, DstT>::value>>
+Vc_INTRINSIC __m512 load(const SrcT *mem, Flags, LoadTag<__m512, DstT>)
+{
+    return AVX512::concat(load<__m256, float>(mem, Vc::Unaligned),
+                          load<__m256, float>(mem + 8, Vc::Unaligned));
+}
+template <typename SrcT, typename Flags, typename DstT,
+          typename = enable_if<!std::is_same<SrcT, DstT>::value>>
+Vc_INTRINSIC __m512d load(const SrcT *mem, Flags, LoadTag<__m512d, DstT>)
+{
+    return AVX512::concat(load<__m256d, double>(mem, Vc::Unaligned),
+                          load<__m256d, double>(mem + 4, Vc::Unaligned));
+}
+template <typename SrcT, typename Flags, typename DstT,
+          typename = enable_if<!std::is_same<SrcT, DstT>::value>>
+Vc_INTRINSIC __m512i load(const SrcT *mem, Flags, LoadTag<__m512i, DstT>)
+{
+    return AVX512::concat(load<__m256i, DstT>(mem, Vc::Unaligned),
+                          load<__m256i, DstT>(mem + 8, Vc::Unaligned));
+}
+template <typename Flags>
+Vc_INTRINSIC __m512 load(const half *mem, Flags, LoadTag<__m512, float>)
+{
+    return _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(mem)));
+}
+
+// allone{{{1
+template<> Vc_INTRINSIC Vc_CONST __m512  allone<__m512 >() { return AVX512::setallone_ps(); }
+template<> Vc_INTRINSIC Vc_CONST __m512i allone<__m512i>() { return AVX512::setallone_si512(); }
+template<> Vc_INTRINSIC Vc_CONST __m512d allone<__m512d>() { return AVX512::setallone_pd(); }
+
+// zero{{{1
+template<> Vc_INTRINSIC Vc_CONST __m512  zero<__m512 >() { return _mm512_setzero_ps(); }
+template<> Vc_INTRINSIC Vc_CONST __m512i zero<__m512i>() { return _mm512_setzero_si512(); }
+template<> Vc_INTRINSIC Vc_CONST __m512d zero<__m512d>() { return _mm512_setzero_pd(); }
+
+// avx512_broadcast{{{1
+Vc_INTRINSIC __m512  avx512_broadcast( float x) { return _mm512_set1_ps(x); }
+Vc_INTRINSIC __m512d avx512_broadcast(double x) { return _mm512_set1_pd(x); }
+Vc_INTRINSIC __m512i avx512_broadcast(   int x) { return _mm512_set1_epi32(x); }
+Vc_INTRINSIC __m512i avx512_broadcast(  uint x) { return _mm512_set1_epi32(x); }
+
+// negate{{{1
+Vc_ALWAYS_INLINE Vc_CONST __m512 negate(__m512 v, std::integral_constant<std::size_t, 4>)
+{
+    return _mm512_xor_ps(v, AVX512::setsignmask_ps());
+}
+Vc_ALWAYS_INLINE Vc_CONST __m512d negate(__m512d v, std::integral_constant<std::size_t, 8>)
+{
+    return _mm512_xor_pd(v, AVX512::setsignmask_pd());
+}
+Vc_ALWAYS_INLINE Vc_CONST __m512i negate(__m512i v, std::integral_constant<std::size_t, 4>)
+{
+    return _mm512_sub_epi32(_mm512_setzero_si512(), v);
+}
+
+// xor_ / or_ / and_ / andnot_ / not_{{{1
+Vc_INTRINSIC __m512  xor_(__m512  a, __m512  b) { return _mm512_xor_ps(a, b); }
+Vc_INTRINSIC __m512d xor_(__m512d a, __m512d b) { return _mm512_xor_pd(a, b); }
+Vc_INTRINSIC __m512i xor_(__m512i a, __m512i b) { return _mm512_xor_si512(a, b); }
+Vc_INTRINSIC __m512  or_(__m512  a, __m512  b) { return _mm512_or_ps(a, b); }
+Vc_INTRINSIC __m512d or_(__m512d a, __m512d b) { return _mm512_or_pd(a, b); }
+Vc_INTRINSIC __m512i or_(__m512i a, __m512i b) { return _mm512_or_si512(a, b); }
+Vc_INTRINSIC __m512  and_(__m512  a, __m512  b) { return _mm512_and_ps(a, b); }
+Vc_INTRINSIC __m512d and_(__m512d a, __m512d b) { return _mm512_and_pd(a, b); }
+Vc_INTRINSIC __m512i and_(__m512i a, __m512i b) { return _mm512_and_si512(a, b); }
+Vc_INTRINSIC __m512  andnot_(__m512  a, __m512  b) { return _mm512_andnot_ps(a, b); }
+Vc_INTRINSIC __m512d andnot_(__m512d a, __m512d b) { return _mm512_andnot_pd(a, b); }
+Vc_INTRINSIC __m512i andnot_(__m512i a, __m512i b) { return _mm512_andnot_si512(a, b); }
+Vc_INTRINSIC __m512  not_(__m512  a) { return andnot_(a, allone<__m512 >()); }
+Vc_INTRINSIC __m512d not_(__m512d a) { return andnot_(a, allone<__m512d>()); }
+Vc_INTRINSIC __m512i not_(__m512i a) { return andnot_(a, allone<__m512i>()); }
+
+// blend{{{1
+// selects b where the bit in k is set and a otherwise
+Vc_INTRINSIC __m512  blend(__m512  a, __m512  b, __mmask16 k) { return _mm512_mask_blend_ps(k, a, b); }
+Vc_INTRINSIC __m512d blend(__m512d a, __m512d b, __mmask8  k) { return _mm512_mask_blend_pd(k, a, b); }
+Vc_INTRINSIC __m512i blend(__m512i a, __m512i b, __mmask16 k) { return _mm512_mask_blend_epi32(k, a, b); }
+
+// abs{{{1
+Vc_INTRINSIC __m512  abs(__m512  a,  float) { return and_(a, AVX512::setabsmask_ps()); }
+Vc_INTRINSIC __m512d abs(__m512d a, double) { return and_(a, AVX512::setabsmask_pd()); }
+Vc_INTRINSIC __m512i abs(__m512i a,    int) { return _mm512_abs_epi32(a); }
+Vc_INTRINSIC __m512i abs(__m512i a,   uint) { return a; }
+
+// add / sub / mul{{{1
+Vc_INTRINSIC __m512  add(__m512  a, __m512  b,  float) { return _mm512_add_ps(a, b); }
+Vc_INTRINSIC __m512d add(__m512d a, __m512d b, double) { return _mm512_add_pd(a, b); }
+Vc_INTRINSIC __m512i add(__m512i a, __m512i b,    int) { return _mm512_add_epi32(a, b); }
+Vc_INTRINSIC __m512i add(__m512i a, __m512i b,   uint) { return _mm512_add_epi32(a, b); }
+
+Vc_INTRINSIC __m512  sub(__m512  a, __m512  b,  float) { return _mm512_sub_ps(a, b); }
+Vc_INTRINSIC __m512d sub(__m512d a, __m512d b, double) { return _mm512_sub_pd(a, b); }
+Vc_INTRINSIC __m512i sub(__m512i a, __m512i b,    int) { return _mm512_sub_epi32(a, b); }
+Vc_INTRINSIC __m512i sub(__m512i a, __m512i b,   uint) { return _mm512_sub_epi32(a, b); }
+
+Vc_INTRINSIC __m512  mul(__m512  a, __m512  b,  float) { return _mm512_mul_ps(a, b); }
+Vc_INTRINSIC __m512d mul(__m512d a, __m512d b, double) { return _mm512_mul_pd(a, b); }
+Vc_INTRINSIC __m512i mul(__m512i a, __m512i b,    int) { return _mm512_mullo_epi32(a, b); }
+Vc_INTRINSIC __m512i mul(__m512i a, __m512i b,   uint) { return _mm512_mullo_epi32(a, b); }
+
+// mulhi{{{1
+// the high half of the double-width products (for Vc::divider)
+Vc_INTRINSIC __m512i mulhi(__m512i a, __m512i b,    int) {
+    const __m512i ab02 = _mm512_srli_epi64(_mm512_mul_epi32(a, b), 32);
+    const __m512i ab13 = _mm512_mul_epi32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32));
+    return _mm512_mask_blend_epi32(0xaaaa, ab02, ab13);
+}
+Vc_INTRINSIC __m512i mulhi(__m512i a, __m512i b,   uint) {
+    const __m512i ab02 = _mm512_srli_epi64(_mm512_mul_epu32(a, b), 32);
+    const __m512i ab13 = _mm512_mul_epu32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32));
+    return _mm512_mask_blend_epi32(0xaaaa, ab02, ab13);
+}
+
+// div{{{1
+Vc_INTRINSIC __m512  div(__m512  a, __m512  b,  float) { return _mm512_div_ps(a, b); }
+Vc_INTRINSIC __m512d div(__m512d a, __m512d b, double) { return _mm512_div_pd(a, b); }
+// there is no integer division instruction: the AVX implementations convert to double
+template <typename T>
+Vc_INTRINSIC enable_if<(std::is_same<T, int>::value || std::is_same<T, uint>::value),
+                       __m512i>
+div(__m512i a, __m512i b, T)
+{
+    using namespace AVX512;
+    return concat(div(lo256(a), lo256(b), T()), div(hi256(a), hi256(b), T()));
+}
+
+// horizontal add / mul / min / max{{{1
+Vc_INTRINSIC  float add(__m512  a,  float) { return _mm512_reduce_add_ps(a); }
+Vc_INTRINSIC double add(__m512d a, double) { return _mm512_reduce_add_pd(a); }
+Vc_INTRINSIC    int add(__m512i a,    int) { return _mm512_reduce_add_epi32(a); }
+Vc_INTRINSIC   uint add(__m512i a,   uint) { return _mm512_reduce_add_epi32(a); }
+
+Vc_INTRINSIC  float mul(__m512  a,  float) { return _mm512_reduce_mul_ps(a); }
+Vc_INTRINSIC double mul(__m512d a, double) { return _mm512_reduce_mul_pd(a); }
+Vc_INTRINSIC    int mul(__m512i a,    int) { return _mm512_reduce_mul_epi32(a); }
+Vc_INTRINSIC   uint mul(__m512i a,   uint) { return _mm512_reduce_mul_epi32(a); }
+
+Vc_INTRINSIC  float min(__m512  a,  float) { return _mm512_reduce_min_ps(a); }
+Vc_INTRINSIC double min(__m512d a, double) { return _mm512_reduce_min_pd(a); }
+Vc_INTRINSIC    int min(__m512i a,    int) { return _mm512_reduce_min_epi32(a); }
+Vc_INTRINSIC   uint min(__m512i a,   uint) { return _mm512_reduce_min_epu32(a); }
+
+Vc_INTRINSIC  float max(__m512  a,  float) { return _mm512_reduce_max_ps(a); }
+Vc_INTRINSIC double max(__m512d a, double) { return _mm512_reduce_max_pd(a); }
+Vc_INTRINSIC    int max(__m512i a,    int) { return _mm512_reduce_max_epi32(a); }
+Vc_INTRINSIC   uint max(__m512i a,   uint) { return _mm512_reduce_max_epu32(a); }
+
+// compares{{{1
+// the compares return the k-mask of the result; the floating-point predicates match
+// the AVX implementation (ordered for ==, <, <=, >, >=, unordered for !=)
+Vc_INTRINSIC __mmask16 cmpeq(__m512  a, __m512  b,  float) { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+Vc_INTRINSIC __mmask8  cmpeq(__m512d a, __m512d b, double) { return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ); }
+Vc_INTRINSIC __mmask16 cmpeq(__m512i a, __m512i b,    int) { return _mm512_cmpeq_epi32_mask(a, b); }
+Vc_INTRINSIC __mmask16 cmpeq(__m512i a, __m512i b,   uint) { return _mm512_cmpeq_epu32_mask(a, b); }
+
+Vc_INTRINSIC __mmask16 cmpneq(__m512  a, __m512  b,  float) { return _mm512_cmp_ps_mask(a, b, _CMP_NEQ_UQ); }
+Vc_INTRINSIC __mmask8  cmpneq(__m512d a, __m512d b, double) { return _mm512_cmp_pd_mask(a, b, _CMP_NEQ_UQ); }
+Vc_INTRINSIC __mmask16 cmpneq(__m512i a, __m512i b,    int) { return _mm512_cmpneq_epi32_mask(a, b); }
+Vc_INTRINSIC __mmask16 cmpneq(__m512i a, __m512i b,   uint) { return _mm512_cmpneq_epu32_mask(a, b); }
+
+Vc_INTRINSIC __mmask16 cmpgt(__m512  a, __m512  b,  float) { return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); }
+Vc_INTRINSIC __mmask8  cmpgt(__m512d a, __m512d b, double) { return _mm512_cmp_pd_mask(a, b, _CMP_GT_OQ); }
+Vc_INTRINSIC __mmask16 cmpgt(__m512i a, __m512i b,    int) { return _mm512_cmpgt_epi32_mask(a, b); }
+Vc_INTRINSIC __mmask16 cmpgt(__m512i a, __m512i b,   uint) { return _mm512_cmpgt_epu32_mask(a, b); }
+
+Vc_INTRINSIC __mmask16 cmpge(__m512  a, __m512  b,  float) { return _mm512_cmp_ps_mask(a, b, _CMP_GE_OQ); }
+Vc_INTRINSIC __mmask8  cmpge(__m512d a, __m512d b, double) { return _mm512_cmp_pd_mask(a, b, _CMP_GE_OQ); }
+Vc_INTRINSIC __mmask16 cmpge(__m512i a, __m512i b,    int) { return _mm512_cmpge_epi32_mask(a, b); }
+Vc_INTRINSIC __mmask16 cmpge(__m512i a, __m512i b,   uint) { return _mm512_cmpge_epu32_mask(a, b); }
+
+Vc_INTRINSIC __mmask16 cmple(__m512  a, __m512  b,  float) { return _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ); }
+Vc_INTRINSIC __mmask8  cmple(__m512d a, __m512d b, double) { return _mm512_cmp_pd_mask(a, b, _CMP_LE_OQ); }
+Vc_INTRINSIC __mmask16 cmple(__m512i a, __m512i b,    int) { return _mm512_cmple_epi32_mask(a, b); }
+Vc_INTRINSIC __mmask16 cmple(__m512i a, __m512i b,   uint) { return _mm512_cmple_epu32_mask(a, b); }
+
+Vc_INTRINSIC __mmask16 cmplt(__m512  a, __m512  b,  float) { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+Vc_INTRINSIC __mmask8  cmplt(__m512d a, __m512d b, double) { return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ); }
+Vc_INTRINSIC __mmask16 cmplt(__m512i a, __m512i b,    int) { return _mm512_cmplt_epi32_mask(a, b); }
+Vc_INTRINSIC __mmask16 cmplt(__m512i a, __m512i b,   uint) { return _mm512_cmplt_epu32_mask(a, b); }
+
+// fma{{{1
+Vc_INTRINSIC __m512  fma(__m512  a, __m512  b, __m512  c,  float) { return _mm512_fmadd_ps(a, b, c); }
+Vc_INTRINSIC __m512d fma(__m512d a, __m512d b, __m512d c, double) { return _mm512_fmadd_pd(a, b, c); }
+template <typename T> Vc_INTRINSIC __m512i fma(__m512i a, __m512i b, __m512i c, T)
+{
+    return _mm512_add_epi32(_mm512_mullo_epi32(a, b), c);
+}
+
+// shiftRight / shiftLeft{{{1
+Vc_INTRINSIC __m512i shiftRight(__m512i a, int shift,  int) { return _mm512_sra_epi32(a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m512i shiftRight(__m512i a, int shift, uint) { return _mm512_srl_epi32(a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m512i shiftLeft(__m512i a, int shift,  int) { return _mm512_sll_epi32(a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m512i shiftLeft(__m512i a, int shift, uint) { return _mm512_sll_epi32(a, _mm_cvtsi32_si128(shift)); }
+
+// shifted / rotated{{{1
+// entry i of the result is entry i + amount of v: zero if that is out of range for
+// shifted, and modulo the number of entries for rotated
+template <typename T, typename V>
+static Vc_INTRINSIC Vc_CONST enable_if<(sizeof(V) == 64 && sizeof(T) == 4), V> shifted(
+    V v, int amount)
+{
+    using namespace AVX512;
+    const __m512i idx = _mm512_add_epi32(
+        _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+        _mm512_set1_epi32(amount));
+    return avx512_cast<V>(
+        _mm512_maskz_permutexvar_epi32(_mm512_cmplt_epu32_mask(idx, _mm512_set1_epi32(16)),
+                                       idx, avx512_cast<__m512i>(v)));
+}
+template <typename T, typename V>
+static Vc_INTRINSIC Vc_CONST enable_if<(sizeof(V) == 64 && sizeof(T) == 8), V> shifted(
+    V v, int amount)
+{
+    using namespace AVX512;
+    const __m512i idx = _mm512_add_epi64(_mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7),
+                                         _mm512_set1_epi64(amount));
+    return avx512_cast<V>(
+        _mm512_maskz_permutexvar_epi64(_mm512_cmplt_epu64_mask(idx, _mm512_set1_epi64(8)),
+                                       idx, avx512_cast<__m512i>(v)));
+}
+template <typename T, size_t N, typename V>
+static Vc_INTRINSIC Vc_CONST enable_if<(sizeof(V) == 64 && N == 16), V> rotated(V v,
+                                                                                int amount)
+{
+    using namespace AVX512;
+    const __m512i idx = _mm512_and_si512(
+        _mm512_add_epi32(
+            _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+            _mm512_set1_epi32(amount)),
+        _mm512_set1_epi32(15));
+    return avx512_cast<V>(_mm512_permutexvar_epi32(idx, avx512_cast<__m512i>(v)));
+}
+template <typename T, size_t N, typename V>
+static Vc_INTRINSIC Vc_CONST enable_if<(sizeof(V) == 64 && N == 8), V> rotated(V v,
+                                                                               int amount)
+{
+    using namespace AVX512;
+    const __m512i idx = _mm512_and_si512(
+        _mm512_add_epi64(_mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7),
+                         _mm512_set1_epi64(amount)),
+        _mm512_set1_epi64(7));
+    return avx512_cast<V>(_mm512_permutexvar_epi64(idx, avx512_cast<__m512i>(v)));
+}
+
+// sorted{{{1
+template <Vc::Implementation Impl, typename T,
+          typename = enable_if<Impl == AVX512Impl>>
+Vc_CONST_L Vector<T, VectorAbi::Avx512> sorted(Vector<T, VectorAbi::Avx512> x) Vc_CONST_R;
+template <typename T>
+Vc_INTRINSIC Vc_CONST Vector<T, VectorAbi::Avx512> sorted(Vector<T, VectorAbi::Avx512> x)
+{
+    return sorted<CurrentImplementation::current()>(x);
+}
+
+//InterleaveImpl{{{1
+// The AVX-512 gather and scatter instructions take a full index vector, so every member of
+// the structs is transferred with a single gather/scatter on the converted indexes.
+template <typename V, int Size> struct InterleaveImpl<V, Size, 64> {
+    template <typename I, typename... Vs>
+    static inline void interleave(typename V::EntryType *const data, const I &i,
+                                  const Vs &... vs)
+    {
+        const typename V::IndexType idx = indexes(i);
+        std::size_t j = 0;
+        auto &&unused = {(vs.scatter(data + j++, idx), 0)...};
+        if (&unused == &unused) {}
+    }
+    template <typename I, typename... Vs>
+    static inline void deinterleave(typename V::EntryType const *const data, const I &i,
+                                    Vs &... vs)
+    {
+        const typename V::IndexType idx = indexes(i);
+        std::size_t j = 0;
+        auto &&unused = {(vs.gather(data + j++, idx), 0)...};
+        if (&unused == &unused) {}
+    }
+
+private:
+    template <typename I> static Vc_INTRINSIC typename V::IndexType indexes(const I &i)
+    {
+        return V::IndexType::generate([&](std::size_t k) { return i[k]; });
+    }
+};
+//}}}1
+}  // namespace Detail
+}  // namespace Vc
+
+#endif  // VC_AVX512_DETAIL_H_
+
+// vim: foldmethod=marker
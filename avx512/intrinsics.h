@@ -0,0 +1,115 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_AVX512_INTRINSICS_H_
+#define VC_AVX512_INTRINSICS_H_
+
+#include "../avx/intrinsics.h"
+#include "../avx/casts.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace AVX512
+{
+namespace Casts
+{
+    template<typename T> Vc_INTRINSIC_L T avx512_cast(__m256  v) Vc_INTRINSIC_R;
+    template<typename T> Vc_INTRINSIC_L T avx512_cast(__m256i v) Vc_INTRINSIC_R;
+    template<typename T> Vc_INTRINSIC_L T avx512_cast(__m256d v) Vc_INTRINSIC_R;
+    template<typename T> Vc_INTRINSIC_L T avx512_cast(__m512  v) Vc_INTRINSIC_R;
+    template<typename T> Vc_INTRINSIC_L T avx512_cast(__m512i v) Vc_INTRINSIC_R;
+    template<typename T> Vc_INTRINSIC_L T avx512_cast(__m512d v) Vc_INTRINSIC_R;
+
+    // 256 -> 512 (the upper half is undefined)
+    template<> Vc_INTRINSIC __m512  avx512_cast(__m256  v) { return _mm512_castps256_ps512(v); }
+    template<> Vc_INTRINSIC __m512  avx512_cast(__m256i v) { return _mm512_castps256_ps512(_mm256_castsi256_ps(v)); }
+    template<> Vc_INTRINSIC __m512  avx512_cast(__m256d v) { return _mm512_castps256_ps512(_mm256_castpd_ps(v)); }
+    template<> Vc_INTRINSIC __m512i avx512_cast(__m256  v) { return _mm512_castsi256_si512(_mm256_castps_si256(v)); }
+    template<> Vc_INTRINSIC __m512i avx512_cast(__m256i v) { return _mm512_castsi256_si512(v); }
+    template<> Vc_INTRINSIC __m512i avx512_cast(__m256d v) { return _mm512_castsi256_si512(_mm256_castpd_si256(v)); }
+    template<> Vc_INTRINSIC __m512d avx512_cast(__m256  v) { return _mm512_castpd256_pd512(_mm256_castps_pd(v)); }
+    template<> Vc_INTRINSIC __m512d avx512_cast(__m256i v) { return _mm512_castpd256_pd512(_mm256_castsi256_pd(v)); }
+    template<> Vc_INTRINSIC __m512d avx512_cast(__m256d v) { return _mm512_castpd256_pd512(v); }
+
+    // 512 -> 256
+    template<> Vc_INTRINSIC __m256  avx512_cast(__m512  v) { return _mm512_castps512_ps256(v); }
+    template<> Vc_INTRINSIC __m256  avx512_cast(__m512i v) { return _mm512_castps512_ps256(_mm512_castsi512_ps(v)); }
+    template<> Vc_INTRINSIC __m256  avx512_cast(__m512d v) { return _mm512_castps512_ps256(_mm512_castpd_ps(v)); }
+    template<> Vc_INTRINSIC __m256i avx512_cast(__m512  v) { return _mm512_castsi512_si256(_mm512_castps_si512(v)); }
+    template<> Vc_INTRINSIC __m256i avx512_cast(__m512i v) { return _mm512_castsi512_si256(v); }
+    template<> Vc_INTRINSIC __m256i avx512_cast(__m512d v) { return _mm512_castsi512_si256(_mm512_castpd_si512(v)); }
+    template<> Vc_INTRINSIC __m256d avx512_cast(__m512  v) { return _mm512_castpd512_pd256(_mm512_castps_pd(v)); }
+    template<> Vc_INTRINSIC __m256d avx512_cast(__m512i v) { return _mm512_castpd512_pd256(_mm512_castsi512_pd(v)); }
+    template<> Vc_INTRINSIC __m256d avx512_cast(__m512d v) { return _mm512_castpd512_pd256(v); }
+
+    // 512 -> 512
+    template<> Vc_INTRINSIC __m512  avx512_cast(__m512  v) { return v; }
+    template<> Vc_INTRINSIC __m512  avx512_cast(__m512i v) { return _mm512_castsi512_ps(v); }
+    template<> Vc_INTRINSIC __m512  avx512_cast(__m512d v) { return _mm512_castpd_ps(v); }
+    template<> Vc_INTRINSIC __m512i avx512_cast(__m512  v) { return _mm512_castps_si512(v); }
+    template<> Vc_INTRINSIC __m512i avx512_cast(__m512i v) { return v; }
+    template<> Vc_INTRINSIC __m512i avx512_cast(__m512d v) { return _mm512_castpd_si512(v); }
+    template<> Vc_INTRINSIC __m512d avx512_cast(__m512  v) { return _mm512_castps_pd(v); }
+    template<> Vc_INTRINSIC __m512d avx512_cast(__m512i v) { return _mm512_castsi512_pd(v); }
+    template<> Vc_INTRINSIC __m512d avx512_cast(__m512d v) { return v; }
+
+    // simplify splitting 512-bit registers in 256-bit registers
+    Vc_INTRINSIC Vc_CONST __m256  lo256(__m512  v) { return avx512_cast<__m256 >(v); }
+    Vc_INTRINSIC Vc_CONST __m256d lo256(__m512d v) { return avx512_cast<__m256d>(v); }
+    Vc_INTRINSIC Vc_CONST __m256i lo256(__m512i v) { return avx512_cast<__m256i>(v); }
+    Vc_INTRINSIC Vc_CONST __m256  hi256(__m512  v) { return _mm512_extractf32x8_ps(v, 1); }
+    Vc_INTRINSIC Vc_CONST __m256d hi256(__m512d v) { return _mm512_extractf64x4_pd(v, 1); }
+    Vc_INTRINSIC Vc_CONST __m256i hi256(__m512i v) { return _mm512_extracti64x4_epi64(v, 1); }
+
+    // simplify combining 256-bit registers in 512-bit registers
+    Vc_INTRINSIC Vc_CONST __m512  concat(__m256  a, __m256  b) { return _mm512_insertf32x8(avx512_cast<__m512 >(a), b, 1); }
+    Vc_INTRINSIC Vc_CONST __m512d concat(__m256d a, __m256d b) { return _mm512_insertf64x4(avx512_cast<__m512d>(a), b, 1); }
+    Vc_INTRINSIC Vc_CONST __m512i concat(__m256i a, __m256i b) { return _mm512_inserti64x4(avx512_cast<__m512i>(a), b, 1); }
+
+    // zero the upper half
+    Vc_INTRINSIC Vc_CONST __m512  zeroExtend(__m256  v) { return _mm512_insertf32x8(_mm512_setzero_ps(), v, 0); }
+    Vc_INTRINSIC Vc_CONST __m512d zeroExtend(__m256d v) { return _mm512_insertf64x4(_mm512_setzero_pd(), v, 0); }
+    Vc_INTRINSIC Vc_CONST __m512i zeroExtend(__m256i v) { return _mm512_inserti64x4(_mm512_setzero_si512(), v, 0); }
+}  // namespace Casts
+using namespace Casts;
+
+    // constants
+    Vc_INTRINSIC Vc_CONST __m512  setone_ps()     { return _mm512_set1_ps(1.f); }
+    Vc_INTRINSIC Vc_CONST __m512d setone_pd()     { return _mm512_set1_pd(1.); }
+    Vc_INTRINSIC Vc_CONST __m512i setone_epi32()  { return _mm512_set1_epi32(1); }
+    Vc_INTRINSIC Vc_CONST __m512i setallone_si512() { return _mm512_set1_epi32(-1); }
+    Vc_INTRINSIC Vc_CONST __m512  setallone_ps()  { return _mm512_castsi512_ps(setallone_si512()); }
+    Vc_INTRINSIC Vc_CONST __m512d setallone_pd()  { return _mm512_castsi512_pd(setallone_si512()); }
+    Vc_INTRINSIC Vc_CONST __m512  setabsmask_ps() { return _mm512_castsi512_ps(_mm512_set1_epi32(0x7fffffff)); }
+    Vc_INTRINSIC Vc_CONST __m512d setabsmask_pd() { return _mm512_castsi512_pd(_mm512_set1_epi64(0x7fffffffffffffffll)); }
+    Vc_INTRINSIC Vc_CONST __m512  setsignmask_ps() { return _mm512_castsi512_ps(_mm512_set1_epi32(0x80000000u)); }
+    Vc_INTRINSIC Vc_CONST __m512d setsignmask_pd() { return _mm512_castsi512_pd(_mm512_set1_epi64(0x8000000000000000ull)); }
+}  // namespace AVX512
+}  // namespace Vc
+
+#endif // VC_AVX512_INTRINSICS_H_
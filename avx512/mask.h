@@ -0,0 +1,244 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_AVX512_MASK_H_
+#define VC_AVX512_MASK_H_
+
+#include <array>
+
+#include "intrinsics.h"
+#include "../common/bitscanintrinsics.h"
+#include "../common/maskbool.h"
+#include "detail.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace AVX512
+{
+template <typename T> struct MaskTypeHelper { typedef __mmask16 Type; };
+template <> struct MaskTypeHelper<double> { typedef __mmask8 Type; };
+}  // namespace AVX512
+
+template <typename T> class Mask<T, VectorAbi::Avx512>
+{
+public:
+    using abi = VectorAbi::Avx512;
+
+    /**
+     * The \c EntryType of masks is always bool, independent of \c T.
+     */
+    typedef bool EntryType;
+    using value_type = EntryType;
+
+    using MaskBool = Common::MaskBool<sizeof(T)>;
+    /**
+     * The \c VectorEntryType, in contrast to \c EntryType, reveals information about the
+     * SIMD implementation. This type is useful for the \c sizeof operator in generic
+     * functions.
+     */
+    using VectorEntryType = MaskBool;
+
+    /**
+     * The associated Vector<T> type.
+     */
+    using Vector = Vc::Vector<T, abi>;
+
+    /** \internal
+     * The intrinsic type of the mask register: one bit per entry.
+     */
+    typedef typename AVX512::MaskTypeHelper<T>::Type MaskType;
+
+    /**
+     * The \c VectorType reveals the implementation-specific internal type used for the
+     * SIMD type.
+     */
+    using VectorType = MaskType;
+
+    using EntryReference = Vc::Detail::ElementReference<Mask>;
+    using reference = EntryReference;
+
+    static constexpr size_t Size = sizeof(MaskType) * 8;
+    static constexpr size_t MemoryAlignment = Size;
+    static constexpr std::size_t size() { return Size; }
+
+private:
+    static constexpr MaskType FullMask = MaskType(~0u);
+
+public:
+    // abstracts the way Masks are passed to functions, it can easily be changed to const ref here
+#if defined Vc_MSVC && defined _WIN32
+    typedef const Mask &AsArg;
+#else
+    typedef const Mask AsArg;
+#endif
+
+    Vc_INTRINSIC Mask() : k() {}
+    Vc_INTRINSIC Mask(MaskType _k) : k(_k) {}
+    Vc_INTRINSIC explicit Mask(VectorSpecialInitializerZero) : k(0) {}
+    Vc_INTRINSIC explicit Mask(VectorSpecialInitializerOne) : k(FullMask) {}
+    Vc_INTRINSIC explicit Mask(bool b) : k(b ? FullMask : MaskType(0)) {}
+    Vc_INTRINSIC static Mask Zero() { return Mask{Vc::Zero}; }
+    Vc_INTRINSIC static Mask One() { return Mask{Vc::One}; }
+
+    // implicit cast: toInt() yields the entries in the k-mask layout for every ABI
+    template <typename U>
+    Vc_INTRINSIC Mask(U &&rhs, Common::enable_if_mask_converts_implicitly<T, U> = nullarg)
+        : k(static_cast<MaskType>(rhs.toInt()))
+    {
+    }
+
+#if Vc_IS_VERSION_1
+    // explicit cast, implemented via simd_cast (in avx512/simd_cast_caller.tcc)
+    template <typename U>
+    Vc_DEPRECATED("use simd_cast instead of explicit type casting to convert between "
+                  "mask types") Vc_INTRINSIC
+        explicit Mask(U &&rhs, Common::enable_if_mask_converts_explicitly<T, U> = nullarg);
+#endif
+
+    template<typename Flags = DefaultLoadTag> Vc_INTRINSIC explicit Mask(const bool *mem, Flags f = Flags()) { load(mem, f); }
+
+    // a bool is one byte with the value 0 or 1: the byte compare against zero yields the
+    // bits directly
+    template <typename Flags = DefaultLoadTag> Vc_INTRINSIC void load(const bool *mem, Flags = Flags())
+    {
+        const __m128i bytes =
+            Size == 16 ? _mm_loadu_si128(reinterpret_cast<const __m128i *>(mem))
+                       : _mm_loadl_epi64(reinterpret_cast<const __m128i *>(mem));
+        k = MaskType(_mm_test_epi8_mask(bytes, bytes));
+    }
+
+    template <typename Flags = DefaultLoadTag> Vc_INTRINSIC void store(bool *mem, Flags = Flags()) const
+    {
+        const __m128i bytes = _mm_maskz_set1_epi8(k, 1);
+        if (Size == 16) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(mem), bytes);
+        } else {
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(mem), bytes);
+        }
+    }
+
+    Vc_INTRINSIC Mask &operator=(const Mask &) = default;
+    Vc_INTRINSIC Mask &operator=(const std::array<bool, Size> &values)
+    {
+        load(values.data());
+        return *this;
+    }
+    Vc_INTRINSIC operator std::array<bool, Size>() const
+    {
+        std::array<bool, Size> r;
+        store(r.data());
+        return r;
+    }
+
+    Vc_INTRINSIC Vc_PURE bool operator==(const Mask &rhs) const { return k == rhs.k; }
+    Vc_INTRINSIC Vc_PURE bool operator!=(const Mask &rhs) const { return k != rhs.k; }
+
+    Vc_INTRINSIC Mask operator!() const { return MaskType(~k); }
+
+    Vc_INTRINSIC Mask &operator&=(const Mask &rhs) { k &= rhs.k; return *this; }
+    Vc_INTRINSIC Mask &operator|=(const Mask &rhs) { k |= rhs.k; return *this; }
+    Vc_INTRINSIC Mask &operator^=(const Mask &rhs) { k ^= rhs.k; return *this; }
+
+    Vc_INTRINSIC Vc_PURE Mask operator&(const Mask &rhs) const { return MaskType(k & rhs.k); }
+    Vc_INTRINSIC Vc_PURE Mask operator|(const Mask &rhs) const { return MaskType(k | rhs.k); }
+    Vc_INTRINSIC Vc_PURE Mask operator^(const Mask &rhs) const { return MaskType(k ^ rhs.k); }
+
+    Vc_INTRINSIC Vc_PURE Mask operator&&(const Mask &rhs) const { return MaskType(k & rhs.k); }
+    Vc_INTRINSIC Vc_PURE Mask operator||(const Mask &rhs) const { return MaskType(k | rhs.k); }
+
+    Vc_INTRINSIC bool isNotEmpty() const { return k != 0; }
+    Vc_INTRINSIC bool isEmpty() const { return k == 0; }
+    Vc_INTRINSIC bool isFull() const { return k == FullMask; }
+    Vc_INTRINSIC bool isMix() const { return !isEmpty() && !isFull(); }
+
+    Vc_INTRINSIC Vc_PURE int shiftMask() const { return k; }
+    Vc_INTRINSIC Vc_PURE int toInt() const { return k; }
+
+    Vc_INTRINSIC MaskType data () const { return k; }
+    Vc_INTRINSIC MaskType dataI() const { return k; }
+    Vc_INTRINSIC MaskType dataD() const { return k; }
+
+private:
+    friend reference;
+    static Vc_INTRINSIC Vc_PURE value_type get(const Mask &m, int i) noexcept
+    {
+        return (m.k >> i) & 1;
+    }
+    template <typename U>
+    static Vc_INTRINSIC void set(Mask &m, int i,
+                                 U &&v) noexcept(noexcept(static_cast<bool>(std::declval<U>())))
+    {
+        const MaskType bit = MaskType(1u << i);
+        m.k = static_cast<bool>(std::forward<U>(v)) ? MaskType(m.k | bit)
+                                                    : MaskType(m.k & ~bit);
+    }
+
+public:
+    Vc_ALWAYS_INLINE reference operator[](size_t index) noexcept
+    {
+        return {*this, int(index)};
+    }
+    Vc_ALWAYS_INLINE Vc_PURE value_type operator[](size_t index) const noexcept
+    {
+        return get(*this, index);
+    }
+
+    Vc_INTRINSIC Vc_PURE int count() const { return Detail::popcnt16(k); }
+    Vc_INTRINSIC Vc_PURE int firstOne() const { return _bit_scan_forward(k); }
+
+    template <typename G> static Vc_INTRINSIC Mask generate(G &&gen)
+    {
+        unsigned int bits = 0;
+        Common::unrolled_loop<std::size_t, 0, Size>([&](std::size_t i) {
+            bits |= static_cast<unsigned int>(static_cast<bool>(gen(i))) << i;
+        });
+        return static_cast<MaskType>(bits);
+    }
+    Vc_INTRINSIC Vc_PURE Mask shifted(int amount) const
+    {
+        if (amount >= 0) {
+            if (amount < int(Size)) {
+                return static_cast<MaskType>(k >> amount);
+            }
+        } else if (amount > -int(Size)) {
+            return static_cast<MaskType>(k << -amount);
+        }
+        return Zero();
+    }
+
+private:
+    MaskType k;
+};
+template <typename T> constexpr size_t Mask<T, VectorAbi::Avx512>::Size;
+template <typename T> constexpr size_t Mask<T, VectorAbi::Avx512>::MemoryAlignment;
+template <typename T>
+constexpr typename Mask<T, VectorAbi::Avx512>::MaskType Mask<T, VectorAbi::Avx512>::FullMask;
+
+}  // namespace Vc
+
+#endif // VC_AVX512_MASK_H_
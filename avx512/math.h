@@ -0,0 +1,286 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_AVX512_MATH_H_
+#define VC_AVX512_MATH_H_
+
+#include "../avx/math.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+// min & max {{{1
+Vc_ALWAYS_INLINE AVX512::int_v    min(const AVX512::int_v    &x, const AVX512::int_v    &y) { return _mm512_min_epi32(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX512::uint_v   min(const AVX512::uint_v   &x, const AVX512::uint_v   &y) { return _mm512_min_epu32(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX512::float_v  min(const AVX512::float_v  &x, const AVX512::float_v  &y) { return _mm512_min_ps(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX512::double_v min(const AVX512::double_v &x, const AVX512::double_v &y) { return _mm512_min_pd(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX512::int_v    max(const AVX512::int_v    &x, const AVX512::int_v    &y) { return _mm512_max_epi32(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX512::uint_v   max(const AVX512::uint_v   &x, const AVX512::uint_v   &y) { return _mm512_max_epu32(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX512::float_v  max(const AVX512::float_v  &x, const AVX512::float_v  &y) { return _mm512_max_ps(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX512::double_v max(const AVX512::double_v &x, const AVX512::double_v &y) { return _mm512_max_pd(x.data(), y.data()); }
+
+// sqrt {{{1
+Vc_ALWAYS_INLINE Vc_PURE AVX512::float_v sqrt(const AVX512::float_v &x) { return _mm512_sqrt_ps(x.data()); }
+Vc_ALWAYS_INLINE Vc_PURE AVX512::double_v sqrt(const AVX512::double_v &x) { return _mm512_sqrt_pd(x.data()); }
+
+// rsqrt {{{1
+// the 14-bit approximation for float; double keeps full precision, as with AVX
+Vc_ALWAYS_INLINE Vc_PURE AVX512::float_v rsqrt(const AVX512::float_v &x) { return _mm512_rsqrt14_ps(x.data()); }
+Vc_ALWAYS_INLINE Vc_PURE AVX512::double_v rsqrt(const AVX512::double_v &x)
+{
+    return _mm512_div_pd(AVX512::setone_pd(), _mm512_sqrt_pd(x.data()));
+}
+
+// reciprocal {{{1
+Vc_ALWAYS_INLINE Vc_PURE AVX512::float_v reciprocal(const AVX512::float_v &x) { return _mm512_rcp14_ps(x.data()); }
+Vc_ALWAYS_INLINE Vc_PURE AVX512::double_v reciprocal(const AVX512::double_v &x)
+{
+    return _mm512_div_pd(AVX512::setone_pd(), x.data());
+}
+
+// round / trunc / floor / ceil {{{1
+Vc_ALWAYS_INLINE Vc_PURE AVX512::float_v round(const AVX512::float_v &x)
+{
+    return _mm512_roundscale_ps(x.data(), _MM_FROUND_TO_NEAREST_INT);
+}
+Vc_ALWAYS_INLINE Vc_PURE AVX512::double_v round(const AVX512::double_v &x)
+{
+    return _mm512_roundscale_pd(x.data(), _MM_FROUND_TO_NEAREST_INT);
+}
+Vc_ALWAYS_INLINE AVX512::float_v trunc(AVX512::float_v::AsArg v)
+{
+    return _mm512_roundscale_ps(v.data(), _MM_FROUND_TO_ZERO);
+}
+Vc_ALWAYS_INLINE AVX512::double_v trunc(AVX512::double_v::AsArg v)
+{
+    return _mm512_roundscale_pd(v.data(), _MM_FROUND_TO_ZERO);
+}
+Vc_ALWAYS_INLINE AVX512::float_v floor(AVX512::float_v::AsArg v)
+{
+    return _mm512_roundscale_ps(v.data(), _MM_FROUND_TO_NEG_INF);
+}
+Vc_ALWAYS_INLINE AVX512::double_v floor(AVX512::double_v::AsArg v)
+{
+    return _mm512_roundscale_pd(v.data(), _MM_FROUND_TO_NEG_INF);
+}
+Vc_ALWAYS_INLINE AVX512::float_v ceil(AVX512::float_v::AsArg v)
+{
+    return _mm512_roundscale_ps(v.data(), _MM_FROUND_TO_POS_INF);
+}
+Vc_ALWAYS_INLINE AVX512::double_v ceil(AVX512::double_v::AsArg v)
+{
+    return _mm512_roundscale_pd(v.data(), _MM_FROUND_TO_POS_INF);
+}
+
+// abs {{{1
+Vc_INTRINSIC Vc_CONST AVX512::double_v abs(AVX512::double_v x) { return Detail::abs(x.data(), double()); }
+Vc_INTRINSIC Vc_CONST AVX512::float_v abs(AVX512::float_v x) { return Detail::abs(x.data(), float()); }
+Vc_INTRINSIC Vc_CONST AVX512::int_v abs(AVX512::int_v x) { return Detail::abs(x.data(), int()); }
+
+// isfinite / isinf / isnan {{{1
+// the fpclass categories: 0x01 QNaN, 0x08 +inf, 0x10 -inf, 0x80 SNaN
+Vc_ALWAYS_INLINE Vc_PURE AVX512::double_m isfinite(const AVX512::double_v &x)
+{
+    return __mmask8(~_mm512_fpclass_pd_mask(x.data(), 0x99));
+}
+Vc_ALWAYS_INLINE Vc_PURE AVX512::float_m isfinite(const AVX512::float_v &x)
+{
+    return __mmask16(~_mm512_fpclass_ps_mask(x.data(), 0x99));
+}
+Vc_ALWAYS_INLINE Vc_PURE AVX512::double_m isinf(const AVX512::double_v &x)
+{
+    return _mm512_fpclass_pd_mask(x.data(), 0x18);
+}
+Vc_ALWAYS_INLINE Vc_PURE AVX512::float_m isinf(const AVX512::float_v &x)
+{
+    return _mm512_fpclass_ps_mask(x.data(), 0x18);
+}
+Vc_ALWAYS_INLINE Vc_PURE AVX512::double_m isnan(const AVX512::double_v &x)
+{
+    return _mm512_cmp_pd_mask(x.data(), x.data(), _CMP_UNORD_Q);
+}
+Vc_ALWAYS_INLINE Vc_PURE AVX512::float_m isnan(const AVX512::float_v &x)
+{
+    return _mm512_cmp_ps_mask(x.data(), x.data(), _CMP_UNORD_Q);
+}
+
+// copysign {{{1
+Vc_INTRINSIC Vc_CONST AVX512::float_v copysign(AVX512::float_v mag, AVX512::float_v sign)
+{
+    return _mm512_or_ps(_mm512_and_ps(sign.data(), AVX512::setsignmask_ps()),
+                        _mm512_and_ps(mag.data(), AVX512::setabsmask_ps()));
+}
+Vc_INTRINSIC Vc_CONST AVX512::double_v copysign(AVX512::double_v::AsArg mag,
+                                                AVX512::double_v::AsArg sign)
+{
+    return _mm512_or_pd(_mm512_and_pd(sign.data(), AVX512::setsignmask_pd()),
+                        _mm512_and_pd(mag.data(), AVX512::setabsmask_pd()));
+}
+
+//}}}1
+// frexp {{{1
+/**
+ * splits \p v into exponent and mantissa, the sign is kept with the mantissa
+ *
+ * The return value will be in the range [0.5, 1.0[
+ * The \p e value will be an integer defining the power-of-two exponent
+ */
+inline AVX512::float_v frexp(AVX512::float_v::AsArg v, AVX512::float_v::IndexType *e)
+{
+    const AVX512::float_m special = isnan(v) || !isfinite(v) || v == AVX512::float_v::Zero();
+    AVX512::float_v ret = _mm512_getmant_ps(v.data(), _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+    ret(special) = v;
+    internal_data(*e) = AVX512::int_v(_mm512_maskz_cvttps_epi32(
+        __mmask16(~special.data()),
+        _mm512_add_ps(_mm512_getexp_ps(v.data()), AVX512::setone_ps())));
+    return ret;
+}
+inline AVX512::double_v frexp(AVX512::double_v::AsArg v, AVX512::double_v::IndexType *e)
+{
+    const AVX512::double_m special = isnan(v) || !isfinite(v) || v == AVX512::double_v::Zero();
+    AVX512::double_v ret = _mm512_getmant_pd(v.data(), _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+    ret(special) = v;
+    internal_data(*e) = AVX2::int_v(_mm512_maskz_cvttpd_epi32(
+        __mmask8(~special.data()),
+        _mm512_add_pd(_mm512_getexp_pd(v.data()), AVX512::setone_pd())));
+    return ret;
+}
+
+// ldexp {{{1
+/*             -> x * 2^e
+ * x == NaN    -> NaN
+ * x == (-)inf -> (-)inf
+ */
+inline AVX512::float_v ldexp(AVX512::float_v::AsArg v, const AVX512::float_v::IndexType &e)
+{
+    return _mm512_scalef_ps(v.data(), _mm512_cvtepi32_ps(internal_data(e).data()));
+}
+inline AVX512::double_v ldexp(AVX512::double_v::AsArg v,
+                              const AVX512::double_v::IndexType &e)
+{
+    return _mm512_scalef_pd(v.data(), _mm512_cvtepi32_pd(internal_data(e).data()));
+}
+
+// fma {{{1
+template <typename T>
+Vc_ALWAYS_INLINE Vector<T, VectorAbi::Avx512> fma(Vector<T, VectorAbi::Avx512> a,
+                                                  Vector<T, VectorAbi::Avx512> b,
+                                                  Vector<T, VectorAbi::Avx512> c)
+{
+    return Detail::fma(a.data(), b.data(), c.data(), T());
+}
+
+// transcendental functions {{{1
+// The polynomial approximations are implemented for the SSE and AVX vector types only.
+// The 512-bit vectors therefore evaluate them on their two 256-bit halves.
+namespace Detail
+{
+template <typename T, typename F>
+Vc_INTRINSIC Vector<T, VectorAbi::Avx512> applyToHalves(const Vector<T, VectorAbi::Avx512> &x,
+                                                        F &&f)
+{
+    using H = Vector<T, VectorAbi::Avx>;
+    return simd_cast<Vector<T, VectorAbi::Avx512>>(f(simd_cast<H, 0>(x)),
+                                                   f(simd_cast<H, 1>(x)));
+}
+template <typename T, typename F>
+Vc_INTRINSIC Vector<T, VectorAbi::Avx512> applyToHalves(const Vector<T, VectorAbi::Avx512> &x,
+                                                        const Vector<T, VectorAbi::Avx512> &y,
+                                                        F &&f)
+{
+    using H = Vector<T, VectorAbi::Avx>;
+    return simd_cast<Vector<T, VectorAbi::Avx512>>(
+        f(simd_cast<H, 0>(x), simd_cast<H, 0>(y)), f(simd_cast<H, 1>(x), simd_cast<H, 1>(y)));
+}
+}  // namespace Detail
+
+#define Vc_MATH_HALVES_(name_)                                                           \
+    template <typename T>                                                                \
+    Vc_INTRINSIC Vector<T, VectorAbi::Avx512> name_(const Vector<T, VectorAbi::Avx512> &x) \
+    {                                                                                    \
+        return Detail::applyToHalves(                                                    \
+            x, [](const Vector<T, VectorAbi::Avx> &h) { return name_(h); });             \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+Vc_MATH_HALVES_(sin);
+Vc_MATH_HALVES_(cos);
+Vc_MATH_HALVES_(tan);
+Vc_MATH_HALVES_(asin);
+Vc_MATH_HALVES_(acos);
+Vc_MATH_HALVES_(atan);
+Vc_MATH_HALVES_(sinh);
+Vc_MATH_HALVES_(cosh);
+Vc_MATH_HALVES_(tanh);
+Vc_MATH_HALVES_(erf);
+Vc_MATH_HALVES_(erfc);
+Vc_MATH_HALVES_(exp);
+Vc_MATH_HALVES_(exp2);
+Vc_MATH_HALVES_(exp10);
+Vc_MATH_HALVES_(expm1);
+Vc_MATH_HALVES_(log);
+Vc_MATH_HALVES_(log2);
+Vc_MATH_HALVES_(log10);
+Vc_MATH_HALVES_(log1p);
+Vc_MATH_HALVES_(cbrt);
+#undef Vc_MATH_HALVES_
+
+template <typename T>
+Vc_INTRINSIC Vector<T, VectorAbi::Avx512> atan2(const Vector<T, VectorAbi::Avx512> &y,
+                                                const Vector<T, VectorAbi::Avx512> &x)
+{
+    return Detail::applyToHalves(
+        y, x, [](const Vector<T, VectorAbi::Avx> &a, const Vector<T, VectorAbi::Avx> &b) {
+            return atan2(a, b);
+        });
+}
+template <typename T>
+Vc_INTRINSIC Vector<T, VectorAbi::Avx512> pow(const Vector<T, VectorAbi::Avx512> &x,
+                                              const Vector<T, VectorAbi::Avx512> &y)
+{
+    return Detail::applyToHalves(
+        x, y, [](const Vector<T, VectorAbi::Avx> &a, const Vector<T, VectorAbi::Avx> &b) {
+            return pow(a, b);
+        });
+}
+template <typename T>
+Vc_INTRINSIC void sincos(const Vector<T, VectorAbi::Avx512> &x,
+                         Vector<T, VectorAbi::Avx512> *sin,
+                         Vector<T, VectorAbi::Avx512> *cos)
+{
+    using H = Vector<T, VectorAbi::Avx>;
+    H s[2], c[2];
+    sincos(simd_cast<H, 0>(x), &s[0], &c[0]);
+    sincos(simd_cast<H, 1>(x), &s[1], &c[1]);
+    *sin = simd_cast<Vector<T, VectorAbi::Avx512>>(s[0], s[1]);
+    *cos = simd_cast<Vector<T, VectorAbi::Avx512>>(c[0], c[1]);
+}
+// }}}1
+}  // namespace Vc
+
+#endif // VC_AVX512_MATH_H_
+
+// vim: foldmethod=marker
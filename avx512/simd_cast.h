@@ -0,0 +1,323 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_AVX512_SIMD_CAST_H_
+#define VC_AVX512_SIMD_CAST_H_
+
+#ifndef VC_AVX512_VECTOR_H_
+#error "Vc/avx512/vector.h needs to be included before Vc/avx512/simd_cast.h"
+#endif
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace AVX512
+{
+// The casts in this file handle every combination of native (i.e. non-SimdArray) vector
+// or mask types where at least one side uses VectorAbi::Avx512. The casts between the
+// other ABIs are implemented in sse/, avx/, and scalar/simd_cast.h.
+template <typename T>
+using is_native_vector = std::integral_constant<
+    bool, Traits::is_simd_vector<T>::value && !Traits::isSimdArray<T>::value>;
+template <typename T>
+using is_native_mask = std::integral_constant<
+    bool, Traits::is_simd_mask<T>::value && !Traits::isSimdMaskArray<T>::value>;
+
+template <typename... Ts> struct all_same : public std::true_type {};
+template <typename T0, typename T1, typename... Ts>
+struct all_same<T0, T1, Ts...>
+    : public std::integral_constant<bool, std::is_same<T0, T1>::value &&
+                                              all_same<T1, Ts...>::value> {
+};
+
+template <typename Return, typename From, typename... Froms>
+using is_vector_cast = std::integral_constant<
+    bool, is_native_vector<Return>::value && is_native_vector<From>::value &&
+              all_same<From, Froms...>::value &&
+              (is_vector<Return>::value || is_vector<From>::value) &&
+              !(sizeof...(Froms) == 0 && std::is_same<Return, From>::value)>;
+template <typename Return, typename From, typename... Froms>
+using is_mask_cast = std::integral_constant<
+    bool, is_native_mask<Return>::value && is_native_mask<From>::value &&
+              all_same<From, Froms...>::value &&
+              (is_mask<Return>::value || is_mask<From>::value) &&
+              !(sizeof...(Froms) == 0 && std::is_same<Return, From>::value)>;
+
+// casts with an offset start at entry offset * Return::Size of the argument. The
+// offset == 0 casts from AVX2 and Scalar types are implemented in avx/ and scalar/.
+template <typename Return, int offset, typename From>
+using is_offset_cast = std::integral_constant<
+    bool, ((is_native_vector<Return>::value && is_native_vector<From>::value &&
+            (is_vector<Return>::value || is_vector<From>::value)) ||
+           (is_native_mask<Return>::value && is_native_mask<From>::value &&
+            (is_mask<Return>::value || is_mask<From>::value))) &&
+              !std::is_same<typename Return::abi, VectorAbi::Scalar>::value &&
+              !(offset == 0 && (std::is_same<typename From::abi, VectorAbi::Avx>::value ||
+                                std::is_same<typename From::abi, VectorAbi::Scalar>::value))>;
+
+// convert {{{1
+// The generic conversion copies entry by entry and zeros the entries of the result that
+// have no input. The overloads below use a conversion instruction instead.
+template <typename Return, typename From, typename... Froms>
+Vc_INTRINSIC Return convert(Return *, From x, Froms... xs)
+{
+    const From args[] = {x, xs...};
+    constexpr std::size_t N = From::Size * (1 + sizeof...(Froms));
+    return Return::generate([&](std::size_t i) {
+        return i < N ? static_cast<typename Return::EntryType>(
+                           args[i / From::Size][i % From::Size])
+                     : typename Return::EntryType();
+    });
+}
+
+// float_v {{{2
+Vc_INTRINSIC float_v convert(float_v *, int_v x) { return _mm512_cvtepi32_ps(x.data()); }
+Vc_INTRINSIC float_v convert(float_v *, uint_v x) { return _mm512_cvtepu32_ps(x.data()); }
+Vc_INTRINSIC float_v convert(float_v *, double_v x)
+{
+    return zeroExtend(_mm512_cvtpd_ps(x.data()));
+}
+Vc_INTRINSIC float_v convert(float_v *, double_v x0, double_v x1)
+{
+    return concat(_mm512_cvtpd_ps(x0.data()), _mm512_cvtpd_ps(x1.data()));
+}
+Vc_INTRINSIC float_v convert(float_v *, AVX2::float_v x) { return zeroExtend(x.data()); }
+Vc_INTRINSIC float_v convert(float_v *, AVX2::float_v x0, AVX2::float_v x1)
+{
+    return concat(x0.data(), x1.data());
+}
+
+// double_v {{{2
+Vc_INTRINSIC double_v convert(double_v *, float_v x)
+{
+    return _mm512_cvtps_pd(lo256(x.data()));
+}
+Vc_INTRINSIC double_v convert(double_v *, int_v x)
+{
+    return _mm512_cvtepi32_pd(lo256(x.data()));
+}
+Vc_INTRINSIC double_v convert(double_v *, uint_v x)
+{
+    return _mm512_cvtepu32_pd(lo256(x.data()));
+}
+Vc_INTRINSIC double_v convert(double_v *, AVX2::float_v x)
+{
+    return _mm512_cvtps_pd(x.data());
+}
+Vc_INTRINSIC double_v convert(double_v *, AVX2::int_v x)
+{
+    return _mm512_cvtepi32_pd(x.data());
+}
+Vc_INTRINSIC double_v convert(double_v *, AVX2::uint_v x)
+{
+    return _mm512_cvtepu32_pd(x.data());
+}
+Vc_INTRINSIC double_v convert(double_v *, AVX2::double_v x) { return zeroExtend(x.data()); }
+Vc_INTRINSIC double_v convert(double_v *, AVX2::double_v x0, AVX2::double_v x1)
+{
+    return concat(x0.data(), x1.data());
+}
+
+// int_v / uint_v {{{2
+Vc_INTRINSIC int_v convert(int_v *, float_v x) { return _mm512_cvttps_epi32(x.data()); }
+Vc_INTRINSIC int_v convert(int_v *, uint_v x) { return x.data(); }
+Vc_INTRINSIC int_v convert(int_v *, double_v x)
+{
+    return zeroExtend(_mm512_cvttpd_epi32(x.data()));
+}
+Vc_INTRINSIC int_v convert(int_v *, double_v x0, double_v x1)
+{
+    return concat(_mm512_cvttpd_epi32(x0.data()), _mm512_cvttpd_epi32(x1.data()));
+}
+Vc_INTRINSIC int_v convert(int_v *, AVX2::int_v x0, AVX2::int_v x1)
+{
+    return concat(x0.data(), x1.data());
+}
+Vc_INTRINSIC uint_v convert(uint_v *, float_v x) { return _mm512_cvttps_epu32(x.data()); }
+Vc_INTRINSIC uint_v convert(uint_v *, int_v x) { return x.data(); }
+Vc_INTRINSIC uint_v convert(uint_v *, double_v x)
+{
+    return zeroExtend(_mm512_cvttpd_epu32(x.data()));
+}
+Vc_INTRINSIC uint_v convert(uint_v *, double_v x0, double_v x1)
+{
+    return concat(_mm512_cvttpd_epu32(x0.data()), _mm512_cvttpd_epu32(x1.data()));
+}
+Vc_INTRINSIC uint_v convert(uint_v *, AVX2::uint_v x0, AVX2::uint_v x1)
+{
+    return concat(x0.data(), x1.data());
+}
+
+// AVX2 from the low half {{{2
+Vc_INTRINSIC AVX2::float_v convert(AVX2::float_v *, float_v x) { return lo256(x.data()); }
+Vc_INTRINSIC AVX2::double_v convert(AVX2::double_v *, double_v x) { return lo256(x.data()); }
+Vc_INTRINSIC AVX2::int_v convert(AVX2::int_v *, int_v x) { return lo256(x.data()); }
+Vc_INTRINSIC AVX2::uint_v convert(AVX2::uint_v *, uint_v x) { return lo256(x.data()); }
+Vc_INTRINSIC AVX2::float_v convert(AVX2::float_v *, double_v x)
+{
+    return _mm512_cvtpd_ps(x.data());
+}
+Vc_INTRINSIC AVX2::int_v convert(AVX2::int_v *, double_v x)
+{
+    return _mm512_cvttpd_epi32(x.data());
+}
+
+// convert_mask {{{1
+template <typename Return, typename From, typename... Froms>
+Vc_INTRINSIC Return convert_mask(Return *, From x, Froms... xs)
+{
+    // not every mask type implements generate (e.g. the 8-bit AVX2 masks), but all of
+    // them load from bool arrays
+    const From args[] = {x, xs...};
+    constexpr std::size_t N = From::Size * (1 + sizeof...(Froms));
+    bool tmp[Return::Size];
+    for (std::size_t i = 0; i < Return::Size; ++i) {
+        tmp[i] = i < N && args[i / From::Size][i % From::Size];
+    }
+    return Return(tmp, Vc::Unaligned);
+}
+// the k-masks of the AVX512 masks use the same bit for the same entry
+template <typename T, typename U>
+Vc_INTRINSIC Vc::Mask<T, VectorAbi::Avx512> convert_mask(Vc::Mask<T, VectorAbi::Avx512> *,
+                                                         Vc::Mask<U, VectorAbi::Avx512> k)
+{
+    return static_cast<typename Vc::Mask<T, VectorAbi::Avx512>::MaskType>(k.data());
+}
+Vc_INTRINSIC Mask<float> convert_mask(Mask<float> *, Mask<double> k0, Mask<double> k1)
+{
+    return static_cast<__mmask16>(k0.data() | (k1.data() << 8));
+}
+Vc_INTRINSIC Mask<int> convert_mask(Mask<int> *, Mask<double> k0, Mask<double> k1)
+{
+    return static_cast<__mmask16>(k0.data() | (k1.data() << 8));
+}
+Vc_INTRINSIC Mask<uint> convert_mask(Mask<uint> *, Mask<double> k0, Mask<double> k1)
+{
+    return static_cast<__mmask16>(k0.data() | (k1.data() << 8));
+}
+}  // namespace AVX512
+
+// simd_cast {{{1
+template <typename Return, typename From, typename... Froms>
+Vc_INTRINSIC Vc_CONST enable_if<AVX512::is_vector_cast<Return, From, Froms...>::value, Return>
+simd_cast(From x, Froms... xs)
+{
+    return AVX512::convert(static_cast<Return *>(nullptr), x, xs...);
+}
+template <typename Return, typename From, typename... Froms>
+Vc_INTRINSIC Vc_CONST enable_if<AVX512::is_mask_cast<Return, From, Froms...>::value, Return>
+simd_cast(From x, Froms... xs)
+{
+    return AVX512::convert_mask(static_cast<Return *>(nullptr), x, xs...);
+}
+
+// simd_cast with offset {{{1
+namespace AVX512
+{
+template <typename Return, int offset, typename From>
+Vc_INTRINSIC Return convert_offset(Return *, From x, std::integral_constant<int, offset>)
+{
+    constexpr std::size_t start = offset * Return::Size;
+    return Return::generate([&](std::size_t i) {
+        return start + i < From::Size
+                   ? static_cast<typename Return::EntryType>(x[start + i])
+                   : typename Return::EntryType();
+    });
+}
+Vc_INTRINSIC double_v convert_offset(double_v *, float_v x, std::integral_constant<int, 1>)
+{
+    return _mm512_cvtps_pd(hi256(x.data()));
+}
+Vc_INTRINSIC double_v convert_offset(double_v *, int_v x, std::integral_constant<int, 1>)
+{
+    return _mm512_cvtepi32_pd(hi256(x.data()));
+}
+Vc_INTRINSIC double_v convert_offset(double_v *, uint_v x, std::integral_constant<int, 1>)
+{
+    return _mm512_cvtepu32_pd(hi256(x.data()));
+}
+Vc_INTRINSIC AVX2::float_v convert_offset(AVX2::float_v *, float_v x,
+                                          std::integral_constant<int, 1>)
+{
+    return hi256(x.data());
+}
+Vc_INTRINSIC AVX2::double_v convert_offset(AVX2::double_v *, double_v x,
+                                           std::integral_constant<int, 1>)
+{
+    return hi256(x.data());
+}
+Vc_INTRINSIC AVX2::int_v convert_offset(AVX2::int_v *, int_v x,
+                                        std::integral_constant<int, 1>)
+{
+    return hi256(x.data());
+}
+Vc_INTRINSIC AVX2::uint_v convert_offset(AVX2::uint_v *, uint_v x,
+                                         std::integral_constant<int, 1>)
+{
+    return hi256(x.data());
+}
+
+template <typename Return, int offset, typename From>
+Vc_INTRINSIC Return convert_mask_offset(Return *, From x, std::integral_constant<int, offset>)
+{
+    constexpr std::size_t start = offset * Return::Size;
+    bool tmp[Return::Size];
+    for (std::size_t i = 0; i < Return::Size; ++i) {
+        tmp[i] = start + i < From::Size && x[start + i];
+    }
+    return Return(tmp, Vc::Unaligned);
+}
+}  // namespace AVX512
+
+template <typename Return, int offset, typename From>
+Vc_INTRINSIC Vc_CONST
+    enable_if<(AVX512::is_offset_cast<Return, offset, From>::value &&
+               Traits::is_simd_vector<Return>::value),
+              Return>
+    simd_cast(From x)
+{
+    return offset == 0 ? simd_cast<Return>(x)
+                       : AVX512::convert_offset(static_cast<Return *>(nullptr), x,
+                                                std::integral_constant<int, offset>());
+}
+template <typename Return, int offset, typename From>
+Vc_INTRINSIC Vc_CONST
+    enable_if<(AVX512::is_offset_cast<Return, offset, From>::value &&
+               Traits::is_simd_mask<Return>::value),
+              Return>
+    simd_cast(From x)
+{
+    return offset == 0 ? simd_cast<Return>(x)
+                       : AVX512::convert_mask_offset(static_cast<Return *>(nullptr), x,
+                                                     std::integral_constant<int, offset>());
+}
+// }}}1
+}  // namespace Vc
+
+#endif  // VC_AVX512_SIMD_CAST_H_
+
+// vim: foldmethod=marker
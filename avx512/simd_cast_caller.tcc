@@ -0,0 +1,55 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef Vc_AVX512_SIMD_CAST_CALLER_TCC_
+#define Vc_AVX512_SIMD_CAST_CALLER_TCC_
+
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+#if Vc_IS_VERSION_1
+template <typename T>
+template <typename U, typename>
+Vc_INTRINSIC Vector<T, VectorAbi::Avx512>::Vector(U &&x)
+    : d(simd_cast<Vector>(std::forward<U>(x)).data())
+{
+}
+
+template <typename T>
+template <typename U>
+Vc_INTRINSIC Mask<T, VectorAbi::Avx512>::Mask(U &&rhs,
+                                              Common::enable_if_mask_converts_explicitly<T, U>)
+    : Mask(simd_cast<Mask>(std::forward<U>(rhs)))
+{
+}
+#endif  // Vc_IS_VERSION_1
+}
+
+#endif  // Vc_AVX512_SIMD_CAST_CALLER_TCC_
+
+// vim: foldmethod=marker
@@ -0,0 +1,609 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2011-2015 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "../common/x86_prefetches.h"
+#include "../common/gatherimplementation.h"
+#include "../common/scatterimplementation.h"
+#include "../common/set.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// compare operators {{{1
+#define Vc_OP_(op_, fun_)                                                                \
+    template <typename T>                                                                \
+    Vc_INTRINSIC Vc::Mask<T, VectorAbi::Avx512> operator op_(                            \
+        Vc::Vector<T, VectorAbi::Avx512> a, Vc::Vector<T, VectorAbi::Avx512> b)          \
+    {                                                                                    \
+        return fun_(a.data(), b.data(), T());                                            \
+    }
+Vc_OP_(==, cmpeq)
+Vc_OP_(!=, cmpneq)
+Vc_OP_(>=, cmpge)
+Vc_OP_(<=, cmple)
+Vc_OP_(> , cmpgt)
+Vc_OP_(< , cmplt)
+#undef Vc_OP_
+
+// bitwise operators {{{1
+template <typename T>
+Vc_INTRINSIC Vc::Vector<T, VectorAbi::Avx512> operator^(Vc::Vector<T, VectorAbi::Avx512> a,
+                                                        Vc::Vector<T, VectorAbi::Avx512> b)
+{
+    return xor_(a.data(), b.data());
+}
+template <typename T>
+Vc_INTRINSIC Vc::Vector<T, VectorAbi::Avx512> operator&(Vc::Vector<T, VectorAbi::Avx512> a,
+                                                        Vc::Vector<T, VectorAbi::Avx512> b)
+{
+    return and_(a.data(), b.data());
+}
+template <typename T>
+Vc_INTRINSIC Vc::Vector<T, VectorAbi::Avx512> operator|(Vc::Vector<T, VectorAbi::Avx512> a,
+                                                        Vc::Vector<T, VectorAbi::Avx512> b)
+{
+    return or_(a.data(), b.data());
+}
+// }}}1
+// arithmetic operators {{{1
+template <typename T>
+Vc_INTRINSIC Vc::Vector<T, VectorAbi::Avx512> operator+(Vc::Vector<T, VectorAbi::Avx512> a,
+                                                        Vc::Vector<T, VectorAbi::Avx512> b)
+{
+    return add(a.data(), b.data(), T());
+}
+template <typename T>
+Vc_INTRINSIC Vc::Vector<T, VectorAbi::Avx512> operator-(Vc::Vector<T, VectorAbi::Avx512> a,
+                                                        Vc::Vector<T, VectorAbi::Avx512> b)
+{
+    return sub(a.data(), b.data(), T());
+}
+template <typename T>
+Vc_INTRINSIC Vc::Vector<T, VectorAbi::Avx512> operator*(Vc::Vector<T, VectorAbi::Avx512> a,
+                                                        Vc::Vector<T, VectorAbi::Avx512> b)
+{
+    return mul(a.data(), b.data(), T());
+}
+template <typename T>
+Vc_INTRINSIC Vc::Vector<T, VectorAbi::Avx512> operator/(Vc::Vector<T, VectorAbi::Avx512> a,
+                                                        Vc::Vector<T, VectorAbi::Avx512> b)
+{
+    return div(a.data(), b.data(), T());
+}
+template <typename T>
+Vc_INTRINSIC enable_if<std::is_integral<T>::value, Vc::Vector<T, VectorAbi::Avx512>>
+operator%(Vc::Vector<T, VectorAbi::Avx512> a, Vc::Vector<T, VectorAbi::Avx512> b)
+{
+    return a - a / b * b;
+}
+// }}}1
+}  // namespace Detail
+///////////////////////////////////////////////////////////////////////////////////////////
+// generate {{{1
+template <typename T>
+template <typename G>
+Vc_INTRINSIC Vector<T, VectorAbi::Avx512> Vector<T, VectorAbi::Avx512>::generate(G gen)
+{
+    alignas(64) T tmp[Size];
+    for (size_t i = 0; i < Size; ++i) {
+        tmp[i] = gen(i);
+    }
+    return Vector(tmp, Vc::Aligned);
+}
+
+// constants {{{1
+template <typename T> Vc_INTRINSIC Vector<T, VectorAbi::Avx512>::Vector(VectorSpecialInitializerZero) : d{} {}
+
+template <> Vc_INTRINSIC Vector<double, VectorAbi::Avx512>::Vector(VectorSpecialInitializerOne) : d(AVX512::setone_pd()) {}
+template <> Vc_INTRINSIC Vector< float, VectorAbi::Avx512>::Vector(VectorSpecialInitializerOne) : d(AVX512::setone_ps()) {}
+template <> Vc_INTRINSIC Vector<   int, VectorAbi::Avx512>::Vector(VectorSpecialInitializerOne) : d(AVX512::setone_epi32()) {}
+template <> Vc_INTRINSIC Vector<  uint, VectorAbi::Avx512>::Vector(VectorSpecialInitializerOne) : d(AVX512::setone_epi32()) {}
+
+template <>
+Vc_ALWAYS_INLINE Vector<double, VectorAbi::Avx512>::Vector(
+    VectorSpecialInitializerIndexesFromZero)
+    : d(_mm512_cvtepi32_pd(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)))
+{
+}
+template <>
+Vc_ALWAYS_INLINE Vector<float, VectorAbi::Avx512>::Vector(
+    VectorSpecialInitializerIndexesFromZero)
+    : d(_mm512_cvtepi32_ps(
+          _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)))
+{
+}
+template <>
+Vc_ALWAYS_INLINE Vector<int, VectorAbi::Avx512>::Vector(
+    VectorSpecialInitializerIndexesFromZero)
+    : d(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15))
+{
+}
+template <>
+Vc_ALWAYS_INLINE Vector<uint, VectorAbi::Avx512>::Vector(
+    VectorSpecialInitializerIndexesFromZero)
+    : d(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15))
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////
+// load member functions {{{1
+// general load, implemented via LoadHelper {{{2
+template <typename DstT>
+template <typename SrcT, typename Flags>
+Vc_INTRINSIC typename Vector<DstT, VectorAbi::Avx512>::
+#ifndef Vc_MSVC
+template
+#endif
+load_concept<SrcT, Flags>::type Vector<DstT, VectorAbi::Avx512>::load(const SrcT *mem, Flags flags)
+{
+    Common::handleLoadPrefetches(mem, flags);
+    d.v() = Detail::load<VectorType, DstT>(mem, flags);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////
+// zeroing {{{1
+template<typename T> Vc_INTRINSIC void Vector<T, VectorAbi::Avx512>::setZero()
+{
+    data() = Detail::zero<VectorType>();
+}
+template<typename T> Vc_INTRINSIC void Vector<T, VectorAbi::Avx512>::setZero(const Mask &k)
+{
+    data() = Detail::blend(data(), Detail::zero<VectorType>(), k.data());
+}
+template<typename T> Vc_INTRINSIC void Vector<T, VectorAbi::Avx512>::setZeroInverted(const Mask &k)
+{
+    data() = Detail::blend(Detail::zero<VectorType>(), data(), k.data());
+}
+
+template<typename T> Vc_INTRINSIC void Vector<T, VectorAbi::Avx512>::setQnan()
+{
+    static_assert(std::is_floating_point<T>::value, "only floating-point vectors hold NaNs");
+    data() = Detail::allone<VectorType>();
+}
+template<typename T> Vc_INTRINSIC void Vector<T, VectorAbi::Avx512>::setQnan(MaskArgument k)
+{
+    static_assert(std::is_floating_point<T>::value, "only floating-point vectors hold NaNs");
+    data() = Detail::blend(data(), Detail::allone<VectorType>(), k.data());
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////
+// stores {{{1
+template <typename T>
+template <typename U,
+          typename Flags,
+          typename>
+Vc_INTRINSIC void Vector<T, VectorAbi::Avx512>::store(U *mem, Flags flags) const
+{
+    Common::handleStorePrefetches(mem, flags);
+    HV::template store<Flags>(mem, data());
+}
+
+template <typename T>
+template <typename U,
+          typename Flags,
+          typename>
+Vc_INTRINSIC void Vector<T, VectorAbi::Avx512>::store(U *mem, Mask mask, Flags flags) const
+{
+    Common::handleStorePrefetches(mem, flags);
+    HV::template store<Flags>(mem, data(), mask.data());
+}
+
+template <typename T>
+template <typename Flags, typename>
+Vc_INTRINSIC void Vector<T, VectorAbi::Avx512>::store(half *mem, Flags flags) const
+{
+    static_assert(std::is_same<T, float>::value, "only float vectors convert to half");
+    Common::handleStorePrefetches(mem, flags);
+    const __m256i h = _mm512_cvtps_ph(data(), _MM_FROUND_TO_NEAREST_INT);
+    if (Flags::IsStreaming) {
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(mem), h);
+    } else if (Flags::IsUnaligned) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(mem), h);
+    } else {
+        _mm256_store_si256(reinterpret_cast<__m256i *>(mem), h);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////
+// integer ops {{{1
+template <> Vc_ALWAYS_INLINE AVX512::Vector< int> Vector< int, VectorAbi::Avx512>::operator<<(AsArg x) const { return _mm512_sllv_epi32(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE AVX512::Vector<uint> Vector<uint, VectorAbi::Avx512>::operator<<(AsArg x) const { return _mm512_sllv_epi32(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE AVX512::Vector< int> Vector< int, VectorAbi::Avx512>::operator>>(AsArg x) const { return _mm512_srav_epi32(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE AVX512::Vector<uint> Vector<uint, VectorAbi::Avx512>::operator>>(AsArg x) const { return _mm512_srlv_epi32(d.v(), x.d.v()); }
+template <typename T>
+Vc_ALWAYS_INLINE Vector<T, VectorAbi::Avx512> &Vector<T, VectorAbi::Avx512>::operator<<=(AsArg x)
+{
+    static_assert(std::is_integral<T>::value,
+                  "bitwise-operators can only be used with Vectors of integral type");
+    return *this = *this << x;
+}
+template <typename T>
+Vc_ALWAYS_INLINE Vector<T, VectorAbi::Avx512> &Vector<T, VectorAbi::Avx512>::operator>>=(AsArg x)
+{
+    static_assert(std::is_integral<T>::value,
+                  "bitwise-operators can only be used with Vectors of integral type");
+    return *this = *this >> x;
+}
+
+template<typename T> Vc_ALWAYS_INLINE Vector<T, VectorAbi::Avx512> &Vector<T, VectorAbi::Avx512>::operator>>=(int shift) {
+    d.v() = Detail::shiftRight(d.v(), shift, T());
+    return *this;
+}
+template<typename T> Vc_ALWAYS_INLINE Vc_PURE Vector<T, VectorAbi::Avx512> Vector<T, VectorAbi::Avx512>::operator>>(int shift) const {
+    return Detail::shiftRight(d.v(), shift, T());
+}
+template<typename T> Vc_ALWAYS_INLINE Vector<T, VectorAbi::Avx512> &Vector<T, VectorAbi::Avx512>::operator<<=(int shift) {
+    d.v() = Detail::shiftLeft(d.v(), shift, T());
+    return *this;
+}
+template<typename T> Vc_ALWAYS_INLINE Vc_PURE Vector<T, VectorAbi::Avx512> Vector<T, VectorAbi::Avx512>::operator<<(int shift) const {
+    return Detail::shiftLeft(d.v(), shift, T());
+}
+
+// isnegative {{{1
+Vc_INTRINSIC Vc_CONST AVX512::float_m isnegative(AVX512::float_v x)
+{
+    return _mm512_movepi32_mask(_mm512_castps_si512(x.data()));
+}
+Vc_INTRINSIC Vc_CONST AVX512::double_m isnegative(AVX512::double_v x)
+{
+    return _mm512_movepi64_mask(_mm512_castpd_si512(x.data()));
+}
+// gathers {{{1
+#ifdef Vc_HARDWARE_GATHERS
+namespace Detail
+{
+// The 512-bit gathers take sixteen 32-bit indexes in a __m512i, or eight in a __m256i for
+// the double gather. They sign-extend the indexes, therefore the uint index vectors use
+// the emulation. The masked instructions take the k-mask of the Mask object directly.
+Vc_INTRINSIC __m512i gatherIndexes(const AVX512::int_v &i) { return i.data(); }
+Vc_INTRINSIC __m512i gatherIndexes(const SimdArray<int, 16, AVX512::int_v, 16> &i)
+{
+    return internal_data(i).data();
+}
+
+Vc_INTRINSIC bool hardwareGather(__m512 &r, const float *mem, __m512i i)
+{
+    r = _mm512_i32gather_ps(i, mem, 4);
+    return true;
+}
+template <typename MT>
+Vc_INTRINSIC enable_if<(std::is_same<MT, int>::value || std::is_same<MT, uint>::value), bool>
+hardwareGather(__m512i &r, const MT *mem, __m512i i)
+{
+    r = _mm512_i32gather_epi32(i, mem, 4);
+    return true;
+}
+Vc_INTRINSIC bool hardwareGather(__m512d &r, const double *mem, __m256i i)
+{
+    r = _mm512_i32gather_pd(i, mem, 8);
+    return true;
+}
+
+template <typename M>
+Vc_INTRINSIC bool hardwareGather(__m512 &r, const float *mem, __m512i i, const M &k)
+{
+    if (!Common::useHardwareGather<float>(k)) {
+        return false;
+    }
+    r = _mm512_mask_i32gather_ps(r, k.data(), i, mem, 4);
+    return true;
+}
+template <typename MT, typename M>
+Vc_INTRINSIC enable_if<(std::is_same<MT, int>::value || std::is_same<MT, uint>::value), bool>
+hardwareGather(__m512i &r, const MT *mem, __m512i i, const M &k)
+{
+    if (!Common::useHardwareGather<MT>(k)) {
+        return false;
+    }
+    r = _mm512_mask_i32gather_epi32(r, k.data(), i, mem, 4);
+    return true;
+}
+template <typename M>
+Vc_INTRINSIC bool hardwareGather(__m512d &r, const double *mem, __m256i i, const M &k)
+{
+    if (!Common::useHardwareGather<double>(k)) {
+        return false;
+    }
+    r = _mm512_mask_i32gather_pd(r, k.data(), i, mem, 8);
+    return true;
+}
+}  // namespace Detail
+#endif  // Vc_HARDWARE_GATHERS
+
+template <typename T>
+template <typename MT, typename IT>
+inline void Vector<T, VectorAbi::Avx512>::gatherImplementation(const MT *mem, IT &&indexes)
+{
+#ifdef Vc_HARDWARE_GATHERS
+    if (Detail::hardwareGather(d.v(), mem, Detail::gatherIndexes(indexes))) {
+        return;
+    }
+#endif
+    Common::unrolled_loop<std::size_t, 0, Size>(
+        [&](std::size_t i) { d.set(i, mem[indexes[i]]); });
+}
+
+template <typename T>
+template <typename MT, typename IT>
+inline void Vector<T, VectorAbi::Avx512>::gatherImplementation(const MT *mem, IT &&indexes, MaskArgument mask)
+{
+    using Selector = std::integral_constant < Common::GatherScatterImplementation,
+#ifdef Vc_USE_SET_GATHERS
+          Traits::is_simd_vector<IT>::value ? Common::GatherScatterImplementation::SetIndexZero :
+#endif
+#ifdef Vc_USE_BSF_GATHERS
+                                            Common::GatherScatterImplementation::BitScanLoop
+#elif defined Vc_USE_POPCNT_BSF_GATHERS
+              Common::GatherScatterImplementation::PopcntSwitch
+#else
+              Common::GatherScatterImplementation::SimpleLoop
+#endif
+                                                > ;
+#ifdef Vc_HARDWARE_GATHERS
+    if (Detail::hardwareGather(d.v(), mem, Detail::gatherIndexes(indexes), mask)) {
+        return;
+    }
+#endif
+    Common::executeGather(Selector(), *this, mem, std::forward<IT>(indexes), mask);
+}
+
+template <typename T>
+template <typename MT, typename IT>
+inline void Vector<T, VectorAbi::Avx512>::scatterImplementation(MT *mem, IT &&indexes) const
+{
+    Common::unrolled_loop<std::size_t, 0, Size>([&](std::size_t i) { mem[indexes[i]] = d.m(i); });
+}
+
+template <typename T>
+template <typename MT, typename IT>
+inline void Vector<T, VectorAbi::Avx512>::scatterImplementation(MT *mem, IT &&indexes, MaskArgument mask) const
+{
+    using Selector = std::integral_constant < Common::GatherScatterImplementation,
+#ifdef Vc_USE_SET_GATHERS
+          Traits::is_simd_vector<IT>::value ? Common::GatherScatterImplementation::SetIndexZero :
+#endif
+#ifdef Vc_USE_BSF_GATHERS
+                                            Common::GatherScatterImplementation::BitScanLoop
+#elif defined Vc_USE_POPCNT_BSF_GATHERS
+              Common::GatherScatterImplementation::PopcntSwitch
+#else
+              Common::GatherScatterImplementation::SimpleLoop
+#endif
+                                                > ;
+    Common::executeScatter(Selector(), *this, mem, std::forward<IT>(indexes), mask);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////
+// operator- {{{1
+template<typename T> Vc_ALWAYS_INLINE Vc_PURE Vector<T, VectorAbi::Avx512> Vector<T, VectorAbi::Avx512>::operator-() const
+{
+    return Detail::negate(d.v(), std::integral_constant<std::size_t, sizeof(T)>());
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////
+// horizontal ops {{{1
+template <typename T>
+Vc_INTRINSIC std::pair<Vector<T, VectorAbi::Avx512>, int>
+Vector<T, VectorAbi::Avx512>::minIndex() const
+{
+    Vector x = min();
+    return std::make_pair(x, (*this == x).firstOne());
+}
+template <typename T>
+Vc_INTRINSIC std::pair<Vector<T, VectorAbi::Avx512>, int>
+Vector<T, VectorAbi::Avx512>::maxIndex() const
+{
+    Vector x = max();
+    return std::make_pair(x, (*this == x).firstOne());
+}
+template<typename T> Vc_ALWAYS_INLINE Vector<T, VectorAbi::Avx512> Vector<T, VectorAbi::Avx512>::partialSum() const
+{
+    Vector tmp = *this;
+    if (Size >  1) tmp += tmp.shifted(-1);
+    if (Size >  2) tmp += tmp.shifted(-2);
+    if (Size >  4) tmp += tmp.shifted(-4);
+    if (Size >  8) tmp += tmp.shifted(-8);
+    return tmp;
+}
+
+template<typename T> Vc_ALWAYS_INLINE typename Vector<T, VectorAbi::Avx512>::EntryType Vector<T, VectorAbi::Avx512>::min(MaskArgument m) const
+{
+    Vector tmp = std::numeric_limits<T>::max();
+    tmp(m) = *this;
+    return tmp.min();
+}
+template<typename T> Vc_ALWAYS_INLINE typename Vector<T, VectorAbi::Avx512>::EntryType Vector<T, VectorAbi::Avx512>::max(MaskArgument m) const
+{
+    Vector tmp = std::numeric_limits<T>::lowest();
+    tmp(m) = *this;
+    return tmp.max();
+}
+template<typename T> Vc_ALWAYS_INLINE typename Vector<T, VectorAbi::Avx512>::EntryType Vector<T, VectorAbi::Avx512>::product(MaskArgument m) const
+{
+    Vector tmp(Vc::One);
+    tmp(m) = *this;
+    return tmp.product();
+}
+template<typename T> Vc_ALWAYS_INLINE typename Vector<T, VectorAbi::Avx512>::EntryType Vector<T, VectorAbi::Avx512>::sum(MaskArgument m) const
+{
+    Vector tmp(Vc::Zero);
+    tmp(m) = *this;
+    return tmp.sum();
+}//}}}
+// exponent {{{1
+Vc_INTRINSIC Vc_CONST AVX512::float_v exponent(AVX512::float_v x)
+{
+    using Detail::operator>=;
+    Vc_ASSERT((x >= x.Zero()).isFull());
+    return _mm512_getexp_ps(x.data());
+}
+Vc_INTRINSIC Vc_CONST AVX512::double_v exponent(AVX512::double_v x)
+{
+    using Detail::operator>=;
+    Vc_ASSERT((x >= x.Zero()).isFull());
+    return _mm512_getexp_pd(x.data());
+}
+// }}}1
+// Random {{{1
+template<typename T> Vc_ALWAYS_INLINE Vector<T, VectorAbi::Avx512> Vector<T, VectorAbi::Avx512>::Random()
+{
+    return Common::randomVector<Vector>();
+}
+// }}}1
+// shifted / rotated {{{1
+template<typename T> Vc_INTRINSIC Vector<T, VectorAbi::Avx512> Vector<T, VectorAbi::Avx512>::shifted(int amount) const
+{
+    return Detail::shifted<EntryType>(d.v(), amount);
+}
+template<typename T> Vc_INTRINSIC Vector<T, VectorAbi::Avx512> Vector<T, VectorAbi::Avx512>::shifted(int amount, Vector shiftIn) const
+{
+    using Detail::operator|;
+    return shifted(amount) | (amount > 0 ?
+                              shiftIn.shifted(amount - Size) :
+                              shiftIn.shifted(Size + amount));
+}
+template<typename T> Vc_INTRINSIC Vector<T, VectorAbi::Avx512> Vector<T, VectorAbi::Avx512>::rotated(int amount) const
+{
+    return Detail::rotated<EntryType, Size>(d.v(), amount);
+}
+// sorted {{{1
+template <typename T>
+Vc_ALWAYS_INLINE Vc_PURE Vector<T, VectorAbi::Avx512> Vector<T, VectorAbi::Avx512>::sorted()
+    const
+{
+    return Detail::sorted(*this);
+}
+// interleaveLow/-High {{{1
+template <> Vc_INTRINSIC AVX512::double_v AVX512::double_v::interleaveLow(AVX512::double_v x) const
+{
+    return _mm512_permutex2var_pd(data(), _mm512_setr_epi64(0, 8, 1, 9, 2, 10, 3, 11), x.data());
+}
+template <> Vc_INTRINSIC AVX512::double_v AVX512::double_v::interleaveHigh(AVX512::double_v x) const
+{
+    return _mm512_permutex2var_pd(data(), _mm512_setr_epi64(4, 12, 5, 13, 6, 14, 7, 15), x.data());
+}
+template <> Vc_INTRINSIC AVX512::float_v AVX512::float_v::interleaveLow(AVX512::float_v x) const
+{
+    return _mm512_permutex2var_ps(
+        data(), _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23),
+        x.data());
+}
+template <> Vc_INTRINSIC AVX512::float_v AVX512::float_v::interleaveHigh(AVX512::float_v x) const
+{
+    return _mm512_permutex2var_ps(
+        data(), _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31),
+        x.data());
+}
+template <> Vc_INTRINSIC AVX512::int_v AVX512::int_v::interleaveLow(AVX512::int_v x) const
+{
+    return _mm512_permutex2var_epi32(
+        data(), _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23),
+        x.data());
+}
+template <> Vc_INTRINSIC AVX512::int_v AVX512::int_v::interleaveHigh(AVX512::int_v x) const
+{
+    return _mm512_permutex2var_epi32(
+        data(), _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31),
+        x.data());
+}
+template <> Vc_INTRINSIC AVX512::uint_v AVX512::uint_v::interleaveLow(AVX512::uint_v x) const
+{
+    return _mm512_permutex2var_epi32(
+        data(), _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23),
+        x.data());
+}
+template <> Vc_INTRINSIC AVX512::uint_v AVX512::uint_v::interleaveHigh(AVX512::uint_v x) const
+{
+    return _mm512_permutex2var_epi32(
+        data(), _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31),
+        x.data());
+}
+// permutation via operator[] {{{1
+template <> Vc_INTRINSIC Vc_PURE AVX512::double_v AVX512::double_v::operator[](Permutation::ReversedTag) const
+{
+    return _mm512_permutexvar_pd(_mm512_setr_epi64(7, 6, 5, 4, 3, 2, 1, 0), d.v());
+}
+template <> Vc_INTRINSIC Vc_PURE AVX512::float_v AVX512::float_v::operator[](Permutation::ReversedTag) const
+{
+    return _mm512_permutexvar_ps(
+        _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0), d.v());
+}
+template <> Vc_INTRINSIC Vc_PURE AVX512::int_v AVX512::int_v::operator[](Permutation::ReversedTag) const
+{
+    return _mm512_permutexvar_epi32(
+        _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0), d.v());
+}
+template <> Vc_INTRINSIC Vc_PURE AVX512::uint_v AVX512::uint_v::operator[](Permutation::ReversedTag) const
+{
+    return _mm512_permutexvar_epi32(
+        _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0), d.v());
+}
+template <> Vc_INTRINSIC AVX512::double_v AVX512::double_v::operator[](const IndexType &perm) const
+{
+    return _mm512_permutexvar_pd(_mm512_cvtepi32_epi64(internal_data(perm).data()), d.v());
+}
+template <> Vc_INTRINSIC AVX512::float_v AVX512::float_v::operator[](const IndexType &perm) const
+{
+    return _mm512_permutexvar_ps(internal_data(perm).data(), d.v());
+}
+template <> Vc_INTRINSIC AVX512::int_v AVX512::int_v::operator[](const IndexType &perm) const
+{
+    return _mm512_permutexvar_epi32(internal_data(perm).data(), d.v());
+}
+template <> Vc_INTRINSIC AVX512::uint_v AVX512::uint_v::operator[](const IndexType &perm) const
+{
+    return _mm512_permutexvar_epi32(internal_data(perm).data(), d.v());
+}
+
+// reversed {{{1
+template <typename T>
+Vc_INTRINSIC Vc_PURE Vector<T, VectorAbi::Avx512> Vector<T, VectorAbi::Avx512>::reversed() const
+{
+    return (*this)[Permutation::Reversed];
+}
+
+// broadcast from constexpr index {{{1
+template <typename T>
+template <int Index>
+Vc_INTRINSIC Vector<T, VectorAbi::Avx512> Vector<T, VectorAbi::Avx512>::broadcast() const
+{
+    static_assert(Index >= 0 && Index < int(Size), "the index must address an entry");
+    return AVX512::avx512_cast<VectorType>(
+        sizeof(T) == 8
+            ? _mm512_permutexvar_epi64(_mm512_set1_epi64(Index),
+                                       AVX512::avx512_cast<__m512i>(d.v()))
+            : _mm512_permutexvar_epi32(_mm512_set1_epi32(Index),
+                                       AVX512::avx512_cast<__m512i>(d.v())));
+}
+// }}}1
+}  // namespace Vc
+
+// vim: foldmethod=marker
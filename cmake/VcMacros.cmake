@@ -159,12 +159,17 @@ macro(vc_check_assembler)
          UserWarning("Your binutils is too old (${_as_version}). Some optimizations of Vc will be disabled.")
          set(Vc_DEFINITIONS "${Vc_DEFINITIONS} -DVc_NO_XGETBV") # old assembler doesn't know the xgetbv instruction
          set(Vc_AVX_INTRINSICS_BROKEN true)
+         set(Vc_AVX512_INTRINSICS_BROKEN true)
          set(Vc_XOP_INTRINSICS_BROKEN true)
          set(Vc_FMA4_INTRINSICS_BROKEN true)
       elseif(_as_version VERSION_LESS "2.21.0")
          UserWarning("Your binutils is too old (${_as_version}) for XOP and AVX2 instructions. They will therefore not be provided in libVc.")
          set(Vc_XOP_INTRINSICS_BROKEN true)
          set(Vc_AVX2_INTRINSICS_BROKEN true)
+         set(Vc_AVX512_INTRINSICS_BROKEN true)
+      elseif(_as_version VERSION_LESS "2.25.0")
+         UserWarning("Your binutils is too old (${_as_version}) for AVX512 instructions. They will therefore not be provided in libVc.")
+         set(Vc_AVX512_INTRINSICS_BROKEN true)
       endif()
    endif()
 endmacro()
@@ -185,6 +190,7 @@ macro(vc_set_preferred_compiler_flags)
    set(Vc_SSE_INTRINSICS_BROKEN false)
    set(Vc_AVX_INTRINSICS_BROKEN false)
    set(Vc_AVX2_INTRINSICS_BROKEN false)
+   set(Vc_AVX512_INTRINSICS_BROKEN false)
    set(Vc_XOP_INTRINSICS_BROKEN false)
    set(Vc_FMA4_INTRINSICS_BROKEN false)
 
@@ -220,6 +226,7 @@ macro(vc_set_preferred_compiler_flags)
       # Open64 4.5.1 still doesn't ship immintrin.h
       set(Vc_AVX_INTRINSICS_BROKEN true)
       set(Vc_AVX2_INTRINSICS_BROKEN true)
+      set(Vc_AVX512_INTRINSICS_BROKEN true)
    elseif(Vc_COMPILER_IS_GCC)
       ##################################################################################################
       #                                              GCC                                               #
@@ -317,6 +324,7 @@ macro(vc_set_preferred_compiler_flags)
          UserWarning("Clang 3.6 has serious issues with AVX code generation, frequently losing 50% of the data. AVX is therefore disabled.\nPlease update to a more recent clang version.\n")
          set(Vc_AVX_INTRINSICS_BROKEN true)
          set(Vc_AVX2_INTRINSICS_BROKEN true)
+         set(Vc_AVX512_INTRINSICS_BROKEN true)
       endif()
 
       # disable these warnings because clang shows them for function overloads that were discarded via SFINAE
@@ -336,6 +344,8 @@ macro(vc_set_preferred_compiler_flags)
          set(_use_var "USE_${Vc_IMPL}")
          if(Vc_IMPL STREQUAL "SSE")
             set(_use_var "USE_SSE2")
+         elseif(Vc_IMPL STREQUAL "AVX512")
+            set(_use_var "USE_AVX512VL")
          endif()
          if(NOT ${_use_var})
             message(WARNING "The selected value for Vc_IMPL (${Vc_IMPL}) will not work because the relevant instructions are not enabled via compiler flags.")
@@ -355,7 +365,7 @@ macro(_vc_compile_one_implementation _srcs _impl)
       endif()
       list(REMOVE_AT _disabled_targets ${_disabled_index})
       # skip the rest and return
-   elseif(NOT _only_targets OR ${_only_index} GREATER -1)
+   elseif(NOT _only_given OR ${_only_index} GREATER -1)
       if(${_only_index} GREATER -1)
          list(REMOVE_AT _only_targets ${_only_index})
       endif()
@@ -416,6 +426,7 @@ macro(vc_compile_for_all_implementations _srcs _src)
    set(_flags)
    unset(_disabled_targets)
    unset(_only_targets)
+   set(_only_given FALSE)
    set(_state 0)
    foreach(_arg ${ARGN})
       if(_arg STREQUAL "FLAGS")
@@ -424,6 +435,7 @@ macro(vc_compile_for_all_implementations _srcs _src)
          set(_state 2)
       elseif(_arg STREQUAL "ONLY")
          set(_state 3)
+         set(_only_given TRUE)
       elseif(_state EQUAL 1)
          set(_flags "${_flags} ${_arg}")
       elseif(_state EQUAL 2)
@@ -465,6 +477,11 @@ macro(vc_compile_for_all_implementations _srcs _src)
       #_vc_compile_one_implementation(${_srcs} AVX2+BMI2 "-mavx2 -mbmi2")
       _vc_compile_one_implementation(${_srcs} AVX2+FMA+BMI2 "-xCORE-AVX2" "-mavx2 -mfma -mbmi2" "/arch:AVX2")
       #_vc_compile_one_implementation(${_srcs} AVX2+FMA "-mavx2 -mfma")
+      if(NOT Vc_AVX512_INTRINSICS_BROKEN)
+         # AVX512 here means the Skylake-SP subset: F + BW + DQ + VL
+         _vc_compile_one_implementation(${_srcs} AVX512+FMA+BMI2 "-xCORE-AVX512"
+            "-mavx512f -mavx512vl -mavx512bw -mavx512dq -mfma -mbmi2" "/arch:AVX512")
+      endif()
    endif()
    list(LENGTH _only_targets _len)
    if(_len GREATER 0)
@@ -28,6 +28,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef VC_COMMON_ALGORITHMS_H_
 #define VC_COMMON_ALGORITHMS_H_
 
+#include <algorithm>
+#include <iterator>
 #include "macros.h"
 
 namespace Vc_VERSIONED_NAMESPACE
@@ -98,7 +100,7 @@ simd_for_each(InputIt first, InputIt last, UnaryFunction f)
     for (; first != last; ++first) {
         f(V1(std::addressof(*first), Vc::Aligned));
     }
-    return std::move(f);
+    return f;
 }
 
 template <typename InputIt, typename UnaryFunction>
@@ -129,7 +131,7 @@ simd_for_each(InputIt first, InputIt last, UnaryFunction f)
         f(tmp);
         tmp.store(std::addressof(*first), Vc::Aligned);
     }
-    return std::move(f);
+    return f;
 }
 
 template <typename InputIt, typename UnaryFunction>
@@ -162,7 +164,7 @@ simd_for_each_n(InputIt first, std::size_t count, UnaryFunction f)
     for (; len != 0; --len, ++first) {
         f(V1(std::addressof(*first), Vc::Aligned));
     }
-    return std::move(f);
+    return f;
 }
 
 template <typename InputIt, typename UnaryFunction>
@@ -193,7 +195,7 @@ simd_for_each_n(InputIt first, std::size_t count, UnaryFunction f)
         f(tmp);
         tmp.store(std::addressof(*first), Vc::Aligned);
     }
-    return std::move(f);
+    return f;
 }
 
 #ifdef Vc_CXX17
@@ -205,6 +207,417 @@ simd_for_each_n(InputIt first, std::size_t count, UnaryFunction f)
 }
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * \ingroup Utilities
+ *
+ * The type of MaskedEpilogue.
+ */
+struct MaskedEpilogueTag {
+};
+
+/**
+ * \ingroup Utilities
+ *
+ * Pass this object as first argument to simd_for_each or simd_for_each_n to process the
+ * elements before the first aligned address and the remainder at the end of the range as
+ * one partial Vc::Vector each, instead of calling the functor with one Vc::Scalar::Vector
+ * per element. Thus the functor is only ever called with Vc::Vector<T> and at most two
+ * calls process less than \c V::Size elements.
+ *
+ * The partial vectors are loaded from a zero-initialized buffer, i.e. the lanes that do not
+ * correspond to an element of the range are zero. Only the lanes of the range are written
+ * back. The functor must ensure that the extra lanes do not affect its side effects (e.g.
+ * a reduction into a captured variable).
+ *
+ * \code
+ * Vc::simd_for_each(Vc::MaskedEpilogue, data.begin(), data.end(), [](float_v &x) { x = sqrt(x); });
+ * \endcode
+ */
+constexpr MaskedEpilogueTag MaskedEpilogue = {};
+
+namespace Detail
+{
+template <typename V, typename UnaryFunction>
+Vc_INTRINSIC void simdForEachVector(UnaryFunction &f, typename V::EntryType *mem,
+                                    std::true_type)
+{
+    f(V(mem, Vc::Aligned));
+}
+template <typename V, typename UnaryFunction>
+Vc_INTRINSIC void simdForEachVector(UnaryFunction &f, typename V::EntryType *mem,
+                                    std::false_type)
+{
+    V tmp(mem, Vc::Aligned);
+    f(tmp);
+    tmp.store(mem, Vc::Aligned);
+}
+
+// calls f with a V that holds the n < V::Size elements starting at first in its low lanes
+template <typename V, typename InputIt, typename UnaryFunction>
+inline void simdForEachPartial(InputIt first, std::size_t n, UnaryFunction &f)
+{
+    typename V::EntryType buffer[V::Size] = {};
+    std::copy_n(first, n, buffer);
+    V tmp(buffer, Vc::Unaligned);
+    f(tmp);
+    if (!Traits::is_functor_argument_immutable<UnaryFunction, V>::value) {
+        tmp.store(buffer, Vc::Unaligned);
+        std::copy_n(buffer, n, first);
+    }
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ *
+ * Calls \p f for the \p count elements starting at \p first, using partial vectors for the
+ * elements that do not fill a whole aligned Vector (see MaskedEpilogue).
+ */
+template <typename InputIt, typename UnaryFunction>
+inline enable_if<std::is_arithmetic<typename InputIt::value_type>::value, UnaryFunction>
+simd_for_each_n(MaskedEpilogueTag, InputIt first, std::size_t count, UnaryFunction f)
+{
+    typedef Vector<typename InputIt::value_type> V;
+    typedef std::integral_constant<
+        bool, Traits::is_functor_argument_immutable<UnaryFunction, V>::value> Immutable;
+    if (count == 0) {
+        return f;
+    }
+    const std::size_t misalignment =
+        (reinterpret_cast<std::uintptr_t>(std::addressof(*first)) &
+         (V::MemoryAlignment - 1)) /
+        sizeof(typename InputIt::value_type);
+    if (misalignment != 0) {
+        const std::size_t head = std::min<std::size_t>(count, V::Size - misalignment);
+        Detail::simdForEachPartial<V>(first, head, f);
+        first += head;
+        count -= head;
+    }
+    for (; count >= V::Size; count -= V::Size, first += V::Size) {
+        Detail::simdForEachVector<V>(f, std::addressof(*first), Immutable());
+    }
+    if (count != 0) {
+        Detail::simdForEachPartial<V>(first, count, f);
+    }
+    return f;
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Calls \p f for the elements in [\p first, \p last), using partial vectors for the
+ * elements that do not fill a whole aligned Vector (see MaskedEpilogue).
+ */
+template <typename InputIt, typename UnaryFunction>
+inline enable_if<std::is_arithmetic<typename InputIt::value_type>::value, UnaryFunction>
+simd_for_each(MaskedEpilogueTag, InputIt first, InputIt last, UnaryFunction f)
+{
+    return simd_for_each_n(MaskedEpilogue, first, std::size_t(std::distance(first, last)),
+                           std::move(f));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * \ingroup Utilities
+ *
+ * Applies \p op to [\p first, \p last) and stores the results to \p d_first.
+ *
+ * \p op is called with Vc::Vector objects (and Vc::Scalar::Vector objects for the elements
+ * before the first aligned address and at the end of the range) and must return a vector
+ * of the same width, which is stored (unaligned) to the output range.
+ *
+ * \returns The output iterator one past the last stored element.
+ */
+template <typename InputIt, typename OutputIt, typename UnaryOperation>
+inline enable_if<
+    std::is_arithmetic<typename std::iterator_traits<InputIt>::value_type>::value,
+    OutputIt>
+simd_transform(InputIt first, InputIt last, OutputIt d_first, UnaryOperation op)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type T;
+    typedef Vector<T> V;
+    typedef Scalar::Vector<T> V1;
+    for (; first != last && reinterpret_cast<std::uintptr_t>(std::addressof(*first)) &
+                                (V::MemoryAlignment - 1);
+         ++first, ++d_first) {
+        op(V1(std::addressof(*first), Vc::Aligned))
+            .store(std::addressof(*d_first), Vc::Unaligned);
+    }
+    for (; last - first >= std::ptrdiff_t(V::Size); first += V::Size, d_first += V::Size) {
+        op(V(std::addressof(*first), Vc::Aligned))
+            .store(std::addressof(*d_first), Vc::Unaligned);
+    }
+    for (; first != last; ++first, ++d_first) {
+        op(V1(std::addressof(*first), Vc::Aligned))
+            .store(std::addressof(*d_first), Vc::Unaligned);
+    }
+    return d_first;
+}
+
+template <typename InputIt, typename OutputIt, typename UnaryOperation>
+inline enable_if<
+    !std::is_arithmetic<typename std::iterator_traits<InputIt>::value_type>::value,
+    OutputIt>
+simd_transform(InputIt first, InputIt last, OutputIt d_first, UnaryOperation op)
+{
+    return std::transform(first, last, d_first, std::move(op));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+namespace Detail
+{
+/**\internal
+ * Reduces the transformed elements of [\p first, \p last) into \p result. If \p
+ * hasResult is \c false, \p result is ignored and the first transformed element starts the
+ * reduction instead. (The range must not be empty in that case.)
+ */
+template <typename InputIt, typename BinaryOperation, typename UnaryOperation>
+Scalar::Vector<typename std::iterator_traits<InputIt>::value_type> transformReduce(
+    InputIt first, InputIt last,
+    Scalar::Vector<typename std::iterator_traits<InputIt>::value_type> result,
+    bool hasResult, BinaryOperation &reduce, UnaryOperation &transform)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type T;
+    typedef Vector<T> V;
+    typedef Scalar::Vector<T> V1;
+    auto &&accumulate = [&](const V1 &x) {
+        result = hasResult ? V1(reduce(result, x)) : x;
+        hasResult = true;
+    };
+    for (; first != last && reinterpret_cast<std::uintptr_t>(std::addressof(*first)) &
+                                (V::MemoryAlignment - 1);
+         ++first) {
+        accumulate(transform(V1(std::addressof(*first), Vc::Aligned)));
+    }
+    if (last - first >= std::ptrdiff_t(V::Size)) {
+        // reduce vertically and only once horizontally at the end
+        V acc = transform(V(std::addressof(*first), Vc::Aligned));
+        for (first += V::Size; last - first >= std::ptrdiff_t(V::Size); first += V::Size) {
+            acc = reduce(acc, transform(V(std::addressof(*first), Vc::Aligned)));
+        }
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            accumulate(V1(acc[i]));
+        }
+    }
+    for (; first != last; ++first) {
+        accumulate(transform(V1(std::addressof(*first), Vc::Aligned)));
+    }
+    return result;
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ *
+ * Applies \p transform to the elements of [\p first, \p last) and reduces the results
+ * together with \p init using \p reduce.
+ *
+ * Both functors are called with Vc::Vector and Vc::Scalar::Vector objects (see
+ * simd_transform). \p reduce must be associative and commutative, since the elements are
+ * combined in unspecified order: most are reduced lane-wise and the lanes are combined at
+ * the end.
+ *
+ * Unlike std::transform_reduce, the reduction is computed in the element type of the range
+ * (the vectors hold that type), not in \p T. Therefore \p T must be the element type; a
+ * wider accumulator requires widening the input range first.
+ *
+ * \code
+ * // sum of squares
+ * float r = Vc::simd_transform_reduce(data.begin(), data.end(), 0.f,
+ *                                     [](auto a, auto b) { return a + b; },
+ *                                     [](auto x) { return x * x; });
+ * \endcode
+ */
+template <typename InputIt, typename T, typename BinaryOperation, typename UnaryOperation>
+inline enable_if<
+    std::is_arithmetic<typename std::iterator_traits<InputIt>::value_type>::value, T>
+simd_transform_reduce(InputIt first, InputIt last, T init, BinaryOperation reduce,
+                      UnaryOperation transform)
+{
+    typedef Scalar::Vector<typename std::iterator_traits<InputIt>::value_type> V1;
+    static_assert(std::is_same<T, typename V1::EntryType>::value,
+                  "simd_transform_reduce reduces in the element type of the range. "
+                  "Therefore init must have the same type.");
+    return Detail::transformReduce(first, last, V1(init), true, reduce, transform)[0];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * \ingroup Utilities
+ *
+ * Returns the number of elements in [\p first, \p last) for which \p pred returns \c true.
+ *
+ * \p pred is called with Vc::Vector and Vc::Scalar::Vector objects (see simd_transform)
+ * and must return the corresponding mask type.
+ */
+template <typename InputIt, typename UnaryPredicate>
+inline enable_if<
+    std::is_arithmetic<typename std::iterator_traits<InputIt>::value_type>::value,
+    typename std::iterator_traits<InputIt>::difference_type>
+simd_count_if(InputIt first, InputIt last, UnaryPredicate pred)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type T;
+    typedef Vector<T> V;
+    typedef Scalar::Vector<T> V1;
+    typename std::iterator_traits<InputIt>::difference_type count = 0;
+    for (; first != last && reinterpret_cast<std::uintptr_t>(std::addressof(*first)) &
+                                (V::MemoryAlignment - 1);
+         ++first) {
+        count += pred(V1(std::addressof(*first), Vc::Aligned)).count();
+    }
+    for (; last - first >= std::ptrdiff_t(V::Size); first += V::Size) {
+        count += pred(V(std::addressof(*first), Vc::Aligned)).count();
+    }
+    for (; first != last; ++first) {
+        count += pred(V1(std::addressof(*first), Vc::Aligned)).count();
+    }
+    return count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * \ingroup Utilities
+ *
+ * Copies the elements of [\p first, \p last) for which \p pred returns \c true to the
+ * range starting at \p d_first, preserving their order.
+ *
+ * \p pred is called with Vc::Vector and Vc::Scalar::Vector objects (see simd_transform)
+ * and must return the corresponding mask type. The selected entries of each vector are
+ * packed with Vector::compressStore instead of testing the mask entry by entry. The output
+ * is written in whole vectors (unaligned) and only at the end of the range element-wise,
+ * so that no element after the last copied one is written. The output range may start at
+ * \p first (see simd_remove_if), but must not overlap the input range otherwise.
+ *
+ * \returns The output iterator one past the last copied element.
+ */
+template <typename InputIt, typename OutputIt, typename UnaryPredicate>
+inline enable_if<
+    std::is_arithmetic<typename std::iterator_traits<InputIt>::value_type>::value,
+    OutputIt>
+simd_copy_if(InputIt first, InputIt last, OutputIt d_first, UnaryPredicate pred)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type T;
+    typedef Vector<T> V;
+    typedef Scalar::Vector<T> V1;
+    for (; first != last && reinterpret_cast<std::uintptr_t>(std::addressof(*first)) &
+                                (V::MemoryAlignment - 1);
+         ++first) {
+        if (pred(V1(std::addressof(*first), Vc::Aligned))[0]) {
+            *d_first = *first;
+            ++d_first;
+        }
+    }
+    // the selected entries are collected in buffer until they fill a whole vector
+    alignas(V::MemoryAlignment) T buffer[2 * V::Size];
+    std::size_t n = 0;
+    for (; last - first >= std::ptrdiff_t(V::Size); first += V::Size) {
+        const V x(std::addressof(*first), Vc::Aligned);
+        n += Detail::compressUnchecked(buffer + n, x, pred(x));
+        if (n >= V::Size) {
+            V(buffer, Vc::Aligned).store(std::addressof(*d_first), Vc::Unaligned);
+            V(buffer + V::Size, Vc::Aligned).store(buffer, Vc::Aligned);
+            d_first += V::Size;
+            n -= V::Size;
+        }
+    }
+    d_first = std::copy_n(buffer, n, d_first);
+    for (; first != last; ++first) {
+        if (pred(V1(std::addressof(*first), Vc::Aligned))[0]) {
+            *d_first = *first;
+            ++d_first;
+        }
+    }
+    return d_first;
+}
+
+template <typename InputIt, typename OutputIt, typename UnaryPredicate>
+inline enable_if<
+    !std::is_arithmetic<typename std::iterator_traits<InputIt>::value_type>::value,
+    OutputIt>
+simd_copy_if(InputIt first, InputIt last, OutputIt d_first, UnaryPredicate pred)
+{
+    return std::copy_if(first, last, d_first, std::move(pred));
+}
+
+namespace Detail
+{
+template <typename UnaryPredicate> struct NegatedPredicate {
+    UnaryPredicate pred;
+    template <typename V> Vc_INTRINSIC auto operator()(const V &x) -> decltype(!pred(x))
+    {
+        return !pred(x);
+    }
+};
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ *
+ * Removes the elements of [\p first, \p last) for which \p pred returns \c true by moving
+ * the remaining elements to the front of the range, preserving their order (see
+ * simd_copy_if).
+ *
+ * \returns The iterator one past the last remaining element.
+ */
+template <typename ForwardIt, typename UnaryPredicate>
+inline enable_if<
+    std::is_arithmetic<typename std::iterator_traits<ForwardIt>::value_type>::value,
+    ForwardIt>
+simd_remove_if(ForwardIt first, ForwardIt last, UnaryPredicate pred)
+{
+    return simd_copy_if(first, last, first,
+                        Detail::NegatedPredicate<UnaryPredicate>{std::move(pred)});
+}
+
+template <typename ForwardIt, typename UnaryPredicate>
+inline enable_if<
+    !std::is_arithmetic<typename std::iterator_traits<ForwardIt>::value_type>::value,
+    ForwardIt>
+simd_remove_if(ForwardIt first, ForwardIt last, UnaryPredicate pred)
+{
+    return std::remove_if(first, last, std::move(pred));
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Converts the \p n half-precision values at \p src to float and stores them to \p dst.
+ * The conversion is exact. The arrays need no particular alignment and must not overlap.
+ *
+ * \see Vc::half
+ */
+inline void convert(const half *src, float *dst, std::size_t n)
+{
+    std::size_t i = 0;
+    for (; i + float_v::Size <= n; i += float_v::Size) {
+        float_v(src + i, Vc::Unaligned).store(dst + i, Vc::Unaligned);
+    }
+    for (; i < n; ++i) {
+        dst[i] = src[i];
+    }
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Converts the \p n float values at \p src to half precision (rounding to nearest even)
+ * and stores them to \p dst. The arrays need no particular alignment and must not
+ * overlap.
+ *
+ * \see Vc::half
+ */
+inline void convert(const float *src, half *dst, std::size_t n)
+{
+    std::size_t i = 0;
+    for (; i + float_v::Size <= n; i += float_v::Size) {
+        float_v(src + i, Vc::Unaligned).store(dst + i, Vc::Unaligned);
+    }
+    for (; i < n; ++i) {
+        dst[i] = src[i];
+    }
+}
+
 }  // namespace Vc
 
 #endif // VC_COMMON_ALGORITHMS_H_
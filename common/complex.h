@@ -0,0 +1,297 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_COMPLEX_H_
+#define VC_COMMON_COMPLEX_H_
+
+#include <complex>
+#include "deinterleave.h"
+#include "interleave.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// complex_load / complex_store{{{1
+// Vc::Vector uses the deinterleave kernels, SimdArray (no deinterleave) goes via the
+// entries.
+template <typename V, typename Flags>
+Vc_INTRINSIC enable_if<!Traits::isSimdArray<V>::value, void> complex_load(
+    V &re, V &im, const std::complex<typename V::EntryType> *mem, Flags flags)
+{
+    Vc::deinterleave(&re, &im, reinterpret_cast<const typename V::EntryType *>(mem), flags);
+}
+template <typename V, typename Flags>
+Vc_INTRINSIC enable_if<Traits::isSimdArray<V>::value, void> complex_load(
+    V &re, V &im, const std::complex<typename V::EntryType> *mem, Flags)
+{
+    re = V::generate([&](std::size_t i) { return mem[i].real(); });
+    im = V::generate([&](std::size_t i) { return mem[i].imag(); });
+}
+template <typename V, typename Flags>
+Vc_INTRINSIC void complex_store(const V &re, const V &im,
+                                std::complex<typename V::EntryType> *mem, Flags flags)
+{
+    const auto tmp = Vc::interleave(re, im);
+    auto *mem2 = reinterpret_cast<typename V::EntryType *>(mem);
+    tmp.first.store(mem2, flags);
+    tmp.second.store(mem2 + V::Size, flags);
+}
+//}}}1
+}  // namespace Detail
+
+/**
+ * \ingroup Math
+ *
+ * A vector of complex numbers, stored as one vector of real parts and one vector of
+ * imaginary parts (SoA).
+ *
+ * \tparam V A floating-point vector type, i.e. Vc::float_v, Vc::double_v, or a SimdArray of
+ *           float or double.
+ *
+ * The arithmetic follows the textbook formulas without the rescaling that std::complex
+ * applies against intermediate overflow and without special-casing infinite operands.
+ * Load and store convert from/to arrays of std::complex (AoS) using the deinterleave
+ * kernels:
+ * \code
+ * std::complex<float> *data = ...;
+ * Vc::complex<Vc::float_v> z(&data[i], Vc::Unaligned);
+ * (z * w).store(&data[i], Vc::Unaligned);
+ * \endcode
+ */
+template <typename V> class complex
+{
+    static_assert(std::is_floating_point<typename V::EntryType>::value,
+                  "Vc::complex requires a floating-point vector type");
+
+public:
+    /// The type of the real and imaginary parts.
+    using value_type = V;
+    /// The scalar type of the entries of the real and imaginary parts.
+    using EntryType = typename V::EntryType;
+    /// The number of complex values in the object.
+    static constexpr std::size_t Size = V::Size;
+
+    // constructors{{{2
+    /// Initializes all entries to zero (like std::complex, also for `complex<V> z;`).
+    Vc_INTRINSIC complex() : m_re(V::Zero()), m_im(V::Zero()) {}
+    /// Initializes the real parts from \p re and the imaginary parts from \p im.
+    Vc_INTRINSIC complex(const V &re, const V &im = V::Zero()) : m_re(re), m_im(im) {}
+    /// Broadcasts \p z to all entries.
+    explicit Vc_INTRINSIC complex(const std::complex<EntryType> &z)
+        : m_re(z.real()), m_im(z.imag())
+    {
+    }
+    /// Loads \VSize{T} consecutive complex values from \p mem.
+    template <typename Flags = DefaultLoadTag,
+              typename = enable_if<Traits::is_load_store_flag<Flags>::value>>
+    explicit Vc_INTRINSIC complex(const std::complex<EntryType> *mem, Flags f = Flags())
+    {
+        load(mem, f);
+    }
+
+    // load/store{{{2
+    /**
+     * Loads \VSize{T} consecutive complex values from \p mem. With the Vc::Aligned flag
+     * \p mem must be aligned to the vector alignment.
+     */
+    template <typename Flags = DefaultLoadTag,
+              typename = enable_if<Traits::is_load_store_flag<Flags>::value>>
+    Vc_INTRINSIC void load(const std::complex<EntryType> *mem, Flags f = Flags())
+    {
+        Detail::complex_load(m_re, m_im, mem, f);
+    }
+    /**
+     * Stores the \VSize{T} complex values to \p mem. With the Vc::Aligned flag \p mem
+     * must be aligned to the vector alignment.
+     */
+    template <typename Flags = DefaultStoreTag,
+              typename = enable_if<Traits::is_load_store_flag<Flags>::value>>
+    Vc_INTRINSIC void store(std::complex<EntryType> *mem, Flags f = Flags()) const
+    {
+        Detail::complex_store(m_re, m_im, mem, f);
+    }
+
+    // access{{{2
+    /// Returns the real parts.
+    Vc_INTRINSIC const V &real() const { return m_re; }
+    /// Returns the imaginary parts.
+    Vc_INTRINSIC const V &imag() const { return m_im; }
+    /// Sets the real parts.
+    Vc_INTRINSIC void real(const V &re) { m_re = re; }
+    /// Sets the imaginary parts.
+    Vc_INTRINSIC void imag(const V &im) { m_im = im; }
+    /// Returns the complex value at \p i.
+    Vc_INTRINSIC std::complex<EntryType> operator[](std::size_t i) const
+    {
+        return {m_re[i], m_im[i]};
+    }
+
+    // compound assignment{{{2
+    Vc_INTRINSIC complex &operator+=(const complex &z) { return *this = *this + z; }
+    Vc_INTRINSIC complex &operator-=(const complex &z) { return *this = *this - z; }
+    Vc_INTRINSIC complex &operator*=(const complex &z) { return *this = *this * z; }
+    Vc_INTRINSIC complex &operator/=(const complex &z) { return *this = *this / z; }
+    Vc_INTRINSIC complex &operator+=(const V &x) { m_re += x; return *this; }
+    Vc_INTRINSIC complex &operator-=(const V &x) { m_re -= x; return *this; }
+    Vc_INTRINSIC complex &operator*=(const V &x) { m_re *= x; m_im *= x; return *this; }
+    Vc_INTRINSIC complex &operator/=(const V &x) { return *this *= V::One() / x; }
+
+    // operators{{{2
+    // defined as friends so that V and EntryType arguments convert implicitly
+    friend Vc_INTRINSIC complex operator+(const complex &z) { return z; }
+    friend Vc_INTRINSIC complex operator-(const complex &z) { return {-z.m_re, -z.m_im}; }
+
+    friend Vc_INTRINSIC complex operator+(const complex &a, const complex &b)
+    {
+        return {a.m_re + b.m_re, a.m_im + b.m_im};
+    }
+    friend Vc_INTRINSIC complex operator-(const complex &a, const complex &b)
+    {
+        return {a.m_re - b.m_re, a.m_im - b.m_im};
+    }
+    friend Vc_INTRINSIC complex operator*(const complex &a, const complex &b)
+    {
+        return {a.m_re * b.m_re - a.m_im * b.m_im, a.m_re * b.m_im + a.m_im * b.m_re};
+    }
+    friend Vc_INTRINSIC complex operator/(const complex &a, const complex &b)
+    {
+        // one division for both parts
+        const V r = V::One() / (b.m_re * b.m_re + b.m_im * b.m_im);
+        return {(a.m_re * b.m_re + a.m_im * b.m_im) * r,
+                (a.m_im * b.m_re - a.m_re * b.m_im) * r};
+    }
+
+    friend Vc_INTRINSIC complex operator+(const complex &a, const V &b)
+    {
+        return {a.m_re + b, a.m_im};
+    }
+    friend Vc_INTRINSIC complex operator+(const V &a, const complex &b)
+    {
+        return {a + b.m_re, b.m_im};
+    }
+    friend Vc_INTRINSIC complex operator-(const complex &a, const V &b)
+    {
+        return {a.m_re - b, a.m_im};
+    }
+    friend Vc_INTRINSIC complex operator-(const V &a, const complex &b)
+    {
+        return {a - b.m_re, -b.m_im};
+    }
+    friend Vc_INTRINSIC complex operator*(const complex &a, const V &b)
+    {
+        return {a.m_re * b, a.m_im * b};
+    }
+    friend Vc_INTRINSIC complex operator*(const V &a, const complex &b)
+    {
+        return {a * b.m_re, a * b.m_im};
+    }
+    friend Vc_INTRINSIC complex operator/(const complex &a, const V &b)
+    {
+        const V r = V::One() / b;
+        return {a.m_re * r, a.m_im * r};
+    }
+    friend Vc_INTRINSIC complex operator/(const V &a, const complex &b)
+    {
+        const V r = a / (b.m_re * b.m_re + b.m_im * b.m_im);
+        return {b.m_re * r, -b.m_im * r};
+    }
+
+    friend Vc_INTRINSIC typename V::MaskType operator==(const complex &a, const complex &b)
+    {
+        return a.m_re == b.m_re && a.m_im == b.m_im;
+    }
+    friend Vc_INTRINSIC typename V::MaskType operator!=(const complex &a, const complex &b)
+    {
+        return a.m_re != b.m_re || a.m_im != b.m_im;
+    }
+    //}}}2
+
+private:
+    V m_re;
+    V m_im;
+};
+template <typename V> constexpr std::size_t complex<V>::Size;
+
+/**
+ * \name Complex Functions
+ * \ingroup Math
+ * The Vc::complex counterparts of the std::complex functions.
+ */
+///@{
+/// Returns the real parts of \p z.
+template <typename V> Vc_INTRINSIC V real(const complex<V> &z) { return z.real(); }
+/// Returns the imaginary parts of \p z.
+template <typename V> Vc_INTRINSIC V imag(const complex<V> &z) { return z.imag(); }
+/// Returns the complex conjugates of \p z.
+template <typename V> Vc_INTRINSIC complex<V> conj(const complex<V> &z)
+{
+    return {z.real(), -z.imag()};
+}
+/**
+ * Returns `a * conj(b)` without negating the imaginary part of \p b first (e.g. for
+ * correlations and cross spectra).
+ */
+template <typename V> Vc_INTRINSIC complex<V> mul_conj(const complex<V> &a, const complex<V> &b)
+{
+    return {a.real() * b.real() + a.imag() * b.imag(),
+            a.imag() * b.real() - a.real() * b.imag()};
+}
+/// Returns the squared magnitudes of \p z.
+template <typename V> Vc_INTRINSIC V norm(const complex<V> &z)
+{
+    return z.real() * z.real() + z.imag() * z.imag();
+}
+/**
+ * Returns the magnitudes of \p z, computed as `sqrt(norm(z))`. Contrary to std::abs this
+ * overflows if `norm(z)` is not representable.
+ */
+template <typename V> Vc_INTRINSIC V abs(const complex<V> &z) { return Vc::sqrt(norm(z)); }
+/// Returns the phase angles of \p z in the range [-π, π].
+template <typename V> Vc_INTRINSIC V arg(const complex<V> &z)
+{
+    return Vc::atan2(z.imag(), z.real());
+}
+/// Returns the complex numbers with magnitude \p r and phase angle \p theta.
+template <typename V> Vc_INTRINSIC complex<V> polar(const V &r, const V &theta)
+{
+    V s, c;
+    Vc::sincos(theta, &s, &c);
+    return {r * c, r * s};
+}
+/// Returns e raised to the powers \p z.
+template <typename V> Vc_INTRINSIC complex<V> exp(const complex<V> &z)
+{
+    return polar(Vc::exp(z.real()), z.imag());
+}
+///@}
+}  // namespace Vc
+
+#endif  // VC_COMMON_COMPLEX_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,406 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_COMPRESS_H_
+#define VC_COMMON_COMPRESS_H_
+
+#include <cstring>
+#include "data.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// compressRegister{{{1
+// Stores the entries of x selected by the bits of mask contiguously to mem. It writes a
+// full register; the entries after the selected ones are unspecified.
+//
+// expandRegister{{{1
+// The inverse: loads a full register from mem and moves the entry at position n to the
+// entry that corresponds to the n-th bit set in mask. The other entries are unspecified.
+//
+// generic{{{2
+template <typename T, typename R> Vc_INTRINSIC void compressRegister(T *mem, R x, int mask)
+{
+    constexpr std::size_t N = sizeof(R) / sizeof(T);
+    T tmp[N];
+    std::memcpy(tmp, &x, sizeof(R));
+    std::size_t n = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+        mem[n] = tmp[i];
+        n += (mask >> i) & 1;
+    }
+}
+template <typename T, typename R> Vc_INTRINSIC void expandRegister(R &r, const T *mem, int mask)
+{
+    constexpr std::size_t N = sizeof(R) / sizeof(T);
+    T tmp[N];
+    std::size_t n = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+        tmp[i] = mem[n];
+        n += (mask >> i) & 1;
+    }
+    std::memcpy(&r, tmp, sizeof(R));
+}
+
+#ifdef Vc_IMPL_SSE
+// SSE{{{2
+Vc_INTRINSIC void compressRegister(double *mem, __m128d x, int mask)
+{
+    _mm_storeu_pd(mem, mask == 2 ? _mm_unpackhi_pd(x, x) : x);
+}
+Vc_INTRINSIC void expandRegister(__m128d &r, const double *mem, int mask)
+{
+    r = _mm_loadu_pd(mem);
+    r = mask == 2 ? _mm_unpacklo_pd(r, r) : r;
+}
+
+#ifdef Vc_IMPL_SSSE3
+// pshufb controls that move the 32-bit (16-bit) entries idx[i] to entry i
+Vc_INTRINSIC __m128i permuteControl32(const unsigned char *idx)
+{
+    __m128i i = _mm_cvtsi32_si128(*reinterpret_cast<const MayAlias<int> *>(idx));
+    i = _mm_unpacklo_epi8(i, i);
+    i = _mm_unpacklo_epi16(i, i);
+    return _mm_add_epi8(_mm_slli_epi32(i, 2), _mm_set1_epi32(0x03020100));
+}
+Vc_INTRINSIC __m128i permuteControl16(const unsigned char *idx)
+{
+    __m128i i = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(idx));
+    i = _mm_unpacklo_epi8(i, i);
+    return _mm_add_epi8(_mm_add_epi8(i, i), _mm_set1_epi16(0x0100));
+}
+
+Vc_INTRINSIC void compressRegister(float *mem, __m128 x, int mask)
+{
+    _mm_storeu_ps(mem, _mm_castsi128_ps(_mm_shuffle_epi8(
+                           _mm_castps_si128(x),
+                           permuteControl32(Common::CompressIndexes[mask]))));
+}
+template <typename T>
+Vc_INTRINSIC enable_if<(sizeof(T) == 4 && std::is_integral<T>::value), void>
+compressRegister(T *mem, __m128i x, int mask)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(mem),
+                     _mm_shuffle_epi8(x, permuteControl32(Common::CompressIndexes[mask])));
+}
+template <typename T>
+Vc_INTRINSIC enable_if<(sizeof(T) == 2 && std::is_integral<T>::value), void>
+compressRegister(T *mem, __m128i x, int mask)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(mem),
+                     _mm_shuffle_epi8(x, permuteControl16(Common::CompressIndexes[mask])));
+}
+
+Vc_INTRINSIC void expandRegister(__m128 &r, const float *mem, int mask)
+{
+    r = _mm_castsi128_ps(
+        _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(mem)),
+                         permuteControl32(Common::ExpandIndexes[mask])));
+}
+template <typename T>
+Vc_INTRINSIC enable_if<(sizeof(T) == 4 && std::is_integral<T>::value), void>
+expandRegister(__m128i &r, const T *mem, int mask)
+{
+    r = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(mem)),
+                         permuteControl32(Common::ExpandIndexes[mask]));
+}
+template <typename T>
+Vc_INTRINSIC enable_if<(sizeof(T) == 2 && std::is_integral<T>::value), void>
+expandRegister(__m128i &r, const T *mem, int mask)
+{
+    r = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(mem)),
+                         permuteControl16(Common::ExpandIndexes[mask]));
+}
+#endif  // Vc_IMPL_SSSE3
+#endif  // Vc_IMPL_SSE
+
+#ifdef Vc_IMPL_AVX
+// AVX{{{2
+#ifdef Vc_IMPL_AVX2
+// vpermd controls that move the 32-bit (64-bit) entries idx[i] to entry i
+Vc_INTRINSIC __m256i permuteControl8x32(const unsigned char *idx)
+{
+    return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(idx)));
+}
+Vc_INTRINSIC __m256i permuteControl4x64(const unsigned char *idx)
+{
+    __m256i i = _mm256_cvtepu8_epi64(
+        _mm_cvtsi32_si128(*reinterpret_cast<const MayAlias<int> *>(idx)));
+    i = _mm256_slli_epi64(i, 1);
+    i = _mm256_or_si256(i, _mm256_slli_epi64(i, 32));
+    return _mm256_add_epi32(i, _mm256_set1_epi64x(1ll << 32));
+}
+#endif  // Vc_IMPL_AVX2
+
+Vc_INTRINSIC void compressRegister(float *mem, __m256 x, int mask)
+{
+#if defined Vc_IMPL_AVX512
+    _mm256_storeu_ps(mem, _mm256_maskz_compress_ps(mask, x));
+#elif defined Vc_IMPL_AVX2
+    _mm256_storeu_ps(
+        mem, _mm256_permutevar8x32_ps(x, permuteControl8x32(Common::CompressIndexes[mask])));
+#else
+    // vpermilps cannot cross the 128-bit lanes: compress the halves independently
+    _mm_storeu_ps(mem, _mm_permutevar_ps(AVX::lo128(x),
+                                         _mm_cvtepu8_epi32(_mm_cvtsi32_si128(
+                                             *reinterpret_cast<const MayAlias<int> *>(
+                                                 Common::CompressIndexes[mask & 0xf])))));
+    _mm_storeu_ps(mem + popcnt4(mask & 0xf),
+                  _mm_permutevar_ps(AVX::hi128(x),
+                                    _mm_cvtepu8_epi32(_mm_cvtsi32_si128(
+                                        *reinterpret_cast<const MayAlias<int> *>(
+                                            Common::CompressIndexes[mask >> 4])))));
+#endif
+}
+Vc_INTRINSIC void compressRegister(double *mem, __m256d x, int mask)
+{
+#if defined Vc_IMPL_AVX512
+    _mm256_storeu_pd(mem, _mm256_maskz_compress_pd(mask, x));
+#elif defined Vc_IMPL_AVX2
+    _mm256_storeu_pd(mem, AVX::avx_cast<__m256d>(_mm256_permutevar8x32_ps(
+                              AVX::avx_cast<__m256>(x),
+                              permuteControl4x64(Common::CompressIndexes[mask]))));
+#else
+    compressRegister(mem, AVX::lo128(x), mask & 3);
+    compressRegister(mem + popcnt4(mask & 3), AVX::hi128(x), mask >> 2);
+#endif
+}
+Vc_INTRINSIC void expandRegister(__m256 &r, const float *mem, int mask)
+{
+#if defined Vc_IMPL_AVX512
+    r = _mm256_maskz_expandloadu_ps(mask, mem);
+#elif defined Vc_IMPL_AVX2
+    r = _mm256_permutevar8x32_ps(_mm256_loadu_ps(mem),
+                                 permuteControl8x32(Common::ExpandIndexes[mask]));
+#else
+    // the upper half starts with the entry after the ones the lower half consumes
+    r = AVX::concat(
+        _mm_permutevar_ps(_mm_loadu_ps(mem),
+                          _mm_cvtepu8_epi32(_mm_cvtsi32_si128(
+                              *reinterpret_cast<const MayAlias<int> *>(
+                                  Common::ExpandIndexes[mask & 0xf])))),
+        _mm_permutevar_ps(_mm_loadu_ps(mem + popcnt4(mask & 0xf)),
+                          _mm_cvtepu8_epi32(_mm_cvtsi32_si128(
+                              *reinterpret_cast<const MayAlias<int> *>(
+                                  Common::ExpandIndexes[mask >> 4])))));
+#endif
+}
+Vc_INTRINSIC void expandRegister(__m256d &r, const double *mem, int mask)
+{
+#if defined Vc_IMPL_AVX512
+    r = _mm256_maskz_expandloadu_pd(mask, mem);
+#elif defined Vc_IMPL_AVX2
+    r = AVX::avx_cast<__m256d>(
+        _mm256_permutevar8x32_ps(_mm256_loadu_ps(reinterpret_cast<const float *>(mem)),
+                                 permuteControl4x64(Common::ExpandIndexes[mask])));
+#else
+    __m128d lo, hi;
+    expandRegister(lo, mem, mask & 3);
+    expandRegister(hi, mem + popcnt4(mask & 3), mask >> 2);
+    r = AVX::concat(lo, hi);
+#endif
+}
+
+#ifdef Vc_IMPL_AVX2
+template <typename T>
+Vc_INTRINSIC enable_if<(sizeof(T) == 4 && std::is_integral<T>::value), void>
+compressRegister(T *mem, __m256i x, int mask)
+{
+#ifdef Vc_IMPL_AVX512
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(mem), _mm256_maskz_compress_epi32(mask, x));
+#else
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i *>(mem),
+        _mm256_permutevar8x32_epi32(x, permuteControl8x32(Common::CompressIndexes[mask])));
+#endif
+}
+template <typename T>
+Vc_INTRINSIC enable_if<(sizeof(T) == 2 && std::is_integral<T>::value), void>
+compressRegister(T *mem, __m256i x, int mask)
+{
+    compressRegister(mem, AVX::lo128(x), mask & 0xff);
+    compressRegister(mem + popcnt8(mask & 0xff), AVX::hi128(x), mask >> 8);
+}
+template <typename T>
+Vc_INTRINSIC enable_if<(sizeof(T) == 4 && std::is_integral<T>::value), void>
+expandRegister(__m256i &r, const T *mem, int mask)
+{
+#ifdef Vc_IMPL_AVX512
+    r = _mm256_maskz_expandloadu_epi32(mask, mem);
+#else
+    r = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(mem)),
+                                    permuteControl8x32(Common::ExpandIndexes[mask]));
+#endif
+}
+template <typename T>
+Vc_INTRINSIC enable_if<(sizeof(T) == 2 && std::is_integral<T>::value), void>
+expandRegister(__m256i &r, const T *mem, int mask)
+{
+    __m128i lo, hi;
+    expandRegister(lo, mem, mask & 0xff);
+    expandRegister(hi, mem + popcnt8(mask & 0xff), mask >> 8);
+    r = AVX::concat(lo, hi);
+}
+#endif  // Vc_IMPL_AVX2
+#ifdef Vc_IMPL_AVX512
+// AVX-512{{{2
+Vc_INTRINSIC void compressRegister(float *mem, __m512 x, int mask)
+{
+    _mm512_storeu_ps(mem, _mm512_maskz_compress_ps(mask, x));
+}
+Vc_INTRINSIC void compressRegister(double *mem, __m512d x, int mask)
+{
+    _mm512_storeu_pd(mem, _mm512_maskz_compress_pd(mask, x));
+}
+template <typename T>
+Vc_INTRINSIC enable_if<(sizeof(T) == 4 && std::is_integral<T>::value), void>
+compressRegister(T *mem, __m512i x, int mask)
+{
+    _mm512_storeu_si512(mem, _mm512_maskz_compress_epi32(mask, x));
+}
+Vc_INTRINSIC void expandRegister(__m512 &r, const float *mem, int mask)
+{
+    r = _mm512_maskz_expandloadu_ps(mask, mem);
+}
+Vc_INTRINSIC void expandRegister(__m512d &r, const double *mem, int mask)
+{
+    r = _mm512_maskz_expandloadu_pd(mask, mem);
+}
+template <typename T>
+Vc_INTRINSIC enable_if<(sizeof(T) == 4 && std::is_integral<T>::value), void>
+expandRegister(__m512i &r, const T *mem, int mask)
+{
+    r = _mm512_maskz_expandloadu_epi32(mask, mem);
+}
+#endif  // Vc_IMPL_AVX512
+#endif  // Vc_IMPL_AVX
+
+// compressUnchecked{{{1
+/**\internal
+ * Stores the entries of \p x where \p k is set contiguously to \p mem and returns their
+ * number. In contrast to Vector::compressStore this writes \VSize{T} values; the ones after
+ * the selected entries are unspecified.
+ */
+template <typename T, typename Abi>
+Vc_INTRINSIC std::size_t compressUnchecked(T *mem, const Vc::Vector<T, Abi> &x,
+                                           const Vc::Mask<T, Abi> &k)
+{
+    compressRegister(mem, x.data(), k.toInt());
+    return k.count();
+}
+
+// expandUnchecked{{{1
+/**\internal
+ * Returns a vector with the first `k.count()` values at \p mem in the entries where \p k
+ * is set and zero elsewhere. In contrast to Vc::expandLoad this reads \VSize{T} values
+ * from \p mem.
+ */
+template <typename T, typename Abi>
+Vc_INTRINSIC Vc::Vector<T, Abi> expandUnchecked(const T *mem, const Vc::Mask<T, Abi> &k)
+{
+    typename Vc::Vector<T, Abi>::VectorType r;
+    expandRegister(r, mem, k.toInt());
+    Vc::Vector<T, Abi> x(r);
+    x.setZeroInverted(k);
+    return x;
+}
+
+// expandLoad{{{1
+template <typename T, typename Abi>
+Vc_INTRINSIC Vc::Vector<T, Abi> expandLoad(const T *mem, const Vc::Mask<T, Abi> &k)
+{
+    using V = Vc::Vector<T, Abi>;
+    const std::size_t n = k.count();
+    if (n == V::Size) {
+        return V(mem, Vc::Unaligned);
+    }
+    // do not read beyond the n values
+    alignas(V::MemoryAlignment) T tmp[V::Size] = {};
+    std::memcpy(tmp, mem, n * sizeof(T));
+    return expandUnchecked(tmp, k);
+}
+template <typename T, std::size_t N, typename V>
+Vc_INTRINSIC SimdArray<T, N, V, N> expandLoad(const T *mem,
+                                              const SimdMaskArray<T, N, V, N> &k)
+{
+    return SimdArray<T, N, V, N>(expandLoad(mem, internal_data(k)));
+}
+template <typename T, std::size_t N, typename V, std::size_t M>
+Vc_INTRINSIC SimdArray<T, N, V, M> expandLoad(const T *mem,
+                                              const SimdMaskArray<T, N, V, M> &k)
+{
+    SimdArray<T, N, V, M> r;
+    internal_data0(r) = expandLoad(mem, internal_data0(k));
+    internal_data1(r) = expandLoad(mem + internal_data0(k).count(), internal_data1(k));
+    return r;
+}
+//}}}1
+}  // namespace Detail
+
+namespace Common
+{
+// compressStore{{{1
+template <typename V>
+Vc_INTRINSIC std::size_t compressStore(const V &x, typename V::EntryType *mem,
+                                       const typename V::MaskType &k)
+{
+    // do not write beyond the selected values
+    alignas(V::MemoryAlignment) typename V::EntryType tmp[V::Size];
+    const std::size_t n = Vc::Detail::compressUnchecked(tmp, x, k);
+    std::memcpy(mem, tmp, n * sizeof(typename V::EntryType));
+    return n;
+}
+//}}}1
+}  // namespace Common
+
+/**
+ * \ingroup Utilities
+ *
+ * Returns a vector that holds the \c mask.count() consecutive values at \p mem in the
+ * entries where \p mask is set, in order, and zero in all other entries. This is the
+ * inverse of Vector::compressStore.
+ * \code
+ * float data[] = {1, 2, 3};
+ * float_v x = Vc::expandLoad(data, float_v::IndexesFromZero() % 2 == 1);
+ * // x = [0 1 0 2] (with SSE)
+ * \endcode
+ *
+ * Only the \c mask.count() values are read from \p mem.
+ */
+template <typename M>
+Vc_INTRINSIC enable_if<Traits::is_simd_mask<M>::value, typename M::Vector> expandLoad(
+    const typename M::Vector::EntryType *mem, const M &mask)
+{
+    return Detail::expandLoad(mem, mask);
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_COMPRESS_H_
+
+// vim: foldmethod=marker
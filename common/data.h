@@ -36,6 +36,10 @@ namespace Common
 
 alignas(64) extern unsigned int RandomState[];
 alignas(32) extern const unsigned int AllBitsSet[8];
+alignas(64) extern const double PowLogTableHi[17];
+alignas(64) extern const double PowLogTableLo[17];
+alignas(64) extern const unsigned char CompressIndexes[256][8];
+alignas(64) extern const unsigned char ExpandIndexes[256][8];
 
 }  // namespace Common
 }  // namespace Vc
@@ -0,0 +1,189 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_DISPATCH_H_
+#define VC_COMMON_DISPATCH_H_
+
+#include <utility>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+/**
+ * \internal
+ * The set of implementations of one kernel that were linked into the program.
+ *
+ * Entries are added during static initialization. Thus the table must not require dynamic
+ * initialization itself (it is zero-initialized).
+ */
+struct KernelTable {
+    using FunctionPointer = void (*)();
+    struct Entry {
+        unsigned int features;
+        FunctionPointer function;
+    };
+    static constexpr int MaxEntries = 32;
+    Entry entries[MaxEntries];
+    int count;
+};
+
+/**\internal
+ * Adds \p function, compiled for the ImplementationT bitmask \p features, to \p table.
+ *
+ * Implemented in libVc, compiled without SIMD flags, so that it may execute on any x86 CPU.
+ */
+bool addKernel(KernelTable &table, unsigned int features, KernelTable::FunctionPointer function);
+/**\internal
+ * Returns the entry of \p table that requires the best Vc::Implementation (and the most
+ * extra instructions) supported by the CPU the program executes on. Returns \c nullptr if no
+ * entry is supported.
+ */
+KernelTable::FunctionPointer selectKernel(const KernelTable &table);
+
+/**\internal
+ * Returns the unique KernelTable for \p Kernel.
+ */
+template <typename Kernel> Vc_INTRINSIC KernelTable &kernelTable()
+{
+    static KernelTable table;
+    return table;
+}
+
+/**\internal
+ * Returns the ImplementationT bitmask (i.e. the Vc::Implementation plus
+ * Vc::ExtraInstructions) of the translation unit.
+ */
+template <unsigned int Features> constexpr unsigned int featureBits(ImplementationT<Features>)
+{
+    return Features;
+}
+
+/**\internal
+ * Registers \p function as the implementation of \p Kernel for the ImplementationT bitmask
+ * \p features.
+ *
+ * registerKernel, resolve, and dispatch are instantiated in translation units compiled for
+ * different targets. They must be inlined: otherwise the linker keeps one of the
+ * instantiations, which may use e.g. AVX instructions and run during static initialization
+ * on a CPU without AVX.
+ */
+template <typename Kernel>
+Vc_ALWAYS_INLINE bool registerKernel(unsigned int features, typename Kernel::type *function)
+{
+    return addKernel(kernelTable<Kernel>(), features,
+                     reinterpret_cast<KernelTable::FunctionPointer>(function));
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile dispatch <Vc/dispatch>
+ *
+ * Returns the implementation of \p Kernel that is best suited for the CPU the program
+ * executes on.
+ *
+ * The choice is made on the first call and cached thereafter, i.e. every later call only
+ * costs the load of a function pointer.
+ *
+ * \tparam Kernel A tag type with a nested \c type that names the function type of the
+ *                kernel.
+ *
+ * \see Vc_REGISTER_KERNEL, dispatch
+ */
+template <typename Kernel> Vc_ALWAYS_INLINE typename Kernel::type *resolve()
+{
+    static typename Kernel::type *const function =
+        reinterpret_cast<typename Kernel::type *>(selectKernel(kernelTable<Kernel>()));
+    Vc_ASSERT(function != nullptr)
+    return function;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile dispatch <Vc/dispatch>
+ *
+ * Calls the implementation of \p Kernel that is best suited for the CPU the program executes
+ * on. This enables building an application for a baseline target (e.g. SSE2) while its hot
+ * loops still use AVX or AVX2 where the CPU supports it.
+ *
+ * Kernels are written once and compiled once per target, typically with
+ * \c vc_compile_for_all_implementations from VcMacros.cmake. Every one of the compiled
+ * translation units registers its version with Vc_REGISTER_KERNEL:
+ * \code
+ * // saxpy.h (included by the kernel and the caller)
+ * struct Saxpy {
+ *   using type = void(float a, const float *x, float *y, std::size_t n);
+ * };
+ *
+ * // saxpy.cpp (compiled for SSE2, AVX, and AVX2)
+ * namespace {
+ * void saxpy(float a, const float *x, float *y, std::size_t n) { ... }  // uses Vc::float_v
+ * }
+ * Vc_REGISTER_KERNEL(Saxpy, saxpy);
+ *
+ * // caller (compiled for the baseline target)
+ * Vc::dispatch<Saxpy>(2.f, x, y, n);
+ * \endcode
+ *
+ * The implementation is selected only once per kernel (see resolve()).
+ *
+ * \note The kernel function must have internal linkage (e.g. be declared in an unnamed
+ * namespace), otherwise the different versions violate the one definition rule.
+ */
+template <typename Kernel, typename... Args>
+Vc_ALWAYS_INLINE auto dispatch(Args &&... args)
+    -> decltype(std::declval<typename Kernel::type *>()(std::forward<Args>(args)...))
+{
+    return resolve<Kernel>()(std::forward<Args>(args)...);
+}
+}  // namespace Common
+}  // namespace Vc
+
+/**
+ * \ingroup Utilities
+ * \headerfile dispatch <Vc/dispatch>
+ *
+ * Registers \p function_ as the implementation of \p Kernel_ for the Vc::Implementation
+ * (and extra instructions) the current translation unit is compiled for.
+ *
+ * Use this macro at namespace scope.
+ *
+ * \see Vc::dispatch
+ */
+#define Vc_REGISTER_KERNEL(Kernel_, function_)                                           \
+    namespace                                                                            \
+    {                                                                                    \
+    const bool Vc_make_unique(kernelRegistered) =                                        \
+        Vc::Common::registerKernel<Kernel_>(                                             \
+            Vc::Common::featureBits(Vc::CurrentImplementation()), function_);            \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+
+#endif  // VC_COMMON_DISPATCH_H_
+
+// vim: foldmethod=marker
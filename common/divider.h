@@ -0,0 +1,159 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_DIVIDER_H_
+#define VC_COMMON_DIVIDER_H_
+
+#include <cstdint>
+#include <type_traits>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// mulhi for Scalar::Vector{{{1
+Vc_INTRINSIC int mulhi(int a, int b, int) { return int((std::int64_t(a) * b) >> 32); }
+Vc_INTRINSIC uint mulhi(uint a, uint b, uint) { return uint((std::uint64_t(a) * b) >> 32); }
+Vc_INTRINSIC short mulhi(short a, short b, short) { return short((int(a) * b) >> 16); }
+Vc_INTRINSIC ushort mulhi(ushort a, ushort b, ushort)
+{
+    return ushort((unsigned(a) * b) >> 16);
+}
+//}}}1
+}  // namespace Detail
+
+/**
+ * \ingroup Math
+ *
+ * Division of integer vectors by a divisor that is only known at runtime but stays the
+ * same for many divisions.
+ *
+ * The SSE and AVX instruction sets have no integer division, thus `V / V` divides entry
+ * by entry. A divider precomputes a magic multiplier and shift counts for its divisor
+ * once (T. Granlund, P. Montgomery: "Division by Invariant Integers using
+ * Multiplication", 1994) and then divides whole vectors with a multiply-high, a few
+ * additions, and shifts:
+ * \code
+ * const Vc::divider<Vc::int_v> rowWidth(width);
+ * for (...) {
+ *     const Vc::int_v row = index / rowWidth;
+ *     const Vc::int_v column = index % rowWidth;
+ * }
+ * \endcode
+ * The result is identical to the C++ operators: the quotient is truncated towards zero.
+ * As for the builtin operators, dividing the minimal value of a signed type by -1 is
+ * undefined.
+ *
+ * \tparam V One of Vc::int_v, Vc::uint_v, Vc::short_v, or Vc::ushort_v.
+ */
+template <typename V> class divider
+{
+    typedef typename V::EntryType T;
+    typedef typename std::make_unsigned<T>::type U;
+    static constexpr int Bits = 8 * sizeof(T);
+    static_assert(Traits::is_simd_vector<V>::value && !Traits::isSimdArray<V>::value &&
+                      std::is_integral<T>::value && (sizeof(T) == 2 || sizeof(T) == 4),
+                  "Vc::divider<V> requires V to be int_v, uint_v, short_v, or ushort_v.");
+
+public:
+    typedef V vector_type;
+    typedef T value_type;
+
+    /// Precomputes the division by \p d, which must not be zero.
+    explicit divider(T d) : m_divisor(d) { init(d, std::is_signed<T>()); }
+
+    /// Returns the divisor.
+    T divisor() const { return m_divisor; }
+
+    /// Returns `n / divisor()` (truncated towards zero).
+    Vc_INTRINSIC V divide(const V &n) const { return divide(n, std::is_signed<T>()); }
+
+    /// Returns `n % divisor()`, computed as `n - (n / divisor()) * divisor()`.
+    Vc_INTRINSIC V remainder(const V &n) const { return n - divide(n) * V(m_divisor); }
+
+    friend Vc_INTRINSIC V operator/(const V &n, const divider &d) { return d.divide(n); }
+    friend Vc_INTRINSIC V operator%(const V &n, const divider &d) { return d.remainder(n); }
+
+private:
+    static Vc_INTRINSIC V mulhi(const V &a, const V &b)
+    {
+        return V(Detail::mulhi(a.data(), b.data(), T()));
+    }
+
+    // unsigned: with l = ceil(log2(d)) and m = floor(2^N * (2^l - d) / d) + 1,
+    // t = mulhi(m, n), q = (t + ((n - t) >> min(l, 1))) >> max(l - 1, 0)
+    void init(T d, std::false_type)
+    {
+        Vc_ASSERT(d != 0)
+        int l = 0;
+        while (l < Bits && (std::uint64_t(1) << l) < d) {
+            ++l;
+        }
+        m_magic = T((((std::uint64_t(1) << l) - d) << Bits) / d + 1);
+        m_shift1 = l < 1 ? l : 1;
+        m_shift2 = l < 1 ? 0 : l - 1;
+        m_sign = 0;
+    }
+    Vc_INTRINSIC V divide(const V &n, std::false_type) const
+    {
+        const V t = mulhi(V(m_magic), n);
+        return (t + ((n - t) >> m_shift1)) >> m_shift2;
+    }
+
+    // signed: with l = max(ceil(log2(|d|)), 1) and m = 2^(N + l - 1) / |d| + 1 - 2^N,
+    // q = ((n + mulhi(m, n)) >> (l - 1)) - (n >> (N - 1)), negated for negative d
+    void init(T d, std::true_type)
+    {
+        Vc_ASSERT(d != 0)
+        const U absd = d < 0 ? U(U(0) - U(d)) : U(d);
+        int l = 1;
+        while (l < Bits && (std::uint64_t(1) << l) < absd) {
+            ++l;
+        }
+        m_magic = T(U((std::uint64_t(1) << (Bits + l - 1)) / absd + 1));
+        m_shift1 = l - 1;
+        m_shift2 = 0;
+        m_sign = d < 0 ? T(-1) : T(0);
+    }
+    Vc_INTRINSIC V divide(const V &n, std::true_type) const
+    {
+        const V q = ((n + mulhi(V(m_magic), n)) >> m_shift1) - (n >> (Bits - 1));
+        return (q ^ V(m_sign)) - V(m_sign);
+    }
+
+    T m_divisor;
+    T m_magic;
+    int m_shift1;
+    int m_shift2;
+    T m_sign;
+};
+}  // namespace Vc
+
+#endif  // VC_COMMON_DIVIDER_H_
+
+// vim: foldmethod=marker
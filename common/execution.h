@@ -0,0 +1,410 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_EXECUTION_H_
+#define VC_COMMON_EXECUTION_H_
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+#include "threadpool.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \ingroup Utilities
+ * \headerfile execution <Vc/execution>
+ *
+ * The type of par_simd.
+ */
+struct ParallelSimdPolicy {
+};
+
+/**
+ * \ingroup Utilities
+ * \headerfile execution <Vc/execution>
+ *
+ * Pass this object as first argument to simd_for_each, simd_for_each_n, simd_transform,
+ * simd_transform_reduce, or simd_count_if to execute the algorithm on multiple threads.
+ *
+ * The range is split into chunks of a few KiB, which start at addresses aligned to
+ * \c V::MemoryAlignment. Every chunk is processed with the vectorized loop of the
+ * sequential algorithm. The chunks are distributed over a work-stealing pool of
+ * \c std::thread::hardware_concurrency() threads (including the calling thread).
+ *
+ * The functors are invoked concurrently and thus must not introduce data races. If a
+ * functor throws, std::terminate is called.
+ */
+constexpr ParallelSimdPolicy par_simd = {};
+
+namespace Detail
+{
+// the number of bytes per task: small enough that a chunk (plus the output of
+// simd_transform) stays in L1, large enough to amortize the scheduling overhead
+constexpr std::size_t ParallelChunkBytes = 16 * 1024;
+
+/**\internal
+ * Splits [\p first, \p last) into chunks of ParallelChunkBytes. All chunks except the first
+ * start at an address aligned to V::MemoryAlignment and all except the last contain a
+ * multiple of V::Size elements.
+ */
+template <typename V, typename RandomIt> class ParallelChunks
+{
+    typedef typename std::iterator_traits<RandomIt>::value_type T;
+    typedef typename std::iterator_traits<RandomIt>::difference_type D;
+    static constexpr D ChunkSize =
+        ParallelChunkBytes / sizeof(T) < V::Size
+            ? D(V::Size)
+            : D(ParallelChunkBytes / sizeof(T) / V::Size * V::Size);
+
+public:
+    ParallelChunks(RandomIt first_, RandomIt last_)
+        : first(first_), n(last_ - first_), head(0), count(0)
+    {
+        if (n > 0) {
+            const D misalignment = (reinterpret_cast<std::uintptr_t>(std::addressof(*first)) &
+                                    (V::MemoryAlignment - 1)) /
+                                   sizeof(T);
+            head = misalignment == 0 ? 0 : std::min<D>(n, D(V::Size) - misalignment);
+            count = n - head <= ChunkSize ? 1
+                                          : std::size_t((n - head + ChunkSize - 1) / ChunkSize);
+        }
+    }
+
+    /// Returns the number of chunks.
+    std::size_t size() const { return count; }
+
+    /**
+     * Calls \p f(k, chunkFirst, chunkLast) for every chunk \c k on the thread pool.
+     */
+    template <typename F> void parallelFor(F &&f) const
+    {
+        auto &&chunk = [&](std::size_t k) {
+            const D b = k == 0 ? 0 : head + D(k) * ChunkSize;
+            const D e = k + 1 == count ? n : head + D(k + 1) * ChunkSize;
+            f(k, first + b, first + e);
+        };
+        Common::ThreadPool::instance().parallelFor(count, chunk);
+    }
+
+private:
+    RandomIt first;
+    D n;
+    D head;
+    std::size_t count;
+};
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile execution <Vc/execution>
+ *
+ * Parallel version of simd_for_each. Since \p f is called from several threads
+ * concurrently, no copy of it is returned.
+ */
+template <typename RandomIt, typename UnaryFunction>
+inline void simd_for_each(ParallelSimdPolicy, RandomIt first, RandomIt last, UnaryFunction f)
+{
+    typedef Vector<typename std::iterator_traits<RandomIt>::value_type> V;
+    Detail::ParallelChunks<V, RandomIt>(first, last)
+        .parallelFor([&](std::size_t, RandomIt b, RandomIt e) { simd_for_each(b, e, f); });
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile execution <Vc/execution>
+ *
+ * Parallel version of simd_for_each_n.
+ */
+template <typename RandomIt, typename UnaryFunction>
+inline void simd_for_each_n(ParallelSimdPolicy, RandomIt first, std::size_t count,
+                            UnaryFunction f)
+{
+    simd_for_each(par_simd, first, first + count, std::move(f));
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile execution <Vc/execution>
+ *
+ * Parallel version of simd_transform.
+ */
+template <typename RandomIt, typename OutputIt, typename UnaryOperation>
+inline OutputIt simd_transform(ParallelSimdPolicy, RandomIt first, RandomIt last,
+                               OutputIt d_first, UnaryOperation op)
+{
+    typedef Vector<typename std::iterator_traits<RandomIt>::value_type> V;
+    Detail::ParallelChunks<V, RandomIt>(first, last)
+        .parallelFor([&](std::size_t, RandomIt b, RandomIt e) {
+            simd_transform(b, e, d_first + (b - first), op);
+        });
+    return d_first + (last - first);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile execution <Vc/execution>
+ *
+ * Parallel version of simd_transform_reduce. Every chunk is reduced on its own and the
+ * partial results are reduced together with \p init on the calling thread. As for the
+ * sequential version, \p T must be the element type of the range.
+ */
+template <typename RandomIt, typename T, typename BinaryOperation, typename UnaryOperation>
+inline T simd_transform_reduce(ParallelSimdPolicy, RandomIt first, RandomIt last, T init,
+                               BinaryOperation reduce, UnaryOperation transform)
+{
+    typedef typename std::iterator_traits<RandomIt>::value_type U;
+    typedef Vector<U> V;
+    typedef Scalar::Vector<U> V1;
+    static_assert(std::is_same<T, U>::value,
+                  "simd_transform_reduce reduces in the element type of the range. "
+                  "Therefore init must have the same type.");
+    const Detail::ParallelChunks<V, RandomIt> chunks(first, last);
+    std::vector<V1> partial(chunks.size());
+    chunks.parallelFor([&](std::size_t k, RandomIt b, RandomIt e) {
+        BinaryOperation r = reduce;
+        UnaryOperation t = transform;
+        partial[k] = Detail::transformReduce(b, e, V1(), false, r, t);
+    });
+    V1 result(init);
+    for (std::size_t k = 0; k < partial.size(); ++k) {
+        result = reduce(result, partial[k]);
+    }
+    return result[0];
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile execution <Vc/execution>
+ *
+ * Parallel version of simd_count_if.
+ */
+template <typename RandomIt, typename UnaryPredicate>
+inline typename std::iterator_traits<RandomIt>::difference_type simd_count_if(
+    ParallelSimdPolicy, RandomIt first, RandomIt last, UnaryPredicate pred)
+{
+    typedef typename std::iterator_traits<RandomIt>::difference_type D;
+    typedef Vector<typename std::iterator_traits<RandomIt>::value_type> V;
+    const Detail::ParallelChunks<V, RandomIt> chunks(first, last);
+    std::vector<D> partial(chunks.size());
+    chunks.parallelFor([&](std::size_t k, RandomIt b, RandomIt e) {
+        partial[k] = simd_count_if(b, e, pred);
+    });
+    D count = 0;
+    for (std::size_t k = 0; k < partial.size(); ++k) {
+        count += partial[k];
+    }
+    return count;
+}
+
+namespace Detail
+{
+/**\internal
+ * Reduce-then-scan: the first pass reduces every chunk but the last (only reading the
+ * input), the totals are scanned on the calling thread, and the second pass scans every
+ * chunk continuing from its carry. Thus \p d_first may equal \p first as in the
+ * sequential scan.
+ */
+template <typename RandomIt, typename OutputIt, typename BinaryOperation>
+inline OutputIt parallelScan(
+    RandomIt first, RandomIt last, OutputIt d_first,
+    Scalar::Vector<typename std::iterator_traits<RandomIt>::value_type> init, bool hasInit,
+    bool exclusive, BinaryOperation &op)
+{
+    typedef typename std::iterator_traits<RandomIt>::value_type T;
+    typedef Vector<T> V;
+    typedef Scalar::Vector<T> V1;
+    const ParallelChunks<V, RandomIt> chunks(first, last);
+    if (chunks.size() <= 1) {
+        return scan(first, last, d_first, init, hasInit, exclusive, op);
+    }
+    std::vector<V1> carry(chunks.size());
+    chunks.parallelFor([&](std::size_t k, RandomIt b, RandomIt e) {
+        if (k + 1 < carry.size()) {
+            BinaryOperation o = op;
+            carry[k + 1] = scanReduce(b, e, o);
+        }
+    });
+    carry[0] = init;
+    for (std::size_t k = 1; k < carry.size(); ++k) {
+        if (k > 1 || hasInit) {
+            carry[k] = op(carry[k - 1], carry[k]);
+        }
+    }
+    chunks.parallelFor([&](std::size_t k, RandomIt b, RandomIt e) {
+        BinaryOperation o = op;
+        scan(b, e, d_first + (b - first), carry[k], k > 0 || hasInit, exclusive, o);
+    });
+    return d_first + (last - first);
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile execution <Vc/execution>
+ *
+ * Parallel version of inclusive_scan. The range is scanned in two passes over the thread
+ * pool: the first reduces every chunk to its total, the second scans every chunk starting
+ * from the combined totals of the preceding chunks. \p op must be associative and is
+ * called concurrently.
+ */
+template <typename RandomIt, typename OutputIt>
+inline OutputIt inclusive_scan(ParallelSimdPolicy, RandomIt first, RandomIt last,
+                               OutputIt d_first)
+{
+    typedef Scalar::Vector<typename std::iterator_traits<RandomIt>::value_type> V1;
+    Detail::ScanPlus op;
+    return Detail::parallelScan(first, last, d_first, V1(), false, false, op);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile execution <Vc/execution>
+ *
+ * Parallel version of inclusive_scan with a custom operation.
+ */
+template <typename RandomIt, typename OutputIt, typename BinaryOperation>
+inline OutputIt inclusive_scan(ParallelSimdPolicy, RandomIt first, RandomIt last,
+                               OutputIt d_first, BinaryOperation op)
+{
+    typedef Scalar::Vector<typename std::iterator_traits<RandomIt>::value_type> V1;
+    return Detail::parallelScan(first, last, d_first, V1(), false, false, op);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile execution <Vc/execution>
+ *
+ * Parallel version of inclusive_scan with a custom operation and initial value.
+ */
+template <typename RandomIt, typename OutputIt, typename BinaryOperation, typename T>
+inline OutputIt inclusive_scan(ParallelSimdPolicy, RandomIt first, RandomIt last,
+                               OutputIt d_first, BinaryOperation op, T init)
+{
+    typedef Scalar::Vector<typename std::iterator_traits<RandomIt>::value_type> V1;
+    return Detail::parallelScan(first, last, d_first, V1(init), true, false, op);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile execution <Vc/execution>
+ *
+ * Parallel version of exclusive_scan.
+ */
+template <typename RandomIt, typename OutputIt, typename T>
+inline OutputIt exclusive_scan(ParallelSimdPolicy, RandomIt first, RandomIt last,
+                               OutputIt d_first, T init)
+{
+    typedef Scalar::Vector<typename std::iterator_traits<RandomIt>::value_type> V1;
+    Detail::ScanPlus op;
+    return Detail::parallelScan(first, last, d_first, V1(init), true, true, op);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile execution <Vc/execution>
+ *
+ * Parallel version of exclusive_scan with a custom operation.
+ */
+template <typename RandomIt, typename OutputIt, typename T, typename BinaryOperation>
+inline OutputIt exclusive_scan(ParallelSimdPolicy, RandomIt first, RandomIt last,
+                               OutputIt d_first, T init, BinaryOperation op)
+{
+    typedef Scalar::Vector<typename std::iterator_traits<RandomIt>::value_type> V1;
+    return Detail::parallelScan(first, last, d_first, V1(init), true, true, op);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile execution <Vc/execution>
+ *
+ * Parallel version of histogram over a range of indexes. Every thread counts its part of
+ * the range into privatized bins: the first part into \p bins directly and all others
+ * into zero-initialized copies. Afterwards the copies are added to \p bins with vector
+ * loads and stores, again distributed over the thread pool.
+ *
+ * \param bins     The counters, which must be large enough for every index in the range.
+ * \param binCount The number of counters in \p bins.
+ * \param first    The first iterator of a contiguous range of integers.
+ * \param last     The end iterator of the range.
+ */
+template <typename T, typename RandomIt>
+inline void histogram(ParallelSimdPolicy, T *bins, std::size_t binCount, RandomIt first,
+                      RandomIt last)
+{
+    typedef typename std::iterator_traits<RandomIt>::value_type U;
+    typedef typename std::iterator_traits<RandomIt>::difference_type D;
+    typedef Vector<T> V;
+    Common::ThreadPool &pool = Common::ThreadPool::instance();
+    const D n = last - first;
+    // every part should amortize zeroing and merging its bins
+    const std::size_t parts = std::max<std::size_t>(
+        1, std::min<std::size_t>(pool.concurrency(),
+                                 std::size_t(n) / std::max<std::size_t>(
+                                                      binCount, Detail::ParallelChunkBytes /
+                                                                    sizeof(U))));
+    if (parts == 1) {
+        histogram(bins, first, last);
+        return;
+    }
+    std::vector<std::vector<T, Allocator<T>>> privateBins(
+        parts - 1, std::vector<T, Allocator<T>>(binCount));
+    auto &&count = [&](std::size_t k) {
+        T *const out = k == 0 ? bins : privateBins[k - 1].data();
+        histogram(out, first + D(n * k / parts), first + D(n * (k + 1) / parts));
+    };
+    pool.parallelFor(parts, count);
+
+    // merge in slices of whole vectors
+    const std::size_t slice =
+        std::max<std::size_t>(V::Size, Detail::ParallelChunkBytes / sizeof(T) / V::Size * V::Size);
+    const std::size_t slices = (binCount + slice - 1) / slice;
+    auto &&merge = [&](std::size_t s) {
+        const std::size_t b = s * slice;
+        const std::size_t e = std::min(binCount, b + slice);
+        std::size_t i = b;
+        for (; i + V::Size <= e; i += V::Size) {
+            V sum(bins + i, Vc::Unaligned);
+            for (const auto &p : privateBins) {
+                sum += V(p.data() + i, Vc::Aligned);
+            }
+            sum.store(bins + i, Vc::Unaligned);
+        }
+        for (; i < e; ++i) {
+            for (const auto &p : privateBins) {
+                bins[i] += p[i];
+            }
+        }
+    };
+    pool.parallelFor(slices, merge);
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_EXECUTION_H_
+
+// vim: foldmethod=marker
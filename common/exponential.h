@@ -81,4 +81,175 @@ inline Vector<float, Abi> exp(Vector<float, Abi> x)
         return x;
     }
 
+namespace Detail
+{
+// is_sse_or_avx_float{{{1
+// selects the vector types for which the functions below are implemented (Scalar uses the
+// std functions)
+template <typename T, typename Abi>
+using is_sse_or_avx_float = std::integral_constant<
+    bool, std::is_floating_point<T>::value && (std::is_same<Abi, VectorAbi::Sse>::value ||
+                                               std::is_same<Abi, VectorAbi::Avx>::value)>;
+
+// ExpConstants{{{1
+template <typename T> struct ExpConstants;
+template <> struct ExpConstants<float> {
+    static constexpr float ln2() { return 6.93147180559945309417e-1f; }
+    // ln2_hi + ln2_lo = ln(2), n * ln2_hi is exact for |n| < 2⁸
+    static constexpr float ln2_hi() { return 6.9314575195e-1f; }
+    static constexpr float ln2_lo() { return 1.4286067653e-6f; }
+    static constexpr float log2_e() { return 1.44269504088896341f; }
+    // log10_2_hi + log10_2_lo = log₁₀(2), n * log10_2_hi is exact for |n| < 2⁸
+    static constexpr float log10_2_hi() { return 3.0078125e-1f; }
+    static constexpr float log10_2_lo() { return 2.48745663981195213739e-4f; }
+    static constexpr float log2_10() { return 3.32192809488736234787f; }
+    static constexpr float ln10() { return 2.30258509299404568402f; }
+    // 2^maxExponent overflows, 2^(minExponent - 1) rounds to zero
+    static constexpr int maxExponent() { return 128; }
+    static constexpr int minExponent() { return -149; }
+    static constexpr int digits() { return 24; }
+};
+template <> struct ExpConstants<double> {
+    static constexpr double ln2() { return 6.93147180559945309417e-1; }
+    // n * ln2_hi is exact for |n| < 2²¹
+    static constexpr double ln2_hi() { return 6.93147180369123816490e-1; }
+    static constexpr double ln2_lo() { return 1.90821492927058770002e-10; }
+    static constexpr double log2_e() { return 1.44269504088896340736; }
+    // n * log10_2_hi is exact for |n| < 2⁴²
+    static constexpr double log10_2_hi() { return 3.01025390625e-1; }
+    static constexpr double log10_2_lo() { return 4.60503898119521373889e-6; }
+    static constexpr double log2_10() { return 3.32192809488736234787; }
+    static constexpr double ln10() { return 2.30258509299404568402; }
+    static constexpr int maxExponent() { return 1024; }
+    static constexpr int minExponent() { return -1074; }
+    static constexpr int digits() { return 53; }
+};
+
+// expm1Poly{{{1
+// eʳ - 1 for |r| ≤ ln(2)/2, using the Taylor series up to r⁸ (float) or r¹⁴ (double)
+template <typename Abi> Vc_INTRINSIC Vector<float, Abi> expm1Poly(Vector<float, Abi> r)
+{
+    const Vector<float, Abi> q =
+        (((((( 2.48015873e-5f  * r
+             + 1.98412698e-4f) * r
+             + 1.38888889e-3f) * r
+             + 8.33333333e-3f) * r
+             + 4.16666667e-2f) * r
+             + 1.66666667e-1f) * r
+             + 5.00000000e-1f);
+    return r + r * r * q;
+}
+template <typename Abi> Vc_INTRINSIC Vector<double, Abi> expm1Poly(Vector<double, Abi> r)
+{
+    const Vector<double, Abi> q =
+        ((((((((((((1.1470745597729725e-11  * r
+                  + 1.6059043836821613e-10) * r
+                  + 2.0876756987868100e-9 ) * r
+                  + 2.5052108385441720e-8 ) * r
+                  + 2.7557319223985888e-7 ) * r
+                  + 2.7557319223985893e-6 ) * r
+                  + 2.4801587301587302e-5 ) * r
+                  + 1.9841269841269841e-4 ) * r
+                  + 1.3888888888888889e-3 ) * r
+                  + 8.3333333333333333e-3 ) * r
+                  + 4.1666666666666667e-2 ) * r
+                  + 1.6666666666666667e-1 ) * r
+                  + 5.0000000000000000e-1 );
+    return r + r * r * q;
+}
+
+// scalePow2{{{1
+// x · 2ⁿ for x ∈ [½, 2]. Unlike ldexp this also works if the result is subnormal or
+// overflows, because it multiplies by two normal powers of two instead of adding n to the
+// exponent bits.
+template <typename V>
+Vc_INTRINSIC V scalePow2(V x, const SimdArray<int, V::Size> &n)
+{
+    const SimdArray<int, V::Size> n0 = n >> 1;
+    return ldexp(x, n0) * ldexp(V::One(), n - n0);
+}
+//}}}1
+}  // namespace Detail
+
+/**
+ * Returns 2ˣ.
+ *
+ * The result is within 1 ulp of the correctly rounded value, including subnormal results.
+ */
+template <typename T, typename Abi,
+          typename = enable_if<Detail::is_sse_or_avx_float<T, Abi>::value>>
+inline Vector<T, Abi> exp2(Vector<T, Abi> x)
+{
+    using V = Vector<T, Abi>;
+    using C = Detail::ExpConstants<T>;
+    const V x0 = x;
+    // clamping x keeps n in the range where scalePow2 returns 0 or inf
+    x = min(max(x, V(T(C::minExponent() - 2))), V(T(C::maxExponent() + 1)));
+
+    // 2ˣ = 2ⁿ · eʳ with n = round(x) and r = (x - n) · ln(2)
+    const V n = floor(x + T(0.5));
+    const V r = (x - n) * T(C::ln2());
+    x = Detail::scalePow2(T(1) + Detail::expm1Poly(r),
+                          static_cast<SimdArray<int, V::Size>>(n));
+    x(isnan(x0)) = x0;
+    return x;
+}
+
+/**
+ * Returns 10ˣ.
+ *
+ * The result is within 2 ulp of the correctly rounded value, including subnormal results.
+ */
+template <typename T, typename Abi,
+          typename = enable_if<Detail::is_sse_or_avx_float<T, Abi>::value>>
+inline Vector<T, Abi> exp10(Vector<T, Abi> x)
+{
+    using V = Vector<T, Abi>;
+    using C = Detail::ExpConstants<T>;
+    const V x0 = x;
+    x = min(max(x, V(T((C::minExponent() - 2) * C::log10_2_hi()))),
+            V(T((C::maxExponent() + 1) * C::log10_2_hi())));
+
+    // 10ˣ = 2ⁿ · eʳ with n = round(x · log₂(10)) and r = (x - n · log₁₀(2)) · ln(10)
+    const V n = floor(x * T(C::log2_10()) + T(0.5));
+    const V r = ((x - n * T(C::log10_2_hi())) - n * T(C::log10_2_lo())) * T(C::ln10());
+    x = Detail::scalePow2(T(1) + Detail::expm1Poly(r),
+                          static_cast<SimdArray<int, V::Size>>(n));
+    x(isnan(x0)) = x0;
+    return x;
+}
+
+/**
+ * Returns eˣ - 1, without the loss of precision of \c exp(x) - 1 for \p x close to 0.
+ *
+ * The result is within 2 ulp of the correctly rounded value.
+ */
+template <typename T, typename Abi,
+          typename = enable_if<Detail::is_sse_or_avx_float<T, Abi>::value>>
+inline Vector<T, Abi> expm1(Vector<T, Abi> x)
+{
+    using V = Vector<T, Abi>;
+    using I = SimdArray<int, V::Size>;
+    using C = Detail::ExpConstants<T>;
+    const V x0 = x;
+    // below -(digits + 2) · ln(2) the result rounds to -1
+    x = min(max(x, V(T(-(C::digits() + 2) * C::ln2()))),
+            V(T((C::maxExponent() + 1) * C::ln2())));
+
+    // eˣ = 2ⁿ · eʳ with n = round(x · log₂(e)) and r = x - n · ln(2)
+    const V n = floor(x * T(C::log2_e()) + T(0.5));
+    const V r = (x - n * T(C::ln2_hi())) - n * T(C::ln2_lo());
+    const V p = Detail::expm1Poly(r);
+    const I ni = static_cast<I>(n);
+
+    // eˣ - 1 = 2ⁿ · p + (2ⁿ - 1), where 2ⁿ - 1 is exact for small n
+    const V t = ldexp(V::One(), min(ni, I(C::digits())));
+    x = t * p + (t - T(1));
+    // for large n the -1 does not matter anymore
+    x(n > T(C::digits())) = Detail::scalePow2(p + T(1), ni);
+
+    x(x0 == V::Zero() || isnan(x0)) = x0;  // keeps the sign of -0
+    return x;
+}
+
 #endif // Vc_COMMON_MATH_H_INTERNAL
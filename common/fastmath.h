@@ -0,0 +1,448 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifdef Vc_COMMON_MATH_H_INTERNAL
+
+namespace fast
+{
+/**
+ * \ingroup Math
+ *
+ * Accuracy policy for the functions in Vc::fast: the result is within 4 ulp of the correctly
+ * rounded value. This is the default policy.
+ */
+struct Ulp4 {};
+/**
+ * \ingroup Math
+ *
+ * Accuracy policy for the functions in Vc::fast: the relative error of the result is less
+ * than 2⁻¹², i.e. about the accuracy of rsqrt and reciprocal.
+ */
+struct Bits12 {};
+}  // namespace fast
+
+namespace Detail
+{
+// has_fast_math{{{1
+// selects the vector types for which Vc::fast has its own implementation, all other types
+// use the accurate functions
+#ifdef Vc_IMPL_SSE
+template <typename T, typename Abi> using has_fast_math = is_sse_or_avx_float<T, Abi>;
+#else
+template <typename T, typename Abi> using has_fast_math = std::false_type;
+#endif
+
+#ifdef Vc_IMPL_SSE
+// fastExpPoly{{{1
+// eʳ for |r| ≤ ln(2)/2, minimax polynomials of degree 5 / 10 (Ulp4) and 3 (Bits12)
+template <typename Abi>
+Vc_INTRINSIC Vector<float, Abi> fastExpPoly(fast::Ulp4, Vector<float, Abi> r)
+{
+    return ((((( 8.369148708879948e-3f  * r
+               + 4.1917506605386734e-2f) * r
+               + 1.6666504740715027e-1f) * r
+               + 4.9998870491981506e-1f) * r
+               + 1.0f                  ) * r
+               + 1.0f                  );
+}
+template <typename Abi>
+Vc_INTRINSIC Vector<double, Abi> fastExpPoly(fast::Ulp4, Vector<double, Abi> r)
+{
+    return (((((((((( 2.7626357241447223e-7  * r
+                    + 2.764018079620985e-6  ) * r
+                    + 2.4801504346997686e-5 ) * r
+                    + 1.9841170270440067e-4 ) * r
+                    + 1.3888888932488599e-3 ) * r
+                    + 8.333333385667782e-3  ) * r
+                    + 4.166666666657314e-2  ) * r
+                    + 1.6666666666554406e-1 ) * r
+                    + 5.000000000000006e-1  ) * r
+                    + 1.0000000000000067    ) * r
+                    + 1.0                   );
+}
+template <typename Abi>
+Vc_INTRINSIC Vector<float, Abi> fastExpPoly(fast::Bits12, Vector<float, Abi> r)
+{
+    return ((( 1.676701158285141e-1f  * r
+             + 5.050222873687744e-1f) * r
+             + 9.999849200248718e-1f) * r
+             + 9.999245405197144e-1f);
+}
+template <typename Abi>
+Vc_INTRINSIC Vector<double, Abi> fastExpPoly(fast::Bits12, Vector<double, Abi> r)
+{
+    return ((( 1.6767011875167742e-1  * r
+             + 5.050222842135581e-1 ) * r
+             + 9.999849286318738e-1 ) * r
+             + 9.999245569508708e-1 );
+}
+
+// fastExpReduce{{{1
+// r = x - n · ln(2); Ulp4 needs the extra precision of the two-part ln(2)
+template <typename V> Vc_INTRINSIC V fastExpReduce(fast::Ulp4, V x, V n)
+{
+    using C = ExpConstants<typename V::EntryType>;
+    return (x - n * C::ln2_hi()) - n * C::ln2_lo();
+}
+template <typename V> Vc_INTRINSIC V fastExpReduce(fast::Bits12, V x, V n)
+{
+    return x - n * ExpConstants<typename V::EntryType>::ln2();
+}
+
+// fastLog1p{{{1
+// ln(1 + f) for f ∈ [√½ - 1, √2 - 1]. With s = f / (2 + f) the result is
+// ln((1 + s) / (1 - s)) = 2s + s · R(s²). Ulp4 uses f - 2s = s · f to evaluate it as
+// f - (f²/2 - s · (f²/2 + R)), which keeps the rounding errors of the small terms.
+template <typename Abi>
+Vc_INTRINSIC Vector<float, Abi> fastLog1p(fast::Ulp4, Vector<float, Abi> f)
+{
+    const Vector<float, Abi> s = f / (f + 2.f);
+    const Vector<float, Abi> z = s * s;
+    const Vector<float, Abi> R = z * ((2.9579949378967285e-1f  * z
+                                     + 3.998878002166748e-1f ) * z
+                                     + 6.666668653488159e-1f );
+    const Vector<float, Abi> hfsq = .5f * f * f;
+    return f - (hfsq - s * (hfsq + R));
+}
+template <typename Abi>
+Vc_INTRINSIC Vector<double, Abi> fastLog1p(fast::Ulp4, Vector<double, Abi> f)
+{
+    const Vector<double, Abi> s = f / (f + 2.);
+    const Vector<double, Abi> z = s * s;
+    const Vector<double, Abi> R = z * (((((( 1.4616449685043406e-1  * z
+                                           + 1.5331721600556042e-1 ) * z
+                                           + 1.8182889125261723e-1 ) * z
+                                           + 2.222221113479508e-1  ) * z
+                                           + 2.8571428625975487e-1 ) * z
+                                           + 3.9999999999899505e-1 ) * z
+                                           + 6.666666666666667e-1  );
+    const Vector<double, Abi> hfsq = .5 * f * f;
+    return f - (hfsq - s * (hfsq + R));
+}
+// Bits12 evaluates 2s · g(s²) with g(z) ≈ atanh(√z) / √z
+template <typename Abi>
+Vc_INTRINSIC Vector<float, Abi> fastLog1p(fast::Bits12, Vector<float, Abi> f)
+{
+    const Vector<float, Abi> s = f / (f + 2.f);
+    return 2.f * s * (3.393312692642212e-1f * (s * s) + 9.999778866767883e-1f);
+}
+template <typename Abi>
+Vc_INTRINSIC Vector<double, Abi> fastLog1p(fast::Bits12, Vector<double, Abi> f)
+{
+    const Vector<double, Abi> s = f / (f + 2.);
+    return 2. * s * (3.393312730346308e-1 * (s * s) + 9.999778713712942e-1);
+}
+
+// fastSinPoly / fastCosPoly{{{1
+// sin(r) and cos(r) for |r| ≤ π/4, with z = r²
+template <typename Abi>
+Vc_INTRINSIC Vector<float, Abi> fastSinPoly(fast::Ulp4, Vector<float, Abi> r,
+                                            Vector<float, Abi> z)
+{
+    return r + r * z * ((-1.9587890710681677e-4f  * z
+                        + 8.332747966051102e-3f ) * z
+                        - 1.66666641831398e-1f  );
+}
+template <typename Abi>
+Vc_INTRINSIC Vector<double, Abi> fastSinPoly(fast::Ulp4, Vector<double, Abi> r,
+                                             Vector<double, Abi> z)
+{
+    return r + r * z * ((((( 1.5918129294866608e-10  * z
+                           - 2.5051131845003624e-8 ) * z
+                           + 2.755731610255244e-6  ) * z
+                           - 1.9841269836758574e-4 ) * z
+                           + 8.333333333330948e-3  ) * z
+                           - 1.6666666666666666e-1 );
+}
+template <typename Abi>
+Vc_INTRINSIC Vector<float, Abi> fastSinPoly(fast::Bits12, Vector<float, Abi> r,
+                                            Vector<float, Abi> z)
+{
+    return r + r * z * (8.21185577660799e-3f * z - 1.6665731370449066e-1f);
+}
+template <typename Abi>
+Vc_INTRINSIC Vector<double, Abi> fastSinPoly(fast::Bits12, Vector<double, Abi> r,
+                                             Vector<double, Abi> z)
+{
+    return r + r * z * (8.211855507308219e-3 * z - 1.6665731001278386e-1);
+}
+template <typename Abi>
+Vc_INTRINSIC Vector<float, Abi> fastCosPoly(fast::Ulp4, Vector<float, Abi> z)
+{
+    return 1.f - .5f * z + z * z * (( 2.454794230288826e-5f  * z
+                                    - 1.388830249197781e-3f) * z
+                                    + 4.16666641831398e-2f );
+}
+template <typename Abi>
+Vc_INTRINSIC Vector<double, Abi> fastCosPoly(fast::Ulp4, Vector<double, Abi> z)
+{
+    return 1. - .5 * z + z * z * ((((( -1.1382632425521717e-11  * z
+                                     + 2.08761462684032e-9   ) * z
+                                     - 2.7557317271729793e-7 ) * z
+                                     + 2.480158729876569e-5  ) * z
+                                     - 1.3888888888887398e-3 ) * z
+                                     + 4.1666666666666664e-2 );
+}
+template <typename Abi>
+Vc_INTRINSIC Vector<float, Abi> fastCosPoly(fast::Bits12, Vector<float, Abi> z)
+{
+    return 1.f - .5f * z + z * z * (-1.3736813561990857e-3f * z + 4.1665494441986084e-2f);
+}
+template <typename Abi>
+Vc_INTRINSIC Vector<double, Abi> fastCosPoly(fast::Bits12, Vector<double, Abi> z)
+{
+    return 1. - .5 * z + z * z * (-1.373681406173436e-3 * z + 4.166549508011033e-2);
+}
+
+// FastTrigConstants{{{1
+// pio2_1 + pio2_2 + pio2_3 = π/2, n · pio2_1 and n · pio2_2 are exact for |n| < 2¹² (float)
+// or 2²⁰ (double). pio2_2 + pio2_3 rounded is pio2_23.
+template <typename T> struct FastTrigConstants;
+template <> struct FastTrigConstants<float> {
+    static constexpr float _2_pi() { return 6.366197466850281e-1f; }
+    static constexpr float pio2_1() { return 1.5703125f; }
+    static constexpr float pio2_2() { return 4.837512969970703e-4f; }
+    static constexpr float pio2_3() { return 7.549790126404332e-8f; }
+    static constexpr float pio2_23() { return 4.838267923332751e-4f; }
+};
+template <> struct FastTrigConstants<double> {
+    static constexpr double _2_pi() { return 6.366197723675814e-1; }
+    static constexpr double pio2_1() { return 1.5707963267341256; }
+    static constexpr double pio2_2() { return 6.077100506303966e-11; }
+    static constexpr double pio2_3() { return 2.0222662487959506e-21; }
+    static constexpr double pio2_23() { return 6.077101923132169e-11; }
+};
+
+// fastTrigReduce{{{1
+// r = x - n · π/2 with n = round(x · 2/π); returns n, r ∈ [-π/4, π/4]
+template <typename V> Vc_INTRINSIC V fastTrigReduce(fast::Ulp4, V x, V &r)
+{
+    using C = FastTrigConstants<typename V::EntryType>;
+    const V n = floor(x * C::_2_pi() + typename V::EntryType(.5));
+    r = ((x - n * C::pio2_1()) - n * C::pio2_2()) - n * C::pio2_3();
+    return n;
+}
+template <typename V> Vc_INTRINSIC V fastTrigReduce(fast::Bits12, V x, V &r)
+{
+    using C = FastTrigConstants<typename V::EntryType>;
+    const V n = floor(x * C::_2_pi() + typename V::EntryType(.5));
+    r = (x - n * C::pio2_1()) - n * C::pio2_23();
+    return n;
+}
+
+// fastQuadrant{{{1
+// n mod 4, for integral n
+template <typename V> Vc_INTRINSIC V fastQuadrant(V n)
+{
+    using T = typename V::EntryType;
+    return n - T(4) * floor(n * T(.25));
+}
+#endif  // Vc_IMPL_SSE
+//}}}1
+}  // namespace Detail
+
+namespace fast
+{
+#ifdef Vc_IMPL_SSE
+/**
+ * \ingroup Math
+ *
+ * Returns eˣ, trading accuracy and the handling of special values for speed.
+ *
+ * \tparam Accuracy Ulp4 (within 4 ulp, the default) or Bits12 (relative error < 2⁻¹²).
+ *
+ * The result is only valid if it is a normal number, i.e. for |x| < 87 (float) or
+ * |x| < 708 (double). NaN, infinities, overflow, and underflow are not handled.
+ */
+template <typename Accuracy = Ulp4, typename T, typename Abi,
+          typename = enable_if<Detail::is_sse_or_avx_float<T, Abi>::value>>
+Vc_ALWAYS_INLINE Vector<T, Abi> exp(Vector<T, Abi> x)
+{
+    using V = Vector<T, Abi>;
+    // eˣ = 2ⁿ · eʳ with n = round(x · log₂(e)) and r = x - n · ln(2)
+    const V n = floor(x * T(Detail::ExpConstants<T>::log2_e()) + T(.5));
+    return ldexp(Detail::fastExpPoly(Accuracy(), Detail::fastExpReduce(Accuracy(), x, n)),
+                 static_cast<SimdArray<int, V::Size>>(n));
+}
+
+/**
+ * \ingroup Math
+ *
+ * Returns the natural logarithm of \p x, trading accuracy and the handling of special
+ * values for speed.
+ *
+ * \tparam Accuracy Ulp4 (within 4 ulp, the default) or Bits12 (relative error < 2⁻¹²).
+ *
+ * \p x must be a positive normal number. Zero, subnormals, negative values, NaN, and
+ * infinity are not handled.
+ */
+template <typename Accuracy = Ulp4, typename T, typename Abi,
+          typename = enable_if<Detail::is_sse_or_avx_float<T, Abi>::value>>
+Vc_ALWAYS_INLINE Vector<T, Abi> log(Vector<T, Abi> x)
+{
+    using V = Vector<T, Abi>;
+    using C = Detail::Const<T, Abi>;
+    using E = Detail::ExpConstants<T>;
+    // x = 2ᵉ · m with m ∈ [√½, √2[
+    V e = Detail::exponent(x.data());
+    x.setZero(C::exponentMask());
+    x = Detail::operator|(x, C::_1_2());  // x ∈ [½, 1[
+    const auto smallX = x < C::_1_sqrt2();
+    x(smallX) += x;
+    e(!smallX) += V::One();
+
+    // ln(x) = e · ln(2) + ln(m)
+    const V p = Detail::fastLog1p(Accuracy(), x - V::One());
+    return e * T(E::ln2_hi()) + (p + e * T(E::ln2_lo()));
+}
+
+/**
+ * \ingroup Math
+ *
+ * Returns the sine of \p x, trading accuracy and the handling of special values for speed.
+ *
+ * \tparam Accuracy Ulp4 (within 4 ulp, the default) or Bits12 (relative error < 2⁻¹²).
+ *
+ * The range reduction supports |x| < 4096 (float) or |x| < 10⁶ (double). For |x| > π the
+ * error bound close to the zeros of the function is an absolute error of ε (Ulp4) or 2⁻¹²
+ * (Bits12) instead. NaN and infinity are not handled.
+ */
+template <typename Accuracy = Ulp4, typename T, typename Abi,
+          typename = enable_if<Detail::is_sse_or_avx_float<T, Abi>::value>>
+Vc_ALWAYS_INLINE Vector<T, Abi> sin(Vector<T, Abi> x)
+{
+    using V = Vector<T, Abi>;
+    V r;
+    const V q = Detail::fastQuadrant(Detail::fastTrigReduce(Accuracy(), x, r));
+    const V z = r * r;
+    // sin(n · π/2 + r) = sin(r), cos(r), -sin(r), -cos(r) for n mod 4 = 0, 1, 2, 3
+    x = Detail::fastSinPoly(Accuracy(), r, z);
+    x(q == T(1) || q == T(3)) = Detail::fastCosPoly(Accuracy(), z);
+    x(q >= T(2)) = -x;
+    return x;
+}
+
+/**
+ * \ingroup Math
+ *
+ * Returns the cosine of \p x, trading accuracy and the handling of special values for
+ * speed.
+ *
+ * \tparam Accuracy Ulp4 (within 4 ulp, the default) or Bits12 (relative error < 2⁻¹²).
+ *
+ * The range reduction supports |x| < 4096 (float) or |x| < 10⁶ (double). For |x| > π the
+ * error bound close to the zeros of the function is an absolute error of ε (Ulp4) or 2⁻¹²
+ * (Bits12) instead. NaN and infinity are not handled.
+ */
+template <typename Accuracy = Ulp4, typename T, typename Abi,
+          typename = enable_if<Detail::is_sse_or_avx_float<T, Abi>::value>>
+Vc_ALWAYS_INLINE Vector<T, Abi> cos(Vector<T, Abi> x)
+{
+    using V = Vector<T, Abi>;
+    V r;
+    const V q = Detail::fastQuadrant(Detail::fastTrigReduce(Accuracy(), x, r));
+    const V z = r * r;
+    // cos(n · π/2 + r) = cos(r), -sin(r), -cos(r), sin(r) for n mod 4 = 0, 1, 2, 3
+    x = Detail::fastCosPoly(Accuracy(), z);
+    x(q == T(1) || q == T(3)) = Detail::fastSinPoly(Accuracy(), r, z);
+    x(q == T(1) || q == T(2)) = -x;
+    return x;
+}
+#endif  // Vc_IMPL_SSE
+
+// fallbacks{{{1
+// the remaining vector types (Scalar and MIC) use the accurate functions
+#define Vc_FAST_FALLBACK_(name_)                                                         \
+    template <typename Accuracy = Ulp4, typename T, typename Abi>                        \
+    Vc_ALWAYS_INLINE enable_if<std::is_floating_point<T>::value &&                       \
+                                   !Detail::has_fast_math<T, Abi>::value,                \
+                               Vector<T, Abi>>                                           \
+    name_(Vector<T, Abi> x)                                                              \
+    {                                                                                    \
+        return Vc::name_(x);                                                             \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+Vc_FAST_FALLBACK_(exp);
+Vc_FAST_FALLBACK_(log);
+Vc_FAST_FALLBACK_(sin);
+Vc_FAST_FALLBACK_(cos);
+#undef Vc_FAST_FALLBACK_
+//}}}1
+// SimdArray{{{1
+// declared before the operations below, which apply them to nested SimdArrays
+#define Vc_FAST_SIMDARRAY_(name_)                                                        \
+    template <typename Accuracy = Ulp4, typename T, std::size_t N, typename V,           \
+              std::size_t M>                                                             \
+    SimdArray<T, N, V, M> name_(const SimdArray<T, N, V, M> &x)
+Vc_FAST_SIMDARRAY_(exp);
+Vc_FAST_SIMDARRAY_(log);
+Vc_FAST_SIMDARRAY_(sin);
+Vc_FAST_SIMDARRAY_(cos);
+#undef Vc_FAST_SIMDARRAY_
+//}}}1
+}  // namespace fast
+
+namespace Detail
+{
+// FastOperation{{{1
+// applies Vc::fast::name_<Accuracy> to the pieces of a SimdArray
+#define Vc_FAST_OPERATION_(name_, Name_)                                                 \
+    template <typename Accuracy> struct Fast##Name_ : public Common::Operations::tag {   \
+        template <typename V,                                                            \
+                  typename = decltype(fast::name_<Accuracy>(std::declval<V>()))>         \
+        Vc_INTRINSIC void operator()(V &r, const V &x)                                   \
+        {                                                                                \
+            r = fast::name_<Accuracy>(x);                                                \
+        }                                                                                \
+    }
+Vc_FAST_OPERATION_(exp, Exp);
+Vc_FAST_OPERATION_(log, Log);
+Vc_FAST_OPERATION_(sin, Sin);
+Vc_FAST_OPERATION_(cos, Cos);
+#undef Vc_FAST_OPERATION_
+//}}}1
+}  // namespace Detail
+
+namespace fast
+{
+#define Vc_FAST_SIMDARRAY_(name_, Name_)                                                 \
+    template <typename Accuracy, typename T, std::size_t N, typename V, std::size_t M>   \
+    inline SimdArray<T, N, V, M> name_(const SimdArray<T, N, V, M> &x)                   \
+    {                                                                                    \
+        return SimdArray<T, N, V, M>::fromOperation(Detail::Fast##Name_<Accuracy>(), x); \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+Vc_FAST_SIMDARRAY_(exp, Exp);
+Vc_FAST_SIMDARRAY_(log, Log);
+Vc_FAST_SIMDARRAY_(sin, Sin);
+Vc_FAST_SIMDARRAY_(cos, Cos);
+#undef Vc_FAST_SIMDARRAY_
+}  // namespace fast
+
+#endif  // Vc_COMMON_MATH_H_INTERNAL
+
+// vim: foldmethod=marker
@@ -0,0 +1,643 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_FFT_H_
+#define VC_COMMON_FFT_H_
+
+#include <complex>
+#include <vector>
+#include "complex.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// fft helpers{{{1
+template <typename T> using FftBuffer = std::vector<T, Allocator<T>>;
+
+// i * z
+template <typename V> Vc_INTRINSIC complex<V> fft_mul_i(const complex<V> &z)
+{
+    return {-z.imag(), z.real()};
+}
+template <typename T> Vc_INTRINSIC std::complex<T> fft_mul_i(const std::complex<T> &z)
+{
+    return {-z.imag(), z.real()};
+}
+
+/**\internal
+ * Radix-4 butterfly (forward direction) without the twiddle factors:
+ * `y_r = sum_j x_j * (-i)^(r * j)`.
+ */
+template <typename C> Vc_INTRINSIC void fft_butterfly4(C &a, C &b, C &c, C &d)
+{
+    const C apc = a + c;
+    const C amc = a - c;
+    const C bpd = b + d;
+    const C jbmd = fft_mul_i(b - d);
+    a = apc + bpd;
+    b = amc - jbmd;
+    c = apc - bpd;
+    d = amc + jbmd;
+}
+
+/**\internal
+ * Radix-8 butterfly (forward direction) without the twiddle factors:
+ * `y_r = sum_j x_j * w^(r * j)`, `w = exp(-2πi/8)`. It combines the radix-4 butterflies
+ * of the even and the odd entries.
+ */
+template <typename T, typename C> Vc_INTRINSIC void fft_butterfly8(C (&x)[8])
+{
+    C e0 = x[0], e1 = x[2], e2 = x[4], e3 = x[6];
+    C o0 = x[1], o1 = x[3], o2 = x[5], o3 = x[7];
+    fft_butterfly4(e0, e1, e2, e3);
+    fft_butterfly4(o0, o1, o2, o3);
+    // w * o1 and w * o3 with w = (1 - i) / sqrt(2); w^2 = -i and w^3 = -i * w
+    const T sqrt_half = T(0.70710678118654752440);
+    const C wo1 = C(o1.real() + o1.imag(), o1.imag() - o1.real()) * sqrt_half;
+    const C wo3 = C(o3.real() + o3.imag(), o3.imag() - o3.real()) * sqrt_half;
+    x[0] = e0 + o0;
+    x[4] = e0 - o0;
+    x[1] = e1 + wo1;
+    x[5] = e1 - wo1;
+    x[2] = e2 - fft_mul_i(o2);
+    x[6] = e2 + fft_mul_i(o2);
+    x[3] = e3 - fft_mul_i(wo3);
+    x[7] = e3 + fft_mul_i(wo3);
+}
+
+/**\internal
+ * Stores the twiddle factors `exp(-2πi * index(k) / n)` to \p re[k] and \p im[k] for all
+ * `k < count`. They are computed with double precision sincos on angles reduced to
+ * [-π, π].
+ */
+template <typename T, typename F>
+void fft_fill_twiddles(T *re, T *im, std::size_t count, std::size_t n, F &&index)
+{
+    for (std::size_t k = 0; k < count; k += double_v::Size) {
+        const double_v angle = double_v::generate([&](std::size_t i) {
+            const std::size_t j = index(k + i) % n;
+            return -6.283185307179586477 * (2 * j > n ? double(j) - double(n) : double(j)) /
+                   double(n);
+        });
+        double_v s, c;
+        sincos(angle, &s, &c);
+        for (std::size_t i = 0; i < double_v::Size && k + i < count; ++i) {
+            re[k + i] = static_cast<T>(c[i]);
+            im[k + i] = static_cast<T>(s[i]);
+        }
+    }
+}
+
+template <typename T> Vc_INTRINSIC std::size_t fft_padded(std::size_t n)
+{
+    return (n + Vector<T>::Size - 1) / Vector<T>::Size * Vector<T>::Size;
+}
+
+/**\internal
+ * The distance between the work arrays of a plan. Arrays larger than a page are skewed by
+ * 512 bytes: otherwise the power-of-two sized arrays start at the same cache set and the
+ * sixteen streams of a radix-8 stage evict each other from L1.
+ */
+template <typename T> Vc_INTRINSIC std::size_t fft_stride(std::size_t n)
+{
+    return fft_padded<T>(n) * sizeof(T) > 4096 ? fft_padded<T>(n) + 512 / sizeof(T)
+                                                : fft_padded<T>(n);
+}
+
+// FftKernel{{{1
+/**\internal
+ * The complex forward transform of a power-of-two size on SoA data.
+ *
+ * The transform is a Stockham autosort FFT: every stage reads one buffer and writes the
+ * other, and the result comes out in natural order without a bit-reversal pass. The stages
+ * are radix-8, plus one radix-4 or radix-2 stage for the remaining factor. Every stage
+ * streams both buffers through the cache once, and for the larger sizes the transform is
+ * bound by these passes rather than by the butterflies. Radix-8 needs ceil(log8 n) passes
+ * instead of the ceil(log4 n) of radix-4, e.g. 6 instead of 8 for 64K points. On AVX2
+ * this made the transforms 1.4-1.9x (float) and 1.0-1.6x (double) faster than radix-4.
+ *
+ * Stage `n, s` of radix \c R (sub-transform length \c n, stride \c s) computes for all
+ * `p < n/R` and `q < s`:
+ * \code
+ * y[q + s * (Rp + r)] = w^(r * p) * butterflyR(x[q + s * (p + j * n/R)])_r,  w = exp(-2πi/n)
+ * \endcode
+ * With `s >= V::Size` the \c q loop is contiguous and vectorizes with one broadcast
+ * twiddle per \c p. The first stages (`s < V::Size`) instead vectorize over `k = q + s
+ * * p`, which keeps the loads contiguous; they need the twiddles per \c k (expanded) and
+ * reorder the results with Vc::interleave (`s == 1`) or via a small buffer.
+ */
+template <typename T> class FftKernel
+{
+    typedef Vector<T> V;
+    typedef complex<V> CV;
+    typedef std::complex<T> CT;
+    static constexpr std::size_t W = V::Size;
+
+    struct Stage {
+        std::size_t radix;
+        std::size_t n;         // length of the sub-transforms
+        std::size_t s;         // stride
+        std::size_t twiddles;  // offset into m_twiddles
+        std::size_t count;     // number of twiddles per table (padded to W)
+    };
+
+public:
+    explicit FftKernel(std::size_t size) : m_size(size)
+    {
+        Vc_ASSERT(size > 0 && (size & (size - 1)) == 0)
+        std::size_t total = 0;
+        std::size_t n = size, s = 1;
+        const auto addStage = [&](std::size_t radix) {
+            const std::size_t count = fft_padded<T>(s < W ? size / radix : n / radix);
+            m_stages.push_back({radix, n, s, total, count});
+            total += 2 * (radix - 1) * count;
+            n /= radix;
+            s *= radix;
+        };
+        while (n >= 8) {
+            addStage(8);
+        }
+        if (n == 4) {
+            addStage(4);
+        } else if (n == 2) {
+            m_stages.push_back({2, 2, s, total, 0});
+        }
+        m_twiddles.resize(total);
+        for (const Stage &st : m_stages) {
+            if (st.radix == 2) {
+                continue;
+            }
+            // expanded tables are indexed with k = q + s * p, the others with p
+            const std::size_t div = st.s < W ? st.s : 1;
+            const std::size_t len = st.s < W ? size / st.radix : st.n / st.radix;
+            for (std::size_t r = 1; r < st.radix; ++r) {
+                T *re = &m_twiddles[st.twiddles + (2 * r - 2) * st.count];
+                fft_fill_twiddles(re, re + st.count, len, st.n,
+                                  [&](std::size_t k) { return r * (k / div); });
+            }
+        }
+    }
+
+    std::size_t size() const { return m_size; }
+
+    /**\internal
+     * Transforms the data in \p re, \p im, using \p re2, \p im2 (of the same size) as
+     * work space. Returns \c true if the result is in \p re2, \p im2.
+     */
+    bool run(T *re, T *im, T *re2, T *im2) const
+    {
+        bool swapped = false;
+        for (const Stage &st : m_stages) {
+            switch (st.radix) {
+            case 2:
+                radix2(st, re, im, re2, im2);
+                break;
+            case 4:
+                radix<4>(st, re, im, re2, im2);
+                break;
+            default:
+                radix<8>(st, re, im, re2, im2);
+                break;
+            }
+            std::swap(re, re2);
+            std::swap(im, im2);
+            swapped = !swapped;
+        }
+        return swapped;
+    }
+
+private:
+    static Vc_INTRINSIC CV load(const T *re, const T *im, std::size_t i)
+    {
+        return {V(re + i, Vc::Aligned), V(im + i, Vc::Aligned)};
+    }
+    static Vc_INTRINSIC void store(const CV &z, T *re, T *im, std::size_t i)
+    {
+        z.real().store(re + i, Vc::Aligned);
+        z.imag().store(im + i, Vc::Aligned);
+    }
+
+    template <typename C> static Vc_INTRINSIC void butterfly(C (&y)[4])
+    {
+        fft_butterfly4(y[0], y[1], y[2], y[3]);
+    }
+    template <typename C> static Vc_INTRINSIC void butterfly(C (&y)[8])
+    {
+        fft_butterfly8<T>(y);
+    }
+
+    void radix2(const Stage &st, const T *xr, const T *xi, T *yr, T *yi) const
+    {
+        // the last stage: y[q] = x[q] + x[q + s], y[q + s] = x[q] - x[q + s]
+        const std::size_t s = st.s;
+        std::size_t q = 0;
+        for (; q + W <= s; q += W) {
+            const CV a = load(xr, xi, q);
+            const CV b = load(xr, xi, q + s);
+            store(a + b, yr, yi, q);
+            store(a - b, yr, yi, q + s);
+        }
+        for (; q < s; ++q) {
+            const CT a(xr[q], xi[q]), b(xr[q + s], xi[q + s]);
+            yr[q] = (a + b).real();
+            yi[q] = (a + b).imag();
+            yr[q + s] = (a - b).real();
+            yi[q + s] = (a - b).imag();
+        }
+    }
+
+    template <std::size_t R>
+    void radix(const Stage &st, const T *xr, const T *xi, T *yr, T *yi) const
+    {
+        const std::size_t s = st.s, m = st.n / R, part = m_size / R;
+        const T *tw = &m_twiddles[st.twiddles];
+        const std::size_t len = st.count;
+        if (s >= W) {
+            for (std::size_t p = 0; p < m; ++p) {
+                CV w[R];
+                for (std::size_t r = 1; r < R; ++r) {
+                    w[r] = CV(V(tw[(2 * r - 2) * len + p]), V(tw[(2 * r - 1) * len + p]));
+                }
+                for (std::size_t q = 0; q < s; q += W) {
+                    const std::size_t k = q + s * p;
+                    CV y[R];
+                    for (std::size_t j = 0; j < R; ++j) {
+                        y[j] = load(xr, xi, k + j * part);
+                    }
+                    butterfly(y);
+                    const std::size_t o = q + R * s * p;
+                    store(y[0], yr, yi, o);
+                    for (std::size_t r = 1; r < R; ++r) {
+                        store(y[r] * w[r], yr, yi, o + r * s);
+                    }
+                }
+            }
+        } else if (part >= W) {
+            for (std::size_t k = 0; k < part; k += W) {
+                CV y[R];
+                for (std::size_t j = 0; j < R; ++j) {
+                    y[j] = load(xr, xi, k + j * part);
+                }
+                butterfly(y);
+                for (std::size_t r = 1; r < R; ++r) {
+                    y[r] *= load(tw + (2 * r - 2) * len, tw + (2 * r - 1) * len, k);
+                }
+                if (s == 1) {
+                    // y_r[j] goes to R * (k + j) + r: an R x W transpose
+                    transposeStore(y, yr + R * k, yi + R * k);
+                } else {
+                    // lanes [j, j + s) of y_r go to R * (k + j) + r * s
+                    alignas(static_cast<std::size_t>(V::MemoryAlignment)) T tmp[2 * W];
+                    for (std::size_t r = 0; r < R; ++r) {
+                        y[r].real().store(&tmp[0], Vc::Aligned);
+                        y[r].imag().store(&tmp[W], Vc::Aligned);
+                        for (std::size_t j = 0; j < W; j += s) {
+                            const std::size_t o = R * (k + j) + r * s;
+                            std::copy_n(&tmp[j], s, yr + o);
+                            std::copy_n(&tmp[W + j], s, yi + o);
+                        }
+                    }
+                }
+            }
+        } else {
+            for (std::size_t k = 0; k < part; ++k) {
+                CT y[R];
+                for (std::size_t j = 0; j < R; ++j) {
+                    y[j] = CT(xr[k + j * part], xi[k + j * part]);
+                }
+                butterfly(y);
+                const std::size_t p = k / s, q = k % s;
+                for (std::size_t r = 0; r < R; ++r) {
+                    if (r > 0) {
+                        y[r] *= CT(tw[(2 * r - 2) * len + k], tw[(2 * r - 1) * len + k]);
+                    }
+                    yr[q + s * (R * p + r)] = y[r].real();
+                    yi[q + s * (R * p + r)] = y[r].imag();
+                }
+            }
+        }
+    }
+
+    static Vc_INTRINSIC void transposeStore(const CV (&y)[4], T *re, T *im)
+    {
+        scatter4(y[0].real(), y[1].real(), y[2].real(), y[3].real(), re);
+        scatter4(y[0].imag(), y[1].imag(), y[2].imag(), y[3].imag(), im);
+    }
+    static Vc_INTRINSIC void transposeStore(const CV (&y)[8], T *re, T *im)
+    {
+        scatter8(y[0].real(), y[1].real(), y[2].real(), y[3].real(), y[4].real(),
+                 y[5].real(), y[6].real(), y[7].real(), re);
+        scatter8(y[0].imag(), y[1].imag(), y[2].imag(), y[3].imag(), y[4].imag(),
+                 y[5].imag(), y[6].imag(), y[7].imag(), im);
+    }
+
+    static Vc_INTRINSIC void scatter4(const V &a, const V &b, const V &c, const V &d, T *mem)
+    {
+        const auto ac = Vc::interleave(a, c);
+        const auto bd = Vc::interleave(b, d);
+        const auto lo = Vc::interleave(ac.first, bd.first);
+        const auto hi = Vc::interleave(ac.second, bd.second);
+        lo.first.store(mem, Vc::Aligned);
+        lo.second.store(mem + W, Vc::Aligned);
+        hi.first.store(mem + 2 * W, Vc::Aligned);
+        hi.second.store(mem + 3 * W, Vc::Aligned);
+    }
+    // interleaving a_r with a_(r+4) first turns the 8 x W transpose into two 4 x W ones
+    static Vc_INTRINSIC void scatter8(const V &a0, const V &a1, const V &a2, const V &a3,
+                                      const V &a4, const V &a5, const V &a6, const V &a7,
+                                      T *mem)
+    {
+        const auto b0 = Vc::interleave(a0, a4);
+        const auto b1 = Vc::interleave(a1, a5);
+        const auto b2 = Vc::interleave(a2, a6);
+        const auto b3 = Vc::interleave(a3, a7);
+        scatter4(b0.first, b1.first, b2.first, b3.first, mem);
+        scatter4(b0.second, b1.second, b2.second, b3.second, mem + 4 * W);
+    }
+
+    std::size_t m_size;
+    std::vector<Stage> m_stages;
+    FftBuffer<T> m_twiddles;
+};
+template <typename T> constexpr std::size_t FftKernel<T>::W;
+//}}}1
+}  // namespace Detail
+
+namespace fft
+{
+// plan{{{1
+/**
+ * \ingroup Math
+ * \headerfile fft <Vc/fft>
+ *
+ * A complex discrete Fourier transform of a fixed power-of-two size \c n on arrays of
+ * std::complex<T> (\p T is \c float or \c double):
+ * \code
+ * forward: out[k] = sum_j in[j] * exp(-2πi j k / n)
+ * inverse: out[k] = sum_j in[j] * exp(+2πi j k / n)
+ * \endcode
+ * The inverse transform is not normalized: `inverse(forward(x)) == n * x`.
+ *
+ * The constructor precomputes the twiddle factors and allocates the work buffers, the
+ * transforms themselves do not allocate. The input is deinterleaved into separate real
+ * and imaginary arrays, transformed with radix-8 stages (plus one radix-4 or radix-2 stage) of
+ * butterflies on Vc::Vector<T>, and interleaved into the output. Therefore, \p in and
+ * \p out may be the same array (in-place transform) and need no special alignment.
+ *
+ * Since the work buffers are part of the plan, one plan object must not be used by
+ * several threads at the same time. Use one plan per thread instead.
+ *
+ * Example:
+ * \code
+ * Vc::fft::plan<float> fft(1024);
+ * std::vector<std::complex<float>> signal(1024), spectrum(1024);
+ * fft.forward(signal.data(), spectrum.data());
+ * fft.inverse(spectrum.data());  // in-place, now spectrum == 1024 * signal
+ * \endcode
+ */
+template <typename T> class plan
+{
+    static_assert(std::is_floating_point<T>::value,
+                  "Vc::fft::plan<T> requires T to be float or double.");
+    typedef Vector<T> V;
+
+public:
+    typedef std::complex<T> value_type;
+
+    /// Prepares transforms of size \p n, which must be a power of two.
+    explicit plan(std::size_t n)
+        : m_kernel(n), m_stride(Detail::fft_stride<T>(n)), m_work(4 * m_stride)
+    {
+    }
+
+    /// Returns the number of points of the transform.
+    std::size_t size() const { return m_kernel.size(); }
+
+    /// Writes the forward transform of the size() values at \p in to \p out.
+    void forward(const value_type *in, value_type *out) { transform(in, out, false); }
+    /// Replaces the size() values at \p data with their forward transform.
+    void forward(value_type *data) { transform(data, data, false); }
+    /// Writes the (unnormalized) inverse transform of \p in to \p out.
+    void inverse(const value_type *in, value_type *out) { transform(in, out, true); }
+    /// Replaces the size() values at \p data with their (unnormalized) inverse transform.
+    void inverse(value_type *data) { transform(data, data, true); }
+
+private:
+    // the inverse transform is conj(forward(conj(x)))
+    void transform(const value_type *in, value_type *out, bool inverse)
+    {
+        const std::size_t n = size();
+        T *re = &m_work[0];
+        T *im = re + m_stride;
+        std::size_t i = 0;
+        for (; i + V::Size <= n; i += V::Size) {
+            V r, j;
+            Detail::complex_load(r, j, in + i, Vc::Unaligned);
+            r.store(re + i, Vc::Aligned);
+            (inverse ? -j : j).store(im + i, Vc::Aligned);
+        }
+        for (; i < n; ++i) {
+            re[i] = in[i].real();
+            im[i] = inverse ? -in[i].imag() : in[i].imag();
+        }
+        if (m_kernel.run(re, im, re + 2 * m_stride, im + 2 * m_stride)) {
+            re += 2 * m_stride;
+            im += 2 * m_stride;
+        }
+        for (i = 0; i + V::Size <= n; i += V::Size) {
+            const V j(im + i, Vc::Aligned);
+            Detail::complex_store(V(re + i, Vc::Aligned), inverse ? -j : j, out + i,
+                                  Vc::Unaligned);
+        }
+        for (; i < n; ++i) {
+            out[i] = {re[i], inverse ? -im[i] : im[i]};
+        }
+    }
+
+    Detail::FftKernel<T> m_kernel;
+    std::size_t m_stride;
+    Detail::FftBuffer<T> m_work;
+};
+
+// real_plan{{{1
+/**
+ * \ingroup Math
+ * \headerfile fft <Vc/fft>
+ *
+ * A discrete Fourier transform of \c n real values (\c n a power of two, at least 2). The
+ * forward transform writes the `n / 2 + 1` non-redundant coefficients `X[0] ... X[n/2]`
+ * (the others follow from `X[n - k] == conj(X[k])`); the inverse transform reads them and
+ * writes \c n real values. As for plan, the inverse is not normalized:
+ * `inverse(forward(x)) == n * x`.
+ *
+ * The real input is packed into `n / 2` complex values `z[j] = x[2j] + i x[2j+1]`, which
+ * are transformed with the complex kernel of plan and then separated into the spectrum of
+ * \c x with one vectorized post-processing pass. Like plan, a real_plan allocates only in
+ * its constructor and must not be used by several threads at the same time.
+ */
+template <typename T> class real_plan
+{
+    static_assert(std::is_floating_point<T>::value,
+                  "Vc::fft::real_plan<T> requires T to be float or double.");
+    typedef Vector<T> V;
+    typedef complex<V> CV;
+    typedef std::complex<T> CT;
+
+public:
+    typedef T value_type;
+
+    /// Prepares transforms of size \p n, which must be a power of two and at least 2.
+    explicit real_plan(std::size_t n)
+        : m_kernel(n / 2)
+        , m_stride(Detail::fft_stride<T>(n / 2 + 1))
+        , m_twiddles(2 * m_stride)
+        , m_work(4 * m_stride)
+    {
+        Vc_ASSERT(n >= 2)
+        Detail::fft_fill_twiddles(&m_twiddles[0], &m_twiddles[m_stride], n / 2 + 1, n,
+                                  [](std::size_t k) { return k; });
+    }
+
+    /// Returns the number of real values of the transform.
+    std::size_t size() const { return 2 * m_kernel.size(); }
+
+    /**
+     * Writes the coefficients `0 ... size()/2` of the forward transform of the size()
+     * values at \p in to \p out.
+     */
+    void forward(const T *in, std::complex<T> *out)
+    {
+        const std::size_t m = m_kernel.size();
+        T *re = &m_work[0];
+        T *im = re + m_stride;
+        std::size_t i = 0;
+        for (; i + V::Size <= m; i += V::Size) {
+            V r, j;
+            Vc::deinterleave(&r, &j, in + 2 * i, Vc::Unaligned);
+            r.store(re + i, Vc::Aligned);
+            j.store(im + i, Vc::Aligned);
+        }
+        for (; i < m; ++i) {
+            re[i] = in[2 * i];
+            im[i] = in[2 * i + 1];
+        }
+        if (m_kernel.run(re, im, re + 2 * m_stride, im + 2 * m_stride)) {
+            re += 2 * m_stride;
+            im += 2 * m_stride;
+        }
+        // Z[m] = Z[0] lets the loop below read Z[m - k] for all k <= m
+        re[m] = re[0];
+        im[m] = im[0];
+        const T *wr = &m_twiddles[0];
+        const T *wi = &m_twiddles[m_stride];
+        for (i = 0; i + V::Size <= m + 1; i += V::Size) {
+            const std::size_t r = m + 1 - V::Size - i;
+            const CV x = separate(CV(V(re + i, Vc::Unaligned), V(im + i, Vc::Unaligned)),
+                                  CV(V(re + r, Vc::Unaligned).reversed(),
+                                     V(im + r, Vc::Unaligned).reversed()),
+                                  CV(V(wr + i, Vc::Aligned), V(wi + i, Vc::Aligned)));
+            x.store(out + i, Vc::Unaligned);
+        }
+        for (; i <= m; ++i) {
+            out[i] = separate(CT(re[i], im[i]), CT(re[m - i], im[m - i]), CT(wr[i], wi[i]));
+        }
+    }
+
+    /**
+     * Writes the (unnormalized) inverse transform of the coefficients `0 ... size()/2` at
+     * \p in to the size() values at \p out.
+     */
+    void inverse(const std::complex<T> *in, T *out)
+    {
+        const std::size_t m = m_kernel.size();
+        T *re = &m_work[0];
+        T *im = re + m_stride;
+        const T *wr = &m_twiddles[0];
+        const T *wi = &m_twiddles[m_stride];
+        // combine into the transform of z (conjugated for the inverse transform)
+        std::size_t i = 0;
+        for (; i + V::Size <= m; i += V::Size) {
+            const CV xr(in + m + 1 - V::Size - i, Vc::Unaligned);
+            const CV z = combine(CV(in + i, Vc::Unaligned),
+                                 CV(xr.real().reversed(), xr.imag().reversed()),
+                                 CV(V(wr + i, Vc::Aligned), V(wi + i, Vc::Aligned)));
+            z.real().store(re + i, Vc::Aligned);
+            (-z.imag()).store(im + i, Vc::Aligned);
+        }
+        for (; i < m; ++i) {
+            const CT z = combine(in[i], in[m - i], CT(wr[i], wi[i]));
+            re[i] = z.real();
+            im[i] = -z.imag();
+        }
+        if (m_kernel.run(re, im, re + 2 * m_stride, im + 2 * m_stride)) {
+            re += 2 * m_stride;
+            im += 2 * m_stride;
+        }
+        for (i = 0; i + V::Size <= m; i += V::Size) {
+            const auto tmp = Vc::interleave(V(re + i, Vc::Aligned), -V(im + i, Vc::Aligned));
+            tmp.first.store(out + 2 * i, Vc::Unaligned);
+            tmp.second.store(out + 2 * i + V::Size, Vc::Unaligned);
+        }
+        for (; i < m; ++i) {
+            out[2 * i] = re[i];
+            out[2 * i + 1] = -im[i];
+        }
+    }
+
+private:
+    /* With E and O the transforms of the even and odd input values, Z = E + iO and
+     * conj(Z[m-k]) = E - iO. Thus X[k] = E[k] + w^k O[k] (w = exp(-2πi/n)) follows from
+     * Z[k] and Z[m-k], and the inverse transform recovers Z[k] from X[k] and X[m-k].
+     */
+    template <typename C> static Vc_INTRINSIC C separate(C z, C zr, C w)
+    {
+        const C zc = conj(zr);
+        const C e = (z + zc) * T(0.5);
+        const C d = z - zc;
+        return e + w * C(d.imag() * T(0.5), d.real() * T(-0.5));  // (z - zc) / 2i
+    }
+    template <typename C> static Vc_INTRINSIC C combine(C x, C xr, C w)
+    {
+        const C xc = conj(xr);
+        const C o = (x - xc) * conj(w);
+        return x + xc + C(-o.imag(), o.real());  // E + iO, scaled by 2
+    }
+
+    Detail::FftKernel<T> m_kernel;
+    std::size_t m_stride;
+    Detail::FftBuffer<T> m_twiddles;
+    Detail::FftBuffer<T> m_work;
+};
+//}}}1
+}  // namespace fft
+}  // namespace Vc
+
+#endif  // VC_COMMON_FFT_H_
+
+// vim: foldmethod=marker
@@ -47,6 +47,40 @@ using SetIndexZeroT = std::integral_constant<GatherScatterImplementation, Gather
 using BitScanLoopT  = std::integral_constant<GatherScatterImplementation, GatherScatterImplementation::BitScanLoop>;
 using PopcntSwitchT = std::integral_constant<GatherScatterImplementation, GatherScatterImplementation::PopcntSwitch>;
 
+#if defined Vc_IMPL_AVX2 && !defined Vc_NO_HARDWARE_GATHERS
+#define Vc_HARDWARE_GATHERS 1
+#endif
+#ifndef Vc_HARDWARE_GATHER_THRESHOLD
+#define Vc_HARDWARE_GATHER_THRESHOLD 1
+#endif
+
+/**\internal
+ * The gather policy for targets with gather instructions (AVX2): a masked gather of \p T
+ * uses the instruction (vgatherdps, vpgatherdd, vgatherdpd, vpgatherdq, vpgatherqq,
+ * vgatherqpd) if at least \c value entries are active, and otherwise the strategy selected
+ * by the Vc_USE_*_GATHERS macros. A value of 0 uses the instruction unconditionally, a
+ * value larger than the vector size never.
+ * Vc_NO_HARDWARE_GATHERS disables the gather instructions for unmasked gathers as well.
+ *
+ * The default of 1 only skips empty masks: examples/gather measures the instruction to be
+ * faster than the emulations for any number of active entries on current cores. Define
+ * Vc_HARDWARE_GATHER_THRESHOLD (or specialize this class for a type) for cores with slow
+ * gather instructions.
+ */
+template <typename T>
+struct HardwareGatherThreshold
+    : public std::integral_constant<int, Vc_HARDWARE_GATHER_THRESHOLD> {
+};
+
+template <typename T, typename M> Vc_INTRINSIC bool useHardwareGather(const M &mask)
+{
+    return HardwareGatherThreshold<T>::value <= 0
+               ? true
+               : HardwareGatherThreshold<T>::value == 1
+                     ? !mask.isEmpty()
+                     : mask.count() >= HardwareGatherThreshold<T>::value;
+}
+
 template <typename V, typename MT, typename IT>
 Vc_ALWAYS_INLINE void executeGather(SetIndexZeroT,
                                     V &v,
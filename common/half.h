@@ -0,0 +1,130 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_HALF_H_
+#define VC_COMMON_HALF_H_
+
+#include <cstring>
+#include <type_traits>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// half_to_float{{{1
+/**\internal
+ * Converts the IEEE 754 binary16 value with the bit pattern \p h to float. The conversion
+ * is exact. Subnormal halfs are scaled into the normal float range by a multiplication.
+ */
+Vc_INTRINSIC float half_to_float(unsigned short h)
+{
+    const unsigned int sign = (h & 0x8000u) << 16;
+    unsigned int bits = (h & 0x7fffu) << 13;
+    float f;
+    std::memcpy(&f, &bits, sizeof(f));
+    f *= 5.192296858534828e+33f;  // 2^112 rebiases the exponent from 15 to 127
+    std::memcpy(&bits, &f, sizeof(f));
+    if ((h & 0x7c00u) == 0x7c00u) {  // inf and NaN
+        bits |= 0x7f800000u;
+    }
+    bits |= sign;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+// float_to_half{{{1
+/**\internal
+ * Converts \p x to the bit pattern of the nearest IEEE 754 binary16 value (rounding ties
+ * to even). Values out of range convert to infinity; NaNs stay (quiet) NaNs.
+ */
+Vc_INTRINSIC unsigned short float_to_half(float x)
+{
+    unsigned int bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    const unsigned int sign = (bits & 0x80000000u) >> 16;
+    bits &= 0x7fffffffu;
+    unsigned int r;
+    if (bits >= 0x47800000u) {  // >= 2^16: overflow, inf, or NaN
+        r = bits > 0x7f800000u ? 0x7e00u : 0x7c00u;
+    } else if (bits < 0x38800000u) {  // < 2^-14: subnormal half or zero
+        // adding 0.5 shifts the mantissa bits into place and lets the FPU round
+        float f;
+        std::memcpy(&f, &bits, sizeof(f));
+        f += 0.5f;
+        std::memcpy(&r, &f, sizeof(r));
+        r -= 0x3f000000u;
+    } else {
+        // rebias the exponent and round to nearest even on the 13 dropped bits
+        r = (bits + 0xc8000fffu + ((bits >> 13) & 1u)) >> 13;
+    }
+    return static_cast<unsigned short>(r | sign);
+}
+//}}}1
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ *
+ * IEEE 754 binary16 (half-precision) storage type.
+ *
+ * Vc does not compute with half-precision values. The type exists for storing data at half
+ * the memory footprint of \c float: Vc::float_v (and SimdArray<float, N>) can load from
+ * and store to `half` arrays, converting with the F16C instructions (vcvtph2ps/vcvtps2ph)
+ * where available and with an emulation otherwise. For whole arrays use Vc::convert.
+ *
+ * A \c half object converts implicitly from and to \c float.
+ */
+class half
+{
+public:
+    half() = default;
+    /// Converts \p x to the nearest half-precision value (ties to even).
+    Vc_INTRINSIC half(float x) : bits(Detail::float_to_half(x)) {}
+    /// Returns the value as float (exact).
+    Vc_INTRINSIC operator float() const { return Detail::half_to_float(bits); }
+
+    /// Returns the half-precision value with the bit pattern \p b.
+    static Vc_INTRINSIC half fromBits(unsigned short b)
+    {
+        half r;
+        r.bits = b;
+        return r;
+    }
+    /// Returns the bit pattern of the half-precision value.
+    Vc_INTRINSIC unsigned short toBits() const { return bits; }
+
+private:
+    unsigned short bits;
+};
+static_assert(sizeof(half) == 2 && std::is_trivially_copyable<half>::value,
+              "Vc::half must have the size and layout of IEEE 754 binary16");
+}  // namespace Vc
+
+#endif  // VC_COMMON_HALF_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,162 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_HISTOGRAM_H_
+#define VC_COMMON_HISTOGRAM_H_
+
+#include <iterator>
+#include <memory>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// combineConflicts{{{1
+/**\internal
+ * Returns the sum of \p values over all entries with the same index as the respective
+ * entry. \p first is cleared for all entries that have an entry with the same index at a
+ * lower position, i.e. afterwards it selects one entry per distinct index, which holds the
+ * sum of its group. Entry i is compared against entry (i + k) % Size in step k, so that
+ * every pair of entries is compared with Size - 1 rotations and compares.
+ */
+template <typename V, typename I>
+Vc_INTRINSIC V combineConflicts(const V &values, const I &indexes, typename V::MaskType &first)
+{
+    using M = typename V::MaskType;
+    const I lane = I::IndexesFromZero();
+    V sum = values;
+    for (int k = 1; k < int(V::Size); ++k) {
+        const M same = simd_cast<M>(indexes == indexes.rotated(k));
+        sum += iif(same, values.rotated(k), V::Zero());
+        first &= !(same && simd_cast<M>(lane >= int(V::Size) - k));
+    }
+    return sum;
+}
+//}}}1
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ *
+ * Adds the entries of \p values to the memory locations \p mem[\p indexes[i]] for all
+ * active entries of \p mask. Entries with equal indexes accumulate: their values are added
+ * up in the register before a single gather, add, and scatter per distinct index. (In
+ * contrast, <code>where(mask, array[indexes]) += values</code> loses all but one update of
+ * every duplicate index.)
+ *
+ * \param mem     The memory to accumulate into.
+ * \param indexes An integer vector with as many entries as \p values.
+ * \param values  The values to add.
+ * \param mask    Only the active entries of \p values are added.
+ */
+template <typename T, typename IT, typename V>
+inline enable_if<Traits::is_simd_vector<V>::value && Traits::is_simd_vector<IT>::value, void>
+scatter_add(T *mem, const IT &indexes, const V &values, const typename V::MaskType &mask)
+{
+    static_assert(IT::Size == V::Size, "scatter_add requires one index per value");
+    using I = typename V::IndexType;
+    I idx = simd_cast<I>(indexes);
+    // inactive entries get distinct negative indexes, which never conflict
+    where(simd_cast<typename I::MaskType>(!mask)) | idx = -1 - I::IndexesFromZero();
+    typename V::MaskType first = mask;
+    const V sum = Detail::combineConflicts(values, idx, first);
+    V x(mem, idx, first);
+    x += sum;
+    x.scatter(mem, idx, first);
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Adds the entries of \p values to the memory locations \p mem[\p indexes[i]]. Entries with
+ * equal indexes accumulate.
+ */
+template <typename T, typename IT, typename V>
+inline enable_if<Traits::is_simd_vector<V>::value && Traits::is_simd_vector<IT>::value, void>
+scatter_add(T *mem, const IT &indexes, const V &values)
+{
+    scatter_add(mem, indexes, values, typename V::MaskType(true));
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Increments the bins \p bins[\p indexes[i]] for all active entries of \p mask. Every entry
+ * counts, even if several entries share the same bin.
+ */
+template <typename T, typename IT>
+inline enable_if<Traits::is_simd_vector<IT>::value, void> histogram(
+    T *bins, const IT &indexes, const typename IT::MaskType &mask)
+{
+    using V = SimdArray<T, IT::Size>;
+    scatter_add(bins, indexes, V::One(), simd_cast<typename V::MaskType>(mask));
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Increments the bins \p bins[\p indexes[i]] for all entries of \p indexes. Every entry
+ * counts, even if several entries share the same bin.
+ */
+template <typename T, typename IT>
+inline enable_if<Traits::is_simd_vector<IT>::value, void> histogram(T *bins, const IT &indexes)
+{
+    using V = SimdArray<T, IT::Size>;
+    scatter_add(bins, indexes, V::One());
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Increments \p bins[i] for every index \c i in the contiguous range [\p first, \p last).
+ * The range is processed in vectors of Vector<T>::Size indexes.
+ *
+ * \param bins  The counters, which must be large enough for every index in the range. \p T
+ *              must be a vectorizable type.
+ * \param first The first iterator of a contiguous range of integers.
+ * \param last  The end iterator of the range.
+ */
+template <typename T, typename RandomIt>
+inline enable_if<!Traits::is_simd_vector<RandomIt>::value, void> histogram(T *bins,
+                                                                            RandomIt first,
+                                                                            RandomIt last)
+{
+    using V = Vector<T>;
+    using I = typename V::IndexType;
+    for (; last - first >= int(V::Size); first += V::Size) {
+        scatter_add(bins, I(std::addressof(*first), Vc::Unaligned), V::One());
+    }
+    for (; first != last; ++first) {
+        ++bins[*first];
+    }
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_HISTOGRAM_H_
+
+// vim: foldmethod=marker
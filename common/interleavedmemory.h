@@ -28,12 +28,61 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef VC_COMMON_INTERLEAVEDMEMORY_H_
 #define VC_COMMON_INTERLEAVEDMEMORY_H_
 
+#include <cstring>
 #include "macros.h"
 
 namespace Vc_VERSIONED_NAMESPACE
 {
 namespace Common
 {
+/**
+ * \internal
+ * The strategies for (de)interleaving a set of vectors:
+ * \li \c Kernel: all vectors are of type \p V and there are 2 to 8 of them. The
+ * InterleaveImpl shuffle kernels for \p V are used directly.
+ * \li \c Chunked: up to 16 vectors, all of the same size as \p V, with entries of the
+ * same size as the entries of \p V (e.g. float_v and int_v members of a struct). The
+ * kernels for \p V are applied to chunks of up to 8 members and the results are
+ * reinterpreted to the requested vector types.
+ * \li \c Strided: everything else. Every member is gathered/scattered on its own.
+ */
+enum class InterleaveStrategy { Kernel, Chunked, Strided };
+
+///\internal Whether the InterleaveImpl kernels for \p V can be reused for \p W.
+template <typename V, typename W>
+struct IsInterleaveCompatible
+    : public std::integral_constant<
+          bool, Traits::is_simd_vector<W>::value && !Traits::isSimdArray<W>::value &&
+                    W::Size == V::Size && sizeof(W) == sizeof(V) &&
+                    sizeof(typename W::EntryType) == sizeof(typename V::EntryType)> {
+};
+
+///\internal Reinterprets the bits of \p v as the (same-sized) vector type \p W.
+template <typename W, typename V> Vc_INTRINSIC W reinterpret_vector(const V &v)
+{
+    static_assert(sizeof(W) == sizeof(V), "reinterpret_vector requires equally sized types");
+    W w;
+    std::memcpy(static_cast<void *>(&w), static_cast<const void *>(&v), sizeof(W));
+    return w;
+}
+
+///\internal Determines the InterleaveStrategy for the vector types \p Ws.
+template <typename V, typename... Ws> struct InterleaveStrategyFor
+{
+    template <bool...> struct BoolPack;
+    template <bool... Bs>
+    using AllOf = std::is_same<BoolPack<true, Bs...>, BoolPack<Bs..., true>>;
+
+    static constexpr InterleaveStrategy value =
+        sizeof...(Ws) >= 2 && sizeof...(Ws) <= 8 &&
+                AllOf<std::is_same<V, Ws>::value...>::value
+            ? InterleaveStrategy::Kernel
+            : sizeof...(Ws) >= 2 && sizeof...(Ws) <= 16 &&
+                      AllOf<IsInterleaveCompatible<V, Ws>::value...>::value
+                  ? InterleaveStrategy::Chunked
+                  : InterleaveStrategy::Strided;
+};
+
 /**
  * \internal
  */
@@ -55,20 +104,161 @@ template<typename V, typename I, bool Readonly> struct InterleavedMemoryAccessBa
     {
     }
 
-    // implementations of the following are in {scalar,sse,avx}/detail.h
+    /**
+     * Loads the first sizeof...(Vs) members of the structs into \p vs. The vectors may be of
+     * different types, as long as their entries have the size of the struct members (e.g.
+     * float_v and int_v for a struct of float and int members).
+     */
     template <typename... Vs> Vc_INTRINSIC void deinterleave(Vs &&... vs) const
     {
-        Impl::deinterleave(m_data, m_indexes, std::forward<Vs>(vs)...);
+        deinterleaveImpl(
+            std::integral_constant<
+                InterleaveStrategy,
+                InterleaveStrategyFor<V, Traits::decay<Vs>...>::value>(),
+            vs...);
     }
 
 protected:
+    // implementations of the kernels are in {scalar,sse,avx}/detail.h
     using Impl = Vc::Detail::InterleaveImpl<V, V::Size, sizeof(V)>;
 
     template <typename T, std::size_t... Indexes>
     Vc_INTRINSIC void callInterleave(T &&a, index_sequence<Indexes...>)
     {
-        Impl::interleave(m_data, m_indexes, a[Indexes]...);
+        interleaveVectors(a[Indexes]...);
+    }
+
+    template <typename... Vs> Vc_INTRINSIC void interleaveVectors(const Vs &... vs)
+    {
+        interleaveImpl(std::integral_constant<
+                           InterleaveStrategy,
+                           InterleaveStrategyFor<V, Traits::decay<Vs>...>::value>(),
+                       vs...);
+    }
+
+private:
+    template <InterleaveStrategy S>
+    using StrategyTag = std::integral_constant<InterleaveStrategy, S>;
+
+    // Kernel{{{
+    template <typename... Vs>
+    Vc_INTRINSIC void deinterleaveImpl(StrategyTag<InterleaveStrategy::Kernel>,
+                                       Vs &... vs) const
+    {
+        Impl::deinterleave(m_data, m_indexes, vs...);
+    }
+    template <typename... Vs>
+    Vc_INTRINSIC void interleaveImpl(StrategyTag<InterleaveStrategy::Kernel>,
+                                     const Vs &... vs)
+    {
+        Impl::interleave(m_data, m_indexes, vs...);
     }
+
+    // Chunked{{{
+    // The first chunk takes up to 8 members, but leaves at least 2 for the second chunk,
+    // since the kernels need at least two vectors.
+    static constexpr std::size_t firstChunkSize(std::size_t n)
+    {
+        return n <= 8 ? n : n - 2 < 8 ? n - 2 : 8;
+    }
+    template <typename... Vs>
+    Vc_INTRINSIC void deinterleaveImpl(StrategyTag<InterleaveStrategy::Chunked>,
+                                       Vs &... vs) const
+    {
+        const std::tuple<Vs &...> refs(vs...);
+        constexpr std::size_t First = firstChunkSize(sizeof...(Vs));
+        deinterleaveChunk<0>(refs, make_index_sequence<First>());
+        deinterleaveChunk<First>(refs, make_index_sequence<sizeof...(Vs) - First>());
+    }
+    template <std::size_t Offset, typename Tuple>
+    Vc_INTRINSIC void deinterleaveChunk(const Tuple &, index_sequence<>) const
+    {
+    }
+    template <std::size_t Offset, typename Tuple, std::size_t... J>
+    Vc_INTRINSIC void deinterleaveChunk(const Tuple &refs, index_sequence<J...>) const
+    {
+        V tmp[sizeof...(J)];
+        Impl::deinterleave(m_data + Offset, m_indexes, tmp[J]...);
+        auto &&unused = {(std::get<Offset + J>(refs) = reinterpret_vector<
+                              Traits::decay<decltype(std::get<Offset + J>(refs))>>(tmp[J]),
+                          0)...};
+        if (&unused == &unused) {}
+    }
+    template <typename... Vs>
+    Vc_INTRINSIC void interleaveImpl(StrategyTag<InterleaveStrategy::Chunked>,
+                                     const Vs &... vs)
+    {
+        const std::tuple<const Vs &...> refs(vs...);
+        constexpr std::size_t First = firstChunkSize(sizeof...(Vs));
+        interleaveChunk<0>(refs, make_index_sequence<First>());
+        interleaveChunk<First>(refs, make_index_sequence<sizeof...(Vs) - First>());
+    }
+    template <std::size_t Offset, typename Tuple>
+    Vc_INTRINSIC void interleaveChunk(const Tuple &, index_sequence<>)
+    {
+    }
+    template <std::size_t Offset, typename Tuple, std::size_t... J>
+    Vc_INTRINSIC void interleaveChunk(const Tuple &refs, index_sequence<J...>)
+    {
+        Impl::interleave(m_data + Offset, m_indexes,
+                         reinterpret_vector<V>(std::get<Offset + J>(refs))...);
+    }
+
+    // Strided{{{
+    // SimdArray gathers/scatters require an index vector
+    template <typename J> static Vc_INTRINSIC const J &gatherIndexes(const J &indexes)
+    {
+        return indexes;
+    }
+    template <std::size_t StructSize>
+    static Vc_INTRINSIC typename V::IndexType gatherIndexes(
+        const SuccessiveEntries<StructSize> &indexes)
+    {
+        typedef typename V::IndexType IV;
+        typedef typename IV::EntryType IT;
+        return IV::IndexesFromZero() * IT(StructSize) + IT(indexes.data());
+    }
+    template <typename... Vs>
+    Vc_INTRINSIC void deinterleaveImpl(StrategyTag<InterleaveStrategy::Strided>,
+                                       Vs &... vs) const
+    {
+        const std::tuple<Vs &...> refs(vs...);
+        gatherMembers(refs, make_index_sequence<sizeof...(Vs)>());
+    }
+    template <typename Tuple, std::size_t... J>
+    Vc_INTRINSIC void gatherMembers(const Tuple &refs, index_sequence<J...>) const
+    {
+        auto &&unused = {(gatherMember<J>(std::get<J>(refs)), 0)...};
+        if (&unused == &unused) {}
+    }
+    template <std::size_t J, typename W> Vc_INTRINSIC void gatherMember(W &w) const
+    {
+        static_assert(sizeof(typename W::EntryType) == sizeof(T) && W::Size <= V::Size,
+                      "The_vector_types_do_not_match_the_interleaved_struct_members");
+        typedef const typename W::EntryType MT Vc_MAY_ALIAS;
+        w.gather(reinterpret_cast<MT *>(m_data) + J, gatherIndexes(m_indexes));
+    }
+    template <typename... Vs>
+    Vc_INTRINSIC void interleaveImpl(StrategyTag<InterleaveStrategy::Strided>,
+                                     const Vs &... vs)
+    {
+        const std::tuple<const Vs &...> refs(vs...);
+        scatterMembers(refs, make_index_sequence<sizeof...(Vs)>());
+    }
+    template <typename Tuple, std::size_t... J>
+    Vc_INTRINSIC void scatterMembers(const Tuple &refs, index_sequence<J...>)
+    {
+        auto &&unused = {(scatterMember<J>(std::get<J>(refs)), 0)...};
+        if (&unused == &unused) {}
+    }
+    template <std::size_t J, typename W> Vc_INTRINSIC void scatterMember(const W &w)
+    {
+        static_assert(sizeof(typename W::EntryType) == sizeof(T) && W::Size <= V::Size,
+                      "The_vector_types_do_not_match_the_interleaved_struct_members");
+        typedef typename W::EntryType MT Vc_MAY_ALIAS;
+        w.scatter(reinterpret_cast<MT *>(m_data) + J, gatherIndexes(m_indexes));
+    }
+    //}}}
 };
 
 /**
@@ -101,7 +291,7 @@ struct InterleavedMemoryReadAccess : public InterleavedMemoryAccessBase<V, I, Re
     Vc_ALWAYS_INLINE T deinterleave_unpack(index_sequence<Indexes...>) const
     {
         T r;
-        Base::Impl::deinterleave(this->m_data, this->m_indexes, std::get<Indexes>(r)...);
+        Base::deinterleave(std::get<Indexes>(r)...);
         return r;
     }
 
@@ -161,6 +351,18 @@ struct InterleavedMemoryAccess : public InterleavedMemoryReadAccess<StructSize,
                       "You_are_trying_to_scatter_more_data_into_the_struct_than_it_has");
         this->callInterleave(std::move(rhs), make_index_sequence<N>());
     }
+
+    /**
+     * Interleaves the vectors \p vs into the first sizeof...(Vs) members of the structs.
+     * This is the inverse of deinterleave; the vectors may be of different types in the
+     * same way.
+     */
+    template <typename... Vs> Vc_INTRINSIC void interleave(const Vs &... vs)
+    {
+        static_assert(sizeof...(Vs) <= StructSize,
+                      "You_are_trying_to_scatter_more_data_into_the_struct_than_it_has");
+        this->interleaveVectors(vs...);
+    }
 };
 
 /**
@@ -170,6 +372,19 @@ struct InterleavedMemoryAccess : public InterleavedMemoryReadAccess<StructSize,
  * \param V The type of the vector to be returned when read. This should reflect the type of the
  * members inside the struct.
  *
+ * All members of \p S must have the size of \p V::EntryType. Structs of up to 16 members are
+ * (de)interleaved with the shuffle kernels of \p V. Members of a different type but the same
+ * size (e.g. \c int members in a struct of \c float) can be read and written with the
+ * \c deinterleave and \c interleave functions of the object returned from operator[]:
+ * \code
+ * struct Record { float x; int id; float y; };
+ * Vc::InterleavedMemoryWrapper<Record, float_v> data(records);
+ * float_v x, y;
+ * int_v id;
+ * data[i].deinterleave(x, id, y);
+ * \endcode
+ * Vector types that do not match \p V in size are gathered/scattered member by member.
+ *
  * \see operator[]
  * \ingroup Utilities
  * \headerfile interleavedmemory.h <Vc/Memory>
@@ -55,7 +55,9 @@ template <typename U, typename Flags = DefaultLoadTag,
           typename = enable_if<
               (!std::is_integral<U>::value || !std::is_integral<EntryType>::value ||
                sizeof(EntryType) >= sizeof(U)) &&
-              std::is_arithmetic<U>::value &&Traits::is_load_store_flag<Flags>::value>>
+              (std::is_arithmetic<U>::value ||
+               (std::is_same<U, half>::value && std::is_same<EntryType, float>::value)) &&
+              Traits::is_load_store_flag<Flags>::value>>
 explicit Vc_INTRINSIC Vector(const U *x, Flags flags = Flags())
 {
     load<U, Flags>(x, flags);
@@ -94,7 +96,9 @@ template <typename U, typename Flags>
 struct load_concept : public std::enable_if<
               (!std::is_integral<U>::value || !std::is_integral<EntryType>::value ||
                sizeof(EntryType) >= sizeof(U)) &&
-              std::is_arithmetic<U>::value && Traits::is_load_store_flag<Flags>::value, void>
+              (std::is_arithmetic<U>::value ||
+               (std::is_same<U, half>::value && std::is_same<EntryType, float>::value)) &&
+              Traits::is_load_store_flag<Flags>::value, void>
 {};
 
 public:
@@ -270,4 +270,22 @@ Vc_INTRINSIC Vc_CONST Vector<T, Abi> log2(const Vector<T, Abi> &x)
     return Detail::LogImpl<Base2>::calc<T, Abi>(x);
 }
 
+/**
+ * Returns ln(1 + x), without the loss of precision of \c log(1 + x) for \p x close to 0.
+ *
+ * The result is within 2 ulp of the correctly rounded value.
+ */
+template <typename T, typename Abi>
+Vc_INTRINSIC Vc_CONST Vector<T, Abi> log1p(const Vector<T, Abi> &x)
+{
+    typedef Vector<T, Abi> V;
+    // u = 1 + x is rounded, but ln(u) / (u - 1) varies slowly enough that evaluating it at
+    // u instead of at 1 + x cancels the rounding error (Goldberg, "What every computer
+    // scientist should know about floating-point arithmetic", Theorem 4)
+    const V u = V::One() + x;
+    V r = log(u) * (x / (u - V::One()));
+    r(u == V::One() || x == std::numeric_limits<T>::infinity()) = x;
+    return r;
+}
+
 #endif // Vc_COMMON_MATH_H_INTERNAL
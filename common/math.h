@@ -41,6 +41,7 @@ namespace Vc_VERSIONED_NAMESPACE
 // for SSE, AVX, and AVX2
 #include "logarithm.h"
 #include "exponential.h"
+#include "pow.h"
 #ifdef Vc_IMPL_AVX
 inline AVX::double_v exp(AVX::double_v _x)
 {
@@ -123,6 +124,8 @@ inline SSE::double_v exp(SSE::double_v::AsArg _x) {
     }
 
 #endif
+
+#include "fastmath.h"
 }  // namespace Vc
 
 #undef Vc_COMMON_MATH_H_INTERNAL
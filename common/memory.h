@@ -29,6 +29,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define VC_COMMON_MEMORY_H_
 
 #include "memorybase.h"
+#include "memoryexpression.h"
 #include <assert.h>
 #include <algorithm>
 #include <cstring>
@@ -240,6 +241,17 @@ private:
                 }
                 return *this;
             }
+
+            /**
+             * Evaluates the expression \p e in a single pass and stores the result.
+             *
+             * \see MemoryExpression
+             */
+            template <typename F, typename... Args>
+            Vc_ALWAYS_INLINE Memory &operator=(const MemoryExpression<V, F, Args...> &e)
+            {
+                return Base::operator=(e);
+            }
 };
 
     /**
@@ -412,6 +424,17 @@ class Memory<V, Size, 0u, InitPadding> :
                 }
                 return *this;
             }
+
+            /**
+             * Evaluates the expression \p e in a single pass and stores the result.
+             *
+             * \see MemoryExpression
+             */
+            template <typename F, typename... Args>
+            Vc_ALWAYS_INLINE Memory &operator=(const MemoryExpression<V, F, Args...> &e)
+            {
+                return Base::operator=(e);
+            }
     };
 
     /**
@@ -442,6 +465,11 @@ class Memory<V, Size, 0u, InitPadding> :
      * accessed with correctly aligned memory addresses.
      * (Note: the scalar loop can be auto-vectorized, except for the last three assignments.)
      *
+     * The size can change with resize() and push_back(); like std::vector the capacity grows
+     * geometrically and can be controlled with reserve() and shrink_to_fit(). The padding
+     * entries after the last entry are always zero, so that vector loops over the whole array
+     * need no scalar epilogue.
+     *
      * \note The internal data pointer is not declared with the \c __restrict__ keyword. Therefore
      * modifying memory of V::EntryType will require the compiler to assume aliasing. If you want to use
      * the \c __restrict__ keyword you need to use a standard pointer to memory and do the vector
@@ -468,12 +496,44 @@ class Memory<V, Size, 0u, InitPadding> :
         };
         size_t m_entriesCount;
         size_t m_vectorsCount;
+        size_t m_vectorsCapacity;
         EntryType *m_mem;
         size_t calcPaddedEntriesCount(size_t x)
         {
             size_t masked = x & AlignmentMask;
             return (masked == 0 ? x : x + (Alignment - masked));
         }
+
+        /**\internal
+         * Moves the data to a new allocation with room for \p vectors vectors.
+         */
+        void reallocate(size_t vectors)
+        {
+            EntryType *mem = Vc::malloc<EntryType, Vc::AlignOnVector>(vectors * V::Size);
+            std::memcpy(mem, m_mem, m_vectorsCount * V::Size * sizeof(EntryType));
+            Vc::free(m_mem);
+            m_mem = mem;
+            m_vectorsCapacity = vectors;
+        }
+
+        /**\internal
+         * Changes the size to \p size entries, reallocating with geometric growth if the
+         * capacity does not suffice. The entries from the old vectorsCount() up to the new
+         * one are zeroed, such that the padding invariant holds for growing sizes.
+         */
+        void growTo(size_t size)
+        {
+            const size_t vectors = calcPaddedEntriesCount(size) / V::Size;
+            if (vectors > m_vectorsCapacity) {
+                reallocate(std::max(vectors, 2 * m_vectorsCapacity));
+            }
+            for (size_t i = m_vectorsCount; i < vectors; ++i) {
+                V::Zero().store(&m_mem[i * V::Size], Vc::Aligned);
+            }
+            m_entriesCount = size;
+            m_vectorsCount = vectors;
+        }
+
     public:
         using Base::vector;
 
@@ -481,16 +541,20 @@ class Memory<V, Size, 0u, InitPadding> :
          * Allocate enough memory to access \p size values of type \p V::EntryType.
          *
          * The allocated memory is aligned and padded correctly for fully vectorized access.
+         * The padding entries are zero.
          *
          * \param size Determines how many scalar values will fit into the allocated memory.
          */
-        Vc_ALWAYS_INLINE Memory(size_t size)
+        Vc_ALWAYS_INLINE Memory(size_t size = 0)
             : m_entriesCount(size),
             m_vectorsCount(calcPaddedEntriesCount(m_entriesCount)),
+            m_vectorsCapacity(m_vectorsCount / V::Size),
             m_mem(Vc::malloc<EntryType, Vc::AlignOnVector>(m_vectorsCount))
         {
             m_vectorsCount /= V::Size;
-            Base::lastVector() = V::Zero();
+            if (m_vectorsCount > 0) {
+                Base::lastVector() = V::Zero();
+            }
         }
 
         /**
@@ -504,6 +568,7 @@ class Memory<V, Size, 0u, InitPadding> :
         Vc_ALWAYS_INLINE Memory(const MemoryBase<V, Parent, 1, RM> &rhs)
             : m_entriesCount(rhs.entriesCount()),
             m_vectorsCount(rhs.vectorsCount()),
+            m_vectorsCapacity(m_vectorsCount),
             m_mem(Vc::malloc<EntryType, Vc::AlignOnVector>(m_vectorsCount * V::Size))
         {
             Detail::copyVectors(*this, rhs);
@@ -519,6 +584,7 @@ class Memory<V, Size, 0u, InitPadding> :
         Vc_ALWAYS_INLINE Memory(const Memory &rhs)
             : m_entriesCount(rhs.entriesCount()),
             m_vectorsCount(rhs.vectorsCount()),
+            m_vectorsCapacity(m_vectorsCount),
             m_mem(Vc::malloc<EntryType, Vc::AlignOnVector>(m_vectorsCount * V::Size))
         {
             Detail::copyVectors(*this, rhs);
@@ -541,6 +607,7 @@ class Memory<V, Size, 0u, InitPadding> :
             std::swap(m_mem, rhs.m_mem);
             std::swap(m_entriesCount, rhs.m_entriesCount);
             std::swap(m_vectorsCount, rhs.m_vectorsCount);
+            std::swap(m_vectorsCapacity, rhs.m_vectorsCapacity);
         }
 
         /**
@@ -553,6 +620,89 @@ class Memory<V, Size, 0u, InitPadding> :
          */
         Vc_ALWAYS_INLINE Vc_PURE size_t vectorsCount() const { return m_vectorsCount; }
 
+        /**
+         * \return the number of scalar entries the array can hold without reallocation.
+         */
+        Vc_ALWAYS_INLINE Vc_PURE size_t capacity() const { return m_vectorsCapacity * V::Size; }
+
+        /**
+         * Changes the number of entries to \p size.
+         *
+         * Entries up to the smaller of the old and new size keep their values; new entries are
+         * zero. The padding entries after the last entry (up to the next multiple of
+         * V::Size) are zero after the call, as for a newly allocated object. If \p size
+         * exceeds capacity() the memory is reallocated with (at least) twice the capacity,
+         * invalidating all pointers and references into the array.
+         *
+         * \param size The new number of scalar entries.
+         */
+        inline void resize(size_t size)
+        {
+            if (size > m_entriesCount) {
+                growTo(size);
+            } else {
+                m_entriesCount = size;
+                m_vectorsCount = calcPaddedEntriesCount(size) / V::Size;
+            }
+            // zero the padding of the (new) last vector; this also clears the stale entries
+            // of a shrunk array
+            for (size_t i = m_entriesCount; i < m_vectorsCount * V::Size; ++i) {
+                m_mem[i] = EntryType();
+            }
+        }
+
+        /**
+         * Increases the capacity() to at least \p size entries, without changing the contents.
+         *
+         * \param size The number of scalar entries that subsequent resize() and push_back()
+         * calls can reach without reallocation.
+         */
+        inline void reserve(size_t size)
+        {
+            const size_t vectors = calcPaddedEntriesCount(size) / V::Size;
+            if (vectors > m_vectorsCapacity) {
+                reallocate(vectors);
+            }
+        }
+
+        /**
+         * Reduces the capacity() to the padded entriesCount(), releasing unused memory.
+         */
+        inline void shrink_to_fit()
+        {
+            if (m_vectorsCapacity > m_vectorsCount) {
+                reallocate(m_vectorsCount);
+            }
+        }
+
+        /**
+         * Appends the V::Size entries of \p x.
+         *
+         * If entriesCount() is a multiple of V::Size the vector is stored with an aligned
+         * store to the new last vector. The capacity grows geometrically, so that a sequence of
+         * push_back calls takes amortized constant time per vector.
+         */
+        inline void push_back(const V &x)
+        {
+            const size_t offset = m_entriesCount;
+            growTo(offset + V::Size);
+            if (offset % V::Size == 0) {
+                x.store(&m_mem[offset], Vc::Aligned);
+            } else {
+                x.store(&m_mem[offset], Vc::Unaligned);
+            }
+        }
+
+        /**
+         * Appends the scalar \p x.
+         */
+        inline void push_back(EntryType x)
+        {
+            const size_t offset = m_entriesCount;
+            growTo(offset + 1);
+            m_mem[offset] = x;
+        }
+
         /**
          * Overwrite all entries with the values stored in \p rhs.
          *
@@ -560,17 +710,18 @@ class Memory<V, Size, 0u, InitPadding> :
          *
          * \return reference to the modified Memory object.
          *
-         * \note this function requires the vectorsCount() of both Memory objects to be equal.
+         * \note The object is resized to the entriesCount() of \p rhs first, like
+         * std::vector's copy assignment.
          */
         template<typename Parent, typename RM>
         Vc_ALWAYS_INLINE Memory &operator=(const MemoryBase<V, Parent, 1, RM> &rhs) {
-            assert(vectorsCount() == rhs.vectorsCount());
+            resize(rhs.entriesCount());
             Detail::copyVectors(*this, rhs);
             return *this;
         }
 
         Vc_ALWAYS_INLINE Memory &operator=(const Memory &rhs) {
-            assert(vectorsCount() == rhs.vectorsCount());
+            resize(rhs.entriesCount());
             Detail::copyVectors(*this, rhs);
             return *this;
         }
@@ -588,6 +739,17 @@ class Memory<V, Size, 0u, InitPadding> :
             std::memcpy(m_mem, rhs, entriesCount() * sizeof(EntryType));
             return *this;
         }
+
+        /**
+         * Evaluates the expression \p e in a single pass and stores the result.
+         *
+         * \see MemoryExpression
+         */
+        template <typename F, typename... Args>
+        Vc_ALWAYS_INLINE Memory &operator=(const MemoryExpression<V, F, Args...> &e)
+        {
+            return Base::operator=(e);
+        }
 };
 
 /**
@@ -31,12 +31,19 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assert.h>
 #include <type_traits>
 #include <iterator>
+#include "memoryfwd.h"
 #include "macros.h"
 
 namespace Vc_VERSIONED_NAMESPACE
 {
 namespace Common
 {
+namespace Detail
+{
+template <typename T> struct IsMemoryExpression : public std::false_type {};
+template <typename V, typename F, typename... Args>
+struct IsMemoryExpression<MemoryExpression<V, F, Args...>> : public std::true_type {};
+}  // namespace Detail
 
 #define Vc_MEM_OPERATOR_EQ(op) \
         template<typename T> \
@@ -215,6 +222,13 @@ template<typename V, typename Parent, typename RowMemory> class MemoryDimensionB
         /// Const overload of the above function.
         Vc_ALWAYS_INLINE Vc_PURE const EntryType *entries() const { return &p()->m_mem[0]; }
 
+        /**\internal
+         * Returns a pointer to the first entry of the \p i-th vector in the memory.
+         */
+        Vc_ALWAYS_INLINE Vc_PURE       EntryType *vectorEntries(size_t i)       { return entries() + i * V::Size; }
+        /// \internal Const overload of the above function.
+        Vc_ALWAYS_INLINE Vc_PURE const EntryType *vectorEntries(size_t i) const { return entries() + i * V::Size; }
+
         /**
          * Returns the \p i-th scalar value in the memory.
          */
@@ -313,6 +327,20 @@ template<typename V, typename Parent, typename RowMemory> class MemoryDimensionB
         /// Const overload of the above function.
         Vc_ALWAYS_INLINE Vc_PURE const EntryType *entries(size_t x = 0) const { return &p()->m_mem[x][0]; }
 
+        /**\internal
+         * Returns a pointer to the first entry of the \p i-th vector in the memory. The row is
+         * selected explicitly since a pointer into one row must not be used to access the next.
+         */
+        Vc_ALWAYS_INLINE Vc_PURE EntryType *vectorEntries(size_t i)
+        {
+            return entries(i / Parent::VectorsCount) + (i % Parent::VectorsCount) * V::Size;
+        }
+        /// \internal Const overload of the above function.
+        Vc_ALWAYS_INLINE Vc_PURE const EntryType *vectorEntries(size_t i) const
+        {
+            return entries(i / Parent::VectorsCount) + (i % Parent::VectorsCount) * V::Size;
+        }
+
         /**
          * Returns the \p i,j-th scalar value in the memory.
          */
@@ -386,6 +414,7 @@ template<typename V, typename Parent, int Dimension, typename RowMemory> class M
 
         using MemoryDimensionBase<V, Parent, Dimension, RowMemory>::entries;
         using MemoryDimensionBase<V, Parent, Dimension, RowMemory>::scalar;
+        using MemoryDimensionBase<V, Parent, Dimension, RowMemory>::vectorEntries;
 
         /**
          * Return a (vectorized) iterator to the start of this memory object.
@@ -574,11 +603,25 @@ template<typename V, typename Parent, int Dimension, typename RowMemory> class M
         /**
          * Assign a value to all vectors in the array.
          */
-        template<typename U>
+        template <typename U, typename = enable_if<!Detail::IsMemoryExpression<
+                                  typename std::decay<U>::type>::value>>
         Vc_ALWAYS_INLINE Parent &operator=(U &&x) {
             for (size_t i = 0; i < vectorsCount(); ++i) {
                 vector(i) = std::forward<U>(x);
             }
+            return static_cast<Parent &>(*this);
+        }
+
+        /**
+         * Evaluates the expression \p e and stores the result, in a single pass over all
+         * arrays involved.
+         *
+         * \see MemoryExpression
+         */
+        template <typename F, typename... Args>
+        inline Parent &operator=(const MemoryExpression<V, F, Args...> &e)
+        {
+            return assignExpression(e);
         }
 
         /**
@@ -673,6 +716,75 @@ template<typename V, typename Parent, int Dimension, typename RowMemory> class M
             return static_cast<Parent &>(*this);
         }
 
+        /**
+         * Adds the result of the expression \p e in a single pass (see MemoryExpression).
+         */
+        template <typename F, typename... Args>
+        inline Parent &operator+=(const MemoryExpression<V, F, Args...> &e)
+        {
+            return assignExpression(*this + e);
+        }
+
+        /**
+         * Subtracts the result of the expression \p e in a single pass (see MemoryExpression).
+         */
+        template <typename F, typename... Args>
+        inline Parent &operator-=(const MemoryExpression<V, F, Args...> &e)
+        {
+            return assignExpression(*this - e);
+        }
+
+        /**
+         * Multiplies with the result of the expression \p e in a single pass (see MemoryExpression).
+         */
+        template <typename F, typename... Args>
+        inline Parent &operator*=(const MemoryExpression<V, F, Args...> &e)
+        {
+            return assignExpression(*this * e);
+        }
+
+        /**
+         * Divides by the result of the expression \p e in a single pass (see MemoryExpression).
+         */
+        template <typename F, typename... Args>
+        inline Parent &operator/=(const MemoryExpression<V, F, Args...> &e)
+        {
+            return assignExpression(*this / e);
+        }
+
+    protected:
+        /**\internal
+         * Stores `e.vector(i)` to the \c i-th vector for all \c i, unrolled four times with all loads
+         * before the stores (cf. Detail::copyVectors). Therefore, the destination may also
+         * be an operand of \p e.
+         */
+        template <typename E> Vc_ALWAYS_INLINE Parent &assignExpression(const E &e)
+        {
+            const size_t count = vectorsCount();
+            assert(e.vectorsCount() == 0 || e.vectorsCount() == count);
+            const size_t unrolledCount = count & ~size_t(3);
+            size_t i = 0;
+            for (; i < unrolledCount; i += 4) {
+                const V tmp0 = e.vector(i + 0);
+                const V tmp1 = e.vector(i + 1);
+                const V tmp2 = e.vector(i + 2);
+                const V tmp3 = e.vector(i + 3);
+                // store directly instead of through vector(i): constructing a
+                // MemoryVector over the entries lets the compiler discard earlier stores
+                tmp0.store(vectorEntries(i + 0), Vc::Aligned);
+                tmp1.store(vectorEntries(i + 1), Vc::Aligned);
+                tmp2.store(vectorEntries(i + 2), Vc::Aligned);
+                tmp3.store(vectorEntries(i + 3), Vc::Aligned);
+            }
+            for (; i < count; ++i) {
+                const V tmp = e.vector(i);
+                tmp.store(vectorEntries(i), Vc::Aligned);
+            }
+            return static_cast<Parent &>(*this);
+        }
+
+    public:
+
         /**
          * (Inefficient) shorthand compare equality of two arrays.
          */
@@ -770,19 +882,20 @@ inline void copyVectors(MemoryBase<V, ParentL, Dimension, RowMemoryL> &dst,
                         const MemoryBase<V, ParentR, Dimension, RowMemoryR> &src)
 {
     const size_t vectorsCount = dst.vectorsCount();
-    size_t i = 3;
-    for (; i < vectorsCount; i += 4) {
-        const V tmp3 = src.vector(i - 3);
-        const V tmp2 = src.vector(i - 2);
-        const V tmp1 = src.vector(i - 1);
-        const V tmp0 = src.vector(i - 0);
-        dst.vector(i - 3) = tmp3;
-        dst.vector(i - 2) = tmp2;
-        dst.vector(i - 1) = tmp1;
-        dst.vector(i - 0) = tmp0;
+    const size_t unrolledCount = vectorsCount & ~size_t(3);
+    size_t i = 0;
+    for (; i < unrolledCount; i += 4) {
+        const V tmp0(src.vectorEntries(i + 0), Vc::Aligned);
+        const V tmp1(src.vectorEntries(i + 1), Vc::Aligned);
+        const V tmp2(src.vectorEntries(i + 2), Vc::Aligned);
+        const V tmp3(src.vectorEntries(i + 3), Vc::Aligned);
+        tmp0.store(dst.vectorEntries(i + 0), Vc::Aligned);
+        tmp1.store(dst.vectorEntries(i + 1), Vc::Aligned);
+        tmp2.store(dst.vectorEntries(i + 2), Vc::Aligned);
+        tmp3.store(dst.vectorEntries(i + 3), Vc::Aligned);
     }
-    for (i -= 3; i < vectorsCount; ++i) {
-        dst.vector(i) = src.vector(i);
+    for (; i < vectorsCount; ++i) {
+        V(src.vectorEntries(i), Vc::Aligned).store(dst.vectorEntries(i), Vc::Aligned);
     }
 }
 } // namespace Detail
@@ -0,0 +1,473 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_MEMORYEXPRESSION_H_
+#define VC_COMMON_MEMORYEXPRESSION_H_
+
+#include <tuple>
+#include <type_traits>
+#include "indexsequence.h"
+#include "memorybase.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+namespace Detail
+{
+// operand traits{{{1
+template <typename V, typename P, int D, typename RM>
+V memoryVectorType(const MemoryBase<V, P, D, RM> *);
+void memoryVectorType(...);
+
+template <typename T>
+struct IsMemory : public std::integral_constant<
+                      bool, !std::is_void<decltype(memoryVectorType(
+                                std::declval<const T *>()))>::value> {
+};
+
+// the vector type of the Memory or MemoryExpression T
+template <typename T, bool = IsMemory<T>::value> struct MemoryOperandVector {
+    typedef decltype(memoryVectorType(std::declval<const T *>())) type;
+};
+template <typename V, typename F, typename... Args>
+struct MemoryOperandVector<MemoryExpression<V, F, Args...>, false> {
+    typedef V type;
+};
+
+// operands{{{1
+/**\internal
+ * Every operand of a MemoryExpression has the member functions `vector(i)`, returning the
+ * value of the \c i-th vector, and `vectorsCount()`, returning the number of vectors it
+ * spans (0 for broadcast scalars).
+ */
+template <typename V, typename M> class MemoryOperand
+{
+public:
+    typedef V result_type;
+    explicit MemoryOperand(const M &m) : mem(&m) {}
+    Vc_INTRINSIC V vector(std::size_t i) const
+    {
+        return V(mem->vectorEntries(i), Vc::Aligned);
+    }
+    std::size_t vectorsCount() const { return mem->vectorsCount(); }
+
+private:
+    const M *mem;
+};
+
+template <typename V> class BroadcastOperand
+{
+public:
+    typedef V result_type;
+    explicit BroadcastOperand(typename V::EntryType x) : value(x) {}
+    Vc_INTRINSIC V vector(std::size_t) const { return value; }
+    std::size_t vectorsCount() const { return 0; }
+
+private:
+    V value;
+};
+
+template <typename V, typename T, bool = IsMemory<T>::value,
+          bool = IsMemoryExpression<T>::value>
+struct OperandFor {
+    typedef BroadcastOperand<V> type;
+};
+template <typename V, typename T> struct OperandFor<V, T, true, false> {
+    typedef MemoryOperand<V, T> type;
+};
+template <typename V, typename T> struct OperandFor<V, T, false, true> {
+    typedef T type;
+};
+
+template <typename V, typename T>
+Vc_INTRINSIC typename OperandFor<V, T>::type makeOperand(const T &x)
+{
+    return typename OperandFor<V, T>::type(x);
+}
+
+// expression types{{{1
+template <typename T>
+struct IsNode
+    : public std::integral_constant<bool, IsMemory<T>::value || IsMemoryExpression<T>::value> {
+};
+
+/**\internal
+ * The type of the expression `F(l, r)`. It is only defined if one operand is a Memory or
+ * MemoryExpression and the other one is of the same vector type or an arithmetic scalar.
+ * Unless \p AllowMemories is \c true, at least one operand must not be a Memory (the
+ * comparison operators of two Memory objects return \c bool).
+ */
+template <typename F, typename L, typename R, bool AllowMemories = true,
+          bool = IsNode<L>::value, bool = IsNode<R>::value>
+struct BinaryExpressionType {
+};
+template <typename F, typename L, typename R, bool AllowMemories>
+struct BinaryExpressionType<F, L, R, AllowMemories, true, true>
+    : public std::enable_if<
+          std::is_same<typename MemoryOperandVector<L>::type,
+                       typename MemoryOperandVector<R>::type>::value &&
+              (AllowMemories || IsMemoryExpression<L>::value ||
+               IsMemoryExpression<R>::value),
+          MemoryExpression<typename MemoryOperandVector<L>::type, F,
+                           typename OperandFor<typename MemoryOperandVector<L>::type, L>::type,
+                           typename OperandFor<typename MemoryOperandVector<L>::type, R>::type>> {
+};
+template <typename F, typename L, typename R, bool AllowMemories>
+struct BinaryExpressionType<F, L, R, AllowMemories, true, false>
+    : public std::enable_if<
+          std::is_arithmetic<R>::value,
+          MemoryExpression<typename MemoryOperandVector<L>::type, F,
+                           typename OperandFor<typename MemoryOperandVector<L>::type, L>::type,
+                           BroadcastOperand<typename MemoryOperandVector<L>::type>>> {
+};
+template <typename F, typename L, typename R, bool AllowMemories>
+struct BinaryExpressionType<F, L, R, AllowMemories, false, true>
+    : public std::enable_if<
+          std::is_arithmetic<L>::value,
+          MemoryExpression<typename MemoryOperandVector<R>::type, F,
+                           BroadcastOperand<typename MemoryOperandVector<R>::type>,
+                           typename OperandFor<typename MemoryOperandVector<R>::type, R>::type>> {
+};
+
+template <typename F, typename T, bool = IsNode<T>::value> struct UnaryExpressionType {
+};
+template <typename F, typename T> struct UnaryExpressionType<F, T, true> {
+    typedef MemoryExpression<typename MemoryOperandVector<T>::type, F,
+                             typename OperandFor<typename MemoryOperandVector<T>::type, T>::type>
+        type;
+};
+
+// functors{{{1
+#define Vc_MEMORY_EXPRESSION_FUNCTOR1(name_, expr_)                                      \
+    struct name_ {                                                                       \
+        template <typename A>                                                            \
+        Vc_INTRINSIC auto operator()(const A &a) const -> decltype(expr_)                \
+        {                                                                                \
+            return expr_;                                                                \
+        }                                                                                \
+    }
+#define Vc_MEMORY_EXPRESSION_FUNCTOR2(name_, expr_)                                      \
+    struct name_ {                                                                       \
+        template <typename A, typename B>                                                \
+        Vc_INTRINSIC auto operator()(const A &a, const B &b) const -> decltype(expr_)    \
+        {                                                                                \
+            return expr_;                                                                \
+        }                                                                                \
+    }
+Vc_MEMORY_EXPRESSION_FUNCTOR2(ExprPlus, a + b);
+Vc_MEMORY_EXPRESSION_FUNCTOR2(ExprMinus, a - b);
+Vc_MEMORY_EXPRESSION_FUNCTOR2(ExprMultiplies, a * b);
+Vc_MEMORY_EXPRESSION_FUNCTOR2(ExprDivides, a / b);
+Vc_MEMORY_EXPRESSION_FUNCTOR2(ExprLess, a < b);
+Vc_MEMORY_EXPRESSION_FUNCTOR2(ExprGreater, a > b);
+Vc_MEMORY_EXPRESSION_FUNCTOR2(ExprLessEqual, a <= b);
+Vc_MEMORY_EXPRESSION_FUNCTOR2(ExprGreaterEqual, a >= b);
+Vc_MEMORY_EXPRESSION_FUNCTOR2(ExprEqual, a == b);
+Vc_MEMORY_EXPRESSION_FUNCTOR2(ExprNotEqual, a != b);
+Vc_MEMORY_EXPRESSION_FUNCTOR2(ExprLogicalAnd, a && b);
+Vc_MEMORY_EXPRESSION_FUNCTOR2(ExprLogicalOr, a || b);
+Vc_MEMORY_EXPRESSION_FUNCTOR2(ExprMin, Vc::min(a, b));
+Vc_MEMORY_EXPRESSION_FUNCTOR2(ExprMax, Vc::max(a, b));
+Vc_MEMORY_EXPRESSION_FUNCTOR1(ExprNegate, -a);
+Vc_MEMORY_EXPRESSION_FUNCTOR1(ExprLogicalNot, !a);
+Vc_MEMORY_EXPRESSION_FUNCTOR1(ExprSqrt, Vc::sqrt(a));
+Vc_MEMORY_EXPRESSION_FUNCTOR1(ExprRSqrt, Vc::rsqrt(a));
+Vc_MEMORY_EXPRESSION_FUNCTOR1(ExprAbs, Vc::abs(a));
+Vc_MEMORY_EXPRESSION_FUNCTOR1(ExprExp, Vc::exp(a));
+Vc_MEMORY_EXPRESSION_FUNCTOR1(ExprLog, Vc::log(a));
+Vc_MEMORY_EXPRESSION_FUNCTOR1(ExprSin, Vc::sin(a));
+Vc_MEMORY_EXPRESSION_FUNCTOR1(ExprCos, Vc::cos(a));
+Vc_MEMORY_EXPRESSION_FUNCTOR1(ExprFloor, Vc::floor(a));
+Vc_MEMORY_EXPRESSION_FUNCTOR1(ExprCeil, Vc::ceil(a));
+#undef Vc_MEMORY_EXPRESSION_FUNCTOR1
+#undef Vc_MEMORY_EXPRESSION_FUNCTOR2
+
+struct ExprSelect {
+    template <typename M, typename A, typename B>
+    Vc_INTRINSIC A operator()(const M &mask, const A &a, const B &b) const
+    {
+        return Vc::iif(mask, a, b);
+    }
+};
+//}}}1
+}  // namespace Detail
+
+// MemoryExpression{{{1
+/**
+ * \headerfile memoryexpression.h <Vc/Memory>
+ *
+ * A lazily evaluated expression over Vc::Memory objects.
+ *
+ * The arithmetic and comparison operators, with at least one Memory or MemoryExpression
+ * operand, do not compute anything but return a MemoryExpression that refers to its
+ * operands. Scalars (of arithmetic type) are broadcast. The same holds for the math
+ * functions Vc::sqrt, Vc::rsqrt, Vc::abs, Vc::exp, Vc::log, Vc::sin, Vc::cos,
+ * Vc::floor, Vc::ceil, Vc::min, Vc::max, and for Vc::iif (select) with a mask expression.
+ * Assigning the expression to a Memory object (or using it on the right-hand side of a
+ * compound assignment) evaluates it in a single pass over the arrays, vector by vector:
+ * \code
+ * Vc::Memory<float_v> a(n), b(n), c(n), d(n);
+ * a = b * c + d;                           // one loop, no temporary arrays
+ * a += Vc::sqrt(b * b + c * c);
+ * a = Vc::iif(b > 0.f, Vc::exp(-b), c);
+ * Vc::where(b > c, a) = 0.f;               // masked assignment
+ * \endcode
+ * Therefore, each array is read (and written) once, no matter how many operations the
+ * expression combines, which matters for arrays that do not fit into the caches.
+ *
+ * All arrays in an expression must span the same number of vectors. The destination
+ * may also appear on the right-hand side (every vector is computed before it is
+ * stored). Note that the comparison of two Memory objects (e.g. `a < b`) keeps its
+ * meaning of a \c bool for the whole arrays; in an expression, at least one side of a
+ * comparison must be an expression or a scalar.
+ *
+ * \tparam V    The vector type of the arrays.
+ * \tparam F    The operation applied to the operands.
+ * \tparam Args The operand types.
+ */
+template <typename V, typename F, typename... Args> class MemoryExpression
+{
+public:
+    /// The type of the vectors (or masks) the expression evaluates to.
+    typedef decltype(std::declval<const F &>()(
+        std::declval<typename Args::result_type>()...)) result_type;
+
+    MemoryExpression(F f, const Args &... args) : m_f(f), m_args(args...) {}
+
+    /// Evaluates the \p i-th vector of the expression.
+    Vc_INTRINSIC result_type vector(std::size_t i) const
+    {
+        return apply(i, make_index_sequence<sizeof...(Args)>());
+    }
+
+    /// Returns the number of vectors the operand arrays span.
+    std::size_t vectorsCount() const { return count(make_index_sequence<sizeof...(Args)>()); }
+
+private:
+    template <std::size_t... I>
+    Vc_INTRINSIC result_type apply(std::size_t i, index_sequence<I...>) const
+    {
+        return m_f(std::get<I>(m_args).vector(i)...);
+    }
+    template <std::size_t... I> std::size_t count(index_sequence<I...>) const
+    {
+        std::size_t n = 0;
+        for (std::size_t c : {std::get<I>(m_args).vectorsCount()...}) {
+            n = c > n ? c : n;
+        }
+        return n;
+    }
+
+    F m_f;
+    std::tuple<Args...> m_args;
+};
+
+// operators{{{1
+#define Vc_MEMORY_EXPRESSION_OPERATOR(op_, functor_, allowMemories_)                     \
+    template <typename L, typename R>                                                    \
+    Vc_INTRINSIC typename Detail::BinaryExpressionType<Detail::functor_, L, R,           \
+                                                       allowMemories_>::type             \
+    operator op_(const L &l, const R &r)                                                 \
+    {                                                                                    \
+        typedef typename Detail::BinaryExpressionType<Detail::functor_, L, R,            \
+                                                      allowMemories_>::type E;           \
+        return E(Detail::functor_(),                                                     \
+                 Detail::makeOperand<typename Detail::MemoryOperandVector<               \
+                     typename std::conditional<Detail::IsNode<L>::value, L, R>::type>::type>(l), \
+                 Detail::makeOperand<typename Detail::MemoryOperandVector<               \
+                     typename std::conditional<Detail::IsNode<L>::value, L, R>::type>::type>(r)); \
+    }
+Vc_MEMORY_EXPRESSION_OPERATOR(+, ExprPlus, true)
+Vc_MEMORY_EXPRESSION_OPERATOR(-, ExprMinus, true)
+Vc_MEMORY_EXPRESSION_OPERATOR(*, ExprMultiplies, true)
+Vc_MEMORY_EXPRESSION_OPERATOR(/, ExprDivides, true)
+Vc_MEMORY_EXPRESSION_OPERATOR(<, ExprLess, false)
+Vc_MEMORY_EXPRESSION_OPERATOR(>, ExprGreater, false)
+Vc_MEMORY_EXPRESSION_OPERATOR(<=, ExprLessEqual, false)
+Vc_MEMORY_EXPRESSION_OPERATOR(>=, ExprGreaterEqual, false)
+Vc_MEMORY_EXPRESSION_OPERATOR(==, ExprEqual, false)
+Vc_MEMORY_EXPRESSION_OPERATOR(!=, ExprNotEqual, false)
+Vc_MEMORY_EXPRESSION_OPERATOR(&&, ExprLogicalAnd, false)
+Vc_MEMORY_EXPRESSION_OPERATOR(||, ExprLogicalOr, false)
+#undef Vc_MEMORY_EXPRESSION_OPERATOR
+
+template <typename T>
+Vc_INTRINSIC typename Detail::UnaryExpressionType<Detail::ExprNegate, T>::type operator-(
+    const T &x)
+{
+    return {Detail::ExprNegate(),
+            Detail::makeOperand<typename Detail::MemoryOperandVector<T>::type>(x)};
+}
+template <typename V, typename F, typename... Args>
+Vc_INTRINSIC typename Detail::UnaryExpressionType<Detail::ExprLogicalNot,
+                                                  MemoryExpression<V, F, Args...>>::type
+operator!(const MemoryExpression<V, F, Args...> &x)
+{
+    return {Detail::ExprLogicalNot(), x};
+}
+
+// MaskedMemoryAssignment{{{1
+/**
+ * \headerfile memoryexpression.h <Vc/Memory>
+ *
+ * The return type of Vc::where with a mask expression and a Memory object. Its assignment
+ * operators evaluate the right-hand side and write only the entries where the mask is
+ * \c true, in one pass.
+ */
+template <typename M, typename Cond> class MaskedMemoryAssignment
+{
+    typedef typename Detail::MemoryOperandVector<M>::type V;
+
+    template <typename E, typename F> void assign(const E &rhs, F &&f)
+    {
+        const auto operand = Detail::makeOperand<V>(rhs);
+        const std::size_t n = m_dst.vectorsCount();
+        assert(m_cond.vectorsCount() == n);
+        assert(operand.vectorsCount() == 0 || operand.vectorsCount() == n);
+        for (std::size_t i = 0; i < n; ++i) {
+            V x(m_dst.vectorEntries(i), Vc::Aligned);
+            x(m_cond.vector(i)) = f(x, V(operand.vector(i)));
+            x.store(m_dst.vectorEntries(i), Vc::Aligned);
+        }
+    }
+
+public:
+    MaskedMemoryAssignment(const Cond &cond, M &dst) : m_cond(cond), m_dst(dst) {}
+
+    template <typename E> void operator=(const E &rhs)
+    {
+        assign(rhs, [](const V &, const V &b) { return b; });
+    }
+    template <typename E> void operator+=(const E &rhs)
+    {
+        assign(rhs, [](const V &a, const V &b) { return a + b; });
+    }
+    template <typename E> void operator-=(const E &rhs)
+    {
+        assign(rhs, [](const V &a, const V &b) { return a - b; });
+    }
+    template <typename E> void operator*=(const E &rhs)
+    {
+        assign(rhs, [](const V &a, const V &b) { return a * b; });
+    }
+    template <typename E> void operator/=(const E &rhs)
+    {
+        assign(rhs, [](const V &a, const V &b) { return a / b; });
+    }
+
+private:
+    Cond m_cond;
+    M &m_dst;
+};
+//}}}1
+}  // namespace Common
+
+using Common::MemoryExpression;
+
+// math functions{{{1
+#define Vc_MEMORY_EXPRESSION_FUNCTION1(name_, functor_)                                  \
+    template <typename T>                                                                \
+    Vc_INTRINSIC                                                                         \
+        typename Common::Detail::UnaryExpressionType<Common::Detail::functor_, T>::type  \
+        name_(const T &x)                                                                \
+    {                                                                                    \
+        return {Common::Detail::functor_(),                                              \
+                Common::Detail::makeOperand<                                             \
+                    typename Common::Detail::MemoryOperandVector<T>::type>(x)};          \
+    }
+Vc_MEMORY_EXPRESSION_FUNCTION1(sqrt, ExprSqrt)
+Vc_MEMORY_EXPRESSION_FUNCTION1(rsqrt, ExprRSqrt)
+Vc_MEMORY_EXPRESSION_FUNCTION1(abs, ExprAbs)
+Vc_MEMORY_EXPRESSION_FUNCTION1(exp, ExprExp)
+Vc_MEMORY_EXPRESSION_FUNCTION1(log, ExprLog)
+Vc_MEMORY_EXPRESSION_FUNCTION1(sin, ExprSin)
+Vc_MEMORY_EXPRESSION_FUNCTION1(cos, ExprCos)
+Vc_MEMORY_EXPRESSION_FUNCTION1(floor, ExprFloor)
+Vc_MEMORY_EXPRESSION_FUNCTION1(ceil, ExprCeil)
+#undef Vc_MEMORY_EXPRESSION_FUNCTION1
+
+/// Returns the lazily evaluated entry-wise minimum of the Memory/expression operands.
+template <typename L, typename R>
+Vc_INTRINSIC typename Common::Detail::BinaryExpressionType<Common::Detail::ExprMin, L, R>::type
+min(const L &l, const R &r)
+{
+    typedef typename Common::Detail::BinaryExpressionType<Common::Detail::ExprMin, L, R>::type E;
+    typedef typename Common::Detail::MemoryOperandVector<
+        typename std::conditional<Common::Detail::IsNode<L>::value, L, R>::type>::type V;
+    return E(Common::Detail::ExprMin(), Common::Detail::makeOperand<V>(l),
+             Common::Detail::makeOperand<V>(r));
+}
+/// Returns the lazily evaluated entry-wise maximum of the Memory/expression operands.
+template <typename L, typename R>
+Vc_INTRINSIC typename Common::Detail::BinaryExpressionType<Common::Detail::ExprMax, L, R>::type
+max(const L &l, const R &r)
+{
+    typedef typename Common::Detail::BinaryExpressionType<Common::Detail::ExprMax, L, R>::type E;
+    typedef typename Common::Detail::MemoryOperandVector<
+        typename std::conditional<Common::Detail::IsNode<L>::value, L, R>::type>::type V;
+    return E(Common::Detail::ExprMax(), Common::Detail::makeOperand<V>(l),
+             Common::Detail::makeOperand<V>(r));
+}
+
+/**
+ * Returns the lazily evaluated selection `condition ? a : b` for a mask expression (e.g.
+ * `x > 0.f`) and Memory, MemoryExpression, or scalar operands \p a and \p b.
+ */
+template <typename V, typename F, typename... Args, typename A, typename B>
+Vc_INTRINSIC MemoryExpression<V, Common::Detail::ExprSelect,
+                              MemoryExpression<V, F, Args...>,
+                              typename Common::Detail::OperandFor<V, A>::type,
+                              typename Common::Detail::OperandFor<V, B>::type>
+iif(const MemoryExpression<V, F, Args...> &condition, const A &a, const B &b)
+{
+    return {Common::Detail::ExprSelect(), condition, Common::Detail::makeOperand<V>(a),
+            Common::Detail::makeOperand<V>(b)};
+}
+
+/**
+ * Returns an object whose assignment operators write only the entries of \p dst where the
+ * mask expression \p condition is \c true:
+ * \code
+ * Vc::where(x < 0.f, x) = -x;
+ * Vc::where(x > limit, y) += 1.f;
+ * \endcode
+ */
+template <typename V, typename F, typename... Args, typename P, int D, typename RM>
+Vc_INTRINSIC Common::MaskedMemoryAssignment<Common::MemoryBase<V, P, D, RM>,
+                                            MemoryExpression<V, F, Args...>>
+where(const MemoryExpression<V, F, Args...> &condition, Common::MemoryBase<V, P, D, RM> &dst)
+{
+    return {condition, dst};
+}
+//}}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_MEMORYEXPRESSION_H_
+
+// vim: foldmethod=marker
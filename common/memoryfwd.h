@@ -38,6 +38,8 @@ class Memory;
 
 template <typename V, typename Parent, int Dimension, typename RowMemory>
 class MemoryBase;
+
+template <typename V, typename F, typename... Args> class MemoryExpression;
 }  // namespace Common
 
 using Common::Memory;
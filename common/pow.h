@@ -0,0 +1,223 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifdef Vc_COMMON_MATH_H_INTERNAL
+
+namespace Detail
+{
+// twoProd{{{1
+// p + e = a · b exactly
+template <typename V> Vc_INTRINSIC void twoProd(V a, V b, V &p, V &e)
+{
+    p = a * b;
+    e = fma(a, b, -p);
+}
+
+// twoSum{{{1
+// s + e = a + b exactly, for any a and b
+template <typename V> Vc_INTRINSIC void twoSum(V a, V b, V &s, V &e)
+{
+    s = a + b;
+    const V bb = s - a;
+    e = (a - (s - bb)) + (b - bb);
+}
+
+// fastTwoSum{{{1
+// s + e = a + b exactly, requires |a| ≥ |b|
+template <typename V> Vc_INTRINSIC void fastTwoSum(V a, V b, V &s, V &e)
+{
+    s = a + b;
+    e = b - (s - a);
+}
+
+// powSpecialCases{{{1
+// applies the C99 special cases of pow(x, y) to r = |x|^y
+template <typename V> Vc_INTRINSIC V powSpecialCases(V x, V y, V r)
+{
+    using T = typename V::EntryType;
+    const V inf = std::numeric_limits<T>::infinity();
+    const V ax = abs(x);
+    const auto yIsInt = y == trunc(y);
+    const auto yIsOdd = yIsInt && y * T(0.5) != trunc(y * T(0.5));
+
+    r(x == V::Zero()) = iif(y < V::Zero(), inf, V::Zero());
+    r(isinf(x)) = iif(y < V::Zero(), V::Zero(), inf);
+    r(isinf(y)) = iif((ax > V::One()) == (y > V::Zero()), inf, V::Zero());
+    r(isinf(y) && ax == V::One()) = V::One();
+    r.setQnan(x < V::Zero() && isfinite(x) && !yIsInt);
+    r(isnegative(x) && yIsOdd) = -r;
+    r(isnan(x) || isnan(y)) = x + y;
+    r(y == V::Zero() || x == V::One()) = V::One();
+    return r;
+}
+
+// powPositive{{{1
+// x^y for finite x > 0 and finite y
+template <typename Abi>
+Vc_INTRINSIC Vector<float, Abi> powPositive(Vector<float, Abi> x, Vector<float, Abi> y)
+{
+    // in double precision y · ln(x) has enough bits for a correctly rounded float result
+    using D = SimdArray<double, Vector<float, Abi>::Size>;
+    return simd_cast<Vector<float, Abi>>(exp(simd_cast<D>(y) * log(simd_cast<D>(x))));
+}
+
+template <typename Abi>
+inline Vector<double, Abi> powPositive(Vector<double, Abi> x, Vector<double, Abi> y)
+{
+    using V = Vector<double, Abi>;
+    using I = SimdArray<int, V::Size>;
+    using C = ExpConstants<double>;
+
+    // x = 2ᵏ · z with z ∈ [1, 2[
+    const auto denormal = x < std::numeric_limits<double>::min();
+    x(denormal) *= 18014398509481984.;  // 2⁵⁴
+    I e;
+    const V z = frexp(x, &e) * 2.;
+    V k = simd_cast<V>(e) - 1.;
+    k(denormal) -= 54.;
+
+    // z = c · (1 + r) with c = 1 + i/16, thus |r| ≤ 1/32 and ln(c) is tabulated
+    const V fi = floor((z - 1.) * 16. + .5);
+    const I i = static_cast<I>(fi);
+    const V c = fi * (1. / 16.) + 1.;
+    const V d = z - c;  // exact
+    const V r = d / c;
+    const V rLo = fma(-r, c, d) / c;
+
+    // ln(1 + r) = r - r²/2 + r³ · P(r), with the first two terms in double-double precision
+    V rr, rrLo;
+    twoProd(r, r, rr, rrLo);
+    const V h = rr * .5;
+    const V hLo = rrLo * .5 + r * rLo;
+    const V p = (((((((( -1. / 12. * r
+                       + 1. / 11.) * r
+                       - 1. / 10.) * r
+                       + 1. /  9.) * r
+                       - 1. /  8.) * r
+                       + 1. /  7.) * r
+                       - 1. /  6.) * r
+                       + 1. /  5.) * r
+                       - 1. /  4.) * r
+                       + 1. /  3.;
+    V s, sLo;
+    fastTwoSum(r, -h, s, sLo);
+    sLo += (rLo - hLo) + rr * r * p;
+
+    // ln(x) = k · ln(2) + ln(c) + ln(1 + r)
+    V u, uLo, w, wLo;
+    twoSum(k * C::ln2_hi(), V(&Common::PowLogTableHi[0], i), u, uLo);
+    twoSum(u, s, w, wLo);
+    V l, lLo;
+    fastTwoSum(w, uLo + wLo + sLo + k * C::ln2_lo() + V(&Common::PowLogTableLo[0], i), l,
+               lLo);
+
+    // y · ln(x)
+    V t, tLo;
+    twoProd(y, l, t, tLo);
+    fastTwoSum(t, tLo + y * lLo, t, tLo);
+    // keep n in the range where scalePow2 returns 0 or inf
+    const auto outOfRange = abs(t) > 746.;
+    t = min(max(t, V(-746.)), V(746.));
+    tLo.setZero(outOfRange);
+
+    // e^(t + tLo) = 2ⁿ · e^q with n = round(t · log₂(e))
+    const V n = floor(t * C::log2_e() + .5);
+    const V q = ((t - n * C::ln2_hi()) - n * C::ln2_lo()) + tLo;
+    return scalePow2(V::One() + expm1Poly(q), static_cast<I>(n));
+}
+//}}}1
+}  // namespace Detail
+
+/**
+ * Returns \p x raised to the power \p y, including the special cases of C99 \c pow.
+ *
+ * The result is within 1 ulp (float) or 2 ulp (double) of the correctly rounded value.
+ */
+template <typename T, typename Abi,
+          typename = enable_if<Detail::is_sse_or_avx_float<T, Abi>::value>>
+inline Vector<T, Abi> pow(Vector<T, Abi> x, Vector<T, Abi> y)
+{
+    using V = Vector<T, Abi>;
+    // the special inputs are replaced by 1 and fixed up in powSpecialCases
+    V ax = abs(x);
+    V y1 = y;
+    const auto special = ax == V::Zero() || !isfinite(ax) || !isfinite(y);
+    ax(special) = V::One();
+    y1(special) = V::One();
+    return Detail::powSpecialCases(x, y, Detail::powPositive(ax, y1));
+}
+
+/**
+ * Returns the cube root of \p x.
+ *
+ * The result is within 1 ulp of the correctly rounded value.
+ */
+template <typename T, typename Abi,
+          typename = enable_if<Detail::is_sse_or_avx_float<T, Abi>::value>>
+inline Vector<T, Abi> cbrt(Vector<T, Abi> x)
+{
+    using V = Vector<T, Abi>;
+    using I = SimdArray<int, V::Size>;
+    const V ax = abs(x);
+
+    // a = m · 2ᵉ with m ∈ [½, 1[; subnormals are scaled by 2^(3·8) or 2^(3·18) first, so
+    // that the Newton iteration below works on normal numbers only
+    V a = ax;
+    const auto denormal = a < std::numeric_limits<T>::min();
+    a(denormal) *= T(std::is_same<T, float>::value ? 16777216. : 18014398509481984.);
+    I e;
+    const V m = frexp(a, &e);
+    const V ef = simd_cast<V>(e);
+
+    // ∛(2ᵉ) = 2^q · ∛(2^rem) with e = 3q + rem
+    const V q = floor((ef + T(0.5)) * T(1. / 3.));
+    const V rem = ef - q * T(3);
+
+    // polynomial approximation of ∛m with a relative error of 1e-5 (Cephes)
+    V y = (((T(-1.3466110473359520655053e-1)  * m
+           + T( 5.4664601366395524503440e-1)) * m
+           + T(-9.5438224771509446525043e-1)) * m
+           + T( 1.1399983354717293273738e0 )) * m
+           + T( 4.0238979564544752126924e-1);
+    y(rem == T(1)) *= T(1.2599210498948732);  // ∛2
+    y(rem == T(2)) *= T(1.5874010519681996);  // ∛4
+    y = ldexp(y, static_cast<I>(q));
+
+    // Newton iteration doubles the number of correct digits
+    y -= (y - a / (y * y)) * T(1. / 3.);
+    if (std::is_same<T, double>::value) {
+        y -= (y - a / (y * y)) * T(1. / 3.);
+    }
+    y(denormal) *= T(std::is_same<T, float>::value ? 1. / 256. : 1. / 262144.);
+
+    y(ax == V::Zero() || !isfinite(ax)) = ax;
+    return copysign(y, x);
+}
+
+#endif // Vc_COMMON_MATH_H_INTERNAL
+
+// vim: foldmethod=marker
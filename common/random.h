@@ -0,0 +1,280 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_RANDOM_H_
+#define VC_COMMON_RANDOM_H_
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// splitmix64{{{1
+// advances \p x and returns the next output of SplitMix64, which is used to turn (seed,
+// stream, lane) into well-distributed xoshiro128** states
+inline std::uint64_t splitmix64(std::uint64_t &x)
+{
+    std::uint64_t z = (x += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+//}}}1
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile random.h <Vc/random>
+ *
+ * A pseudo-random number engine that produces one vector \p V of random numbers per
+ * invocation.
+ *
+ * Every entry of the vector is an independent xoshiro128** generator with its own 128 bits
+ * of state. The engine therefore only needs shifts, rotates, xor, and multiplication by
+ * small constants, which all SIMD targets support for 32-bit integers.
+ *
+ * The engine is a value type without any shared state: use one engine per thread and
+ * the threads never contend. Engines constructed with the same \p seed and \p stream
+ * produce identical sequences on every target with the same \c V::Size. Different
+ * \p stream numbers yield statistically independent sequences; thus parallel Monte Carlo
+ * runs should use a common seed and e.g. the thread (or task) index as stream number:
+ * \code
+ * Vc::RandomEngine<float_v> rng(seed, taskIndex);
+ * for (...) {
+ *   const float_v x = rng.uniform(-1.f, 1.f);
+ *   const float_v y = rng.normal();
+ *   ...
+ * }
+ * \endcode
+ *
+ * \tparam V The vector type to generate: Vc::Vector<T> or Vc::SimdArray<T, N> with \c T
+ *           one of the arithmetic types supported by Vc::Vector.
+ */
+template <typename V> class RandomEngine
+{
+    static constexpr std::size_t Size = V::Size;
+    using T = typename V::EntryType;
+    using Bits = SimdArray<unsigned int, Size>;
+    using IndexArray = SimdArray<int, Size>;
+
+public:
+    using result_type = V;
+
+    Vc_FREE_STORE_OPERATORS_ALIGNED(alignof(Bits));
+
+    /**
+     * Initializes the state of every lane from \p seedValue and \p stream.
+     */
+    explicit RandomEngine(std::uint64_t seedValue = 0, std::uint64_t stream = 0)
+    {
+        seed(seedValue, stream);
+    }
+
+    /**
+     * Resets the engine to the state a newly constructed RandomEngine(\p seedValue, \p
+     * stream) has.
+     */
+    void seed(std::uint64_t seedValue, std::uint64_t stream = 0)
+    {
+        // hash seed and stream separately before adding the lane index: deriving the
+        // lanes from stream * Size + i would let engines with a different Size share lanes
+        std::uint64_t key = seedValue;
+        key = Detail::splitmix64(key);
+        key ^= Detail::splitmix64(stream);
+        key = Detail::splitmix64(key);
+        unsigned int words[4][Size];
+        for (std::size_t i = 0; i < Size; ++i) {
+            std::uint64_t x = key + i;
+            const std::uint64_t a = Detail::splitmix64(x);
+            const std::uint64_t b = Detail::splitmix64(x);
+            words[0][i] = static_cast<unsigned int>(a);
+            words[1][i] = static_cast<unsigned int>(a >> 32);
+            words[2][i] = static_cast<unsigned int>(b);
+            words[3][i] = static_cast<unsigned int>(b >> 32);
+            if ((a | b) == 0) {  // the all-zero state is a fixed point of xoshiro
+                words[0][i] = 1;
+            }
+        }
+        for (int k = 0; k < 4; ++k) {
+            s[k].load(&words[k][0], Vc::Unaligned);
+        }
+        hasSpare = false;
+    }
+
+    /**
+     * Returns 32 random bits per entry and advances the state.
+     */
+    Vc_INTRINSIC Bits bits()
+    {
+        const Bits result = rotl(s[1] * 5u, 7) * 9u;
+        const Bits t = s[1] << 9;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 11);
+        return result;
+    }
+
+    /**
+     * Returns the next random vector, with the same value range as Vector::Random():
+     * floating-point entries are uniform in [0, 1), integer entries cover the full range of
+     * the type.
+     */
+    Vc_INTRINSIC V operator()()
+    {
+        return next(std::is_floating_point<T>(), std::integral_constant<std::size_t, sizeof(T)>());
+    }
+
+    /**
+     * Returns entries that are uniformly distributed in [\p lo, \p hi).
+     */
+    Vc_INTRINSIC V uniform(V lo, V hi)
+    {
+        static_assert(std::is_floating_point<T>::value,
+                      "RandomEngine::uniform requires a floating-point vector type");
+        return lo + (hi - lo) * operator()();
+    }
+
+    /**
+     * Returns normally distributed entries with mean 0 and standard deviation 1.
+     *
+     * Uses the Box-Muller transform on full vectors. Every transform yields two vectors, the
+     * second one is returned on the next call.
+     */
+    V normal()
+    {
+        static_assert(std::is_floating_point<T>::value,
+                      "RandomEngine::normal requires a floating-point vector type");
+        if (hasSpare) {
+            hasSpare = false;
+            return spare;
+        }
+        const V u1 = T(1) - operator()();  // (0, 1]: log(u1) is finite
+        const V u2 = operator()();
+        const V r = Vc::sqrt(T(-2) * Vc::log(u1));
+        V sine, cosine;
+        Vc::sincos(u2 * T(2 * 3.14159265358979323846), &sine, &cosine);
+        spare = r * sine;
+        hasSpare = true;
+        return r * cosine;
+    }
+
+    /**
+     * Returns normally distributed entries with the given \p mean and \p stddev.
+     */
+    Vc_INTRINSIC V normal(V mean, V stddev) { return mean + stddev * normal(); }
+
+    /**
+     * Returns exponentially distributed entries with rate \p lambda (i.e. mean
+     * 1 / \p lambda).
+     */
+    Vc_INTRINSIC V exponential(V lambda = V(T(1)))
+    {
+        static_assert(std::is_floating_point<T>::value,
+                      "RandomEngine::exponential requires a floating-point vector type");
+        return -Vc::log(T(1) - operator()()) / lambda;
+    }
+
+private:
+    static Vc_INTRINSIC Bits rotl(const Bits &x, int k) { return (x << k) | (x >> (32 - k)); }
+
+    static Vc_INTRINSIC V convert(const Bits &x) { return simd_cast<V>(simd_cast<IndexArray>(x)); }
+
+    // float: 24 bits, scaled to [0, 1)
+    Vc_INTRINSIC V next(std::true_type, std::integral_constant<std::size_t, 4>)
+    {
+        return convert(bits() >> 8) * T(1. / (1 << 24));
+    }
+    // double: 53 bits from two draws, scaled to [0, 1)
+    Vc_INTRINSIC V next(std::true_type, std::integral_constant<std::size_t, 8>)
+    {
+        const V hi = convert(bits() >> 5);
+        const V lo = convert(bits() >> 6);
+        return (hi * T(1 << 26) + lo) * T(1. / 9007199254740992.);
+    }
+    // int and unsigned int
+    Vc_INTRINSIC V next(std::false_type, std::integral_constant<std::size_t, 4>)
+    {
+        return simd_cast<V>(bits());
+    }
+    // short and unsigned short: the upper half of the output, shifted into the value range
+    Vc_INTRINSIC V next(std::false_type, std::integral_constant<std::size_t, 2>)
+    {
+        return simd_cast<V>(simd_cast<IndexArray>(bits() >> 16) -
+                            (std::is_signed<T>::value ? 32768 : 0));
+    }
+    // signed and unsigned char: the upper quarter of the output
+    Vc_INTRINSIC V next(std::false_type, std::integral_constant<std::size_t, 1>)
+    {
+        return simd_cast<V>(simd_cast<IndexArray>(bits() >> 24) -
+                            (std::is_signed<T>::value ? 128 : 0));
+    }
+    // 64-bit integers: two draws
+    Vc_INTRINSIC V next(std::false_type, std::integral_constant<std::size_t, 8>)
+    {
+        const V hi = simd_cast<V>(bits());
+        const V lo = simd_cast<V>(bits());
+        return (hi << 32) | lo;
+    }
+
+    Bits s[4];
+    V spare;
+    bool hasSpare = false;
+};
+
+namespace Common
+{
+/**\internal
+ * Returns a new stream number on every call, so that the engines behind Vector::Random()
+ * never share a sequence.
+ */
+inline std::uint64_t nextRandomStream()
+{
+    static std::atomic<std::uint64_t> counter(0);
+    return counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**\internal
+ * Implements Vector::Random(): every thread has its own engine per vector type.
+ */
+template <typename V> Vc_INTRINSIC V randomVector()
+{
+    static thread_local RandomEngine<V> engine(0, nextRandomStream());
+    return engine();
+}
+}  // namespace Common
+}  // namespace Vc
+
+#endif  // VC_COMMON_RANDOM_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,222 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_SATURATED_H_
+#define VC_COMMON_SATURATED_H_
+
+#include <limits>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// is_small_integer{{{1
+template <typename T>
+using is_small_integer =
+    std::integral_constant<bool, std::is_integral<T>::value && (sizeof(T) <= 2) &&
+                                     !std::is_same<T, bool>::value>;
+
+// saturate{{{1
+template <typename T> Vc_INTRINSIC T saturate(int x)
+{
+    return x < std::numeric_limits<T>::min()
+               ? std::numeric_limits<T>::min()
+               : x > std::numeric_limits<T>::max() ? std::numeric_limits<T>::max() : T(x);
+}
+
+// generic implementations{{{1
+template <typename T, typename Abi>
+Vc_INTRINSIC Vc::Vector<T, Abi> saturated_add(Vc::Vector<T, Abi> a, Vc::Vector<T, Abi> b)
+{
+    return Vc::Vector<T, Abi>::generate(
+        [&](int i) { return saturate<T>(int(a[i]) + int(b[i])); });
+}
+template <typename T, typename Abi>
+Vc_INTRINSIC Vc::Vector<T, Abi> saturated_sub(Vc::Vector<T, Abi> a, Vc::Vector<T, Abi> b)
+{
+    return Vc::Vector<T, Abi>::generate(
+        [&](int i) { return saturate<T>(int(a[i]) - int(b[i])); });
+}
+template <typename T, typename Abi>
+Vc_INTRINSIC Vc::Vector<T, Abi> average(Vc::Vector<T, Abi> a, Vc::Vector<T, Abi> b)
+{
+    return Vc::Vector<T, Abi>::generate(
+        [&](int i) { return T((int(a[i]) + int(b[i]) + 1) >> 1); });
+}
+template <typename Abi>
+Vc_INTRINSIC Vc::Vector<short, Abi> multiply_add_pairs(Vc::Vector<uchar, Abi> a,
+                                                       Vc::Vector<schar, Abi> b)
+{
+    constexpr int N = Vc::Vector<uchar, Abi>::Size;
+    return Vc::Vector<short, Abi>::generate([&](int i) {
+        return saturate<short>(int(a[2 * i]) * b[2 * i] +
+                               (2 * i + 1 < N ? int(a[2 * i + 1]) * b[2 * i + 1] : 0));
+    });
+}
+
+#ifdef Vc_IMPL_SSE
+// SSE{{{1
+Vc_INTRINSIC SSE::schar_v saturated_add(SSE::schar_v a, SSE::schar_v b) { return _mm_adds_epi8(a.data(), b.data()); }
+Vc_INTRINSIC SSE::uchar_v saturated_add(SSE::uchar_v a, SSE::uchar_v b) { return _mm_adds_epu8(a.data(), b.data()); }
+Vc_INTRINSIC SSE::short_v saturated_add(SSE::short_v a, SSE::short_v b) { return _mm_adds_epi16(a.data(), b.data()); }
+Vc_INTRINSIC SSE::ushort_v saturated_add(SSE::ushort_v a, SSE::ushort_v b) { return _mm_adds_epu16(a.data(), b.data()); }
+
+Vc_INTRINSIC SSE::schar_v saturated_sub(SSE::schar_v a, SSE::schar_v b) { return _mm_subs_epi8(a.data(), b.data()); }
+Vc_INTRINSIC SSE::uchar_v saturated_sub(SSE::uchar_v a, SSE::uchar_v b) { return _mm_subs_epu8(a.data(), b.data()); }
+Vc_INTRINSIC SSE::short_v saturated_sub(SSE::short_v a, SSE::short_v b) { return _mm_subs_epi16(a.data(), b.data()); }
+Vc_INTRINSIC SSE::ushort_v saturated_sub(SSE::ushort_v a, SSE::ushort_v b) { return _mm_subs_epu16(a.data(), b.data()); }
+
+// pavg only exists for unsigned integers. Flipping the sign bit maps the signed range onto
+// the unsigned range while preserving the order.
+Vc_INTRINSIC SSE::uchar_v average(SSE::uchar_v a, SSE::uchar_v b) { return _mm_avg_epu8(a.data(), b.data()); }
+Vc_INTRINSIC SSE::ushort_v average(SSE::ushort_v a, SSE::ushort_v b) { return _mm_avg_epu16(a.data(), b.data()); }
+Vc_INTRINSIC SSE::schar_v average(SSE::schar_v a, SSE::schar_v b)
+{
+    const __m128i bias = SSE::setmin_epi8();
+    return _mm_xor_si128(
+        _mm_avg_epu8(_mm_xor_si128(a.data(), bias), _mm_xor_si128(b.data(), bias)), bias);
+}
+Vc_INTRINSIC SSE::short_v average(SSE::short_v a, SSE::short_v b)
+{
+    const __m128i bias = SSE::setmin_epi16();
+    return _mm_xor_si128(
+        _mm_avg_epu16(_mm_xor_si128(a.data(), bias), _mm_xor_si128(b.data(), bias)), bias);
+}
+
+Vc_INTRINSIC SSE::short_v multiply_add_pairs(SSE::uchar_v a, SSE::schar_v b)
+{
+#ifdef Vc_IMPL_SSSE3
+    return _mm_maddubs_epi16(a.data(), b.data());
+#else
+    const __m128i lo8 = _mm_srli_epi16(SSE::_mm_setallone_si128(), 8);
+    const __m128i even = _mm_mullo_epi16(_mm_and_si128(a.data(), lo8),
+                                         _mm_srai_epi16(_mm_slli_epi16(b.data(), 8), 8));
+    const __m128i odd =
+        _mm_mullo_epi16(_mm_srli_epi16(a.data(), 8), _mm_srai_epi16(b.data(), 8));
+    return _mm_adds_epi16(even, odd);
+#endif
+}
+#endif  // Vc_IMPL_SSE
+
+#ifdef Vc_IMPL_AVX2
+// AVX2{{{1
+Vc_INTRINSIC AVX2::schar_v saturated_add(AVX2::schar_v a, AVX2::schar_v b) { return _mm256_adds_epi8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2::uchar_v saturated_add(AVX2::uchar_v a, AVX2::uchar_v b) { return _mm256_adds_epu8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2::short_v saturated_add(AVX2::short_v a, AVX2::short_v b) { return _mm256_adds_epi16(a.data(), b.data()); }
+Vc_INTRINSIC AVX2::ushort_v saturated_add(AVX2::ushort_v a, AVX2::ushort_v b) { return _mm256_adds_epu16(a.data(), b.data()); }
+
+Vc_INTRINSIC AVX2::schar_v saturated_sub(AVX2::schar_v a, AVX2::schar_v b) { return _mm256_subs_epi8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2::uchar_v saturated_sub(AVX2::uchar_v a, AVX2::uchar_v b) { return _mm256_subs_epu8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2::short_v saturated_sub(AVX2::short_v a, AVX2::short_v b) { return _mm256_subs_epi16(a.data(), b.data()); }
+Vc_INTRINSIC AVX2::ushort_v saturated_sub(AVX2::ushort_v a, AVX2::ushort_v b) { return _mm256_subs_epu16(a.data(), b.data()); }
+
+Vc_INTRINSIC AVX2::uchar_v average(AVX2::uchar_v a, AVX2::uchar_v b) { return _mm256_avg_epu8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2::ushort_v average(AVX2::ushort_v a, AVX2::ushort_v b) { return _mm256_avg_epu16(a.data(), b.data()); }
+Vc_INTRINSIC AVX2::schar_v average(AVX2::schar_v a, AVX2::schar_v b)
+{
+    const __m256i bias = _mm256_set1_epi8(-0x80);
+    return _mm256_xor_si256(
+        _mm256_avg_epu8(_mm256_xor_si256(a.data(), bias), _mm256_xor_si256(b.data(), bias)),
+        bias);
+}
+Vc_INTRINSIC AVX2::short_v average(AVX2::short_v a, AVX2::short_v b)
+{
+    const __m256i bias = _mm256_set1_epi16(-0x8000);
+    return _mm256_xor_si256(
+        _mm256_avg_epu16(_mm256_xor_si256(a.data(), bias), _mm256_xor_si256(b.data(), bias)),
+        bias);
+}
+
+Vc_INTRINSIC AVX2::short_v multiply_add_pairs(AVX2::uchar_v a, AVX2::schar_v b)
+{
+    return _mm256_maddubs_epi16(a.data(), b.data());
+}
+#endif  // Vc_IMPL_AVX2
+//}}}1
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ *
+ * Adds \p a and \p b and clamps the result to the range of \p T instead of wrapping
+ * around. Available for 8- and 16-bit integers.
+ */
+template <typename T, typename Abi>
+Vc_INTRINSIC enable_if<Detail::is_small_integer<T>::value, Vector<T, Abi>> saturated_add(
+    const Vector<T, Abi> &a, const Vector<T, Abi> &b)
+{
+    return Detail::saturated_add(a, b);
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Subtracts \p b from \p a and clamps the result to the range of \p T instead of wrapping
+ * around. Available for 8- and 16-bit integers.
+ */
+template <typename T, typename Abi>
+Vc_INTRINSIC enable_if<Detail::is_small_integer<T>::value, Vector<T, Abi>> saturated_sub(
+    const Vector<T, Abi> &a, const Vector<T, Abi> &b)
+{
+    return Detail::saturated_sub(a, b);
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Returns `(a + b + 1) >> 1` computed without intermediate overflow, i.e. the average
+ * rounded towards positive infinity. Available for 8- and 16-bit integers.
+ */
+template <typename T, typename Abi>
+Vc_INTRINSIC enable_if<Detail::is_small_integer<T>::value, Vector<T, Abi>> average(
+    const Vector<T, Abi> &a, const Vector<T, Abi> &b)
+{
+    return Detail::average(a, b);
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Multiplies the unsigned bytes of \p a with the signed bytes of \p b and adds neighboring
+ * products with signed saturation: entry \c i of the result is `a[2i] * b[2i] + a[2i+1] *
+ * b[2i+1]`. This is the building block of 8-bit dot products (\c pmaddubsw).
+ *
+ * The result has half as many entries as the arguments, i.e. it is a short_v for the
+ * default ABI. For the one-entry Scalar vectors the missing partner is treated as zero.
+ */
+template <typename Abi>
+Vc_INTRINSIC Vector<short, Abi> multiply_add_pairs(const Vector<uchar, Abi> &a,
+                                                   const Vector<schar, Abi> &b)
+{
+    return Detail::multiply_add_pairs(a, b);
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_SATURATED_H_
+
+// vim: foldmethod=marker
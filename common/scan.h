@@ -0,0 +1,386 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_SCAN_H_
+#define VC_COMMON_SCAN_H_
+
+#include <iterator>
+#include "memoryfwd.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// ScanPlus{{{1
+/**\internal
+ * The default operation of inclusive_scan and exclusive_scan. It selects the partialSum
+ * and sum kernels of the vector types.
+ */
+struct ScanPlus {
+    template <typename V> Vc_INTRINSIC V operator()(const V &a, const V &b) const
+    {
+        return a + b;
+    }
+};
+
+// scanVector{{{1
+/**\internal
+ * Returns the inclusive scan of the lanes of \p x with \p op: lane \c i holds
+ * `op(x[0], ..., x[i])`. The shifted vector is combined only into the lanes that
+ * received an entry, since \p op need not have zero as identity.
+ */
+template <typename V, typename BinaryOperation>
+Vc_INTRINSIC V scanVector(V x, BinaryOperation &op)
+{
+    for (int shift = 1; shift < int(V::Size); shift *= 2) {
+        x(V::IndexesFromZero() >= typename V::EntryType(shift)) = op(x.shifted(-shift), x);
+    }
+    return x;
+}
+template <typename V> Vc_INTRINSIC V scanVector(const V &x, ScanPlus &)
+{
+    return x.partialSum();
+}
+
+// scanTotal{{{1
+template <typename V, typename BinaryOperation>
+Vc_INTRINSIC typename V::EntryType scanTotal(const V &x, BinaryOperation &op)
+{
+    return scanVector(x, op)[V::Size - 1];
+}
+template <typename V> Vc_INTRINSIC typename V::EntryType scanTotal(const V &x, ScanPlus &)
+{
+    return x.sum();
+}
+
+// scanReduce{{{1
+/**\internal
+ * Returns `op(x_0, ..., x_n-1)` for the elements of the non-empty range [\p first, \p
+ * last), combined in order (i.e. \p op need not be commutative).
+ */
+template <typename InputIt, typename BinaryOperation>
+Scalar::Vector<typename std::iterator_traits<InputIt>::value_type> scanReduce(
+    InputIt first, InputIt last, BinaryOperation &op)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type T;
+    typedef Vector<T> V;
+    typedef Scalar::Vector<T> V1;
+    V1 result(std::addressof(*first), Vc::Aligned);
+    for (++first; first != last && reinterpret_cast<std::uintptr_t>(std::addressof(*first)) &
+                                       (V::MemoryAlignment - 1);
+         ++first) {
+        result = op(result, V1(std::addressof(*first), Vc::Aligned));
+    }
+    for (; last - first >= std::ptrdiff_t(V::Size); first += V::Size) {
+        result = op(result, V1(scanTotal(V(std::addressof(*first), Vc::Aligned), op)));
+    }
+    for (; first != last; ++first) {
+        result = op(result, V1(std::addressof(*first), Vc::Aligned));
+    }
+    return result;
+}
+
+// scan{{{1
+/**\internal
+ * The inclusive (or exclusive) scan of [\p first, \p last) with \p op, continuing from
+ * \p carry if \p hasCarry is \c true. An exclusive scan requires \p hasCarry.
+ *
+ * Every aligned vector of the input is scanned in registers (log2(V::Size) steps of
+ * Vector::shifted and \p op), combined with the broadcast carry, and stored unaligned to
+ * the output. Its last lane is the carry into the next vector. Every input vector is read
+ * before the corresponding output is written, so \p d_first may equal \p first.
+ */
+template <typename InputIt, typename OutputIt, typename BinaryOperation>
+OutputIt scan(InputIt first, InputIt last, OutputIt d_first,
+              Scalar::Vector<typename std::iterator_traits<InputIt>::value_type> carry,
+              bool hasCarry, bool exclusive, BinaryOperation &op)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type T;
+    typedef Vector<T> V;
+    typedef Scalar::Vector<T> V1;
+    auto &&scalarStep = [&]() {
+        const V1 x(std::addressof(*first), Vc::Aligned);
+        const V1 y = hasCarry ? V1(op(carry, x)) : x;
+        (exclusive ? carry : y).store(std::addressof(*d_first), Vc::Unaligned);
+        carry = y;
+        hasCarry = true;
+    };
+    for (; first != last && reinterpret_cast<std::uintptr_t>(std::addressof(*first)) &
+                                (V::MemoryAlignment - 1);
+         ++first, ++d_first) {
+        scalarStep();
+    }
+    if (!hasCarry && last - first >= std::ptrdiff_t(V::Size)) {
+        const V s = scanVector(V(std::addressof(*first), Vc::Aligned), op);
+        s.store(std::addressof(*d_first), Vc::Unaligned);
+        carry = s[V::Size - 1];
+        hasCarry = true;
+        first += V::Size;
+        d_first += V::Size;
+    }
+    for (; last - first >= std::ptrdiff_t(V::Size); first += V::Size, d_first += V::Size) {
+        const V c(carry[0]);
+        const V s = op(c, scanVector(V(std::addressof(*first), Vc::Aligned), op));
+        (exclusive ? s.shifted(-1, c) : s).store(std::addressof(*d_first), Vc::Unaligned);
+        carry = s[V::Size - 1];
+    }
+    for (; first != last; ++first, ++d_first) {
+        scalarStep();
+    }
+    return d_first;
+}
+
+// scanSerial{{{1
+// the fallback for non-arithmetic value types
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOperation>
+OutputIt scanSerial(InputIt first, InputIt last, OutputIt d_first, T carry, bool hasCarry,
+                    bool exclusive, BinaryOperation &op)
+{
+    for (; first != last; ++first, ++d_first) {
+        T y = hasCarry ? T(op(carry, *first)) : T(*first);
+        *d_first = exclusive ? carry : y;
+        carry = std::move(y);
+        hasCarry = true;
+    }
+    return d_first;
+}
+//}}}1
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ *
+ * Stores the inclusive prefix sums of [\p first, \p last) to the range starting at \p
+ * d_first: `d_first[i] = first[0] + ... + first[i]`.
+ *
+ * The input is scanned one aligned vector at a time with Vector::partialSum and the
+ * running total is carried from vector to vector. \p d_first may equal \p first;
+ * otherwise the ranges must not overlap.
+ *
+ * \returns The output iterator one past the last stored element.
+ */
+template <typename InputIt, typename OutputIt>
+inline enable_if<
+    std::is_arithmetic<typename std::iterator_traits<InputIt>::value_type>::value,
+    OutputIt>
+inclusive_scan(InputIt first, InputIt last, OutputIt d_first)
+{
+    typedef Scalar::Vector<typename std::iterator_traits<InputIt>::value_type> V1;
+    Detail::ScanPlus op;
+    return Detail::scan(first, last, d_first, V1(), false, false, op);
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Stores the inclusive scan of [\p first, \p last) with \p op to the range starting at \p
+ * d_first: `d_first[i] = op(first[0], ..., first[i])`.
+ *
+ * \p op must be associative; it need not be commutative, since the elements are always
+ * combined in order. It is called with Vc::Vector and Vc::Scalar::Vector objects (see
+ * simd_transform), e.g.:
+ * \code
+ * Vc::inclusive_scan(data.begin(), data.end(), runningMax.begin(),
+ *                    [](auto a, auto b) { return Vc::max(a, b); });
+ * \endcode
+ */
+template <typename InputIt, typename OutputIt, typename BinaryOperation>
+inline enable_if<
+    std::is_arithmetic<typename std::iterator_traits<InputIt>::value_type>::value,
+    OutputIt>
+inclusive_scan(InputIt first, InputIt last, OutputIt d_first, BinaryOperation op)
+{
+    typedef Scalar::Vector<typename std::iterator_traits<InputIt>::value_type> V1;
+    return Detail::scan(first, last, d_first, V1(), false, false, op);
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Stores the inclusive scan of [\p first, \p last) with \p op, starting from \p init, to
+ * the range starting at \p d_first: `d_first[i] = op(init, first[0], ..., first[i])`.
+ */
+template <typename InputIt, typename OutputIt, typename BinaryOperation, typename T>
+inline enable_if<
+    std::is_arithmetic<typename std::iterator_traits<InputIt>::value_type>::value,
+    OutputIt>
+inclusive_scan(InputIt first, InputIt last, OutputIt d_first, BinaryOperation op, T init)
+{
+    typedef Scalar::Vector<typename std::iterator_traits<InputIt>::value_type> V1;
+    return Detail::scan(first, last, d_first, V1(init), true, false, op);
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Stores the exclusive prefix sums of [\p first, \p last), starting from \p init, to the
+ * range starting at \p d_first: `d_first[0] = init` and `d_first[i] = init + first[0] +
+ * ... + first[i - 1]`. See inclusive_scan.
+ */
+template <typename InputIt, typename OutputIt, typename T>
+inline enable_if<
+    std::is_arithmetic<typename std::iterator_traits<InputIt>::value_type>::value,
+    OutputIt>
+exclusive_scan(InputIt first, InputIt last, OutputIt d_first, T init)
+{
+    typedef Scalar::Vector<typename std::iterator_traits<InputIt>::value_type> V1;
+    Detail::ScanPlus op;
+    return Detail::scan(first, last, d_first, V1(init), true, true, op);
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Stores the exclusive scan of [\p first, \p last) with \p op, starting from \p init, to
+ * the range starting at \p d_first: `d_first[0] = init` and `d_first[i] = op(init,
+ * first[0], ..., first[i - 1])`. See inclusive_scan for the requirements on \p op.
+ */
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOperation>
+inline enable_if<
+    std::is_arithmetic<typename std::iterator_traits<InputIt>::value_type>::value,
+    OutputIt>
+exclusive_scan(InputIt first, InputIt last, OutputIt d_first, T init, BinaryOperation op)
+{
+    typedef Scalar::Vector<typename std::iterator_traits<InputIt>::value_type> V1;
+    return Detail::scan(first, last, d_first, V1(init), true, true, op);
+}
+
+template <typename InputIt, typename OutputIt>
+inline enable_if<
+    !std::is_arithmetic<typename std::iterator_traits<InputIt>::value_type>::value,
+    OutputIt>
+inclusive_scan(InputIt first, InputIt last, OutputIt d_first)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type T;
+    auto &&op = [](const T &a, const T &b) { return a + b; };
+    return Detail::scanSerial(first, last, d_first, T(), false, false, op);
+}
+
+template <typename InputIt, typename OutputIt, typename BinaryOperation>
+inline enable_if<
+    !std::is_arithmetic<typename std::iterator_traits<InputIt>::value_type>::value,
+    OutputIt>
+inclusive_scan(InputIt first, InputIt last, OutputIt d_first, BinaryOperation op)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type T;
+    return Detail::scanSerial(first, last, d_first, T(), false, false, op);
+}
+
+template <typename InputIt, typename OutputIt, typename BinaryOperation, typename T>
+inline enable_if<
+    !std::is_arithmetic<typename std::iterator_traits<InputIt>::value_type>::value,
+    OutputIt>
+inclusive_scan(InputIt first, InputIt last, OutputIt d_first, BinaryOperation op, T init)
+{
+    return Detail::scanSerial(first, last, d_first, std::move(init), true, false, op);
+}
+
+template <typename InputIt, typename OutputIt, typename T>
+inline enable_if<
+    !std::is_arithmetic<typename std::iterator_traits<InputIt>::value_type>::value,
+    OutputIt>
+exclusive_scan(InputIt first, InputIt last, OutputIt d_first, T init)
+{
+    auto &&op = [](const T &a, const T &b) { return a + b; };
+    return Detail::scanSerial(first, last, d_first, std::move(init), true, true, op);
+}
+
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOperation>
+inline enable_if<
+    !std::is_arithmetic<typename std::iterator_traits<InputIt>::value_type>::value,
+    OutputIt>
+exclusive_scan(InputIt first, InputIt last, OutputIt d_first, T init, BinaryOperation op)
+{
+    return Detail::scanSerial(first, last, d_first, std::move(init), true, true, op);
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Stores the inclusive prefix sums of the entries of the one-dimensional Vc::Memory \p in
+ * to \p out, which must have at least as many entries. \p out may be \p in.
+ */
+template <typename V, typename P1, typename R1, typename P2, typename R2>
+inline void inclusive_scan(const Common::MemoryBase<V, P1, 1, R1> &in,
+                           Common::MemoryBase<V, P2, 1, R2> &out)
+{
+    Vc_ASSERT(out.entriesCount() >= in.entriesCount())
+    inclusive_scan(in.entries(), in.entries() + in.entriesCount(), out.entries());
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Stores the inclusive scan with \p op of the entries of the one-dimensional Vc::Memory
+ * \p in to \p out.
+ */
+template <typename V, typename P1, typename R1, typename P2, typename R2,
+          typename BinaryOperation>
+inline void inclusive_scan(const Common::MemoryBase<V, P1, 1, R1> &in,
+                           Common::MemoryBase<V, P2, 1, R2> &out, BinaryOperation op)
+{
+    Vc_ASSERT(out.entriesCount() >= in.entriesCount())
+    inclusive_scan(in.entries(), in.entries() + in.entriesCount(), out.entries(),
+                   std::move(op));
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Stores the exclusive prefix sums (starting from \p init) of the entries of the
+ * one-dimensional Vc::Memory \p in to \p out.
+ */
+template <typename V, typename P1, typename R1, typename P2, typename R2, typename T>
+inline void exclusive_scan(const Common::MemoryBase<V, P1, 1, R1> &in,
+                           Common::MemoryBase<V, P2, 1, R2> &out, T init)
+{
+    Vc_ASSERT(out.entriesCount() >= in.entriesCount())
+    exclusive_scan(in.entries(), in.entries() + in.entriesCount(), out.entries(), init);
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Stores the exclusive scan with \p op (starting from \p init) of the entries of the
+ * one-dimensional Vc::Memory \p in to \p out.
+ */
+template <typename V, typename P1, typename R1, typename P2, typename R2, typename T,
+          typename BinaryOperation>
+inline void exclusive_scan(const Common::MemoryBase<V, P1, 1, R1> &in,
+                           Common::MemoryBase<V, P2, 1, R2> &out, T init,
+                           BinaryOperation op)
+{
+    Vc_ASSERT(out.entriesCount() >= in.entriesCount())
+    exclusive_scan(in.entries(), in.entries() + in.entriesCount(), out.entries(), init,
+                   std::move(op));
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_SCAN_H_
+
+// vim: foldmethod=marker
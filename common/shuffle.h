@@ -0,0 +1,605 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_SHUFFLE_H_
+#define VC_COMMON_SHUFFLE_H_
+
+#include "indexsequence.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// ShuffleIndexes{{{1
+// The index list of a shuffle as a type. Index i < Size selects lane i of the first source,
+// Size ≤ i < 2 · Size lane i - Size of the second source, and -1 zero.
+template <int... Indexes> struct ShuffleIndexes {
+    static constexpr int Size = sizeof...(Indexes);
+    static constexpr int data[Size] = {Indexes...};
+
+    // the indexes of the lanes that read the first / second source, -1 for all others
+    using First = ShuffleIndexes<((Indexes < Size) ? Indexes : -1)...>;
+    using Second = ShuffleIndexes<((Indexes >= Size) ? Indexes - Size : -1)...>;
+
+    static constexpr bool isZero(int i) { return data[i] < 0; }
+    // the lane within its source that lane i reads. Zero lanes are set to zero after the
+    // permutation, so for them any lane will do: they read lane i.
+    static constexpr int lane(int i) { return data[i] < 0 ? i : data[i] % Size; }
+    // -1 for zero, 0 for the first, and 1 for the second source
+    static constexpr int source(int i) { return data[i] < 0 ? -1 : data[i] / Size; }
+
+    static constexpr bool valid(int sources, int i = 0)
+    {
+        return i == Size || (data[i] >= -1 && data[i] < sources * Size && valid(sources, i + 1));
+    }
+    static constexpr bool anyZero(int i = 0)
+    {
+        return i < Size && (isZero(i) || anyZero(i + 1));
+    }
+    static constexpr bool anyFrom(int src, int i = 0)
+    {
+        return i < Size && (source(i) == src || anyFrom(src, i + 1));
+    }
+    // true if every lane reads lane i of one of the sources
+    static constexpr bool isBlend(int i = 0)
+    {
+        return i == Size || (lane(i) == i && isBlend(i + 1));
+    }
+    // true if every lane reads from its own block of L lanes (e.g. a 128-bit lane)
+    static constexpr bool inBlocks(int L, int i = 0)
+    {
+        return i == Size || (lane(i) / L == i / L && inBlocks(L, i + 1));
+    }
+    // the position within its block that column k of the blocks of L lanes reads
+    static constexpr int column(int L, int k, int i = 0)
+    {
+        return k + i >= Size ? k : !isZero(k + i) ? lane(k + i) % L : column(L, k, i + L);
+    }
+    // true if all blocks of L lanes apply the same permutation
+    static constexpr bool sameInBlocks(int L, int i = 0)
+    {
+        return i == Size ||
+               ((isZero(i) || lane(i) % L == column(L, i % L)) && sameInBlocks(L, i + 1));
+    }
+
+    // merges two source values: -1 is "any", -2 a conflict
+    static constexpr int merge(int a, int b)
+    {
+        return a == -2 || b == -2 ? -2 : a == -1 ? b : b == -1 ? a : a == b ? a : -2;
+    }
+    // the common source of the lanes i with (i % Period) / Width == k
+    static constexpr int sourceOf(int Period, int Width, int k, int i = 0)
+    {
+        return i == Size ? -1 : merge((i % Period) / Width == k ? source(i) : -1,
+                                      sourceOf(Period, Width, k, i + 1));
+    }
+    // the source block (counting the blocks of both sources) that block b of L lanes copies,
+    // -1 if the block is zero, -2 if it is not a copy of a whole block
+    static constexpr int blockOf(int L, int i)
+    {
+        return data[i] < 0 ? -1 : data[i] % L == i % L ? data[i] / L : -2;
+    }
+    static constexpr int blockSource(int L, int b, int k = 0)
+    {
+        return k == L ? -1 : merge(blockOf(L, b * L + k), blockSource(L, b, k + 1));
+    }
+    // the immediate of vperm2f128 if every 128-bit half is a copy or zero, -1 otherwise
+    static constexpr int perm2f128()
+    {
+        return blockSource(Size / 2, 0) == -2 || blockSource(Size / 2, 1) == -2
+                   ? -1
+                   : (blockSource(Size / 2, 0) == -1 ? 8 : blockSource(Size / 2, 0)) |
+                         (blockSource(Size / 2, 1) == -1 ? 8 : blockSource(Size / 2, 1)) << 4;
+    }
+
+    // the 2-bit fields of pshufd / shufps / vpermilps for 4 lanes starting at Offset
+    static constexpr int imm4(int Offset = 0)
+    {
+        return (lane(Offset + 0) % 4) | (lane(Offset + 1) % 4) << 2 |
+               (lane(Offset + 2) % 4) << 4 | (lane(Offset + 3) % 4) << 6;
+    }
+    // the same for the column of every block of 4 lanes
+    static constexpr int columnImm4()
+    {
+        return column(4, 0) | column(4, 1) << 2 | column(4, 2) << 4 | column(4, 3) << 6;
+    }
+    // bit i is set for the lanes where lane(i) % 2 == 1 (shufpd / vpermilpd)
+    static constexpr unsigned oddBits(int i = 0)
+    {
+        return i == Size ? 0u : (lane(i) % 2 == 1 ? 1u << i : 0u) | oddBits(i + 1);
+    }
+    // bit i is set for the lanes that read the second source
+    static constexpr unsigned secondBits(int i = 0)
+    {
+        return i == Size ? 0u : (source(i) == 1 ? 1u << i : 0u) | secondBits(i + 1);
+    }
+    // bit i is set for the zero lanes
+    static constexpr unsigned zeroBits(int i = 0)
+    {
+        return i == Size ? 0u : (isZero(i) ? 1u << i : 0u) | zeroBits(i + 1);
+    }
+    // bit i is set for the lanes that read from the other block of L lanes
+    static constexpr unsigned crossBits(int L, int i = 0)
+    {
+        return i == Size ? 0u : (lane(i) / L != i / L ? 1u << i : 0u) | crossBits(L, i + 1);
+    }
+    // the pshufb control byte for byte j, with 16-bit lanes in blocks of 8. Select 0 uses
+    // all lanes, 1 only the lanes that stay in their block, 2 only those that cross.
+    static constexpr int byteControl16(int j, int Select = 0)
+    {
+        return (Select == 1 && lane(j / 2) / 8 != j / 16) ||
+                       (Select == 2 && lane(j / 2) / 8 == j / 16)
+                   ? 0x80
+                   : 2 * (lane(j / 2) % 8) + j % 2;
+    }
+};
+template <int... Indexes> constexpr int ShuffleIndexes<Indexes...>::data[];
+
+// ShuffleSlice{{{1
+// the indexes of the lanes [Offset, Offset + Seq::size()) of Ix
+template <typename Ix, std::size_t Offset, typename Seq> struct ShuffleSlice;
+template <typename Ix, std::size_t Offset, std::size_t... J>
+struct ShuffleSlice<Ix, Offset, index_sequence<J...>> {
+    using type = ShuffleIndexes<Ix::data[Offset + J]...>;
+};
+
+template <int N> using Lanes = std::integral_constant<int, N>;
+
+// shuffleGeneric{{{1
+// lane by lane, for the types without a register implementation
+template <typename Ix, typename V> Vc_INTRINSIC V shuffleGeneric(const V &a, const V &b)
+{
+    using T = typename V::EntryType;
+    return V::generate([&](int i) {
+        const int j = Ix::data[i];
+        return j < 0 ? T(0) : j < Ix::Size ? T(a[j]) : T(b[j - Ix::Size]);
+    });
+}
+
+#ifdef Vc_IMPL_SSE
+// SSE{{{1
+// shuffleZero {{{2
+Vc_INTRINSIC __m128 shuffleZero(__m128) { return _mm_setzero_ps(); }
+Vc_INTRINSIC __m128d shuffleZero(__m128d) { return _mm_setzero_pd(); }
+Vc_INTRINSIC __m128i shuffleZero(__m128i) { return _mm_setzero_si128(); }
+
+// shuffleBlend: lane i from b if bit i of Bits is set {{{2
+template <unsigned Bits> Vc_INTRINSIC __m128 shuffleBlend(Lanes<4>, __m128 a, __m128 b)
+{
+    return SseIntrinsics::blend_ps<Bits>(a, b);
+}
+template <unsigned Bits> Vc_INTRINSIC __m128d shuffleBlend(Lanes<2>, __m128d a, __m128d b)
+{
+    return SseIntrinsics::blend_pd<Bits>(a, b);
+}
+template <unsigned Bits> Vc_INTRINSIC __m128i shuffleBlend(Lanes<4>, __m128i a, __m128i b)
+{
+    return _mm_castps_si128(
+        SseIntrinsics::blend_ps<Bits>(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+}
+template <unsigned Bits> Vc_INTRINSIC __m128i shuffleBlend(Lanes<8>, __m128i a, __m128i b)
+{
+    return SseIntrinsics::blend_epi16<Bits>(a, b);
+}
+
+// permuteOne: one source, zero lanes are "don't care" {{{2
+template <typename Ix> Vc_INTRINSIC __m128 permuteOne(Lanes<4>, __m128 x)
+{
+    return Ix::imm4() == 0xe4 ? x : _mm_shuffle_ps(x, x, Ix::imm4());
+}
+template <typename Ix> Vc_INTRINSIC __m128d permuteOne(Lanes<2>, __m128d x)
+{
+    return Ix::oddBits() == 2 ? x : _mm_shuffle_pd(x, x, Ix::oddBits());
+}
+template <typename Ix> Vc_INTRINSIC __m128i permuteOne(Lanes<4>, __m128i x)
+{
+    return Ix::imm4() == 0xe4 ? x : _mm_shuffle_epi32(x, Ix::imm4());
+}
+template <typename Ix, std::size_t... J>
+Vc_INTRINSIC __m128i byteControl16(index_sequence<J...>)
+{
+    return _mm_setr_epi8(Ix::byteControl16(J)...);
+}
+template <typename Ix> Vc_INTRINSIC __m128i permuteOne(Lanes<8>, __m128i x)
+{
+    if (Ix::inBlocks(4)) {
+        // pshuflw and pshufhw
+        if (Ix::imm4(0) != 0xe4) {
+            x = _mm_shufflelo_epi16(x, Ix::imm4(0));
+        }
+        if (Ix::imm4(4) != 0xe4) {
+            x = _mm_shufflehi_epi16(x, Ix::imm4(4));
+        }
+        return x;
+    }
+#ifdef Vc_IMPL_SSSE3
+    return _mm_shuffle_epi8(x, byteControl16<Ix>(make_index_sequence<16>()));
+#else
+    alignas(16) short in[8], out[8];
+    _mm_store_si128(reinterpret_cast<__m128i *>(in), x);
+    for (int i = 0; i < 8; ++i) {
+        out[i] = in[Ix::lane(i)];
+    }
+    return _mm_load_si128(reinterpret_cast<const __m128i *>(out));
+#endif
+}
+
+// permuteTwo: the special cases of two sources {{{2
+// shufps: lanes 0, 1 from one source and lanes 2, 3 from one source
+template <typename Ix> Vc_INTRINSIC bool shufps(Lanes<4>, __m128i a, __m128i b, __m128i &r)
+{
+    if (Ix::sourceOf(4, 2, 0) == -2 || Ix::sourceOf(4, 2, 1) == -2) {
+        return false;
+    }
+    r = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(Ix::sourceOf(4, 2, 0) == 1 ? b : a),
+                                        _mm_castsi128_ps(Ix::sourceOf(4, 2, 1) == 1 ? b : a),
+                                        Ix::imm4()));
+    return true;
+}
+template <typename Ix> Vc_INTRINSIC bool shufps(Lanes<4>, __m128 a, __m128 b, __m128 &r)
+{
+    if (Ix::sourceOf(4, 2, 0) == -2 || Ix::sourceOf(4, 2, 1) == -2) {
+        return false;
+    }
+    r = _mm_shuffle_ps(Ix::sourceOf(4, 2, 0) == 1 ? b : a,
+                       Ix::sourceOf(4, 2, 1) == 1 ? b : a, Ix::imm4());
+    return true;
+}
+// shufpd: every lane reads any lane of one source
+template <typename Ix> Vc_INTRINSIC bool shufps(Lanes<2>, __m128d a, __m128d b, __m128d &r)
+{
+    r = _mm_shuffle_pd(Ix::source(0) == 1 ? b : a, Ix::source(1) == 1 ? b : a, Ix::oddBits());
+    return true;
+}
+template <typename Ix> Vc_INTRINSIC bool shufps(Lanes<8>, __m128i, __m128i, __m128i &)
+{
+    return false;
+}
+// vperm2f128 only exists for 256-bit registers
+template <typename Ix, typename R> Vc_INTRINSIC bool permute2f128(R, R, R &) { return false; }
+#endif  // Vc_IMPL_SSE
+
+#ifdef Vc_IMPL_AVX
+// AVX{{{1
+// shuffleZero {{{2
+Vc_INTRINSIC __m256 shuffleZero(__m256) { return _mm256_setzero_ps(); }
+Vc_INTRINSIC __m256d shuffleZero(__m256d) { return _mm256_setzero_pd(); }
+Vc_INTRINSIC __m256i shuffleZero(__m256i) { return _mm256_setzero_si256(); }
+
+// shuffleBlend {{{2
+template <unsigned Bits> Vc_INTRINSIC __m256 shuffleBlend(Lanes<8>, __m256 a, __m256 b)
+{
+    return _mm256_blend_ps(a, b, Bits);
+}
+template <unsigned Bits> Vc_INTRINSIC __m256d shuffleBlend(Lanes<4>, __m256d a, __m256d b)
+{
+    return _mm256_blend_pd(a, b, Bits);
+}
+
+// controls {{{2
+template <typename Ix, std::size_t... I>
+Vc_INTRINSIC __m256i laneControl32(int Modulo, index_sequence<I...>)
+{
+    return _mm256_setr_epi32(Ix::lane(I) % Modulo...);
+}
+// swaps the 128-bit halves
+Vc_INTRINSIC __m256 swapHalves(__m256 x) { return _mm256_permute2f128_ps(x, x, 0x01); }
+Vc_INTRINSIC __m256d swapHalves(__m256d x) { return _mm256_permute2f128_pd(x, x, 0x01); }
+
+// permuteOne {{{2
+template <typename Ix> Vc_INTRINSIC __m256 permuteOne(Lanes<8>, __m256 x)
+{
+    if (Ix::inBlocks(4)) {
+        if (Ix::sameInBlocks(4)) {
+            // vpermilps with immediate
+            return Ix::columnImm4() == 0xe4 ? x : _mm256_permute_ps(x, Ix::columnImm4());
+        }
+        // vpermilps with a control register
+        return _mm256_permutevar_ps(x, laneControl32<Ix>(4, make_index_sequence<8>()));
+    }
+    if (Ix::perm2f128() >= 0) {
+        return _mm256_permute2f128_ps(x, x, Ix::perm2f128());
+    }
+#ifdef Vc_IMPL_AVX2
+    return _mm256_permutevar8x32_ps(x, laneControl32<Ix>(8, make_index_sequence<8>()));
+#else
+    // the lanes that cross the 128-bit boundary read from the swapped halves
+    const __m256i control = laneControl32<Ix>(4, make_index_sequence<8>());
+    return _mm256_blend_ps(_mm256_permutevar_ps(x, control),
+                           _mm256_permutevar_ps(swapHalves(x), control), Ix::crossBits(4));
+#endif
+}
+template <typename Ix> Vc_INTRINSIC __m256d permuteOne(Lanes<4>, __m256d x)
+{
+    if (Ix::inBlocks(2)) {
+        return Ix::oddBits() == 0xa ? x : _mm256_permute_pd(x, Ix::oddBits());
+    }
+    if (Ix::perm2f128() >= 0) {
+        return _mm256_permute2f128_pd(x, x, Ix::perm2f128());
+    }
+#ifdef Vc_IMPL_AVX2
+    return _mm256_permute4x64_pd(x, Ix::imm4());
+#else
+    return _mm256_blend_pd(_mm256_permute_pd(x, Ix::oddBits()),
+                           _mm256_permute_pd(swapHalves(x), Ix::oddBits()), Ix::crossBits(2));
+#endif
+}
+
+// permuteTwo special cases {{{2
+// vshufps: the same shufps in both halves
+template <typename Ix> Vc_INTRINSIC bool shufps(Lanes<8>, __m256 a, __m256 b, __m256 &r)
+{
+    if (!Ix::inBlocks(4) || !Ix::sameInBlocks(4) || Ix::sourceOf(4, 2, 0) == -2 ||
+        Ix::sourceOf(4, 2, 1) == -2) {
+        return false;
+    }
+    r = _mm256_shuffle_ps(Ix::sourceOf(4, 2, 0) == 1 ? b : a,
+                          Ix::sourceOf(4, 2, 1) == 1 ? b : a, Ix::columnImm4());
+    return true;
+}
+// vshufpd: the even lanes from one source and the odd lanes from one source
+template <typename Ix> Vc_INTRINSIC bool shufps(Lanes<4>, __m256d a, __m256d b, __m256d &r)
+{
+    if (!Ix::inBlocks(2) || Ix::sourceOf(2, 1, 0) == -2 || Ix::sourceOf(2, 1, 1) == -2) {
+        return false;
+    }
+    r = _mm256_shuffle_pd(Ix::sourceOf(2, 1, 0) == 1 ? b : a,
+                          Ix::sourceOf(2, 1, 1) == 1 ? b : a, Ix::oddBits());
+    return true;
+}
+// vperm2f128: every half is a copy of a half of one of the sources, or zero
+template <typename Ix> Vc_INTRINSIC bool permute2f128(__m256 a, __m256 b, __m256 &r)
+{
+    if (Ix::perm2f128() < 0) {
+        return false;
+    }
+    r = _mm256_permute2f128_ps(a, b, Ix::perm2f128());
+    return true;
+}
+template <typename Ix> Vc_INTRINSIC bool permute2f128(__m256d a, __m256d b, __m256d &r)
+{
+    if (Ix::perm2f128() < 0) {
+        return false;
+    }
+    r = _mm256_permute2f128_pd(a, b, Ix::perm2f128());
+    return true;
+}
+
+#ifdef Vc_IMPL_AVX2
+// AVX2 integers {{{2
+template <unsigned Bits> Vc_INTRINSIC __m256i shuffleBlend(Lanes<8>, __m256i a, __m256i b)
+{
+    return _mm256_blend_epi32(a, b, Bits);
+}
+template <unsigned Bits, std::size_t... I>
+Vc_INTRINSIC __m256i blendMask16(index_sequence<I...>)
+{
+    return _mm256_setr_epi16(((Bits >> I) & 1) ? -1 : 0 ...);
+}
+template <unsigned Bits> Vc_INTRINSIC __m256i shuffleBlend(Lanes<16>, __m256i a, __m256i b)
+{
+    return _mm256_blendv_epi8(a, b, blendMask16<Bits>(make_index_sequence<16>()));
+}
+template <typename Ix> Vc_INTRINSIC __m256i permuteOne(Lanes<8>, __m256i x)
+{
+    return _mm256_castps_si256(permuteOne<Ix>(Lanes<8>(), _mm256_castsi256_ps(x)));
+}
+template <typename Ix, std::size_t... J>
+Vc_INTRINSIC __m256i byteControl16(int Select, index_sequence<J...>)
+{
+    return _mm256_setr_epi8(Ix::byteControl16(J, Select)...);
+}
+template <typename Ix> Vc_INTRINSIC __m256i permuteOne(Lanes<16>, __m256i x)
+{
+    if (Ix::inBlocks(8)) {
+        return _mm256_shuffle_epi8(x, byteControl16<Ix>(0, make_index_sequence<32>()));
+    }
+    if (Ix::perm2f128() >= 0) {
+        return _mm256_permute2x128_si256(x, x, Ix::perm2f128());
+    }
+    // vpshufb only permutes within the 128-bit halves: the lanes that cross the boundary
+    // read from the swapped halves
+    return _mm256_or_si256(
+        _mm256_shuffle_epi8(x, byteControl16<Ix>(1, make_index_sequence<32>())),
+        _mm256_shuffle_epi8(_mm256_permute2x128_si256(x, x, 0x01),
+                            byteControl16<Ix>(2, make_index_sequence<32>())));
+}
+template <typename Ix> Vc_INTRINSIC bool shufps(Lanes<8>, __m256i a, __m256i b, __m256i &r)
+{
+    __m256 tmp;
+    if (shufps<Ix>(Lanes<8>(), _mm256_castsi256_ps(a), _mm256_castsi256_ps(b), tmp)) {
+        r = _mm256_castps_si256(tmp);
+        return true;
+    }
+    return false;
+}
+template <typename Ix> Vc_INTRINSIC bool shufps(Lanes<16>, __m256i, __m256i, __m256i &)
+{
+    return false;
+}
+template <typename Ix> Vc_INTRINSIC bool permute2f128(__m256i a, __m256i b, __m256i &r)
+{
+    if (Ix::perm2f128() < 0) {
+        return false;
+    }
+    r = _mm256_permute2x128_si256(a, b, Ix::perm2f128());
+    return true;
+}
+#endif  // Vc_IMPL_AVX2
+#endif  // Vc_IMPL_AVX
+
+#ifdef Vc_IMPL_SSE
+// shuffleRegister{{{1
+// the two source shuffle of registers with N lanes
+template <typename Ix, int N, typename R> Vc_INTRINSIC R permuteTwo(Lanes<N>, R a, R b)
+{
+    if (!Ix::anyFrom(1)) {
+        return permuteOne<Ix>(Lanes<N>(), a);
+    } else if (!Ix::anyFrom(0)) {
+        return permuteOne<typename Ix::Second>(Lanes<N>(), b);
+    } else if (Ix::isBlend()) {
+        return shuffleBlend<Ix::secondBits()>(Lanes<N>(), a, b);
+    }
+    R r;
+    if (shufps<Ix>(Lanes<N>(), a, b, r) || permute2f128<Ix>(a, b, r)) {
+        return r;
+    }
+    return shuffleBlend<Ix::secondBits()>(Lanes<N>(), permuteOne<typename Ix::First>(Lanes<N>(), a),
+                                          permuteOne<typename Ix::Second>(Lanes<N>(), b));
+}
+
+template <typename Ix, int N, typename R> Vc_INTRINSIC R shuffleRegister(Lanes<N>, R a, R b)
+{
+    const R r = permuteTwo<Ix>(Lanes<N>(), a, b);
+    return Ix::anyZero() ? shuffleBlend<Ix::zeroBits()>(Lanes<N>(), r, shuffleZero(r)) : r;
+}
+#endif  // Vc_IMPL_SSE
+
+// shuffleImpl{{{1
+template <typename Ix, typename T, typename Abi>
+Vc_INTRINSIC Vector<T, Abi> shuffleImpl(const Vector<T, Abi> &a, const Vector<T, Abi> &b)
+{
+    return shuffleGeneric<Ix>(a, b);
+}
+template <typename Ix, typename T>
+Vc_INTRINSIC Scalar::Vector<T> shuffleImpl(const Scalar::Vector<T> &a,
+                                           const Scalar::Vector<T> &b)
+{
+    return Ix::data[0] < 0 ? Scalar::Vector<T>(T(0)) : Ix::data[0] == 0 ? a : b;
+}
+#ifdef Vc_IMPL_SSE
+template <typename Ix, typename T>
+Vc_INTRINSIC SSE::Vector<T> shuffleImpl(const SSE::Vector<T> &a, const SSE::Vector<T> &b)
+{
+    return shuffleRegister<Ix>(Lanes<Ix::Size>(), a.data(), b.data());
+}
+#endif
+#ifdef Vc_IMPL_AVX
+template <typename Ix, typename T>
+Vc_INTRINSIC AVX2::Vector<T> shuffleImpl(const AVX2::Vector<T> &a, const AVX2::Vector<T> &b)
+{
+    return shuffleRegister<Ix>(Lanes<Ix::Size>(), a.data(), b.data());
+}
+#endif
+
+// SimdArray{{{1
+template <typename Ix, typename T, std::size_t N, typename V, std::size_t M>
+Vc_INTRINSIC SimdArray<T, N, V, M> shuffleImpl(const SimdArray<T, N, V, M> &a,
+                                               const SimdArray<T, N, V, M> &b);
+
+// a SimdArray with a single vector member uses the vector shuffle
+template <typename Ix, typename T, std::size_t N, typename V>
+Vc_INTRINSIC SimdArray<T, N, V, N> shuffleImpl(const SimdArray<T, N, V, N> &a,
+                                               const SimdArray<T, N, V, N> &b)
+{
+    return {shuffleImpl<Ix>(internal_data(a), internal_data(b))};
+}
+// a one source shuffle of a SimdArray with two equal halves is a two source shuffle of the
+// halves for each half of the result
+template <typename Ix, typename T, std::size_t N, typename V, std::size_t M>
+Vc_INTRINSIC SimdArray<T, N, V, M> shuffleHalves(std::true_type, const SimdArray<T, N, V, M> &a,
+                                                 const SimdArray<T, N, V, M> &)
+{
+    using Seq = make_index_sequence<N / 2>;
+    return {shuffleImpl<typename ShuffleSlice<Ix, 0, Seq>::type>(internal_data0(a),
+                                                                 internal_data1(a)),
+            shuffleImpl<typename ShuffleSlice<Ix, N / 2, Seq>::type>(internal_data0(a),
+                                                                     internal_data1(a))};
+}
+template <typename Ix, typename T, std::size_t N, typename V, std::size_t M>
+Vc_INTRINSIC SimdArray<T, N, V, M> shuffleHalves(std::false_type,
+                                                 const SimdArray<T, N, V, M> &a,
+                                                 const SimdArray<T, N, V, M> &b)
+{
+    return shuffleGeneric<Ix>(a, b);
+}
+template <typename Ix, typename T, std::size_t N, typename V, std::size_t M>
+Vc_INTRINSIC SimdArray<T, N, V, M> shuffleImpl(const SimdArray<T, N, V, M> &a,
+                                               const SimdArray<T, N, V, M> &b)
+{
+    using A = SimdArray<T, N, V, M>;
+    return shuffleHalves<Ix>(
+        std::integral_constant<bool, std::is_same<typename A::storage_type0,
+                                                  typename A::storage_type1>::value &&
+                                         !Ix::anyFrom(1)>(),
+        a, b);
+}
+//}}}1
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ *
+ * Returns the vector \p x with its entries permuted at compile time: entry \c i of the
+ * result is \c x[Indexes[i]], or zero if \c Indexes[i] is -1.
+ * \code
+ * float_v x = ...;                       // [x0 x1 x2 x3] (with SSE)
+ * float_v y = Vc::shuffle<1, 0, 3, -1>(x); // [x1 x0 x3 0]
+ * \endcode
+ *
+ * The permutation is mapped to the cheapest instruction sequence available for the
+ * vector type (e.g. \c pshufd, \c shufps, \c vpermilps, \c vperm2f128, \c vpermps, or a
+ * blend), which is much faster than \c operator[] with a runtime permutation.
+ *
+ * \tparam Indexes One index in [-1, V::Size) for every entry of the vector.
+ */
+template <int... Indexes, typename V>
+Vc_INTRINSIC enable_if<Traits::is_simd_vector<V>::value, V> shuffle(const V &x)
+{
+    using Ix = Detail::ShuffleIndexes<Indexes...>;
+    static_assert(Ix::Size == int(V::size()), "shuffle requires one index per entry");
+    static_assert(Ix::valid(1), "the shuffle indexes must be in [-1, V::Size)");
+    return Detail::shuffleImpl<Ix>(x, x);
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Returns the entries of the concatenation of \p a and \p b selected by \p Indexes: entry
+ * \c i of the result is \c a[Indexes[i]] for indexes below \c V::Size, \c b[Indexes[i] -
+ * V::Size] for larger indexes, or zero for -1.
+ * \code
+ * float_v a = ..., b = ...;                    // [a0 a1 a2 a3], [b0 b1 b2 b3] (with SSE)
+ * float_v c = Vc::shuffle<0, 4, 1, 5>(a, b);  // [a0 b0 a1 b1]
+ * \endcode
+ *
+ * \tparam Indexes One index in [-1, 2 * V::Size) for every entry of the vector.
+ */
+template <int... Indexes, typename V>
+Vc_INTRINSIC enable_if<Traits::is_simd_vector<V>::value, V> shuffle(const V &a, const V &b)
+{
+    using Ix = Detail::ShuffleIndexes<Indexes...>;
+    static_assert(Ix::Size == int(V::size()), "shuffle requires one index per entry");
+    static_assert(Ix::valid(2), "the shuffle indexes must be in [-1, 2 * V::Size)");
+    return Detail::shuffleImpl<Ix>(a, b);
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_SHUFFLE_H_
+
+// vim: foldmethod=marker
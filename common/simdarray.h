@@ -35,6 +35,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #endif
 
 #include <array>
+#include <limits>
 
 #include "writemaskedvector.h"
 #include "simdarrayhelper.h"
@@ -50,7 +51,20 @@ namespace Vc_VERSIONED_NAMESPACE
 // internal namespace (product & sum helper) {{{1
 namespace internal
 {
-template <typename T> T Vc_INTRINSIC Vc_PURE product_helper_(const T &l, const T &r) { return l * r; }
+template <typename T>
+Vc_INTRINSIC Vc_PURE enable_if<!(std::is_integral<T>::value && std::is_signed<T>::value), T>
+product_helper_(const T &l, const T &r)
+{
+    return l * r;
+}
+// signed overflow is undefined, but the vector reductions wrap: multiply as unsigned
+template <typename T>
+Vc_INTRINSIC Vc_PURE enable_if<std::is_integral<T>::value && std::is_signed<T>::value, T>
+product_helper_(const T &l, const T &r)
+{
+    using U = typename std::make_unsigned<decltype(l * r)>::type;
+    return static_cast<T>(static_cast<U>(l) * static_cast<U>(r));
+}
 template <typename T> T Vc_INTRINSIC Vc_PURE sum_helper_(const T &l, const T &r) { return l + r; }
 }  // namespace internal
 
@@ -84,9 +98,11 @@ class SimdArray<T, N, VectorType_, N>
                       std::is_same<T, int32_t>::value ||
                       std::is_same<T, uint32_t>::value ||
                       std::is_same<T, int16_t>::value ||
-                      std::is_same<T, uint16_t>::value,
-                  "SimdArray<T, N> may only be used with T = { double, float, int32_t, uint32_t, "
-                  "int16_t, uint16_t }");
+                      std::is_same<T, uint16_t>::value ||
+                      std::is_same<T, int8_t>::value || std::is_same<T, uint8_t>::value ||
+                      Detail::is_int64<T>::value,
+                  "SimdArray<T, N> may only be used with T = { double, float, int64_t, uint64_t, "
+                  "int32_t, uint32_t, int16_t, uint16_t, int8_t, uint8_t }");
 
 public:
     using VectorType = VectorType_;
@@ -260,6 +276,12 @@ public:
         data.store(std::forward<Args>(args)...);
     }
 
+    ///\copydoc Vector::compressStore
+    Vc_INTRINSIC std::size_t compressStore(value_type *mem, const mask_type &k) const
+    {
+        return data.compressStore(mem, internal_data(k));
+    }
+
     Vc_INTRINSIC mask_type operator!() const
     {
         return {!data};
@@ -563,7 +585,10 @@ template <typename T, size_t N, typename V, size_t Wt> class SimdArray
                   std::is_same<T,  int32_t>::value ||
                   std::is_same<T, uint32_t>::value ||
                   std::is_same<T,  int16_t>::value ||
-                  std::is_same<T, uint16_t>::value, "SimdArray<T, N> may only be used with T = { double, float, int32_t, uint32_t, int16_t, uint16_t }");
+                  std::is_same<T, uint16_t>::value ||
+                  std::is_same<T,   int8_t>::value ||
+                  std::is_same<T,  uint8_t>::value ||
+                  Detail::is_int64<T>::value, "SimdArray<T, N> may only be used with T = { double, float, int64_t, uint64_t, int32_t, uint32_t, int16_t, uint16_t, int8_t, uint8_t }");
     static_assert(
         // either the EntryType and VectorEntryType of the main V are equal
         std::is_same<typename V::EntryType, typename V::VectorEntryType>::value ||
@@ -862,6 +887,13 @@ public:
         data1.store(mem + storage_type0::size(), Split::hi(std::forward<Args>(args))...);
     }
 
+    ///\copydoc Vector::compressStore
+    Vc_INTRINSIC std::size_t compressStore(value_type *mem, const mask_type &k) const
+    {
+        const std::size_t n = data0.compressStore(mem, internal_data0(k));
+        return n + data1.compressStore(mem + n, internal_data1(k));
+    }
+
     Vc_INTRINSIC mask_type operator!() const
     {
         return {!data0, !data1};
@@ -1673,13 +1705,21 @@ Vc_ALL_COMPARES(Vc_BINARY_OPERATORS_);
  */
 ///@{
 Vc_FORWARD_UNARY_OPERATOR(abs);
+Vc_FORWARD_UNARY_OPERATOR(acos);
 Vc_FORWARD_UNARY_OPERATOR(asin);
 Vc_FORWARD_UNARY_OPERATOR(atan);
 Vc_FORWARD_BINARY_OPERATOR(atan2);
+Vc_FORWARD_UNARY_OPERATOR(cbrt);
 Vc_FORWARD_UNARY_OPERATOR(ceil);
 Vc_FORWARD_BINARY_OPERATOR(copysign);
 Vc_FORWARD_UNARY_OPERATOR(cos);
+Vc_FORWARD_UNARY_OPERATOR(cosh);
+Vc_FORWARD_UNARY_OPERATOR(erf);
+Vc_FORWARD_UNARY_OPERATOR(erfc);
 Vc_FORWARD_UNARY_OPERATOR(exp);
+Vc_FORWARD_UNARY_OPERATOR(exp10);
+Vc_FORWARD_UNARY_OPERATOR(exp2);
+Vc_FORWARD_UNARY_OPERATOR(expm1);
 Vc_FORWARD_UNARY_OPERATOR(exponent);
 Vc_FORWARD_UNARY_OPERATOR(floor);
 /// Applies the std::fma function component-wise and concurrently.
@@ -1722,12 +1762,15 @@ inline SimdArray<T, N> ldexp(const SimdArray<T, N> &x, const SimdArray<int, N> &
     return SimdArray<T, N>::fromOperation(Common::Operations::Forward_ldexp(), x, e);
 }
 Vc_FORWARD_UNARY_OPERATOR(log);
+Vc_FORWARD_UNARY_OPERATOR(log1p);
 Vc_FORWARD_UNARY_OPERATOR(log10);
 Vc_FORWARD_UNARY_OPERATOR(log2);
+Vc_FORWARD_BINARY_OPERATOR(pow);
 Vc_FORWARD_UNARY_OPERATOR(reciprocal);
 Vc_FORWARD_UNARY_OPERATOR(round);
 Vc_FORWARD_UNARY_OPERATOR(rsqrt);
 Vc_FORWARD_UNARY_OPERATOR(sin);
+Vc_FORWARD_UNARY_OPERATOR(sinh);
 /// Determines sine and cosine concurrently and component-wise on \p x.
 template <typename T, std::size_t N>
 void sincos(const SimdArray<T, N> &x, SimdArray<T, N> *sin, SimdArray<T, N> *cos)
@@ -1735,6 +1778,8 @@ void sincos(const SimdArray<T, N> &x, SimdArray<T, N> *sin, SimdArray<T, N> *cos
     SimdArray<T, N>::callOperation(Common::Operations::Forward_sincos(), x, sin, cos);
 }
 Vc_FORWARD_UNARY_OPERATOR(sqrt);
+Vc_FORWARD_UNARY_OPERATOR(tan);
+Vc_FORWARD_UNARY_OPERATOR(tanh);
 Vc_FORWARD_UNARY_OPERATOR(trunc);
 Vc_FORWARD_BINARY_OPERATOR(min);
 Vc_FORWARD_BINARY_OPERATOR(max);
@@ -81,13 +81,21 @@ Vc_DEFINE_OPERATION(random, v = V::Random());
         }                                                                                \
     }
 Vc_DEFINE_OPERATION_FORWARD(abs);
+Vc_DEFINE_OPERATION_FORWARD(acos);
 Vc_DEFINE_OPERATION_FORWARD(asin);
 Vc_DEFINE_OPERATION_FORWARD(atan);
 Vc_DEFINE_OPERATION_FORWARD(atan2);
 Vc_DEFINE_OPERATION_FORWARD(cos);
+Vc_DEFINE_OPERATION_FORWARD(cbrt);
 Vc_DEFINE_OPERATION_FORWARD(ceil);
 Vc_DEFINE_OPERATION_FORWARD(copysign);
+Vc_DEFINE_OPERATION_FORWARD(cosh);
+Vc_DEFINE_OPERATION_FORWARD(erf);
+Vc_DEFINE_OPERATION_FORWARD(erfc);
 Vc_DEFINE_OPERATION_FORWARD(exp);
+Vc_DEFINE_OPERATION_FORWARD(exp10);
+Vc_DEFINE_OPERATION_FORWARD(exp2);
+Vc_DEFINE_OPERATION_FORWARD(expm1);
 Vc_DEFINE_OPERATION_FORWARD(exponent);
 Vc_DEFINE_OPERATION_FORWARD(fma);
 Vc_DEFINE_OPERATION_FORWARD(floor);
@@ -98,14 +106,19 @@ Vc_DEFINE_OPERATION_FORWARD(isnan);
 Vc_DEFINE_OPERATION_FORWARD(isnegative);
 Vc_DEFINE_OPERATION_FORWARD(ldexp);
 Vc_DEFINE_OPERATION_FORWARD(log);
+Vc_DEFINE_OPERATION_FORWARD(log1p);
 Vc_DEFINE_OPERATION_FORWARD(log10);
 Vc_DEFINE_OPERATION_FORWARD(log2);
+Vc_DEFINE_OPERATION_FORWARD(pow);
 Vc_DEFINE_OPERATION_FORWARD(reciprocal);
 Vc_DEFINE_OPERATION_FORWARD(round);
 Vc_DEFINE_OPERATION_FORWARD(rsqrt);
 Vc_DEFINE_OPERATION_FORWARD(sin);
 Vc_DEFINE_OPERATION_FORWARD(sincos);
+Vc_DEFINE_OPERATION_FORWARD(sinh);
 Vc_DEFINE_OPERATION_FORWARD(sqrt);
+Vc_DEFINE_OPERATION_FORWARD(tan);
+Vc_DEFINE_OPERATION_FORWARD(tanh);
 Vc_DEFINE_OPERATION_FORWARD(trunc);
 Vc_DEFINE_OPERATION_FORWARD(min);
 Vc_DEFINE_OPERATION_FORWARD(max);
@@ -30,7 +30,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <tuple>
 #include <array>
+#include <vector>
 
+#include "interleavedmemory.h"
 #include "macros.h"
 
 /*!
@@ -1218,19 +1220,175 @@ Vc_INTRINSIC V fromIteratorImpl(enable_if<(I < End), It> it)
     get_dispatcher<I>(r) = tmp;
     return r;
 }
+
+/**\internal
+ * Whether the scalar iterator \p It traverses an array of \p S objects that are stored
+ * contiguously in memory: pointers and the iterators of std::vector and Vc::vector.
+ * (Traits::has_contiguous_storage is only a heuristic for iterator types; e.g. the
+ * iterators of std::deque are random access, but the storage is not contiguous.)
+ */
+template <typename It, typename S = typename std::iterator_traits<It>::value_type>
+struct is_contiguous_iterator
+    : public std::integral_constant<
+          bool,
+          std::is_pointer<It>::value ||
+              is_same<It, typename std::vector<S>::iterator>::value ||
+              is_same<It, typename std::vector<S>::const_iterator>::value ||
+              is_same<It, typename std::vector<S, Vc::Allocator<S>>::iterator>::value ||
+              is_same<It, typename std::vector<S, Vc::Allocator<S>>::const_iterator>::value> {
+};
+
+/**\internal
+ * Determines whether objects of type \p S can be converted to/from the simdized \p V via
+ * the interleaved load/store kernels of InterleavedMemoryWrapper: \p S must consist of 2 to
+ * 8 members of the same arithmetic type without padding, vectorized as Vc::Vector.
+ */
+template <typename S, typename V,
+          typename = Vc::make_index_sequence<determine_tuple_size_<S>::value>>
+struct InterleavedAccessImpl;
+template <typename S, typename V, size_t... I>
+struct InterleavedAccessImpl<S, V, Vc::index_sequence<I...>> {
+    using T = Traits::decay<decltype(get_dispatcher<0>(std::declval<S &>()))>;
+    using VT = Traits::decay<decltype(get_dispatcher<0>(std::declval<V &>()))>;
+    template <bool...> struct BoolPack;
+    static constexpr bool value =
+        sizeof...(I) >= 2 && sizeof...(I) <= 8 && sizeof(S) == sizeof...(I) * sizeof(T) &&
+        std::is_arithmetic<T>::value && Traits::is_simd_vector<VT>::value &&
+        !Traits::isSimdArray<VT>::value &&
+        is_same<BoolPack<true, is_same<T, Traits::decay<decltype(get_dispatcher<I>(
+                                              std::declval<S &>()))>>::value...>,
+                BoolPack<is_same<T, Traits::decay<decltype(get_dispatcher<I>(
+                                        std::declval<S &>()))>>::value...,
+                         true>>::value &&
+        is_same<BoolPack<true, is_same<VT, Traits::decay<decltype(get_dispatcher<I>(
+                                               std::declval<V &>()))>>::value...>,
+                BoolPack<is_same<VT, Traits::decay<decltype(get_dispatcher<I>(
+                                         std::declval<V &>()))>>::value...,
+                         true>>::value;
+
+    /// Returns whether the members of \p s are stored in the order of their tuple indexes
+    /// (this folds to a constant).
+    static bool inOrder(const S &s)
+    {
+        const char *base = reinterpret_cast<const char *>(&s);
+        for (bool b : {(reinterpret_cast<const char *>(&get_dispatcher<I>(s)) ==
+                        base + I * sizeof(T))...}) {
+            if (!b) {
+                return false;
+            }
+        }
+        return true;
+    }
+    static Vc_INTRINSIC V load(const S *p)
+    {
+        V r;
+        const Common::InterleavedMemoryWrapper<const S, VT> wrapper(p);
+        wrapper[size_t(0)].deinterleave(get_dispatcher<I>(r)...);
+        return r;
+    }
+    static Vc_INTRINSIC void store(S *p, const V &x)
+    {
+        Common::InterleavedMemoryWrapper<S, VT>(p)[size_t(0)].interleave(
+            get_dispatcher<I>(x)...);
+    }
+};
+
+/**\internal
+ * Converts element by element between V::Size consecutive objects referenced by the
+ * scalar iterator \p It and the vectorized object \p V.
+ */
+template <typename It, typename V> struct ElementwiseIteratorAccess {
+    static Vc_INTRINSIC V load(const It &it)
+    {
+        // the member count of the scalar type also works for Vc_SIMDIZE_INTERFACE structs
+        return fromIteratorImpl<
+            It, V, 0,
+            determine_tuple_size<typename std::iterator_traits<It>::value_type>()>(it);
+    }
+    static Vc_INTRINSIC void store(It it, const V &x)
+    {
+        for (size_t i = 0; i < V::Size; ++i, ++it) {
+            *it = extract(x, i);
+        }
+    }
+};
+
+/**\internal
+ * Implements the conversion between V::Size consecutive objects referenced by the scalar
+ * iterator \p It and the vectorized object \p V, using vector loads/stores where \p It
+ * is known to reference contiguous memory.
+ */
+template <typename It, typename V, typename = void>
+struct IteratorAccess : public ElementwiseIteratorAccess<It, V> {
+};
+///\internal element-wise implementation for arithmetic value types
+template <typename It, typename V>
+struct IteratorAccess<It, V, typename std::enable_if<Traits::is_simd_vector<V>::value &&
+                                                     !is_contiguous_iterator<It>::value>::type> {
+    static Vc_INTRINSIC V load(It it)
+    {
+        V r;
+        for (size_t j = 0; j < V::size(); ++j, ++it) {
+            r[j] = *it;
+        }
+        return r;
+    }
+    static Vc_INTRINSIC void store(It it, const V &x)
+    {
+        for (size_t i = 0; i < V::Size; ++i, ++it) {
+            *it = x[i];
+        }
+    }
+};
+///\internal vector loads and stores for contiguous arrays of arithmetic values
+template <typename It, typename V>
+struct IteratorAccess<It, V, typename std::enable_if<Traits::is_simd_vector<V>::value &&
+                                                     is_contiguous_iterator<It>::value>::type> {
+    static Vc_INTRINSIC V load(const It &it) { return V(std::addressof(*it), Vc::Unaligned); }
+    static Vc_INTRINSIC void store(const It &it, const V &x)
+    {
+        x.store(std::addressof(*it), Vc::Unaligned);
+    }
+};
+///\internal InterleavedAccessImpl for the value_type of the iterator \p It
+template <typename It, typename V>
+struct InterleavedAccess
+    : public InterleavedAccessImpl<typename std::iterator_traits<It>::value_type, V> {
+};
+///\internal interleaved loads and stores for contiguous arrays of structs
 template <typename It, typename V>
-Vc_INTRINSIC V fromIterator(enable_if<!Traits::is_simd_vector<V>::value, const It &> it)
+struct IteratorAccess<
+    It, V, typename std::enable_if<
+               std::conditional<!Traits::is_simd_vector<V>::value &&
+                                    is_contiguous_iterator<It>::value,
+                                InterleavedAccess<It, V>, std::false_type>::type::value>::type> {
+    using S = typename std::iterator_traits<It>::value_type;
+    using Interleaved = InterleavedAccess<It, V>;
+
+    static Vc_INTRINSIC V load(const It &it)
+    {
+        const S *p = std::addressof(*it);
+        return Interleaved::inOrder(*p) ? Interleaved::load(p)
+                                        : ElementwiseIteratorAccess<It, V>::load(it);
+    }
+    static Vc_INTRINSIC void store(const It &it, const V &x)
+    {
+        S *p = std::addressof(*it);
+        if (Interleaved::inOrder(*p)) {
+            Interleaved::store(p, x);
+        } else {
+            ElementwiseIteratorAccess<It, V>::store(it, x);
+        }
+    }
+};
+
+template <typename It, typename V> Vc_INTRINSIC V fromIterator(const It &it)
 {
-    return fromIteratorImpl<It, V, 0, determine_tuple_size<V>()>(it);
+    return IteratorAccess<It, V>::load(it);
 }
-template <typename It, typename V>
-Vc_INTRINSIC V fromIterator(enable_if<Traits::is_simd_vector<V>::value, It> it)
+template <typename It, typename V> Vc_INTRINSIC void toIterator(const It &it, const V &x)
 {
-    V r;
-    for (size_t j = 0; j < V::size(); ++j, ++it) {
-        r[j] = *it;
-    }
-    return r;
+    IteratorAccess<It, V>::store(it, x);
 }
 
 // Note: §13.5.6 says: “An expression x->m is interpreted as (x.operator->())->m for a
@@ -1274,9 +1432,7 @@ public:
     ~Pointer()
     {
         // store data back to where it came from
-        for (size_t i = 0; i < Size; ++i, ++begin_iterator) {
-            *begin_iterator = extract(data, i);
-        }
+        toIterator(begin_iterator, data);
     }
 
     /// Construct the Pointer object from the values returned by the scalar iterator \p it.
@@ -1358,10 +1514,7 @@ public:
     void operator=(const value_vector &x)
     {
         static_cast<value_vector &>(*this) = x;
-        auto it = scalar_it;
-        for (size_t i = 0; i < Size; ++i, ++it) {
-            *it = extract(x, i);
-        }
+        toIterator(scalar_it, x);
     }
 };
 #define Vc_OP(op_)                                                                       \
@@ -0,0 +1,264 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_SOAVECTOR_H_
+#define VC_COMMON_SOAVECTOR_H_
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+#include "simdize.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace SimdizeDetail
+{
+/**\internal
+ * The storage of soa_vector: one aligned std::vector per member of \p S.
+ */
+template <typename S, typename V, typename IndexSeq> struct SoaStorage;
+template <typename S, typename V, std::size_t... I>
+struct SoaStorage<S, V, Vc::index_sequence<I...>> {
+    template <std::size_t J>
+    using scalar_member = typename std::decay<decltype(
+        get_dispatcher<J>(std::declval<S &>()))>::type;
+    template <std::size_t J>
+    using vector_member = typename std::decay<decltype(
+        get_dispatcher<J>(std::declval<V &>()))>::type;
+    template <typename T> using array = std::vector<T, Vc::Allocator<T>>;
+    // vectors start at aligned addresses unless N is an odd width
+    template <std::size_t J>
+    using flags = typename std::conditional<
+        (vector_member<J>::Size * sizeof(scalar_member<J>)) %
+                vector_member<J>::MemoryAlignment ==
+            0,
+        Vc::AlignedTag, Vc::UnalignedTag>::type;
+
+    typedef std::tuple<array<scalar_member<I>>...> type;
+
+    template <bool...> struct BoolPack;
+    static_assert(
+        std::is_same<BoolPack<true, Traits::is_simd_vector<vector_member<I>>::value...>,
+                     BoolPack<Traits::is_simd_vector<vector_member<I>>::value..., true>>::value,
+        "soa_vector requires all members of the struct to be of arithmetic type");
+
+    static void resize(type &data, std::size_t size, std::size_t padded)
+    {
+        auto &&unused = {(std::get<I>(data).resize(padded), 0)...};
+        auto &&unused2 = {(std::fill(std::get<I>(data).begin() + size, std::get<I>(data).end(),
+                                     scalar_member<I>()),
+                           0)...};
+        if (&unused == &unused2) {}
+    }
+    static void reserve(type &data, std::size_t n)
+    {
+        auto &&unused = {(std::get<I>(data).reserve(n), 0)...};
+        if (&unused == &unused) {}
+    }
+    static V load(const type &data, std::size_t i)
+    {
+        return V(vector_member<I>(&std::get<I>(data)[i * V::Size], flags<I>())...);
+    }
+    static void store(type &data, std::size_t i, const V &x)
+    {
+        auto &&unused = {
+            (get_dispatcher<I>(x).store(&std::get<I>(data)[i * V::Size], flags<I>()), 0)...};
+        if (&unused == &unused) {}
+    }
+    static S get(const type &data, std::size_t j) { return S(std::get<I>(data)[j]...); }
+    static void set(type &data, std::size_t j, const S &x)
+    {
+        auto &&unused = {(std::get<I>(data)[j] = get_dispatcher<I>(x), 0)...};
+        if (&unused == &unused) {}
+    }
+};
+}  // namespace SimdizeDetail
+
+/**
+ * \ingroup Simdize
+ *
+ * A container of objects of type \p S that stores every member in its own array
+ * (structure of arrays).
+ *
+ * The vectorized access works with the \ref simdize type of \p S: `operator[]` takes the
+ * index of a vector, i.e. of the \c vector_type::size() consecutive objects starting at
+ * `i * vector_type::size()`, and loads (or, on assignment, stores) all members with
+ * aligned vector loads (stores); only an explicit width \p N that does not fill whole
+ * registers requires unaligned accesses. No gathers or scatters are involved, in contrast
+ * to the vectorized iteration over an array of structures.
+ * \code
+ * Vc::soa_vector<Point> points(n);
+ * for (std::size_t i = 0; i < points.vectorsCount(); ++i) {
+ *   PointV p = points[i];
+ *   p.x += p.y * dt;
+ *   points[i] = p;
+ * }
+ * \endcode
+ * Single objects are accessed via scalar(), which returns a proxy object that converts to
+ * \p S and can be assigned from \p S.
+ *
+ * The arrays are padded to a multiple of \c vector_type::size(). The padding entries are
+ * zero (after construction and every resize), such that loops over all vectorsCount()
+ * vectors need no scalar epilogue.
+ *
+ * \tparam S A class template instance that can be simdized and whose members all have
+ *           arithmetic type. It must be constructible from its members in tuple order.
+ * \tparam N The number of objects per vector (see \ref simdize); the default 0 selects
+ *           the native width of the first member type.
+ */
+template <typename S, std::size_t N = 0> class soa_vector
+{
+public:
+    /// The type of the stored objects.
+    typedef S value_type;
+    /// The vectorized type of \p S, i.e. \ref simdize<S, N>.
+    typedef simdize<S, N> vector_type;
+
+private:
+    typedef SimdizeDetail::SoaStorage<
+        S, vector_type,
+        Vc::make_index_sequence<SimdizeDetail::determine_tuple_size_<S>::value>>
+        Storage;
+
+    static std::size_t paddedSize(std::size_t n)
+    {
+        return (n + vector_type::Size - 1) / vector_type::Size * vector_type::Size;
+    }
+
+    class ScalarReference
+    {
+    public:
+        ScalarReference(soa_vector &c, std::size_t j) : container(c), index(j) {}
+        operator S() const { return Storage::get(container.m_data, index); }
+        ScalarReference &operator=(const S &x)
+        {
+            Storage::set(container.m_data, index, x);
+            return *this;
+        }
+        ScalarReference &operator=(const ScalarReference &x) { return *this = S(x); }
+
+    private:
+        soa_vector &container;
+        std::size_t index;
+    };
+
+    class VectorReference
+    {
+    public:
+        VectorReference(soa_vector &c, std::size_t i) : container(c), index(i) {}
+        operator vector_type() const { return Storage::load(container.m_data, index); }
+        VectorReference &operator=(const vector_type &x)
+        {
+            Storage::store(container.m_data, index, x);
+            return *this;
+        }
+        VectorReference &operator=(const VectorReference &x)
+        {
+            return *this = vector_type(x);
+        }
+
+    private:
+        soa_vector &container;
+        std::size_t index;
+    };
+
+public:
+    /// Constructs an empty container.
+    soa_vector() : m_size(0) {}
+    /// Constructs a container with \p n value-initialized (zero) objects.
+    explicit soa_vector(std::size_t n) : m_size(0) { resize(n); }
+
+    /// Returns the number of objects.
+    std::size_t size() const { return m_size; }
+    /// Returns whether the container holds no objects.
+    bool empty() const { return m_size == 0; }
+    /// Returns the number of vectors, i.e. the valid arguments of operator[].
+    std::size_t vectorsCount() const { return paddedSize(m_size) / vector_type::Size; }
+
+    /**
+     * Changes the number of objects to \p n. New objects are zero, as are the padding
+     * entries after the last object.
+     */
+    void resize(std::size_t n)
+    {
+        Storage::resize(m_data, n, paddedSize(n));
+        m_size = n;
+    }
+    /// Reserves memory for at least \p n objects in every member array.
+    void reserve(std::size_t n) { Storage::reserve(m_data, paddedSize(n)); }
+    /// Removes all objects.
+    void clear() { resize(0); }
+
+    /// Appends the object \p x.
+    void push_back(const S &x)
+    {
+        const std::size_t j = m_size;
+        if (j % vector_type::Size == 0) {
+            resize(j + 1);
+        } else {
+            m_size = j + 1;  // the padding already has room for x
+        }
+        Storage::set(m_data, j, x);
+    }
+
+    /**
+     * Returns a proxy object for the \p i-th vector, i.e. the objects `i * vector_type::size()`
+     * to `(i + 1) * vector_type::size() - 1`. It converts to \c vector_type (loading all
+     * members) and can be assigned a \c vector_type (storing all members).
+     */
+    VectorReference operator[](std::size_t i) { return {*this, i}; }
+    /// Returns the \p i-th vector.
+    vector_type operator[](std::size_t i) const { return Storage::load(m_data, i); }
+
+    /// Returns a proxy object for the \p j-th object.
+    ScalarReference scalar(std::size_t j) { return {*this, j}; }
+    /// Returns the \p j-th object.
+    S scalar(std::size_t j) const { return Storage::get(m_data, j); }
+
+    /// Returns a pointer to the (aligned and padded) array of the \p I-th member.
+    template <std::size_t I>
+    typename Storage::template scalar_member<I> *data()
+    {
+        return std::get<I>(m_data).data();
+    }
+    /// Returns a pointer to the (aligned and padded) array of the \p I-th member.
+    template <std::size_t I>
+    const typename Storage::template scalar_member<I> *data() const
+    {
+        return std::get<I>(m_data).data();
+    }
+
+private:
+    typename Storage::type m_data;
+    std::size_t m_size;
+};
+}  // namespace Vc
+
+#endif  // VC_COMMON_SOAVECTOR_H_
+
+// vim: foldmethod=marker
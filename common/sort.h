@@ -0,0 +1,426 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_SORT_H_
+#define VC_COMMON_SORT_H_
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+#include "malloc.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// SortBuffer{{{1
+// vector-aligned scratch memory for the merge passes
+template <typename T> class SortBuffer
+{
+public:
+    explicit SortBuffer(std::size_t n)
+        : ptr(static_cast<T *>(Common::malloc<Vc::AlignOnVector>(n * sizeof(T))))
+    {
+    }
+    ~SortBuffer() { Common::free(ptr); }
+    SortBuffer(const SortBuffer &) = delete;
+    SortBuffer &operator=(const SortBuffer &) = delete;
+    T *data() const { return ptr; }
+
+private:
+    T *const ptr;
+};
+
+// sortPadding{{{1
+// the value that fills the last vector: it must not compare less than any key
+template <typename T>
+constexpr enable_if<std::numeric_limits<T>::has_infinity, T> sortPadding()
+{
+    return std::numeric_limits<T>::infinity();
+}
+template <typename T>
+constexpr enable_if<!std::numeric_limits<T>::has_infinity, T> sortPadding()
+{
+    return std::numeric_limits<T>::max();
+}
+
+// KeySorter{{{1
+// the sorting networks for Vc::sort: whole registers are sorted with Vector::sorted and two
+// sorted registers are merged with a min/max step plus two more register sorts
+template <typename T> struct KeySorter {
+    typedef Vector<T> V;
+    struct Range {
+        T *key;
+    };
+    struct Reg {
+        V key;
+    };
+
+    static Vc_INTRINSIC Range offset(Range r, std::size_t n) { return {r.key + n}; }
+    static Vc_INTRINSIC Reg load(Range r) { return {V(r.key, Vc::Aligned)}; }
+    static Vc_INTRINSIC void store(Range r, const Reg &x) { x.key.store(r.key, Vc::Aligned); }
+    static Vc_INTRINSIC void copy(Range from, Range to, std::size_t n)
+    {
+        std::copy_n(from.key, n, to.key);
+    }
+    static Vc_INTRINSIC void sortRegister(Reg &x) { x.key = x.key.sorted(); }
+
+    // a and b are sorted; afterwards a holds the smaller and b the larger half, both sorted
+    static Vc_INTRINSIC void merge(Reg &a, Reg &b)
+    {
+        // a and reversed b form a bitonic sequence, which min/max split into two halves
+        const V r = b.key.reversed();
+        const V lo = min(a.key, r);
+        b.key = max(a.key, r).sorted();
+        a.key = lo.sorted();
+    }
+};
+
+// KeyIndexSorter{{{1
+// the sorting networks for Vc::sort_by_key: the keys carry the index of their value along.
+// Vector::sorted cannot permute a second register, thus this uses bitonic networks built
+// from shifts and compare-exchange via masks.
+template <typename T> struct KeyIndexSorter {
+    typedef Vector<T> V;
+    typedef SimdArray<int, V::Size> W;
+    typedef typename V::Mask M;
+    struct Range {
+        T *key;
+        int *index;
+    };
+    struct Reg {
+        V key;
+        W index;
+    };
+
+    static Vc_INTRINSIC Range offset(Range r, std::size_t n)
+    {
+        return {r.key + n, r.index + n};
+    }
+    static Vc_INTRINSIC Reg load(Range r)
+    {
+        return {V(r.key, Vc::Aligned), W(r.index, Vc::Unaligned)};
+    }
+    static Vc_INTRINSIC void store(Range r, const Reg &x)
+    {
+        x.key.store(r.key, Vc::Aligned);
+        x.index.store(r.index, Vc::Unaligned);
+    }
+    static Vc_INTRINSIC void copy(Range from, Range to, std::size_t n)
+    {
+        std::copy_n(from.key, n, to.key);
+        std::copy_n(from.index, n, to.index);
+    }
+
+    // replaces the lanes of x where swap is set with the corresponding lanes of y
+    static Vc_INTRINSIC void select(Reg &x, const M &swap, const Reg &y)
+    {
+        x.key = iif(swap, y.key, x.key);
+        x.index = iif(simd_cast<typename W::Mask>(swap), y.index, x.index);
+    }
+
+    // compare-exchange of lane i with lane i ^ J. Lane i receives the larger key iff bit J
+    // and bit K of i differ.
+    template <std::size_t K, std::size_t J> static Vc_INTRINSIC void exchange(Reg &x)
+    {
+        const M upper = M::generate([](std::size_t i) { return (i & J) != 0; });
+        const M keepMax =
+            M::generate([](std::size_t i) { return ((i & J) != 0) != ((i & K) != 0); });
+        const Reg partner = {iif(upper, x.key.shifted(-int(J)), x.key.shifted(int(J))),
+                             iif(simd_cast<typename W::Mask>(upper), x.index.shifted(-int(J)),
+                                 x.index.shifted(int(J)))};
+        select(x, (keepMax && x.key < partner.key) || (!keepMax && partner.key < x.key),
+               partner);
+    }
+
+    // the steps J, J/2, ..., 1 of the merge stage K
+    template <std::size_t K, std::size_t J> struct Steps {
+        static Vc_INTRINSIC void run(Reg &x)
+        {
+            exchange<K, J>(x);
+            Steps<K, J / 2>::run(x);
+        }
+    };
+    template <std::size_t K> struct Steps<K, 0> {
+        static Vc_INTRINSIC void run(Reg &) {}
+    };
+
+    // the merge stages K, 2K, ..., V::Size
+    template <std::size_t K, bool Done = (K > V::Size)> struct Stages {
+        static Vc_INTRINSIC void run(Reg &x)
+        {
+            Steps<K, K / 2>::run(x);
+            Stages<2 * K>::run(x);
+        }
+    };
+    template <std::size_t K> struct Stages<K, true> {
+        static Vc_INTRINSIC void run(Reg &) {}
+    };
+
+    static Vc_INTRINSIC void sortRegister(Reg &x) { Stages<2>::run(x); }
+
+    // sorts the bitonic sequence in x (bit 2 * V::Size is never set, thus the upper lane of
+    // every pair receives the larger key)
+    static Vc_INTRINSIC void bitonicClean(Reg &x) { Steps<2 * V::Size, V::Size / 2>::run(x); }
+
+    static Vc_INTRINSIC void merge(Reg &a, Reg &b)
+    {
+        Reg r = {b.key.reversed(), b.index.reversed()};
+        const M swap = r.key < a.key;
+        b = r;
+        select(b, swap, a);
+        select(a, swap, r);
+        bitonicClean(a);
+        bitonicClean(b);
+    }
+};
+
+// mergeRuns{{{1
+// merges the sorted runs a and b (both a non-zero multiple of V::Size long) into out
+template <typename S>
+void mergeRuns(typename S::Range a, std::size_t na, typename S::Range b, std::size_t nb,
+               typename S::Range out)
+{
+    constexpr std::size_t N = S::V::Size;
+    typename S::Reg lo = S::load(a);
+    typename S::Reg hi = S::load(b);
+    std::size_t ia = N;
+    std::size_t ib = N;
+    S::merge(lo, hi);
+    S::store(out, lo);
+    for (std::size_t io = N; ia < na || ib < nb; io += N) {
+        // the next register comes from the run whose next key is smaller. The comparison
+        // is unpredictable, thus select the source without a branch.
+        const bool fromA = ib == nb || (ia < na && !(b.key[ib] < a.key[ia]));
+        lo = S::load(fromA ? S::offset(a, ia) : S::offset(b, ib));
+        ia += fromA ? N : 0;
+        ib += fromA ? 0 : N;
+        S::merge(lo, hi);
+        S::store(S::offset(out, io), lo);
+    }
+    S::store(S::offset(out, na + nb - N), hi);
+}
+
+// mergePass{{{1
+// merges neighboring runs of length width in [0, n) of src into dst
+template <typename S>
+void mergePass(typename S::Range src, typename S::Range dst, std::size_t n,
+               std::size_t width)
+{
+    for (std::size_t i = 0; i < n; i += 2 * width) {
+        const std::size_t na = std::min(width, n - i);
+        const std::size_t nb = std::min(width, n - i - na);
+        if (nb == 0) {
+            S::copy(S::offset(src, i), S::offset(dst, i), na);
+        } else {
+            mergeRuns<S>(S::offset(src, i), na, S::offset(src, i + na), nb,
+                         S::offset(dst, i));
+        }
+    }
+}
+
+// sortBuffer{{{1
+// sorts buf[0, n), with n a multiple of V::Size, using tmp as scratch space
+template <typename S> void sortBuffer(typename S::Range buf, typename S::Range tmp, std::size_t n)
+{
+    constexpr std::size_t N = S::V::Size;
+    // the number of keys that are merged completely before moving on, such that the first
+    // merge passes execute on L1-resident data
+    constexpr std::size_t BlockSize =
+        16 * 1024 / sizeof(typename S::V::EntryType) < N
+            ? N
+            : 16 * 1024 / sizeof(typename S::V::EntryType);
+
+    for (std::size_t i = 0; i < n; i += N) {
+        typename S::Reg x = S::load(S::offset(buf, i));
+        S::sortRegister(x);
+        S::store(S::offset(buf, i), x);
+    }
+
+    // every block executes the same number of passes, thus the result of all blocks ends up
+    // in the same buffer
+    const std::size_t blockSize = std::min(BlockSize, n);
+    std::size_t width = N;
+    bool inTmp = false;
+    for (; width < blockSize; width *= 2, inTmp = !inTmp) {
+        for (std::size_t i = 0; i < n; i += BlockSize) {
+            const std::size_t m = std::min(BlockSize, n - i);
+            mergePass<S>(S::offset(inTmp ? tmp : buf, i), S::offset(inTmp ? buf : tmp, i), m,
+                         width);
+        }
+    }
+    for (; width < n; width *= 2, inTmp = !inTmp) {
+        mergePass<S>(inTmp ? tmp : buf, inTmp ? buf : tmp, n, width);
+    }
+    if (inTmp) {
+        S::copy(tmp, buf, n);
+    }
+}
+
+// is_sortable_vector_type{{{1
+template <typename T>
+using is_sortable_vector_type =
+    std::integral_constant<bool, std::is_same<T, float>::value ||
+                                     std::is_same<T, double>::value ||
+                                     std::is_same<T, int>::value ||
+                                     std::is_same<T, unsigned int>::value ||
+                                     std::is_same<T, short>::value ||
+                                     std::is_same<T, unsigned short>::value>;
+//}}}1
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ *
+ * Sorts the elements in [\p first, \p last) in ascending order.
+ *
+ * For the element types that Vc::Vector supports, the elements are copied to an aligned
+ * buffer and sorted with SIMD sorting networks: every register is sorted with
+ * Vector::sorted and the sorted registers are combined by vectorized bitonic merges. The
+ * first merge passes run on L1-sized blocks. Other element types are sorted with
+ * std::sort.
+ *
+ * The sort is not stable. The result is unspecified if the range contains NaNs.
+ */
+template <typename RandomIt>
+inline enable_if<
+    Detail::is_sortable_vector_type<typename std::iterator_traits<RandomIt>::value_type>::value,
+    void>
+sort(RandomIt first, RandomIt last)
+{
+    typedef typename std::iterator_traits<RandomIt>::value_type T;
+    typedef Detail::KeySorter<T> S;
+    constexpr std::size_t N = S::V::Size;
+    const std::size_t n = std::distance(first, last);
+    if (N == 1 || n < 2) {
+        std::sort(first, last);
+        return;
+    }
+    const std::size_t padded = (n + N - 1) / N * N;
+    Detail::SortBuffer<T> buf(padded), tmp(padded);
+    std::copy(first, last, buf.data());
+    std::fill(buf.data() + n, buf.data() + padded, Detail::sortPadding<T>());
+    Detail::sortBuffer<S>({buf.data()}, {tmp.data()}, padded);
+    std::copy_n(buf.data(), n, first);
+}
+
+template <typename RandomIt>
+inline enable_if<
+    !Detail::is_sortable_vector_type<typename std::iterator_traits<RandomIt>::value_type>::value,
+    void>
+sort(RandomIt first, RandomIt last)
+{
+    std::sort(first, last);
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Sorts the keys in [\p keys_first, \p keys_last) in ascending order and applies the same
+ * permutation to the values starting at \p values_first.
+ *
+ * The keys are sorted with the SIMD sorting networks of Vc::sort, together with the index
+ * of their value. The values are permuted once at the end. Thus the value type can be
+ * anything that is move-constructible and move-assignable.
+ *
+ * The sort is not stable. The result is unspecified if the keys contain NaNs.
+ */
+template <typename KeyIt, typename ValueIt>
+inline enable_if<
+    Detail::is_sortable_vector_type<typename std::iterator_traits<KeyIt>::value_type>::value,
+    void>
+sort_by_key(KeyIt keys_first, KeyIt keys_last, ValueIt values_first)
+{
+    typedef typename std::iterator_traits<KeyIt>::value_type T;
+    typedef typename std::iterator_traits<ValueIt>::value_type U;
+    typedef Detail::KeyIndexSorter<T> S;
+    constexpr std::size_t N = S::V::Size;
+    const std::size_t n = std::distance(keys_first, keys_last);
+    if (n < 2) {
+        return;
+    }
+    Vc_ASSERT(n <= std::size_t(std::numeric_limits<int>::max()))
+    const std::size_t padded = (n + N - 1) / N * N;
+    Detail::SortBuffer<T> keys(padded), keysTmp(padded);
+    Detail::SortBuffer<int> index(padded), indexTmp(padded);
+    std::copy(keys_first, keys_last, keys.data());
+    std::fill(keys.data() + n, keys.data() + padded, Detail::sortPadding<T>());
+    for (std::size_t i = 0; i < padded; ++i) {
+        index.data()[i] = int(i);
+    }
+    Detail::sortBuffer<S>({keys.data(), index.data()}, {keysTmp.data(), indexTmp.data()},
+                          padded);
+
+    // padding may compare equal to keys of the input, therefore skip it by its index
+    std::vector<U> values;
+    values.reserve(n);
+    for (std::size_t i = 0; i < padded; ++i) {
+        const int j = index.data()[i];
+        if (std::size_t(j) < n) {
+            *keys_first = keys.data()[i];
+            ++keys_first;
+            values.push_back(std::move(values_first[j]));
+        }
+    }
+    std::move(values.begin(), values.end(), values_first);
+}
+
+template <typename KeyIt, typename ValueIt>
+inline enable_if<
+    !Detail::is_sortable_vector_type<typename std::iterator_traits<KeyIt>::value_type>::value,
+    void>
+sort_by_key(KeyIt keys_first, KeyIt keys_last, ValueIt values_first)
+{
+    typedef typename std::iterator_traits<KeyIt>::value_type T;
+    typedef typename std::iterator_traits<ValueIt>::value_type U;
+    const std::size_t n = std::distance(keys_first, keys_last);
+    std::vector<std::size_t> index(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        index[i] = i;
+    }
+    std::sort(index.begin(), index.end(), [&](std::size_t a, std::size_t b) {
+        return keys_first[a] < keys_first[b];
+    });
+    std::vector<T> keys;
+    std::vector<U> values;
+    keys.reserve(n);
+    values.reserve(n);
+    for (std::size_t i : index) {
+        keys.push_back(std::move(keys_first[i]));
+        values.push_back(std::move(values_first[i]));
+    }
+    std::move(keys.begin(), keys.end(), keys_first);
+    std::move(values.begin(), values.end(), values_first);
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_SORT_H_
+
+// vim: foldmethod=marker
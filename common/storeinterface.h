@@ -61,6 +61,35 @@ template <
     typename = enable_if<std::is_arithmetic<U>::value &&Traits::is_load_store_flag<Flags>::value>>
 Vc_INTRINSIC_L void Vc_VDECL store(U *mem, MaskType mask, Flags flags = Flags()) const Vc_INTRINSIC_R;
 
+/**
+ * Store the vector data, rounded to half precision, to \p mem. Only float vectors
+ * support this conversion.
+ *
+ * \param mem A pointer to memory, where \VSize{T} consecutive values will be stored.
+ * \param flags The flags parameter can be used to select e.g. the Vc::Aligned,
+ *              Vc::Unaligned, Vc::Streaming, and/or Vc::PrefetchDefault flags.
+ */
+template <typename Flags = DefaultStoreTag,
+          typename = enable_if<Traits::is_load_store_flag<Flags>::value>>
+Vc_INTRINSIC_L void store(half *mem, Flags flags = Flags()) const Vc_INTRINSIC_R;
+
+/**
+ * Store the entries of the vector where \p mask is set contiguously to \p mem
+ * (left-packing/stream compaction).
+ *
+ * \param mem A pointer to memory, where `mask.count()` consecutive values will be stored.
+ *             The memory after the last of these values is not touched.
+ * \param mask A mask object that determines which entries of the vector are stored.
+ *
+ * \returns The number of stored values, i.e. `mask.count()`.
+ *
+ * \see Vc::expandLoad
+ */
+Vc_INTRINSIC std::size_t Vc_VDECL compressStore(EntryType *mem, MaskType mask) const
+{
+    return Common::compressStore(*this, mem, mask);
+}
+
 //@{
 /**
  * The following store overloads support classes that have a cast operator to `EntryType
@@ -0,0 +1,202 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_THREADPOOL_H_
+#define VC_COMMON_THREADPOOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+/**\internal
+ * A pool of worker threads that executes the tasks of parallelFor.
+ *
+ * The indexes of a job are split into one slice per participating thread. Every thread
+ * first works off its own slice and then steals the remaining indexes of the other slices.
+ * Thus a thread that finishes early takes over work from threads that were delayed
+ * (e.g. by the OS scheduler or by a more expensive part of the range).
+ */
+class ThreadPool
+{
+public:
+    /// Returns the process-wide pool. The worker threads are started on first use.
+    static ThreadPool &instance()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    /// Returns the number of threads that execute a job (i.e. the workers plus the caller).
+    std::size_t concurrency() const { return workers.size() + 1; }
+
+    /**
+     * Calls \p f(i) for every \c i in [0, \p n) and returns once all calls are done. The
+     * calls execute concurrently and in unspecified order. The calling thread participates.
+     *
+     * If \p f throws, std::terminate is called. A nested invocation (i.e. from inside of
+     * \p f) executes serially on the calling thread.
+     */
+    template <typename F> void parallelFor(std::size_t n, F &f)
+    {
+        if (n <= 1 || workers.empty() || insideJob()) {
+            for (std::size_t i = 0; i < n; ++i) {
+                f(i);
+            }
+            return;
+        }
+        std::lock_guard<std::mutex> serialize(jobMutex);
+        Job j(n, concurrency(), &invoke<F>, &f);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            job = &j;
+            ++generation;
+            pending = workers.size();
+        }
+        wakeup.notify_all();
+        insideJob() = true;
+        work(j, 0);
+        insideJob() = false;
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [&] { return pending == 0; });
+        job = nullptr;
+    }
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        wakeup.notify_all();
+        for (auto &t : workers) {
+            t.join();
+        }
+    }
+
+private:
+    struct Slice {
+        std::atomic<std::size_t> next;
+        std::size_t end;
+        // keep the counters of different threads on different cache lines
+        char padding[64 - sizeof(std::atomic<std::size_t>) - sizeof(std::size_t)];
+    };
+
+    struct Job {
+        Job(std::size_t n, std::size_t nSlices_, void (*run_)(void *, std::size_t),
+            void *fun_)
+            : run(run_), fun(fun_), slices(new Slice[nSlices_]), nSlices(nSlices_)
+        {
+            for (std::size_t s = 0; s < nSlices; ++s) {
+                slices[s].next.store(n * s / nSlices, std::memory_order_relaxed);
+                slices[s].end = n * (s + 1) / nSlices;
+            }
+        }
+        void (*run)(void *, std::size_t);
+        void *fun;
+        std::unique_ptr<Slice[]> slices;
+        std::size_t nSlices;
+    };
+
+    ThreadPool()
+    {
+        const unsigned int hw = std::thread::hardware_concurrency();
+        for (unsigned int i = 1; i < hw; ++i) {
+            workers.emplace_back([this, i] { workerMain(i); });
+        }
+    }
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    template <typename F> static void invoke(void *f, std::size_t i)
+    {
+        (*static_cast<F *>(f))(i);
+    }
+
+    static bool &insideJob()
+    {
+        static thread_local bool flag = false;
+        return flag;
+    }
+
+    // executes the indexes of slice id, then steals from the other slices
+    static void work(const Job &j, std::size_t id) noexcept
+    {
+        for (std::size_t s = 0; s < j.nSlices; ++s) {
+            Slice &slice = j.slices[(id + s) % j.nSlices];
+            for (std::size_t i = slice.next.fetch_add(1, std::memory_order_relaxed);
+                 i < slice.end; i = slice.next.fetch_add(1, std::memory_order_relaxed)) {
+                j.run(j.fun, i);
+            }
+        }
+    }
+
+    void workerMain(std::size_t id)
+    {
+        insideJob() = true;
+        std::size_t seen = 0;
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            wakeup.wait(lock, [&] { return stop || generation != seen; });
+            if (stop) {
+                return;
+            }
+            seen = generation;
+            const Job *j = job;
+            lock.unlock();
+            work(*j, id);
+            lock.lock();
+            if (--pending == 0) {
+                done.notify_one();
+            }
+        }
+    }
+
+    std::vector<std::thread> workers;
+    std::mutex jobMutex;  // serializes concurrent parallelFor calls
+    std::mutex mutex;     // protects the members below
+    std::condition_variable wakeup;
+    std::condition_variable done;
+    const Job *job = nullptr;
+    std::size_t generation = 0;
+    std::size_t pending = 0;
+    bool stop = false;
+};
+}  // namespace Common
+}  // namespace Vc
+
+#endif  // VC_COMMON_THREADPOOL_H_
+
+// vim: foldmethod=marker
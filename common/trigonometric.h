@@ -53,9 +53,16 @@ template<typename Impl> struct Trigonometric
     template<typename T> static T sin(const T &_x);
     template<typename T> static T cos(const T &_x);
     template<typename T> static void sincos(const T &_x, T *_sin, T *_cos);
+    template<typename T> static T tan(const T &_x);
     template<typename T> static T asin (const T &_x);
+    template<typename T> static T acos (const T &_x);
     template<typename T> static T atan (const T &_x);
     template<typename T> static T atan2(const T &y, const T &x);
+    template<typename T> static T sinh(const T &_x);
+    template<typename T> static T cosh(const T &_x);
+    template<typename T> static T tanh(const T &_x);
+    template<typename T> static T erf (const T &_x);
+    template<typename T> static T erfc(const T &_x);
 };
 }  // namespace Common
 
@@ -71,10 +78,17 @@ using Trig = Common::Trigonometric<Detail::TrigonometricImplementation<
 }  // namespace Detail
 template <typename T, typename Abi> Vc_INTRINSIC Vector<T, Abi> sin(const Vector<T, Abi> &x) { return Detail::Trig<T, Abi>::sin(x); }
 template <typename T, typename Abi> Vc_INTRINSIC Vector<T, Abi> cos(const Vector<T, Abi> &x) { return Detail::Trig<T, Abi>::cos(x); }
+template <typename T, typename Abi> Vc_INTRINSIC Vector<T, Abi> tan(const Vector<T, Abi> &x) { return Detail::Trig<T, Abi>::tan(x); }
 template <typename T, typename Abi> Vc_INTRINSIC Vector<T, Abi> asin(const Vector<T, Abi> &x) { return Detail::Trig<T, Abi>::asin(x); }
+template <typename T, typename Abi> Vc_INTRINSIC Vector<T, Abi> acos(const Vector<T, Abi> &x) { return Detail::Trig<T, Abi>::acos(x); }
 template <typename T, typename Abi> Vc_INTRINSIC Vector<T, Abi> atan(const Vector<T, Abi> &x) { return Detail::Trig<T, Abi>::atan(x); }
 template <typename T, typename Abi> Vc_INTRINSIC Vector<T, Abi> atan2(const Vector<T, Abi> &y, const Vector<T, Abi> &x) { return Detail::Trig<T, Abi>::atan2(y, x); }
 template <typename T, typename Abi> Vc_INTRINSIC void sincos(const Vector<T, Abi> &x, Vector<T, Abi> *sin, Vector<T, Abi> *cos) { Detail::Trig<T, Abi>::sincos(x, sin, cos); }
+template <typename T, typename Abi> Vc_INTRINSIC Vector<T, Abi> sinh(const Vector<T, Abi> &x) { return Detail::Trig<T, Abi>::sinh(x); }
+template <typename T, typename Abi> Vc_INTRINSIC Vector<T, Abi> cosh(const Vector<T, Abi> &x) { return Detail::Trig<T, Abi>::cosh(x); }
+template <typename T, typename Abi> Vc_INTRINSIC Vector<T, Abi> tanh(const Vector<T, Abi> &x) { return Detail::Trig<T, Abi>::tanh(x); }
+template <typename T, typename Abi> Vc_INTRINSIC Vector<T, Abi> erf(const Vector<T, Abi> &x) { return Detail::Trig<T, Abi>::erf(x); }
+template <typename T, typename Abi> Vc_INTRINSIC Vector<T, Abi> erfc(const Vector<T, Abi> &x) { return Detail::Trig<T, Abi>::erfc(x); }
 #endif
 }  // namespace Vc
 
@@ -107,6 +107,15 @@ template<typename T> struct MayAliasImpl {
 #endif
 };
 //template<size_t Bytes> struct MayAlias<MaskBool<Bytes>> { typedef MaskBool<Bytes> type; };
+
+/**\internal
+ * Identifies the 64-bit integer types, i.e. \c long \c long and, on LP64 targets, \c long.
+ * They share one implementation in all vector ABIs.
+ */
+template <typename T>
+struct is_int64
+    : public std::integral_constant<bool, std::is_integral<T>::value && sizeof(T) == 8> {
+};
 }  // namespace Detail
 /**\internal
  * Helper MayAlias<T> that turns T into the type to be used for an aliasing pointer. This
@@ -268,6 +277,14 @@ public:
     }
 };
 
+// declaration for the function in common/random.h, which implements Vector::Random()
+template <typename V> Vc_INTRINSIC_L V randomVector() Vc_INTRINSIC_R;
+
+// declaration for the function in common/compress.h, which implements Vector::compressStore()
+template <typename V>
+Vc_INTRINSIC_L std::size_t compressStore(const V &x, typename V::EntryType *mem,
+                                         const typename V::MaskType &k) Vc_INTRINSIC_R;
+
 // declaration for functions in common/malloc.h
 template <std::size_t alignment>
 Vc_INTRINSIC_L void *aligned_malloc(std::size_t n) Vc_INTRINSIC_R;
@@ -361,6 +378,7 @@ template <std::size_t Size, typename F> Vc_INTRINSIC void for_all_vector_entries
 }  // namespace Common
 }  // namespace Vc
 
+#include "half.h"
 #include "vector.h"
 #include "mask.h"
 #include "memoryfwd.h"
@@ -35,10 +35,18 @@ namespace VectorAbi
 struct Scalar {};
 struct Sse {};
 struct Avx {};
+struct Avx512 {};
 struct Mic {};
 template <typename T>
 using Avx1Abi = typename std::conditional<std::is_integral<T>::value, VectorAbi::Sse,
                                           VectorAbi::Avx>::type;
+// AVX-512 widens float, double, int, and uint to 512 bits; the 8-, 16-, and 64-bit
+// integers keep their 256-bit AVX2 implementation
+template <typename T>
+using Avx512Abi = typename std::conditional<
+    std::is_floating_point<T>::value || std::is_same<T, int>::value ||
+        std::is_same<T, unsigned int>::value,
+    VectorAbi::Avx512, VectorAbi::Avx>::type;
 template <typename T>
 using Best = typename std::conditional<
     CurrentImplementation::is(ScalarImpl), Scalar,
@@ -48,9 +56,15 @@ using Best = typename std::conditional<
             CurrentImplementation::is(AVXImpl), Avx1Abi<T>,
             typename std::conditional<
                 CurrentImplementation::is(AVX2Impl), Avx,
-                typename std::conditional<CurrentImplementation::is(MICImpl), Mic,
-                                          void>::type>::type>::type>::type>::type;
-#ifdef Vc_IMPL_AVX2
+                typename std::conditional<
+                    CurrentImplementation::is(AVX512Impl), Avx512Abi<T>,
+                    typename std::conditional<CurrentImplementation::is(MICImpl), Mic,
+                                              void>::type>::type>::type>::type>::type>::type;
+#ifdef Vc_IMPL_AVX512
+static_assert(std::is_same<Best<float>, Avx512>::value, "");
+static_assert(std::is_same<Best<int>, Avx512>::value, "");
+static_assert(std::is_same<Best<short>, Avx>::value, "");
+#elif defined Vc_IMPL_AVX2
 static_assert(std::is_same<Best<float>, Avx>::value, "");
 static_assert(std::is_same<Best<int>, Avx>::value, "");
 #elif defined Vc_IMPL_AVX
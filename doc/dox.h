@@ -297,6 +297,7 @@ One or more of the following macros will be defined:
 \li \ref Vc_IMPL_SSE4_2
 \li \ref Vc_IMPL_AVX
 \li \ref Vc_IMPL_AVX2
+\li \ref Vc_IMPL_AVX512
 \li \ref Vc_IMPL_MIC
 
 You can use these macros to enable target-specific implementations.
@@ -307,7 +308,7 @@ After you include a %Vc header, you will have the following macros available, wh
 
 \section vc_size Vector/Mask Sizes
 
-The macros \ref Vc_DOUBLE_V_SIZE, \ref Vc_FLOAT_V_SIZE, \ref Vc_INT_V_SIZE, \ref Vc_UINT_V_SIZE, \ref Vc_SHORT_V_SIZE, and \ref Vc_USHORT_V_SIZE make the default vector width accessible in the preprocessor.
+The macros \ref Vc_DOUBLE_V_SIZE, \ref Vc_FLOAT_V_SIZE, \ref Vc_INT_V_SIZE, \ref Vc_UINT_V_SIZE, \ref Vc_SHORT_V_SIZE, \ref Vc_USHORT_V_SIZE, \ref Vc_SCHAR_V_SIZE, \ref Vc_UCHAR_V_SIZE, \ref Vc_LLONG_V_SIZE, and \ref Vc_ULLONG_V_SIZE make the default vector width accessible in the preprocessor.
 In most cases you should prefer the Vector::size() function, though.
 Since this function is \c constexpr you can use it for compile-time decisions (e.g. as template argument).
 
@@ -641,6 +642,13 @@ namespace Vc
  * This macro is defined if the current translation unit is compiled with AVX2 instruction support.
  */
 #define Vc_IMPL_AVX2
+/**
+ * This macro is defined if the current translation unit is compiled with AVX512F, AVX512BW,
+ * AVX512DQ, and AVX512VL instruction support. Vc_IMPL_AVX2 and Vc_IMPL_AVX are defined as
+ * well. The vector types keep the AVX2 width (e.g. float_v::size() == 8); only the
+ * instruction encoding and a few library kernels make use of AVX-512.
+ */
+#define Vc_IMPL_AVX512
 /**
  * This macro is defined if the current translation unit is compiled for the Knights
  * Corner Xeon Phi instruction set.
@@ -684,6 +692,26 @@ namespace Vc
  * An integer (for use with the preprocessor) that gives the number of entries in a ushort_v.
  */
 #define Vc_USHORT_V_SIZE
+/**
+ * \ingroup Utilities
+ * An integer (for use with the preprocessor) that gives the number of entries in a schar_v.
+ */
+#define Vc_SCHAR_V_SIZE
+/**
+ * \ingroup Utilities
+ * An integer (for use with the preprocessor) that gives the number of entries in a uchar_v.
+ */
+#define Vc_UCHAR_V_SIZE
+/**
+ * \ingroup Utilities
+ * An integer (for use with the preprocessor) that gives the number of entries in a llong_v.
+ */
+#define Vc_LLONG_V_SIZE
+/**
+ * \ingroup Utilities
+ * An integer (for use with the preprocessor) that gives the number of entries in a ullong_v.
+ */
+#define Vc_ULLONG_V_SIZE
 //@}
 
 } // namespace Vc
@@ -0,0 +1,129 @@
+/*{{{
+    Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+}}}*/
+
+#include <Vc/Vc>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "../tsc.h"
+
+/*
+ * This example measures the gather strategies for every number of active mask entries. It
+ * is the basis for the default of Vc::Common::HardwareGatherThreshold: compile it for AVX2
+ * and compare the "Vc" column (the gather instruction, unless disabled with
+ * -DVc_NO_HARDWARE_GATHERS) against the emulations. The lowest column count for which the
+ * instruction wins is the threshold for the measured type on the CPU it runs on.
+ */
+
+constexpr std::size_t TableSize = 64 * 1024;  // fits into L2
+constexpr std::size_t Count = 4096;           // index vectors per measurement
+
+template <typename V> struct Benchmark
+{
+    using T = typename V::EntryType;
+    using IT = typename V::IndexType;
+    using M = typename V::MaskType;
+
+    std::vector<T, Vc::Allocator<T>> table;
+    std::vector<IT, Vc::Allocator<IT>> indexes;
+    std::vector<M, Vc::Allocator<M>> masks;
+    std::default_random_engine rne;
+
+    Benchmark() : table(TableSize), indexes(Count), masks(Count)
+    {
+        for (std::size_t i = 0; i < TableSize; ++i) {
+            table[i] = T(i);
+        }
+        std::uniform_int_distribution<int> dist(0, TableSize - 1);
+        for (auto &idx : indexes) {
+            idx = IT::generate([&](int) { return dist(rne); });
+        }
+    }
+
+    // random masks with exactly `active` entries set
+    void setMasks(std::size_t active)
+    {
+        std::uniform_int_distribution<int> dist(0, V::Size - 1);
+        for (auto &m : masks) {
+            m = M(false);
+            while (std::size_t(m.count()) < active) {
+                m[dist(rne)] = true;
+            }
+        }
+    }
+
+    // the minimal number of cycles per gather over a few runs
+    template <typename F> double measure(F &&gather)
+    {
+        TimeStampCounter tsc;
+        double best = 1e99;
+        for (int run = 0; run < 10; ++run) {
+            V sum = V::Zero();
+            tsc.start();
+            for (std::size_t i = 0; i < Count; ++i) {
+                V v = V::Zero();
+                gather(v, indexes[i], masks[i]);
+                sum += v;
+            }
+            tsc.stop();
+            if (sum.sum() == T(-1)) {  // keep the result alive
+                std::printf(" ");
+            }
+            best = std::min(best, double(tsc.cycles()) / Count);
+        }
+        return best;
+    }
+
+    void run(const char *name)
+    {
+        std::printf("%-8s %6s %8s %8s %8s %8s\n", name, "active", "Vc", "bitscan",
+                    "loop", "unmasked");
+        const T *mem = table.data();
+        for (std::size_t active = 0; active <= V::Size; ++active) {
+            setMasks(active);
+            const double vc =
+                measure([&](V &v, const IT &i, const M &m) { v.gather(mem, i, m); });
+            const double bitscan = measure([&](V &v, const IT &i, const M &m) {
+                Vc::Common::executeGather(Vc::Common::BitScanLoopT(), v, mem, i, m);
+            });
+            const double loop = measure([&](V &v, const IT &i, const M &m) {
+                Vc::Common::executeGather(Vc::Common::SimpleLoopT(), v, mem, i, m);
+            });
+            std::printf("%-8s %6d %8.1f %8.1f %8.1f", "", int(active), vc, bitscan, loop);
+            if (active == V::Size) {
+                std::printf(" %8.1f",
+                            measure([&](V &v, const IT &i, const M &) { v.gather(mem, i); }));
+            }
+            std::printf("\n");
+        }
+    }
+};
+
+int Vc_CDECL main()
+{
+    std::printf("cycles per gather\n");
+    Benchmark<Vc::float_v>().run("float_v");
+    Benchmark<Vc::double_v>().run("double_v");
+    Benchmark<Vc::int_v>().run("int_v");
+    return 0;
+}
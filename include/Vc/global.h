@@ -149,6 +149,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define AVX    0x00800000
 #define AVX2   0x00900000
 #define MIC    0x00A00000
+#define AVX512 0x00B00000
 
 #define XOP    0x00000001
 #define FMA4   0x00000002
@@ -198,6 +199,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #  if defined(__MIC__)
 #    define Vc_IMPL_MIC 1
+#  elif defined(__AVX512F__) && defined(__AVX512VL__) && defined(__AVX512BW__) && \
+        defined(__AVX512DQ__)
+#    define Vc_IMPL_AVX512 1
+#    define Vc_IMPL_AVX2 1
+#    define Vc_IMPL_AVX 1
 #  elif defined(__AVX2__)
 #    define Vc_IMPL_AVX2 1
 #    define Vc_IMPL_AVX 1
@@ -262,6 +268,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #    ifdef __POPCNT__
 #      define Vc_IMPL_POPCNT 1
 #    endif
+#  elif (Vc_IMPL & IMPL_MASK) == AVX512 // AVX512 supersedes AVX2
+#    define Vc_IMPL_AVX512 1
+#    define Vc_IMPL_AVX2 1
+#    define Vc_IMPL_AVX 1
 #  elif (Vc_IMPL & IMPL_MASK) == AVX2 // AVX2 supersedes SSE
 #    define Vc_IMPL_AVX2 1
 #    define Vc_IMPL_AVX 1
@@ -384,6 +394,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #undef AVX
 #undef AVX2
 #undef MIC
+#undef AVX512
 
 #undef XOP
 #undef FMA4
@@ -398,6 +409,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #ifdef Vc_IMPL_MIC
 #define Vc_DEFAULT_IMPL_MIC
+#elif defined Vc_IMPL_AVX512
+#define Vc_DEFAULT_IMPL_AVX512
 #elif defined Vc_IMPL_AVX2
 #define Vc_DEFAULT_IMPL_AVX2
 #elif defined Vc_IMPL_AVX
@@ -484,6 +497,12 @@ enum Implementation : std::uint_least32_t { // TODO: make enum class
     AVX2Impl,
     /// Intel Xeon Phi
     MICImpl,
+    /**
+     * x86 AVX + AVX2 + AVX512F + AVX512BW + AVX512DQ + AVX512VL
+     *
+     * \note The vector types still use the 256-bit AVX2 ABI for this implementation.
+     */
+    AVX512Impl,
     ImplementationMask = 0xfff
 };
 
@@ -569,6 +588,8 @@ using CurrentImplementation = ImplementationT<
     ScalarImpl
 #elif defined(Vc_IMPL_MIC)
     MICImpl
+#elif defined(Vc_IMPL_AVX512)
+    AVX512Impl
 #elif defined(Vc_IMPL_AVX2)
     AVX2Impl
 #elif defined(Vc_IMPL_AVX)
@@ -419,6 +419,13 @@ Vc_ALWAYS_INLINE Vc_CONST enable_if<std::is_signed<T>::value, MIC::Vector<T>> ab
     Vc_MATH_OP1(floor, floor);
     Vc_MATH_OP1(ceil, ceil);
     Vc_MATH_OP1(exp, exp);
+    Vc_MATH_OP1(tan, tan);
+    Vc_MATH_OP1(acos, acos);
+    Vc_MATH_OP1(sinh, sinh);
+    Vc_MATH_OP1(cosh, cosh);
+    Vc_MATH_OP1(tanh, tanh);
+    Vc_MATH_OP1(erf, erf);
+    Vc_MATH_OP1(erfc, erfc);
 #undef Vc_MATH_OP1
     Vc_ALWAYS_INLINE MIC::double_v round(MIC::double_v x)
     {
@@ -71,6 +71,18 @@ Vc_INTRINSIC Vc_CONST Scalar::double_v copysign(Scalar::double_v mag,
     }
 Vc_ALL_VECTOR_TYPES(Vc_MINMAX);
 #undef Vc_MINMAX
+template <typename T>
+static Vc_ALWAYS_INLINE enable_if<Detail::is_int64<T>::value, Scalar::Vector<T>> min(
+    const Scalar::Vector<T> &x, const Scalar::Vector<T> &y)
+{
+    return Scalar::Vector<T>(std::min(x.data(), y.data()));
+}
+template <typename T>
+static Vc_ALWAYS_INLINE enable_if<Detail::is_int64<T>::value, Scalar::Vector<T>> max(
+    const Scalar::Vector<T> &x, const Scalar::Vector<T> &y)
+{
+    return Scalar::Vector<T>(std::max(x.data(), y.data()));
+}
 
 template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> sqrt (const Scalar::Vector<T> &x)
 {
@@ -130,6 +142,16 @@ template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> cos  (const Scala
     return Scalar::Vector<T>(std::cos(x.data()));
 }
 
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> tan  (const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::tan(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> acos (const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::acos(x.data()));
+}
+
 template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> log  (const Scalar::Vector<T> &x)
 {
     return Scalar::Vector<T>(std::log(x.data()));
@@ -150,6 +172,36 @@ template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> exp (const Scalar
     return Scalar::Vector<T>(std::exp(x.data()));
 }
 
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> exp2 (const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::exp2(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> exp10(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::pow(T(10), x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> expm1(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::expm1(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> log1p(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::log1p(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> cbrt (const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::cbrt(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> pow  (const Scalar::Vector<T> &x, const Scalar::Vector<T> &y)
+{
+    return Scalar::Vector<T>(std::pow(x.data(), y.data()));
+}
+
 template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> atan (const Scalar::Vector<T> &x)
 {
     return Scalar::Vector<T>(std::atan( x.data() ));
@@ -160,6 +212,31 @@ template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> atan2(const Scala
     return Scalar::Vector<T>(std::atan2( x.data(), y.data() ));
 }
 
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> sinh (const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::sinh(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> cosh (const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::cosh(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> tanh (const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::tanh(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> erf  (const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::erf(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> erfc (const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::erfc(x.data()));
+}
+
 template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> trunc(const Scalar::Vector<T> &x)
 {
     return std::trunc(x.data());
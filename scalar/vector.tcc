@@ -77,6 +77,13 @@ Vc_INTRINSIC void Vector<T, VectorAbi::Scalar>::store(U *mem, Mask mask, Flags)
     if (mask.data())
         mem[0] = m_data;
 }
+template <typename T>
+template <typename Flags, typename>
+Vc_INTRINSIC void Vector<T, VectorAbi::Scalar>::store(half *mem, Flags) const
+{
+    static_assert(std::is_same<T, float>::value, "only float vectors convert to half");
+    mem[0] = m_data;
+}
 
 // gather {{{1
 template <typename T>
@@ -133,43 +140,9 @@ Vc_INTRINSIC Vc_CONST Scalar::double_v Vc_VDECL exponent(Scalar::double_v x)
 }
 
 // Random {{{1
-static Vc_ALWAYS_INLINE void _doRandomStep(Scalar::uint_v &state0, Scalar::uint_v &state1)
-{
-    using Scalar::uint_v;
-    state0.load(&Common::RandomState[0]);
-    state1.load(&Common::RandomState[uint_v::Size]);
-    Detail::operator+(Detail::operator*(state1, uint_v(0xdeece66du)),
-                      uint_v(11))
-        .store(&Common::RandomState[uint_v::Size]);
-    uint_v(Detail::operator+(Detail::operator*(state0, uint_v(0xdeece66du)), uint_v(11))
-               .data() ^
-           (state1.data() >> 16))
-        .store(&Common::RandomState[0]);
-}
-
 template<typename T> Vc_INTRINSIC Vector<T, VectorAbi::Scalar> Vector<T, VectorAbi::Scalar>::Random()
 {
-    Scalar::uint_v state0, state1;
-    _doRandomStep(state0, state1);
-    return Vector<T, VectorAbi::Scalar>(static_cast<EntryType>(state0.data()));
-}
-template<> Vc_INTRINSIC Scalar::float_v Scalar::float_v::Random()
-{
-    Scalar::uint_v state0, state1;
-    _doRandomStep(state0, state1);
-    union { unsigned int i; float f; } x;
-    x.i = (state0.data() & 0x0fffffffu) | 0x3f800000u;
-    return Scalar::float_v(x.f - 1.f);
-}
-template<> Vc_INTRINSIC Scalar::double_v Scalar::double_v::Random()
-{
-    typedef unsigned long long uint64 Vc_MAY_ALIAS;
-    uint64 state0 = *reinterpret_cast<const uint64 *>(&Common::RandomState[8]);
-    state0 = (state0 * 0x5deece66dull + 11) & 0x000fffffffffffffull;
-    *reinterpret_cast<uint64 *>(&Common::RandomState[8]) = state0;
-    union { unsigned long long i; double f; } x;
-    x.i = state0 | 0x3ff0000000000000ull;
-    return Scalar::double_v(x.f - 1.);
+    return Common::randomVector<Vector>();
 }
 // isnegative {{{1
 Vc_INTRINSIC Vc_CONST Scalar::float_m isnegative(Scalar::float_v x)
@@ -0,0 +1,226 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include <avx/vector.h>
+#ifdef Vc_IMPL_AVX512
+#include <avx512/vector.h>
+#endif
+#include <avx/macros.h>
+
+#ifdef Vc_IMPL_AVX512
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+namespace
+{
+// Bitonic sorting networks on 256- and 512-bit registers. Every compare-exchange step needs one
+// permutation plus a min and a write-masked max: the k-register selects the lanes that
+// keep the maximum of the (i, i ^ J) pair, which replaces the blend/unpack sequences the
+// AVX2 kernels in avx_sorthelper.cpp need.
+
+// bitonicMaxLanes{{{1
+// lane i keeps the max of the pair iff bit J and bit K of i differ
+constexpr unsigned bitonicMaxLanes(int N, int K, int J, int i = 0)
+{
+    return i == N ? 0u : ((((i & J) != 0) != ((i & K) != 0)) ? (1u << i) : 0u) |
+                             bitonicMaxLanes(N, K, J, i + 1);
+}
+
+// partner{{{1
+// returns the register with lanes i and i ^ Bytes / sizeof(T) exchanged
+template <int Bytes> Vc_INTRINSIC __m256 partner(__m256 x);
+template <> Vc_INTRINSIC __m256 partner<4>(__m256 x) { return _mm256_permute_ps(x, 0xb1); }
+template <> Vc_INTRINSIC __m256 partner<8>(__m256 x) { return _mm256_permute_ps(x, 0x4e); }
+template <> Vc_INTRINSIC __m256 partner<16>(__m256 x) { return _mm256_permute2f128_ps(x, x, 0x01); }
+
+template <int Bytes> Vc_INTRINSIC __m256d partner(__m256d x);
+template <> Vc_INTRINSIC __m256d partner<8>(__m256d x) { return _mm256_permute_pd(x, 0x5); }
+template <> Vc_INTRINSIC __m256d partner<16>(__m256d x) { return _mm256_permute2f128_pd(x, x, 0x01); }
+
+template <int Bytes> Vc_INTRINSIC __m256i partner(__m256i x);
+template <> Vc_INTRINSIC __m256i partner<2>(__m256i x)
+{
+    return _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(x, 0xb1), 0xb1);
+}
+template <> Vc_INTRINSIC __m256i partner<4>(__m256i x) { return _mm256_shuffle_epi32(x, 0xb1); }
+template <> Vc_INTRINSIC __m256i partner<8>(__m256i x) { return _mm256_shuffle_epi32(x, 0x4e); }
+template <> Vc_INTRINSIC __m256i partner<16>(__m256i x) { return _mm256_permute2x128_si256(x, x, 0x01); }
+
+template <int Bytes> Vc_INTRINSIC __m512 partner(__m512 x);
+template <> Vc_INTRINSIC __m512 partner<4>(__m512 x) { return _mm512_permute_ps(x, 0xb1); }
+template <> Vc_INTRINSIC __m512 partner<8>(__m512 x) { return _mm512_permute_ps(x, 0x4e); }
+template <> Vc_INTRINSIC __m512 partner<16>(__m512 x) { return _mm512_shuffle_f32x4(x, x, 0xb1); }
+template <> Vc_INTRINSIC __m512 partner<32>(__m512 x) { return _mm512_shuffle_f32x4(x, x, 0x4e); }
+
+template <int Bytes> Vc_INTRINSIC __m512d partner(__m512d x);
+template <> Vc_INTRINSIC __m512d partner<8>(__m512d x) { return _mm512_permute_pd(x, 0x55); }
+template <> Vc_INTRINSIC __m512d partner<16>(__m512d x) { return _mm512_shuffle_f64x2(x, x, 0xb1); }
+template <> Vc_INTRINSIC __m512d partner<32>(__m512d x) { return _mm512_shuffle_f64x2(x, x, 0x4e); }
+
+template <int Bytes> Vc_INTRINSIC __m512i partner(__m512i x);
+template <> Vc_INTRINSIC __m512i partner<4>(__m512i x) { return _mm512_shuffle_epi32(x, _MM_PERM_CDAB); }
+template <> Vc_INTRINSIC __m512i partner<8>(__m512i x) { return _mm512_shuffle_epi32(x, _MM_PERM_BADC); }
+template <> Vc_INTRINSIC __m512i partner<16>(__m512i x) { return _mm512_shuffle_i32x4(x, x, 0xb1); }
+template <> Vc_INTRINSIC __m512i partner<32>(__m512i x) { return _mm512_shuffle_i32x4(x, x, 0x4e); }
+
+// minmax{{{1
+// min in every lane, except where k is set: there the max is stored
+Vc_INTRINSIC __m256 minmax(float, __m256 x, __m256 y, __mmask8 k)
+{
+    return _mm256_mask_max_ps(_mm256_min_ps(x, y), k, x, y);
+}
+Vc_INTRINSIC __m256d minmax(double, __m256d x, __m256d y, __mmask8 k)
+{
+    return _mm256_mask_max_pd(_mm256_min_pd(x, y), k, x, y);
+}
+Vc_INTRINSIC __m256i minmax(int, __m256i x, __m256i y, __mmask8 k)
+{
+    return _mm256_mask_max_epi32(_mm256_min_epi32(x, y), k, x, y);
+}
+Vc_INTRINSIC __m256i minmax(uint, __m256i x, __m256i y, __mmask8 k)
+{
+    return _mm256_mask_max_epu32(_mm256_min_epu32(x, y), k, x, y);
+}
+Vc_INTRINSIC __m256i minmax(short, __m256i x, __m256i y, __mmask16 k)
+{
+    return _mm256_mask_max_epi16(_mm256_min_epi16(x, y), k, x, y);
+}
+Vc_INTRINSIC __m256i minmax(ushort, __m256i x, __m256i y, __mmask16 k)
+{
+    return _mm256_mask_max_epu16(_mm256_min_epu16(x, y), k, x, y);
+}
+Vc_INTRINSIC __m512 minmax(float, __m512 x, __m512 y, __mmask16 k)
+{
+    return _mm512_mask_max_ps(_mm512_min_ps(x, y), k, x, y);
+}
+Vc_INTRINSIC __m512d minmax(double, __m512d x, __m512d y, __mmask8 k)
+{
+    return _mm512_mask_max_pd(_mm512_min_pd(x, y), k, x, y);
+}
+Vc_INTRINSIC __m512i minmax(int, __m512i x, __m512i y, __mmask16 k)
+{
+    return _mm512_mask_max_epi32(_mm512_min_epi32(x, y), k, x, y);
+}
+Vc_INTRINSIC __m512i minmax(uint, __m512i x, __m512i y, __mmask16 k)
+{
+    return _mm512_mask_max_epu32(_mm512_min_epu32(x, y), k, x, y);
+}
+
+// BitonicSort{{{1
+// runs the steps J = K/2, ..., 1 of every merge stage K = 2, 4, ..., N
+template <typename T, int N, int K, int J> struct BitonicSort {
+    template <typename R> static Vc_INTRINSIC R run(R x)
+    {
+        return BitonicSort<T, N, K, J / 2>::run(
+            minmax(T(), x, partner<J * sizeof(T)>(x), bitonicMaxLanes(N, K, J)));
+    }
+};
+template <typename T, int N, int K> struct BitonicSort<T, N, K, 0> {
+    template <typename R> static Vc_INTRINSIC R run(R x)
+    {
+        return BitonicSort<T, N, 2 * K, K>::run(x);
+    }
+};
+template <typename T, int N> struct BitonicSort<T, N, N, 0> {
+    template <typename R> static Vc_INTRINSIC R run(R x) { return x; }
+};
+
+template <typename T> Vc_INTRINSIC AVX2::Vector<T> bitonicSort(AVX2::Vector<T> x)
+{
+    return BitonicSort<T, AVX2::Vector<T>::Size, 2, 1>::run(x.data());
+}
+template <typename T>
+Vc_INTRINSIC Vector<T, VectorAbi::Avx512> bitonicSort(Vector<T, VectorAbi::Avx512> x)
+{
+    return BitonicSort<T, Vector<T, VectorAbi::Avx512>::Size, 2, 1>::run(x.data());
+}
+//}}}1
+}  // unnamed namespace
+
+template <>
+Vc_CONST AVX2::short_v sorted<CurrentImplementation::current()>(AVX2::short_v x)
+{
+    return bitonicSort(x);
+}
+
+template <>
+Vc_CONST AVX2::ushort_v sorted<CurrentImplementation::current()>(AVX2::ushort_v x)
+{
+    return bitonicSort(x);
+}
+
+template <> Vc_CONST AVX2::int_v sorted<CurrentImplementation::current()>(AVX2::int_v x)
+{
+    return bitonicSort(x);
+}
+
+template <> Vc_CONST AVX2::uint_v sorted<CurrentImplementation::current()>(AVX2::uint_v x)
+{
+    return bitonicSort(x);
+}
+
+template <>
+Vc_CONST AVX2::float_v sorted<CurrentImplementation::current()>(AVX2::float_v x)
+{
+    return bitonicSort(x);
+}
+
+template <>
+Vc_CONST AVX2::double_v sorted<CurrentImplementation::current()>(AVX2::double_v x)
+{
+    return bitonicSort(x);
+}
+
+template <>
+Vc_CONST AVX512::int_v sorted<CurrentImplementation::current()>(AVX512::int_v x)
+{
+    return bitonicSort(x);
+}
+
+template <>
+Vc_CONST AVX512::uint_v sorted<CurrentImplementation::current()>(AVX512::uint_v x)
+{
+    return bitonicSort(x);
+}
+
+template <>
+Vc_CONST AVX512::float_v sorted<CurrentImplementation::current()>(AVX512::float_v x)
+{
+    return bitonicSort(x);
+}
+
+template <>
+Vc_CONST AVX512::double_v sorted<CurrentImplementation::current()>(AVX512::double_v x)
+{
+    return bitonicSort(x);
+}
+}  // namespace Detail
+}  // namespace Vc
+#endif  // Vc_IMPL_AVX512
+
+// vim: foldmethod=marker
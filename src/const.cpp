@@ -45,6 +45,7 @@ namespace AVX
 
     // cacheline 1
     alignas(64) extern const unsigned int   _IndexesFromZero32[ 8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+    alignas(32) extern const unsigned long long _IndexesFromZero64[4] = { 0, 1, 2, 3 };
     alignas(16) extern const unsigned short _IndexesFromZero16[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
     alignas(16) extern const unsigned char  _IndexesFromZero8 [32] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31 };
 
@@ -262,6 +263,8 @@ namespace Vc_VERSIONED_NAMESPACE
 {
 namespace Common
 {
+    // unused since Vector::Random() draws from RandomEngine; binaries compiled against
+    // older headers still reference it
     alignas(64) unsigned int RandomState[16] = {
         0x5a383a4fu, 0xc68bd45eu, 0x691d6d86u, 0xb367e14fu,
         0xd689dbaau, 0xfde442aau, 0x3d265423u, 0x1a77885cu,
@@ -273,6 +276,181 @@ namespace Common
         0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU
     };
 
+    // ln(1 + i/16) = PowLogTableHi[i] + PowLogTableLo[i]
+    alignas(64) const double PowLogTableHi[17] = {
+        0.,
+        0.06062462181643484,
+        0.11778303565638346,
+        0.17185025692665923,
+        0.22314355131420976,
+        0.27193371548364176,
+        0.3184537311185346,
+        0.3629054936893685,
+        0.4054651081081644,
+        0.44628710262841953,
+        0.4855078157817008,
+        0.5232481437645479,
+        0.5596157879354227,
+        0.5947071077466928,
+        0.6286086594223741,
+        0.661398482245365,
+        0.6931471805599453
+    };
+    alignas(64) const double PowLogTableLo[17] = {
+        0.,
+        2.6424025938726934e-18,
+        -1.1971685747593677e-18,
+        -6.0224538210113705e-18,
+        -9.091270597324799e-18,
+        7.83319637697442e-19,
+        2.7114779367326236e-17,
+        -2.1492361455310972e-17,
+        -2.8811380259626426e-18,
+        -1.8182541194649598e-17,
+        -1.6618350693852048e-17,
+        -3.1833882216350925e-17,
+        2.685492580212308e-17,
+        1.3751689964323675e-17,
+        4.3538742607970387e-17,
+        -7.603333785634003e-18,
+        2.3190468138462996e-17
+    };
+
+    // row m lists the indexes of the bits set in m, in increasing order (zero-filled)
+    alignas(64) const unsigned char CompressIndexes[256][8] = {
+        {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {1,0,0,0,0,0,0,0}, {0,1,0,0,0,0,0,0},
+        {2,0,0,0,0,0,0,0}, {0,2,0,0,0,0,0,0}, {1,2,0,0,0,0,0,0}, {0,1,2,0,0,0,0,0},
+        {3,0,0,0,0,0,0,0}, {0,3,0,0,0,0,0,0}, {1,3,0,0,0,0,0,0}, {0,1,3,0,0,0,0,0},
+        {2,3,0,0,0,0,0,0}, {0,2,3,0,0,0,0,0}, {1,2,3,0,0,0,0,0}, {0,1,2,3,0,0,0,0},
+        {4,0,0,0,0,0,0,0}, {0,4,0,0,0,0,0,0}, {1,4,0,0,0,0,0,0}, {0,1,4,0,0,0,0,0},
+        {2,4,0,0,0,0,0,0}, {0,2,4,0,0,0,0,0}, {1,2,4,0,0,0,0,0}, {0,1,2,4,0,0,0,0},
+        {3,4,0,0,0,0,0,0}, {0,3,4,0,0,0,0,0}, {1,3,4,0,0,0,0,0}, {0,1,3,4,0,0,0,0},
+        {2,3,4,0,0,0,0,0}, {0,2,3,4,0,0,0,0}, {1,2,3,4,0,0,0,0}, {0,1,2,3,4,0,0,0},
+        {5,0,0,0,0,0,0,0}, {0,5,0,0,0,0,0,0}, {1,5,0,0,0,0,0,0}, {0,1,5,0,0,0,0,0},
+        {2,5,0,0,0,0,0,0}, {0,2,5,0,0,0,0,0}, {1,2,5,0,0,0,0,0}, {0,1,2,5,0,0,0,0},
+        {3,5,0,0,0,0,0,0}, {0,3,5,0,0,0,0,0}, {1,3,5,0,0,0,0,0}, {0,1,3,5,0,0,0,0},
+        {2,3,5,0,0,0,0,0}, {0,2,3,5,0,0,0,0}, {1,2,3,5,0,0,0,0}, {0,1,2,3,5,0,0,0},
+        {4,5,0,0,0,0,0,0}, {0,4,5,0,0,0,0,0}, {1,4,5,0,0,0,0,0}, {0,1,4,5,0,0,0,0},
+        {2,4,5,0,0,0,0,0}, {0,2,4,5,0,0,0,0}, {1,2,4,5,0,0,0,0}, {0,1,2,4,5,0,0,0},
+        {3,4,5,0,0,0,0,0}, {0,3,4,5,0,0,0,0}, {1,3,4,5,0,0,0,0}, {0,1,3,4,5,0,0,0},
+        {2,3,4,5,0,0,0,0}, {0,2,3,4,5,0,0,0}, {1,2,3,4,5,0,0,0}, {0,1,2,3,4,5,0,0},
+        {6,0,0,0,0,0,0,0}, {0,6,0,0,0,0,0,0}, {1,6,0,0,0,0,0,0}, {0,1,6,0,0,0,0,0},
+        {2,6,0,0,0,0,0,0}, {0,2,6,0,0,0,0,0}, {1,2,6,0,0,0,0,0}, {0,1,2,6,0,0,0,0},
+        {3,6,0,0,0,0,0,0}, {0,3,6,0,0,0,0,0}, {1,3,6,0,0,0,0,0}, {0,1,3,6,0,0,0,0},
+        {2,3,6,0,0,0,0,0}, {0,2,3,6,0,0,0,0}, {1,2,3,6,0,0,0,0}, {0,1,2,3,6,0,0,0},
+        {4,6,0,0,0,0,0,0}, {0,4,6,0,0,0,0,0}, {1,4,6,0,0,0,0,0}, {0,1,4,6,0,0,0,0},
+        {2,4,6,0,0,0,0,0}, {0,2,4,6,0,0,0,0}, {1,2,4,6,0,0,0,0}, {0,1,2,4,6,0,0,0},
+        {3,4,6,0,0,0,0,0}, {0,3,4,6,0,0,0,0}, {1,3,4,6,0,0,0,0}, {0,1,3,4,6,0,0,0},
+        {2,3,4,6,0,0,0,0}, {0,2,3,4,6,0,0,0}, {1,2,3,4,6,0,0,0}, {0,1,2,3,4,6,0,0},
+        {5,6,0,0,0,0,0,0}, {0,5,6,0,0,0,0,0}, {1,5,6,0,0,0,0,0}, {0,1,5,6,0,0,0,0},
+        {2,5,6,0,0,0,0,0}, {0,2,5,6,0,0,0,0}, {1,2,5,6,0,0,0,0}, {0,1,2,5,6,0,0,0},
+        {3,5,6,0,0,0,0,0}, {0,3,5,6,0,0,0,0}, {1,3,5,6,0,0,0,0}, {0,1,3,5,6,0,0,0},
+        {2,3,5,6,0,0,0,0}, {0,2,3,5,6,0,0,0}, {1,2,3,5,6,0,0,0}, {0,1,2,3,5,6,0,0},
+        {4,5,6,0,0,0,0,0}, {0,4,5,6,0,0,0,0}, {1,4,5,6,0,0,0,0}, {0,1,4,5,6,0,0,0},
+        {2,4,5,6,0,0,0,0}, {0,2,4,5,6,0,0,0}, {1,2,4,5,6,0,0,0}, {0,1,2,4,5,6,0,0},
+        {3,4,5,6,0,0,0,0}, {0,3,4,5,6,0,0,0}, {1,3,4,5,6,0,0,0}, {0,1,3,4,5,6,0,0},
+        {2,3,4,5,6,0,0,0}, {0,2,3,4,5,6,0,0}, {1,2,3,4,5,6,0,0}, {0,1,2,3,4,5,6,0},
+        {7,0,0,0,0,0,0,0}, {0,7,0,0,0,0,0,0}, {1,7,0,0,0,0,0,0}, {0,1,7,0,0,0,0,0},
+        {2,7,0,0,0,0,0,0}, {0,2,7,0,0,0,0,0}, {1,2,7,0,0,0,0,0}, {0,1,2,7,0,0,0,0},
+        {3,7,0,0,0,0,0,0}, {0,3,7,0,0,0,0,0}, {1,3,7,0,0,0,0,0}, {0,1,3,7,0,0,0,0},
+        {2,3,7,0,0,0,0,0}, {0,2,3,7,0,0,0,0}, {1,2,3,7,0,0,0,0}, {0,1,2,3,7,0,0,0},
+        {4,7,0,0,0,0,0,0}, {0,4,7,0,0,0,0,0}, {1,4,7,0,0,0,0,0}, {0,1,4,7,0,0,0,0},
+        {2,4,7,0,0,0,0,0}, {0,2,4,7,0,0,0,0}, {1,2,4,7,0,0,0,0}, {0,1,2,4,7,0,0,0},
+        {3,4,7,0,0,0,0,0}, {0,3,4,7,0,0,0,0}, {1,3,4,7,0,0,0,0}, {0,1,3,4,7,0,0,0},
+        {2,3,4,7,0,0,0,0}, {0,2,3,4,7,0,0,0}, {1,2,3,4,7,0,0,0}, {0,1,2,3,4,7,0,0},
+        {5,7,0,0,0,0,0,0}, {0,5,7,0,0,0,0,0}, {1,5,7,0,0,0,0,0}, {0,1,5,7,0,0,0,0},
+        {2,5,7,0,0,0,0,0}, {0,2,5,7,0,0,0,0}, {1,2,5,7,0,0,0,0}, {0,1,2,5,7,0,0,0},
+        {3,5,7,0,0,0,0,0}, {0,3,5,7,0,0,0,0}, {1,3,5,7,0,0,0,0}, {0,1,3,5,7,0,0,0},
+        {2,3,5,7,0,0,0,0}, {0,2,3,5,7,0,0,0}, {1,2,3,5,7,0,0,0}, {0,1,2,3,5,7,0,0},
+        {4,5,7,0,0,0,0,0}, {0,4,5,7,0,0,0,0}, {1,4,5,7,0,0,0,0}, {0,1,4,5,7,0,0,0},
+        {2,4,5,7,0,0,0,0}, {0,2,4,5,7,0,0,0}, {1,2,4,5,7,0,0,0}, {0,1,2,4,5,7,0,0},
+        {3,4,5,7,0,0,0,0}, {0,3,4,5,7,0,0,0}, {1,3,4,5,7,0,0,0}, {0,1,3,4,5,7,0,0},
+        {2,3,4,5,7,0,0,0}, {0,2,3,4,5,7,0,0}, {1,2,3,4,5,7,0,0}, {0,1,2,3,4,5,7,0},
+        {6,7,0,0,0,0,0,0}, {0,6,7,0,0,0,0,0}, {1,6,7,0,0,0,0,0}, {0,1,6,7,0,0,0,0},
+        {2,6,7,0,0,0,0,0}, {0,2,6,7,0,0,0,0}, {1,2,6,7,0,0,0,0}, {0,1,2,6,7,0,0,0},
+        {3,6,7,0,0,0,0,0}, {0,3,6,7,0,0,0,0}, {1,3,6,7,0,0,0,0}, {0,1,3,6,7,0,0,0},
+        {2,3,6,7,0,0,0,0}, {0,2,3,6,7,0,0,0}, {1,2,3,6,7,0,0,0}, {0,1,2,3,6,7,0,0},
+        {4,6,7,0,0,0,0,0}, {0,4,6,7,0,0,0,0}, {1,4,6,7,0,0,0,0}, {0,1,4,6,7,0,0,0},
+        {2,4,6,7,0,0,0,0}, {0,2,4,6,7,0,0,0}, {1,2,4,6,7,0,0,0}, {0,1,2,4,6,7,0,0},
+        {3,4,6,7,0,0,0,0}, {0,3,4,6,7,0,0,0}, {1,3,4,6,7,0,0,0}, {0,1,3,4,6,7,0,0},
+        {2,3,4,6,7,0,0,0}, {0,2,3,4,6,7,0,0}, {1,2,3,4,6,7,0,0}, {0,1,2,3,4,6,7,0},
+        {5,6,7,0,0,0,0,0}, {0,5,6,7,0,0,0,0}, {1,5,6,7,0,0,0,0}, {0,1,5,6,7,0,0,0},
+        {2,5,6,7,0,0,0,0}, {0,2,5,6,7,0,0,0}, {1,2,5,6,7,0,0,0}, {0,1,2,5,6,7,0,0},
+        {3,5,6,7,0,0,0,0}, {0,3,5,6,7,0,0,0}, {1,3,5,6,7,0,0,0}, {0,1,3,5,6,7,0,0},
+        {2,3,5,6,7,0,0,0}, {0,2,3,5,6,7,0,0}, {1,2,3,5,6,7,0,0}, {0,1,2,3,5,6,7,0},
+        {4,5,6,7,0,0,0,0}, {0,4,5,6,7,0,0,0}, {1,4,5,6,7,0,0,0}, {0,1,4,5,6,7,0,0},
+        {2,4,5,6,7,0,0,0}, {0,2,4,5,6,7,0,0}, {1,2,4,5,6,7,0,0}, {0,1,2,4,5,6,7,0},
+        {3,4,5,6,7,0,0,0}, {0,3,4,5,6,7,0,0}, {1,3,4,5,6,7,0,0}, {0,1,3,4,5,6,7,0},
+        {2,3,4,5,6,7,0,0}, {0,2,3,4,5,6,7,0}, {1,2,3,4,5,6,7,0}, {0,1,2,3,4,5,6,7}
+    };
+    // entry i of row m is the number of bits set in m below bit i, if bit i is set (else 0)
+    alignas(64) const unsigned char ExpandIndexes[256][8] = {
+        {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0}, {0,1,0,0,0,0,0,0},
+        {0,0,0,0,0,0,0,0}, {0,0,1,0,0,0,0,0}, {0,0,1,0,0,0,0,0}, {0,1,2,0,0,0,0,0},
+        {0,0,0,0,0,0,0,0}, {0,0,0,1,0,0,0,0}, {0,0,0,1,0,0,0,0}, {0,1,0,2,0,0,0,0},
+        {0,0,0,1,0,0,0,0}, {0,0,1,2,0,0,0,0}, {0,0,1,2,0,0,0,0}, {0,1,2,3,0,0,0,0},
+        {0,0,0,0,0,0,0,0}, {0,0,0,0,1,0,0,0}, {0,0,0,0,1,0,0,0}, {0,1,0,0,2,0,0,0},
+        {0,0,0,0,1,0,0,0}, {0,0,1,0,2,0,0,0}, {0,0,1,0,2,0,0,0}, {0,1,2,0,3,0,0,0},
+        {0,0,0,0,1,0,0,0}, {0,0,0,1,2,0,0,0}, {0,0,0,1,2,0,0,0}, {0,1,0,2,3,0,0,0},
+        {0,0,0,1,2,0,0,0}, {0,0,1,2,3,0,0,0}, {0,0,1,2,3,0,0,0}, {0,1,2,3,4,0,0,0},
+        {0,0,0,0,0,0,0,0}, {0,0,0,0,0,1,0,0}, {0,0,0,0,0,1,0,0}, {0,1,0,0,0,2,0,0},
+        {0,0,0,0,0,1,0,0}, {0,0,1,0,0,2,0,0}, {0,0,1,0,0,2,0,0}, {0,1,2,0,0,3,0,0},
+        {0,0,0,0,0,1,0,0}, {0,0,0,1,0,2,0,0}, {0,0,0,1,0,2,0,0}, {0,1,0,2,0,3,0,0},
+        {0,0,0,1,0,2,0,0}, {0,0,1,2,0,3,0,0}, {0,0,1,2,0,3,0,0}, {0,1,2,3,0,4,0,0},
+        {0,0,0,0,0,1,0,0}, {0,0,0,0,1,2,0,0}, {0,0,0,0,1,2,0,0}, {0,1,0,0,2,3,0,0},
+        {0,0,0,0,1,2,0,0}, {0,0,1,0,2,3,0,0}, {0,0,1,0,2,3,0,0}, {0,1,2,0,3,4,0,0},
+        {0,0,0,0,1,2,0,0}, {0,0,0,1,2,3,0,0}, {0,0,0,1,2,3,0,0}, {0,1,0,2,3,4,0,0},
+        {0,0,0,1,2,3,0,0}, {0,0,1,2,3,4,0,0}, {0,0,1,2,3,4,0,0}, {0,1,2,3,4,5,0,0},
+        {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,1,0}, {0,0,0,0,0,0,1,0}, {0,1,0,0,0,0,2,0},
+        {0,0,0,0,0,0,1,0}, {0,0,1,0,0,0,2,0}, {0,0,1,0,0,0,2,0}, {0,1,2,0,0,0,3,0},
+        {0,0,0,0,0,0,1,0}, {0,0,0,1,0,0,2,0}, {0,0,0,1,0,0,2,0}, {0,1,0,2,0,0,3,0},
+        {0,0,0,1,0,0,2,0}, {0,0,1,2,0,0,3,0}, {0,0,1,2,0,0,3,0}, {0,1,2,3,0,0,4,0},
+        {0,0,0,0,0,0,1,0}, {0,0,0,0,1,0,2,0}, {0,0,0,0,1,0,2,0}, {0,1,0,0,2,0,3,0},
+        {0,0,0,0,1,0,2,0}, {0,0,1,0,2,0,3,0}, {0,0,1,0,2,0,3,0}, {0,1,2,0,3,0,4,0},
+        {0,0,0,0,1,0,2,0}, {0,0,0,1,2,0,3,0}, {0,0,0,1,2,0,3,0}, {0,1,0,2,3,0,4,0},
+        {0,0,0,1,2,0,3,0}, {0,0,1,2,3,0,4,0}, {0,0,1,2,3,0,4,0}, {0,1,2,3,4,0,5,0},
+        {0,0,0,0,0,0,1,0}, {0,0,0,0,0,1,2,0}, {0,0,0,0,0,1,2,0}, {0,1,0,0,0,2,3,0},
+        {0,0,0,0,0,1,2,0}, {0,0,1,0,0,2,3,0}, {0,0,1,0,0,2,3,0}, {0,1,2,0,0,3,4,0},
+        {0,0,0,0,0,1,2,0}, {0,0,0,1,0,2,3,0}, {0,0,0,1,0,2,3,0}, {0,1,0,2,0,3,4,0},
+        {0,0,0,1,0,2,3,0}, {0,0,1,2,0,3,4,0}, {0,0,1,2,0,3,4,0}, {0,1,2,3,0,4,5,0},
+        {0,0,0,0,0,1,2,0}, {0,0,0,0,1,2,3,0}, {0,0,0,0,1,2,3,0}, {0,1,0,0,2,3,4,0},
+        {0,0,0,0,1,2,3,0}, {0,0,1,0,2,3,4,0}, {0,0,1,0,2,3,4,0}, {0,1,2,0,3,4,5,0},
+        {0,0,0,0,1,2,3,0}, {0,0,0,1,2,3,4,0}, {0,0,0,1,2,3,4,0}, {0,1,0,2,3,4,5,0},
+        {0,0,0,1,2,3,4,0}, {0,0,1,2,3,4,5,0}, {0,0,1,2,3,4,5,0}, {0,1,2,3,4,5,6,0},
+        {0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,1}, {0,0,0,0,0,0,0,1}, {0,1,0,0,0,0,0,2},
+        {0,0,0,0,0,0,0,1}, {0,0,1,0,0,0,0,2}, {0,0,1,0,0,0,0,2}, {0,1,2,0,0,0,0,3},
+        {0,0,0,0,0,0,0,1}, {0,0,0,1,0,0,0,2}, {0,0,0,1,0,0,0,2}, {0,1,0,2,0,0,0,3},
+        {0,0,0,1,0,0,0,2}, {0,0,1,2,0,0,0,3}, {0,0,1,2,0,0,0,3}, {0,1,2,3,0,0,0,4},
+        {0,0,0,0,0,0,0,1}, {0,0,0,0,1,0,0,2}, {0,0,0,0,1,0,0,2}, {0,1,0,0,2,0,0,3},
+        {0,0,0,0,1,0,0,2}, {0,0,1,0,2,0,0,3}, {0,0,1,0,2,0,0,3}, {0,1,2,0,3,0,0,4},
+        {0,0,0,0,1,0,0,2}, {0,0,0,1,2,0,0,3}, {0,0,0,1,2,0,0,3}, {0,1,0,2,3,0,0,4},
+        {0,0,0,1,2,0,0,3}, {0,0,1,2,3,0,0,4}, {0,0,1,2,3,0,0,4}, {0,1,2,3,4,0,0,5},
+        {0,0,0,0,0,0,0,1}, {0,0,0,0,0,1,0,2}, {0,0,0,0,0,1,0,2}, {0,1,0,0,0,2,0,3},
+        {0,0,0,0,0,1,0,2}, {0,0,1,0,0,2,0,3}, {0,0,1,0,0,2,0,3}, {0,1,2,0,0,3,0,4},
+        {0,0,0,0,0,1,0,2}, {0,0,0,1,0,2,0,3}, {0,0,0,1,0,2,0,3}, {0,1,0,2,0,3,0,4},
+        {0,0,0,1,0,2,0,3}, {0,0,1,2,0,3,0,4}, {0,0,1,2,0,3,0,4}, {0,1,2,3,0,4,0,5},
+        {0,0,0,0,0,1,0,2}, {0,0,0,0,1,2,0,3}, {0,0,0,0,1,2,0,3}, {0,1,0,0,2,3,0,4},
+        {0,0,0,0,1,2,0,3}, {0,0,1,0,2,3,0,4}, {0,0,1,0,2,3,0,4}, {0,1,2,0,3,4,0,5},
+        {0,0,0,0,1,2,0,3}, {0,0,0,1,2,3,0,4}, {0,0,0,1,2,3,0,4}, {0,1,0,2,3,4,0,5},
+        {0,0,0,1,2,3,0,4}, {0,0,1,2,3,4,0,5}, {0,0,1,2,3,4,0,5}, {0,1,2,3,4,5,0,6},
+        {0,0,0,0,0,0,0,1}, {0,0,0,0,0,0,1,2}, {0,0,0,0,0,0,1,2}, {0,1,0,0,0,0,2,3},
+        {0,0,0,0,0,0,1,2}, {0,0,1,0,0,0,2,3}, {0,0,1,0,0,0,2,3}, {0,1,2,0,0,0,3,4},
+        {0,0,0,0,0,0,1,2}, {0,0,0,1,0,0,2,3}, {0,0,0,1,0,0,2,3}, {0,1,0,2,0,0,3,4},
+        {0,0,0,1,0,0,2,3}, {0,0,1,2,0,0,3,4}, {0,0,1,2,0,0,3,4}, {0,1,2,3,0,0,4,5},
+        {0,0,0,0,0,0,1,2}, {0,0,0,0,1,0,2,3}, {0,0,0,0,1,0,2,3}, {0,1,0,0,2,0,3,4},
+        {0,0,0,0,1,0,2,3}, {0,0,1,0,2,0,3,4}, {0,0,1,0,2,0,3,4}, {0,1,2,0,3,0,4,5},
+        {0,0,0,0,1,0,2,3}, {0,0,0,1,2,0,3,4}, {0,0,0,1,2,0,3,4}, {0,1,0,2,3,0,4,5},
+        {0,0,0,1,2,0,3,4}, {0,0,1,2,3,0,4,5}, {0,0,1,2,3,0,4,5}, {0,1,2,3,4,0,5,6},
+        {0,0,0,0,0,0,1,2}, {0,0,0,0,0,1,2,3}, {0,0,0,0,0,1,2,3}, {0,1,0,0,0,2,3,4},
+        {0,0,0,0,0,1,2,3}, {0,0,1,0,0,2,3,4}, {0,0,1,0,0,2,3,4}, {0,1,2,0,0,3,4,5},
+        {0,0,0,0,0,1,2,3}, {0,0,0,1,0,2,3,4}, {0,0,0,1,0,2,3,4}, {0,1,0,2,0,3,4,5},
+        {0,0,0,1,0,2,3,4}, {0,0,1,2,0,3,4,5}, {0,0,1,2,0,3,4,5}, {0,1,2,3,0,4,5,6},
+        {0,0,0,0,0,1,2,3}, {0,0,0,0,1,2,3,4}, {0,0,0,0,1,2,3,4}, {0,1,0,0,2,3,4,5},
+        {0,0,0,0,1,2,3,4}, {0,0,1,0,2,3,4,5}, {0,0,1,0,2,3,4,5}, {0,1,2,0,3,4,5,6},
+        {0,0,0,0,1,2,3,4}, {0,0,0,1,2,3,4,5}, {0,0,0,1,2,3,4,5}, {0,1,0,2,3,4,5,6},
+        {0,0,0,1,2,3,4,5}, {0,0,1,2,3,4,5,6}, {0,0,1,2,3,4,5,6}, {0,1,2,3,4,5,6,7}
+    };
+
     const char LIBRARY_VERSION[] = Vc_VERSION_STRING;
     const unsigned int LIBRARY_VERSION_NUMBER = Vc_VERSION_NUMBER;
     const unsigned int LIBRARY_ABI_VERSION = Vc_LIBRARY_ABI_VERSION;
@@ -304,6 +482,7 @@ namespace SSE
 
     // cacheline 2
     alignas(16) extern const unsigned int   _IndexesFromZero4[4] = { 0, 1, 2, 3 };
+    alignas(16) extern const unsigned long long _IndexesFromZero2[2] = { 0, 1 };
     alignas(16) const unsigned short c_general::one16[8] = { 1, 1, 1, 1, 1, 1, 1, 1 };
     alignas(16) const unsigned int c_general::one32[4] = { 1, 1, 1, 1 };
     alignas(16) const float c_general::oneFloat[4] = { 1.f, 1.f, 1.f, 1.f };
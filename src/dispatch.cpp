@@ -0,0 +1,96 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include <Vc/global.h>
+#include <Vc/support.h>
+#include "common/dispatch.h"
+
+#if defined(Vc_GCC) && Vc_GCC >= 0x40400
+#define Vc_TARGET_NO_SIMD __attribute__((target("no-sse2,no-avx")))
+#else
+#define Vc_TARGET_NO_SIMD
+#endif
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+namespace
+{
+Vc_TARGET_NO_SIMD
+int countBits(unsigned int x)
+{
+    int n = 0;
+    for (; x; x &= x - 1) {
+        ++n;
+    }
+    return n;
+}
+}  // unnamed namespace
+
+Vc_TARGET_NO_SIMD
+bool addKernel(KernelTable &table, unsigned int features, KernelTable::FunctionPointer function)
+{
+    if (table.count >= KernelTable::MaxEntries) {
+        return false;
+    }
+    table.entries[table.count].features = features;
+    table.entries[table.count].function = function;
+    ++table.count;
+    return true;
+}
+
+Vc_TARGET_NO_SIMD
+KernelTable::FunctionPointer selectKernel(const KernelTable &table)
+{
+    const unsigned int extra = extraInstructionsSupported();
+    KernelTable::FunctionPointer best = nullptr;
+    unsigned int bestImpl = 0;
+    int bestExtraCount = 0;
+    for (int i = 0; i < table.count; ++i) {
+        const unsigned int impl = table.entries[i].features & ImplementationMask;
+        const unsigned int required = table.entries[i].features & ExtraInstructionsMask;
+        if (!isImplementationSupported(static_cast<Implementation>(impl)) ||
+            (required & extra) != required) {
+            continue;
+        }
+        const int extraCount = countBits(required);
+        if (best == nullptr || impl > bestImpl ||
+            (impl == bestImpl && extraCount > bestExtraCount)) {
+            best = table.entries[i].function;
+            bestImpl = impl;
+            bestExtraCount = extraCount;
+        }
+    }
+    return best;
+}
+}  // namespace Common
+}  // namespace Vc
+
+#undef Vc_TARGET_NO_SIMD
+
+// vim: sw=4 sts=4 et tw=100
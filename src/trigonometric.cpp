@@ -141,6 +141,205 @@ static Vc_ALWAYS_INLINE double_v_for<Abi> foldInput(double_v_for<Abi> x,
         // requires more bits than there are zero bits at the end of _pi_4_hi (30 bits -> 1e9)
         return ((x - y * C::_pi_4_hi()) - y * C::_pi_4_rem1()) - y * C::_pi_4_rem2();
     }
+
+template <typename Abi>
+static Vc_ALWAYS_INLINE Vector<float, Abi> erfPoly(const Vector<float, Abi> &x2)
+{
+    // erf(x) / x as a polynomial in x² for |x| ≤ 1 (Chebyshev interpolant)
+    return (((((-5.648059886880219e-4f  * x2
+              + 4.921761807054281e-3f) * x2
+              - 2.6715055108070374e-2f) * x2
+              + 1.1280316859483719e-1f) * x2
+              - 3.7612342834472656e-1f) * x2
+              + 1.1283791065216064e0f);
+}
+template <typename Abi>
+static Vc_ALWAYS_INLINE Vector<double, Abi> erfPoly(const Vector<double, Abi> &x2)
+{
+    return (((((((((((-7.795898827002142e-10  * x2
+                    + 1.3720064546777686e-8 ) * x2
+                    - 1.6208483801871705e-7 ) * x2
+                    + 1.6447424703317362e-6 ) * x2
+                    - 1.492473690741966e-5  ) * x2
+                    + 1.2055294904839707e-4 ) * x2
+                    - 8.548325975389692e-4  ) * x2
+                    + 5.2239776071164225e-3 ) * x2
+                    - 2.686617064323777e-2  ) * x2
+                    + 1.1283791670945006e-1 ) * x2
+                    - 3.7612638903183543e-1 ) * x2
+                    + 1.1283791670955126e0  );
+}
+
+// Chebyshev coefficients of P(t) = ln(erfc(x) / t) + x² with t = 2 / (2 + x), for x ≥ ½,
+// i.e. t ∈ [0, 0.8]
+constexpr float erfcCoeffFloat[] = {
+    -7.831870913505554e-1f, 5.058947801589966e-1f,   2.0165331661701202e-2f,
+    -4.150784108787775e-3f, -6.929393275640905e-4f,  8.061307016760111e-5f,
+    2.5850926249404438e-5f, -2.4536393539165147e-6f, -1.0645995871527703e-6f,
+    1.1586644887984221e-7f};
+constexpr double erfcCoeffDouble[] = {
+    -7.8318707272406e-1,     5.058947933173407e-1,    2.0165332295700413e-2,
+    -4.150784270483714e-3,   -6.929393033131829e-4,   8.061304448090166e-5,
+    2.5850999510766174e-5,   -2.4532413619366538e-6,  -1.0665628949056516e-6,
+    1.0956136201272647e-7,   4.618283721422925e-8,    -6.305089137369667e-9,
+    -1.9633309872353595e-9,  3.9793711163649415e-10,  7.359712081538185e-11,
+    -2.4619582503765762e-11, -1.7696477486412257e-12, 1.3810080807319007e-12,
+    -4.6002065943993684e-14, -6.38048381963249e-14,   9.937707476237303e-15,
+    1.856965007826927e-15,   -7.706664034702891e-16,  3.106081841473968e-17,
+    3.460258399259602e-17};
+
+// Clenshaw summation of Σ c[k] · T_k(u), with T_k the Chebyshev polynomials
+template <typename V, std::size_t N>
+static Vc_ALWAYS_INLINE V chebyshevSeries(const typename V::EntryType (&c)[N], const V &u)
+{
+    const V u2 = u + u;
+    V b1 = V::Zero();
+    V b2 = V::Zero();
+    for (std::size_t k = N - 1; k > 0; --k) {
+        const V b = (u2 * b1 - b2) + c[k];
+        b2 = b1;
+        b1 = b;
+    }
+    return (u * b1 - b2) + c[0];
+}
+template <typename Abi>
+static Vc_ALWAYS_INLINE Vector<float, Abi> erfcSeries(const Vector<float, Abi> &u)
+{
+    return chebyshevSeries(erfcCoeffFloat, u);
+}
+template <typename Abi>
+static Vc_ALWAYS_INLINE Vector<double, Abi> erfcSeries(const Vector<double, Abi> &u)
+{
+    return chebyshevSeries(erfcCoeffDouble, u);
+}
+
+// erfc(a) for a ≥ ½
+template <typename V> static Vc_ALWAYS_INLINE V erfcLarge(V a)
+{
+    typedef typename V::EntryType T;
+    // the result underflows to 0 beyond these values anyway; this keeps a² finite
+    a = min(a, V(std::is_same<T, float>::value ? T(11) : T(28)));
+
+    // erfc(a) = t · e^(P(t) - a²)
+    const V t = T(2) / (T(2) + a);
+    const V p = erfcSeries(t * T(2.5) - T(1));
+
+    // a² = hi + lo exactly, since the rounding error of a² would be amplified by a² in
+    // e^-a². t · e^(P - lo) < 1, thus e^-hi is normal whenever the result is.
+    const V hi = a * a;
+    const V lo = fma(a, a, -hi);
+    return (t * exp(p - lo)) * exp(-hi);
+}
+
+template <typename V> static Vc_ALWAYS_INLINE V erfImpl(const V &x)
+{
+    const V a = abs(x);
+    V r = x * erfPoly(x * x);
+    const auto large = a > V::One();
+    if (any_of(large)) {
+        r(large) = copysign(V::One() - erfcLarge(a), x);
+        r(isnan(x)) = x;
+    }
+    return r;
+}
+
+template <typename V> static Vc_ALWAYS_INLINE V erfcImpl(const V &x)
+{
+    typedef typename V::EntryType T;
+    const V a = abs(x);
+    V r = erfcLarge(a);
+    r(x < V::Zero()) = T(2) - r;
+    const auto small = a < T(0.5);
+    if (any_of(small)) {
+        r(small) = V::One() - x * erfPoly(x * x);
+    }
+    r(isnan(x)) = x;
+    return r;
+}
+
+template <typename V> static Vc_ALWAYS_INLINE V tanImpl(const V &_x)
+{
+    typedef typename V::Mask M;
+    using IV = best_int_v_for<V>;
+
+    IV quadrant;
+    const V z = foldInput(_x, quadrant);
+    const V s = sinSeries(z);
+    const V c = cosSeries(z);
+
+    // tan has a period of π: the quadrants 0 and 4 map to tan(z), 2 and 6 map to -cot(z)
+    V y = s / c;
+    y(simd_cast<M>((quadrant & 2) != IV::Zero())) = -c / s;
+    y(isnegative(_x)) = -y;
+    return y;
+}
+
+template <typename V, typename F>
+static Vc_ALWAYS_INLINE V acosImpl(const V &x, const F &asin)
+{
+    typedef Const<typename V::EntryType, typename V::abi> C;
+
+    // acos(x) = π/2 - asin(x) for |x| ≤ ½. Otherwise this loses precision, and
+    // acos(|x|) = 2 asin(√((1 - |x|) / 2)) together with acos(-x) = π - acos(x) is used.
+    const V a = abs(x);
+    const auto large = a > C::_1_2();
+    V z = x;
+    z(large) = sqrt((V::One() - a) * C::_1_2());
+    const V s = asin(z);
+    const V pi_2_minus_s = (C::_pi_2() - s) + C::_pi_2_rem();
+
+    V r = pi_2_minus_s;
+    r(large) = s + s;
+    r(large && x < V::Zero()) = pi_2_minus_s + pi_2_minus_s;
+    return r;
+}
+
+// for |x| above this threshold e^|x| may overflow even though sinh(x) and cosh(x) do not
+template <typename T> static Vc_ALWAYS_INLINE T expOverflowThreshold()
+{
+    typedef Vc::Detail::ExpConstants<T> C;
+    return T(C::maxExponent() - 2) * C::ln2();
+}
+
+template <typename V> static Vc_ALWAYS_INLINE V sinhImpl(const V &x)
+{
+    typedef typename V::EntryType T;
+    const V a = abs(x);
+    // with u = e^|x| - 1: sinh(|x|) = (u + u / (u + 1)) / 2, which does not cancel for small x
+    const V u = expm1(a);
+    V r = (u + u / (u + V::One())) * T(0.5);
+    const auto large = a > expOverflowThreshold<T>();
+    if (any_of(large)) {
+        const V w = exp(a * T(0.5));
+        r(large) = (w * T(0.5)) * w;
+        r(isnan(x)) = x;
+    }
+    return copysign(r, x);
+}
+
+template <typename V> static Vc_ALWAYS_INLINE V coshImpl(const V &x)
+{
+    typedef typename V::EntryType T;
+    const V a = abs(x);
+    const V t = exp(a);
+    V r = t * T(0.5) + T(0.5) / t;
+    const auto large = a > expOverflowThreshold<T>();
+    if (any_of(large)) {
+        const V w = exp(a * T(0.5));
+        r(large) = (w * T(0.5)) * w;
+    }
+    r(isnan(x)) = x;
+    return r;
+}
+
+template <typename V> static Vc_ALWAYS_INLINE V tanhImpl(const V &x)
+{
+    typedef typename V::EntryType T;
+    // with u = e^(-2|x|) - 1 ∈ ]-1, 0]: tanh(|x|) = -u / (u + 2), which neither cancels
+    // nor overflows
+    const V u = expm1(abs(x) * T(-2));
+    return copysign(-u / (u + T(2)), x);
+}
 } // anonymous namespace
 
 /*
@@ -498,6 +697,49 @@ template<> template<> Vc::double_v Trigonometric<Vc::Detail::TrigonometricImplem
     return a;
 }
 
+/*
+ * tan, the hyperbolic functions, and erf/erfc are written once for float_v and double_v
+ * (see the *Impl functions above).
+ */
+#define Vc_TRIGONOMETRIC_IMPL(name_)                                                     \
+    template <>                                                                          \
+    template <>                                                                          \
+    Vc::float_v Trigonometric<Vc::Detail::TrigonometricImplementation<                   \
+        Vc::CurrentImplementation::current()>>::name_(const Vc::float_v &x)              \
+    {                                                                                    \
+        return name_##Impl(x);                                                           \
+    }                                                                                    \
+    template <>                                                                          \
+    template <>                                                                          \
+    Vc::double_v Trigonometric<Vc::Detail::TrigonometricImplementation<                  \
+        Vc::CurrentImplementation::current()>>::name_(const Vc::double_v &x)             \
+    {                                                                                    \
+        return name_##Impl(x);                                                           \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+Vc_TRIGONOMETRIC_IMPL(tan);
+Vc_TRIGONOMETRIC_IMPL(sinh);
+Vc_TRIGONOMETRIC_IMPL(cosh);
+Vc_TRIGONOMETRIC_IMPL(tanh);
+Vc_TRIGONOMETRIC_IMPL(erf);
+Vc_TRIGONOMETRIC_IMPL(erfc);
+#undef Vc_TRIGONOMETRIC_IMPL
+
+template <>
+template <>
+Vc::float_v Trigonometric<Vc::Detail::TrigonometricImplementation<
+    Vc::CurrentImplementation::current()>>::acos(const Vc::float_v &x)
+{
+    return acosImpl(x, [](const Vc::float_v &z) { return asin(z); });
+}
+template <>
+template <>
+Vc::double_v Trigonometric<Vc::Detail::TrigonometricImplementation<
+    Vc::CurrentImplementation::current()>>::acos(const Vc::double_v &x)
+{
+    return acosImpl(x, [](const Vc::double_v &z) { return asin(z); });
+}
+
 }
 }
 
@@ -138,6 +138,109 @@ Vc_INTRINSIC __m128i convert(__m128  v, ConvertTag<float , ushort>) { return con
 Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<short , ushort>) { return v; }
 Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ushort, ushort>) { return v; }
 Vc_INTRINSIC __m128i convert(__m128d v, ConvertTag<double, ushort>) { return convert(convert(v, ConvertTag<double, int>()), ConvertTag<int, ushort>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , short >) { return _mm_srai_epi16(_mm_unpacklo_epi8(v, v), 8); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , short >) { return _mm_unpacklo_epi8(v, _mm_setzero_si128()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , ushort>) { return convert(v, ConvertTag<schar, short>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , ushort>) { return convert(v, ConvertTag<uchar, short>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , int   >) { return convert(convert(v, ConvertTag<schar, short>()), ConvertTag<short, int>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , int   >) { return _mm_unpacklo_epi16(convert(v, ConvertTag<uchar, short>()), _mm_setzero_si128()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , uint  >) { return convert(v, ConvertTag<schar, int>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , uint  >) { return convert(v, ConvertTag<uchar, int>()); }
+Vc_INTRINSIC __m128  convert(__m128i v, ConvertTag<schar , float >) { return _mm_cvtepi32_ps(convert(v, ConvertTag<schar, int>())); }
+Vc_INTRINSIC __m128  convert(__m128i v, ConvertTag<uchar , float >) { return _mm_cvtepi32_ps(convert(v, ConvertTag<uchar, int>())); }
+Vc_INTRINSIC __m128d convert(__m128i v, ConvertTag<schar , double>) { return _mm_cvtepi32_pd(convert(v, ConvertTag<schar, int>())); }
+Vc_INTRINSIC __m128d convert(__m128i v, ConvertTag<uchar , double>) { return _mm_cvtepi32_pd(convert(v, ConvertTag<uchar, int>())); }
+// conversions to 8-bit integers truncate (like the scalar conversion does on all
+// relevant compilers) and zero the remaining entries
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<short , schar >) {
+    return _mm_packus_epi16(_mm_and_si128(v, _mm_srli_epi16(_mm_setallone_si128(), 8)), _mm_setzero_si128());
+}
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<int   , schar >) {
+    return _mm_packus_epi16(_mm_packs_epi32(_mm_and_si128(v, _mm_srli_epi32(_mm_setallone_si128(), 24)), _mm_setzero_si128()), _mm_setzero_si128());
+}
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ushort, schar >) { return convert(v, ConvertTag<short, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uint  , schar >) { return convert(v, ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128  v, ConvertTag<float , schar >) { return convert(_mm_cvttps_epi32(v), ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128d v, ConvertTag<double, schar >) { return convert(_mm_cvttpd_epi32(v), ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , schar >) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , schar >) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<short , uchar >) { return convert(v, ConvertTag<short, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ushort, uchar >) { return convert(v, ConvertTag<short, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<int   , uchar >) { return convert(v, ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uint  , uchar >) { return convert(v, ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128  v, ConvertTag<float , uchar >) { return convert(_mm_cvttps_epi32(v), ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128d v, ConvertTag<double, uchar >) { return convert(_mm_cvttpd_epi32(v), ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , uchar >) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , uchar >) { return v; }
+
+// 64-bit integers: the implementations are shared between long, long long, and their
+// unsigned variants (see Detail::is_int64)
+template <typename From, typename To>
+Vc_INTRINSIC enable_if<(Detail::is_int64<From>::value && Detail::is_int64<To>::value), __m128i>
+convert(__m128i v, ConvertTag<From, To>)
+{
+    return v;
+}
+// to 64-bit: sign or zero extend the two low 32-bit entries
+Vc_INTRINSIC __m128i convert_int_to_int64(__m128i v) {
+#ifdef Vc_IMPL_SSE4_1
+    return _mm_cvtepi32_epi64(v);
+#else
+    return _mm_unpacklo_epi32(v, _mm_srai_epi32(v, 31));
+#endif
+}
+template <typename From, typename To>
+Vc_INTRINSIC enable_if<(!Detail::is_int64<From>::value && std::is_integral<From>::value &&
+                        Detail::is_int64<To>::value),
+                       __m128i>
+convert(__m128i v, ConvertTag<From, To>)
+{
+    return std::is_signed<From>::value
+               ? convert_int_to_int64(convert(v, ConvertTag<From, int>()))
+               : _mm_unpacklo_epi32(convert(v, ConvertTag<From, uint>()), _mm_setzero_si128());
+}
+// double to 64-bit has no SSE instruction; convert the two entries with the scalar
+// conversion (which also defines the out-of-range behavior as on the Scalar target)
+template <typename To>
+Vc_INTRINSIC enable_if<Detail::is_int64<To>::value, __m128i> convert(__m128d v,
+                                                                      ConvertTag<double, To>)
+{
+    using U = typename std::conditional<std::is_signed<To>::value, long long,
+                                        unsigned long long>::type;
+    return _mm_set_epi64x(static_cast<U>(_mm_cvtsd_f64(_mm_unpackhi_pd(v, v))),
+                          static_cast<U>(_mm_cvtsd_f64(v)));
+}
+template <typename To>
+Vc_INTRINSIC enable_if<Detail::is_int64<To>::value, __m128i> convert(__m128 v,
+                                                                      ConvertTag<float, To>)
+{
+    return convert(_mm_cvtps_pd(v), ConvertTag<double, To>());
+}
+// from 64-bit to 32-bit: truncate, i.e. keep the low halves of both entries
+template <typename From, typename To>
+Vc_INTRINSIC enable_if<(Detail::is_int64<From>::value && std::is_integral<To>::value &&
+                        sizeof(To) == 4),
+                       __m128i>
+convert(__m128i v, ConvertTag<From, To>)
+{
+    return _mm_move_epi64(_mm_shuffle_epi32(v, 0x08));
+}
+// 64-bit to double: hi * 2^32 + lo is exact in both terms, thus the sum rounds only once
+template <typename From>
+Vc_INTRINSIC enable_if<Detail::is_int64<From>::value, __m128d> convert(__m128i v,
+                                                                        ConvertTag<From, double>)
+{
+    using Hi = typename std::conditional<std::is_signed<From>::value, int, uint>::type;
+    const __m128d hi = convert(_mm_shuffle_epi32(v, 0x0d), ConvertTag<Hi, double>());
+    const __m128d lo = convert(_mm_shuffle_epi32(v, 0x08), ConvertTag<uint, double>());
+    return _mm_add_pd(_mm_mul_pd(hi, _mm_set1_pd(4294967296.)), lo);
+}
+template <typename From>
+Vc_INTRINSIC enable_if<Detail::is_int64<From>::value, __m128> convert(__m128i v,
+                                                                       ConvertTag<From, float>)
+{
+    return _mm_cvtpd_ps(convert(v, ConvertTag<From, double>()));
+}
 
 // }}}1
 }  // namespace SSE
@@ -36,6 +36,7 @@ namespace Vc_VERSIONED_NAMESPACE
 namespace SSE
 {
 
+alignas(16) extern const unsigned long long _IndexesFromZero2[2];
 alignas(16) extern const unsigned int   _IndexesFromZero4[4];
 alignas(16) extern const unsigned short _IndexesFromZero8[8];
 alignas(16) extern const unsigned char  _IndexesFromZero16[16];
@@ -329,6 +329,11 @@ Vc_INTRINSIC __m128 load(const T *mem, Flags f, LoadTag<__m128, float>)
 {
     return _mm_cvtepi32_ps(load<__m128i, int>(mem, f));
 }
+template <typename Flags>
+Vc_INTRINSIC __m128 load(const half *mem, Flags, LoadTag<__m128, float>)
+{
+    return SSE::cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(mem)));
+}
 
 // shifted{{{1
 template <int amount, typename T>
@@ -350,7 +355,9 @@ Vc_INTRINSIC Vc_CONST enable_if<(sizeof(T) == 16 && amount < 0), T> shifted(T k)
 // IndexesFromZero{{{1
 template <typename T, int Size> Vc_INTRINSIC Vc_CONST const T *IndexesFromZero()
 {
-    if (Size == 4) {
+    if (Size == 2) {
+        return reinterpret_cast<const T *>(SSE::_IndexesFromZero2);
+    } else if (Size == 4) {
         return reinterpret_cast<const T *>(SSE::_IndexesFromZero4);
     } else if (Size == 8) {
         return reinterpret_cast<const T *>(SSE::_IndexesFromZero8);
@@ -425,6 +432,11 @@ template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<2, 8, __m128>(__m128i k)
     return SSE::sse_cast<__m128>(
         _mm_packs_epi16(_mm_packs_epi16(k, _mm_setzero_si128()), _mm_setzero_si128()));
 }
+template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<2, 16, __m128>(__m128i k)
+{
+    return SSE::sse_cast<__m128>(
+        _mm_packs_epi16(SSE::sse_cast<__m128i>(mask_cast<2, 8, __m128>(k)), _mm_setzero_si128()));
+}
 
 template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<4, 2, __m128>(__m128i k)
 {
@@ -434,6 +446,11 @@ template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<4, 8, __m128>(__m128i k)
 {
     return SSE::sse_cast<__m128>(_mm_packs_epi16(k, _mm_setzero_si128()));
 }
+template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<4, 16, __m128>(__m128i k)
+{
+    return SSE::sse_cast<__m128>(
+        _mm_packs_epi16(_mm_packs_epi16(k, _mm_setzero_si128()), _mm_setzero_si128()));
+}
 
 template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<8, 2, __m128>(__m128i k)
 {
@@ -444,6 +461,10 @@ template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<8, 4, __m128>(__m128i k)
 {
     return SSE::sse_cast<__m128>(_mm_unpacklo_epi16(k, k));
 }
+template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<8, 16, __m128>(__m128i k)
+{
+    return SSE::sse_cast<__m128>(_mm_packs_epi16(k, _mm_setzero_si128()));
+}
 
 template<> Vc_INTRINSIC Vc_CONST __m128 mask_cast<16, 8, __m128>(__m128i k)
 {
@@ -481,6 +502,10 @@ Vc_ALWAYS_INLINE Vc_CONST __m128d negate(__m128d v, std::integral_constant<std::
 {
     return _mm_xor_pd(v, SSE::_mm_setsignmask_pd());
 }
+Vc_ALWAYS_INLINE Vc_CONST __m128i negate(__m128i v, std::integral_constant<std::size_t, 8>)
+{
+    return _mm_sub_epi64(_mm_setzero_si128(), v);
+}
 Vc_ALWAYS_INLINE Vc_CONST __m128i negate(__m128i v, std::integral_constant<std::size_t, 4>)
 {
 #ifdef Vc_IMPL_SSSE3
@@ -497,6 +522,14 @@ Vc_ALWAYS_INLINE Vc_CONST __m128i negate(__m128i v, std::integral_constant<std::
     return _mm_sub_epi16(_mm_setzero_si128(), v);
 #endif
 }
+Vc_ALWAYS_INLINE Vc_CONST __m128i negate(__m128i v, std::integral_constant<std::size_t, 1>)
+{
+#ifdef Vc_IMPL_SSSE3
+    return _mm_sign_epi8(v, allone<__m128i>());
+#else
+    return _mm_sub_epi8(_mm_setzero_si128(), v);
+#endif
+}
 
 // xor_{{{1
 Vc_INTRINSIC __m128 xor_(__m128 a, __m128 b) { return _mm_xor_ps(a, b); }
@@ -532,6 +565,8 @@ Vc_INTRINSIC __m128i add(__m128i a, __m128i b,  short) { return _mm_add_epi16(a,
 Vc_INTRINSIC __m128i add(__m128i a, __m128i b, ushort) { return _mm_add_epi16(a, b); }
 Vc_INTRINSIC __m128i add(__m128i a, __m128i b,  schar) { return _mm_add_epi8 (a, b); }
 Vc_INTRINSIC __m128i add(__m128i a, __m128i b,  uchar) { return _mm_add_epi8 (a, b); }
+template <typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, __m128i> add(__m128i a, __m128i b, T) { return _mm_add_epi64(a, b); }
 
 // sub{{{1
 Vc_INTRINSIC __m128  sub(__m128  a, __m128  b,  float) { return _mm_sub_ps(a, b); }
@@ -542,6 +577,8 @@ Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,  short) { return _mm_sub_epi16(a,
 Vc_INTRINSIC __m128i sub(__m128i a, __m128i b, ushort) { return _mm_sub_epi16(a, b); }
 Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,  schar) { return _mm_sub_epi8 (a, b); }
 Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,  uchar) { return _mm_sub_epi8 (a, b); }
+template <typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, __m128i> sub(__m128i a, __m128i b, T) { return _mm_sub_epi64(a, b); }
 
 // mul{{{1
 Vc_INTRINSIC __m128  mul(__m128  a, __m128  b,  float) { return _mm_mul_ps(a, b); }
@@ -568,7 +605,7 @@ Vc_INTRINSIC __m128i mul(__m128i a, __m128i b,  schar) {
     return reinterpret_cast<const __m128i &>(x);
 #else
     return or_(
-        and_(_mm_mullo_epi16(a, b), _mm_slli_epi16(allone<__m128i>(), 8)),
+        and_(_mm_mullo_epi16(a, b), _mm_srli_epi16(allone<__m128i>(), 8)),
         _mm_slli_epi16(_mm_mullo_epi16(_mm_srli_si128(a, 1), _mm_srli_si128(b, 1)), 8));
 #endif
 }
@@ -580,11 +617,36 @@ Vc_INTRINSIC __m128i mul(__m128i a, __m128i b,  uchar) {
     return reinterpret_cast<const __m128i &>(x);
 #else
     return or_(
-        and_(_mm_mullo_epi16(a, b), _mm_slli_epi16(allone<__m128i>(), 8)),
+        and_(_mm_mullo_epi16(a, b), _mm_srli_epi16(allone<__m128i>(), 8)),
         _mm_slli_epi16(_mm_mullo_epi16(_mm_srli_si128(a, 1), _mm_srli_si128(b, 1)), 8));
 #endif
 }
 
+template <typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, __m128i> mul(__m128i a, __m128i b, T) { return SSE::mullo_epi64(a, b); }
+
+// mulhi{{{1
+// the high half of the double-width products (for Vc::divider)
+Vc_INTRINSIC __m128i mulhi(__m128i a, __m128i b,   uint) {
+    const __m128i ab02 = _mm_srli_epi64(_mm_mul_epu32(a, b), 32);
+    const __m128i ab13 = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return SSE::blend_epi16<0xcc>(ab02, ab13);
+}
+Vc_INTRINSIC __m128i mulhi(__m128i a, __m128i b,    int) {
+#ifdef Vc_IMPL_SSE4_1
+    const __m128i ab02 = _mm_srli_epi64(_mm_mul_epi32(a, b), 32);
+    const __m128i ab13 = _mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_blend_epi16(ab02, ab13, 0xcc);
+#else
+    // hi_signed(a, b) = hi_unsigned(a, b) - (a < 0 ? b : 0) - (b < 0 ? a : 0)
+    const __m128i fixup = _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(a, 31), b),
+                                        _mm_and_si128(_mm_srai_epi32(b, 31), a));
+    return _mm_sub_epi32(mulhi(a, b, uint()), fixup);
+#endif
+}
+Vc_INTRINSIC __m128i mulhi(__m128i a, __m128i b,  short) { return _mm_mulhi_epi16(a, b); }
+Vc_INTRINSIC __m128i mulhi(__m128i a, __m128i b, ushort) { return _mm_mulhi_epu16(a, b); }
+
 // div{{{1
 Vc_INTRINSIC __m128  div(__m128  a, __m128  b,  float) { return _mm_div_ps(a, b); }
 Vc_INTRINSIC __m128d div(__m128d a, __m128d b, double) { return _mm_div_pd(a, b); }
@@ -608,6 +670,11 @@ Vc_INTRINSIC __m128i min(__m128i a, __m128i b,  short) { return _mm_min_epi16(a,
 Vc_INTRINSIC __m128i min(__m128i a, __m128i b, ushort) { return SSE::min_epu16(a, b); }
 Vc_INTRINSIC __m128i min(__m128i a, __m128i b,  schar) { return SSE::min_epi8 (a, b); }
 Vc_INTRINSIC __m128i min(__m128i a, __m128i b,  uchar) { return _mm_min_epu8 (a, b); }
+template <typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, __m128i> min(__m128i a, __m128i b, T)
+{
+    return std::is_signed<T>::value ? SSE::min_epi64(a, b) : SSE::min_epu64(a, b);
+}
 
 // max{{{1
 Vc_INTRINSIC __m128  max(__m128  a, __m128  b,  float) { return _mm_max_ps(a, b); }
@@ -618,6 +685,11 @@ Vc_INTRINSIC __m128i max(__m128i a, __m128i b,  short) { return _mm_max_epi16(a,
 Vc_INTRINSIC __m128i max(__m128i a, __m128i b, ushort) { return SSE::max_epu16(a, b); }
 Vc_INTRINSIC __m128i max(__m128i a, __m128i b,  schar) { return SSE::max_epi8 (a, b); }
 Vc_INTRINSIC __m128i max(__m128i a, __m128i b,  uchar) { return _mm_max_epu8 (a, b); }
+template <typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, __m128i> max(__m128i a, __m128i b, T)
+{
+    return std::is_signed<T>::value ? SSE::max_epi64(a, b) : SSE::max_epu64(a, b);
+}
 
 // horizontal add{{{1
 Vc_INTRINSIC  float add(__m128  a,  float) {
@@ -650,6 +722,10 @@ Vc_INTRINSIC  schar add(__m128i a,  schar) {
     return _mm_cvtsi128_si32(a);  // & 0xff is implicit
 }
 Vc_INTRINSIC  uchar add(__m128i a,  uchar) { return add(a, schar()); }
+template <typename T> Vc_INTRINSIC enable_if<is_int64<T>::value, T> add(__m128i a, T)
+{
+    return _mm_cvtsi128_si64(add(a, _mm_unpackhi_epi64(a, a), T()));
+}
 
 // horizontal mul{{{1
 Vc_INTRINSIC  float mul(__m128  a,  float) {
@@ -675,12 +751,15 @@ Vc_INTRINSIC  short mul(__m128i a,  short) {
 }
 Vc_INTRINSIC ushort mul(__m128i a, ushort) { return mul(a, short()); }
 Vc_INTRINSIC  schar mul(__m128i a,  schar) {
-    // convert to two short vectors, multiply them and then do horizontal reduction
-    const __m128i s0 = _mm_srai_epi16(a, 1);
-    const __m128i s1 = Detail::and_(a, _mm_set1_epi32(0x0f0f0f0f));
-    return mul(mul(s0, s1, short()), short());
+    // multiply neighboring bytes as 16-bit words (only the low byte of each word is
+    // relevant) and then do the horizontal reduction on shorts
+    return mul(mul(a, _mm_srli_epi16(a, 8), short()), short());
 }
 Vc_INTRINSIC  uchar mul(__m128i a,  uchar) { return mul(a, schar()); }
+template <typename T> Vc_INTRINSIC enable_if<is_int64<T>::value, T> mul(__m128i a, T)
+{
+    return _mm_cvtsi128_si64(mul(a, _mm_unpackhi_epi64(a, a), T()));
+}
 
 // horizontal min{{{1
 Vc_INTRINSIC  float min(__m128  a,  float) {
@@ -721,11 +800,15 @@ Vc_INTRINSIC  schar min(__m128i a,  schar) {
     return std::min(schar(_mm_cvtsi128_si32(a) >> 8), schar(_mm_cvtsi128_si32(a)));
 }
 Vc_INTRINSIC  uchar min(__m128i a,  uchar) {
-    a = min(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), schar());
+    a = min(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), uchar());
+    a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), uchar());
+    a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), uchar());
     return std::min((_mm_cvtsi128_si32(a) >> 8) & 0xff, _mm_cvtsi128_si32(a) & 0xff);
 }
+template <typename T> Vc_INTRINSIC enable_if<is_int64<T>::value, T> min(__m128i a, T)
+{
+    return _mm_cvtsi128_si64(min(a, _mm_unpackhi_epi64(a, a), T()));
+}
 
 // horizontal max{{{1
 Vc_INTRINSIC  float max(__m128  a,  float) {
@@ -766,11 +849,15 @@ Vc_INTRINSIC  schar max(__m128i a,  schar) {
     return std::max(schar(_mm_cvtsi128_si32(a) >> 8), schar(_mm_cvtsi128_si32(a)));
 }
 Vc_INTRINSIC  uchar max(__m128i a,  uchar) {
-    a = max(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), schar());
+    a = max(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), uchar());
+    a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), uchar());
+    a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), uchar());
     return std::max((_mm_cvtsi128_si32(a) >> 8) & 0xff, _mm_cvtsi128_si32(a) & 0xff);
 }
+template <typename T> Vc_INTRINSIC enable_if<is_int64<T>::value, T> max(__m128i a, T)
+{
+    return _mm_cvtsi128_si64(max(a, _mm_unpackhi_epi64(a, a), T()));
+}
 
 // sorted{{{1
 template <Vc::Implementation, typename T>
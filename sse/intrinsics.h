@@ -107,6 +107,7 @@ namespace SseIntrinsics
     static Vc_INTRINSIC __m128i Vc_CONST cmpgt_epu32(__m128i a, __m128i b) { return _mm_comgt_epu32(a, b); }
     static Vc_INTRINSIC __m128i Vc_CONST cmplt_epu64(__m128i a, __m128i b) { return _mm_comlt_epu64(a, b); }
     static Vc_INTRINSIC __m128i Vc_CONST cmpgt_epu64(__m128i a, __m128i b) { return _mm_comgt_epu64(a, b); }
+    static Vc_INTRINSIC __m128i Vc_CONST cmpgt_epi64(__m128i a, __m128i b) { return _mm_comgt_epi64(a, b); }
 #else
     static Vc_INTRINSIC __m128i Vc_CONST cmplt_epu8(__m128i a, __m128i b)
     {
@@ -680,6 +681,89 @@ namespace SseIntrinsics
         return _mm_stream_load(reinterpret_cast<const int *>(mem));
     }
 
+    // 64-bit integers: SSE has neither min/max nor a multiplication or an arithmetic
+    // right shift for 64-bit lanes (AVX-512VL adds the latter two)
+    Vc_INTRINSIC Vc_CONST __m128i min_epi64(__m128i a, __m128i b) {
+        return blendv_epi8(a, b, cmpgt_epi64(a, b));
+    }
+    Vc_INTRINSIC Vc_CONST __m128i max_epi64(__m128i a, __m128i b) {
+        return blendv_epi8(b, a, cmpgt_epi64(a, b));
+    }
+    Vc_INTRINSIC Vc_CONST __m128i min_epu64(__m128i a, __m128i b) {
+        return blendv_epi8(a, b, cmpgt_epu64(a, b));
+    }
+    Vc_INTRINSIC Vc_CONST __m128i max_epu64(__m128i a, __m128i b) {
+        return blendv_epi8(b, a, cmpgt_epu64(a, b));
+    }
+    Vc_INTRINSIC Vc_CONST __m128i mullo_epi64(__m128i a, __m128i b) {
+#ifdef Vc_IMPL_AVX512
+        return _mm_mullo_epi64(a, b);
+#else
+        // a * b mod 2^64 = lo(a) * lo(b) + ((hi(a) * lo(b) + lo(a) * hi(b)) << 32)
+        const __m128i cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), b),
+                                            _mm_mul_epu32(a, _mm_srli_epi64(b, 32)));
+        return _mm_add_epi64(_mm_mul_epu32(a, b), _mm_slli_epi64(cross, 32));
+#endif
+    }
+    Vc_INTRINSIC Vc_CONST __m128i sra_epi64(__m128i a, int shift) {
+#ifdef Vc_IMPL_AVX512
+        return _mm_sra_epi64(a, _mm_cvtsi32_si128(shift));
+#else
+        // shift logically and fill the vacated bits with the sign; the count of 64 for
+        // shift == 0 makes _mm_sll_epi64 return zero
+        const __m128i sign = _mm_srai_epi32(_mm_shuffle_epi32(a, 0xf5), 31);
+        return _mm_or_si128(_mm_srl_epi64(a, _mm_cvtsi32_si128(shift)),
+                            _mm_sll_epi64(sign, _mm_cvtsi32_si128(64 - shift)));
+#endif
+    }
+
+    // half-precision conversions of the four entries in the low 64 bits; the emulations
+    // follow Detail::half_to_float and Detail::float_to_half (common/half.h)
+    Vc_INTRINSIC Vc_CONST __m128 cvtph_ps(__m128i h) {
+#ifdef Vc_IMPL_F16C
+        return _mm_cvtph_ps(h);
+#else
+        h = _mm_unpacklo_epi16(h, _mm_setzero_si128());
+        const __m128i sign = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16);
+        const __m128i em = _mm_and_si128(h, _mm_set1_epi32(0x7fff));
+        const __m128 f = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(em, 13)),
+                                    _mm_castsi128_ps(_mm_set1_epi32(0x77800000)));
+        const __m128i infnan = _mm_and_si128(_mm_cmpgt_epi32(em, _mm_set1_epi32(0x7bff)),
+                                             _mm_set1_epi32(0x7f800000));
+        return _mm_castsi128_ps(
+            _mm_or_si128(_mm_or_si128(_mm_castps_si128(f), infnan), sign));
+#endif
+    }
+    Vc_INTRINSIC Vc_CONST __m128i cvtps_ph(__m128 x) {
+#ifdef Vc_IMPL_F16C
+        return _mm_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT);
+#else
+        const __m128i bits = _mm_castps_si128(x);
+        const __m128i sign = _mm_and_si128(bits, _mm_set1_epi32(0x80000000u));
+        const __m128i a = _mm_xor_si128(bits, sign);
+        // >= 2^16: overflow, inf, or NaN
+        const __m128i overflow = _mm_cmpgt_epi32(a, _mm_set1_epi32(0x477fffff));
+        const __m128i r_overflow = _mm_or_si128(
+            _mm_set1_epi32(0x7c00),
+            _mm_and_si128(_mm_cmpgt_epi32(a, _mm_set1_epi32(0x7f800000)),
+                          _mm_set1_epi32(0x0200)));
+        // < 2^-14: subnormal half or zero
+        const __m128i subnormal = _mm_cmplt_epi32(a, _mm_set1_epi32(0x38800000));
+        const __m128i r_subnormal = _mm_sub_epi32(
+            _mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(a), _mm_set1_ps(0.5f))),
+            _mm_set1_epi32(0x3f000000));
+        const __m128i odd = _mm_and_si128(_mm_srli_epi32(a, 13), _mm_set1_epi32(1));
+        const __m128i r_normal = _mm_srli_epi32(
+            _mm_add_epi32(_mm_add_epi32(a, _mm_set1_epi32(0xc8000fffu)), odd), 13);
+        __m128i r = blendv_epi8(r_normal, r_subnormal, subnormal);
+        r = blendv_epi8(r, r_overflow, overflow);
+        r = _mm_or_si128(r, _mm_srli_epi32(sign, 16));
+        // sign extend so that the saturating pack keeps all 16 bits
+        r = _mm_srai_epi32(_mm_slli_epi32(r, 16), 16);
+        return _mm_packs_epi32(r, _mm_setzero_si128());
+#endif
+    }
+
 #ifndef __x86_64__
     Vc_INTRINSIC Vc_PURE __m128i _mm_cvtsi64_si128(int64_t x) {
         return _mm_castpd_si128(_mm_load_sd(reinterpret_cast<const double *>(&x)));
@@ -90,7 +90,7 @@ template<> Vc_INTRINSIC Vc_CONST int mask_to_int<16>(__m128i k)
 template <size_t> Vc_ALWAYS_INLINE void mask_store(__m128i k, bool *mem);
 template <> Vc_ALWAYS_INLINE void mask_store<16>(__m128i k, bool *mem)
 {
-    _mm_store_si128(reinterpret_cast<__m128i *>(mem), _mm_and_si128(k, _mm_set1_epi8(1)));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(mem), _mm_and_si128(k, _mm_set1_epi8(1)));
 }
 template <> Vc_ALWAYS_INLINE void mask_store<8>(__m128i k, bool *mem)
 {
@@ -119,7 +119,7 @@ template<size_t> Vc_ALWAYS_INLINE __m128 mask_load(const bool *mem);
 template<> Vc_ALWAYS_INLINE __m128 mask_load<16>(const bool *mem)
 {
     return sse_cast<__m128>(_mm_cmpgt_epi8(
-        _mm_load_si128(reinterpret_cast<const __m128i *>(mem)), _mm_setzero_si128()));
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(mem)), _mm_setzero_si128()));
 }
 template<> Vc_ALWAYS_INLINE __m128 mask_load<8>(const bool *mem)
 {
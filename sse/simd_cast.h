@@ -98,6 +98,32 @@ Vc_SIMD_CAST_1(  uint_v, ushort_v);
 Vc_SIMD_CAST_1( float_v, ushort_v);
 Vc_SIMD_CAST_1(double_v, ushort_v);
 Vc_SIMD_CAST_1( short_v, ushort_v);
+Vc_SIMD_CAST_1( schar_v,    int_v);
+Vc_SIMD_CAST_1( schar_v,   uint_v);
+Vc_SIMD_CAST_1( schar_v,  float_v);
+Vc_SIMD_CAST_1( schar_v, double_v);
+Vc_SIMD_CAST_1( schar_v,  short_v);
+Vc_SIMD_CAST_1( schar_v, ushort_v);
+Vc_SIMD_CAST_1( uchar_v,    int_v);
+Vc_SIMD_CAST_1( uchar_v,   uint_v);
+Vc_SIMD_CAST_1( uchar_v,  float_v);
+Vc_SIMD_CAST_1( uchar_v, double_v);
+Vc_SIMD_CAST_1( uchar_v,  short_v);
+Vc_SIMD_CAST_1( uchar_v, ushort_v);
+Vc_SIMD_CAST_1(   int_v,  schar_v);
+Vc_SIMD_CAST_1(  uint_v,  schar_v);
+Vc_SIMD_CAST_1( float_v,  schar_v);
+Vc_SIMD_CAST_1(double_v,  schar_v);
+Vc_SIMD_CAST_1( short_v,  schar_v);
+Vc_SIMD_CAST_1(ushort_v,  schar_v);
+Vc_SIMD_CAST_1( uchar_v,  schar_v);
+Vc_SIMD_CAST_1(   int_v,  uchar_v);
+Vc_SIMD_CAST_1(  uint_v,  uchar_v);
+Vc_SIMD_CAST_1( float_v,  uchar_v);
+Vc_SIMD_CAST_1(double_v,  uchar_v);
+Vc_SIMD_CAST_1( short_v,  uchar_v);
+Vc_SIMD_CAST_1(ushort_v,  uchar_v);
+Vc_SIMD_CAST_1( schar_v,  uchar_v);
 
 // 2 SSE::Vector to 1 SSE::Vector {{{2
 Vc_SIMD_CAST_2(double_v,    int_v);
@@ -111,6 +137,18 @@ Vc_SIMD_CAST_2(   int_v, ushort_v);
 Vc_SIMD_CAST_2(  uint_v, ushort_v);
 Vc_SIMD_CAST_2( float_v, ushort_v);
 Vc_SIMD_CAST_2(double_v, ushort_v);
+Vc_SIMD_CAST_2(   int_v,  schar_v);
+Vc_SIMD_CAST_2(  uint_v,  schar_v);
+Vc_SIMD_CAST_2( float_v,  schar_v);
+Vc_SIMD_CAST_2(double_v,  schar_v);
+Vc_SIMD_CAST_2( short_v,  schar_v);
+Vc_SIMD_CAST_2(ushort_v,  schar_v);
+Vc_SIMD_CAST_2(   int_v,  uchar_v);
+Vc_SIMD_CAST_2(  uint_v,  uchar_v);
+Vc_SIMD_CAST_2( float_v,  uchar_v);
+Vc_SIMD_CAST_2(double_v,  uchar_v);
+Vc_SIMD_CAST_2( short_v,  uchar_v);
+Vc_SIMD_CAST_2(ushort_v,  uchar_v);
 
 // 3 SSE::Vector to 1 SSE::Vector {{{2
 #define Vc_CAST_(To_)                                                                    \
@@ -118,10 +156,101 @@ Vc_SIMD_CAST_2(double_v, ushort_v);
     Vc_INTRINSIC Vc_CONST enable_if<std::is_same<Return, To_>::value, Return>
 Vc_CAST_(short_v) simd_cast(double_v a, double_v b, double_v c);
 Vc_CAST_(ushort_v) simd_cast(double_v a, double_v b, double_v c);
+Vc_CAST_(schar_v) simd_cast(double_v a, double_v b, double_v c);
+Vc_CAST_(schar_v) simd_cast( float_v a,  float_v b,  float_v c);
+Vc_CAST_(schar_v) simd_cast(   int_v a,    int_v b,    int_v c);
+Vc_CAST_(schar_v) simd_cast(  uint_v a,   uint_v b,   uint_v c);
+Vc_CAST_(uchar_v) simd_cast(double_v a, double_v b, double_v c);
+Vc_CAST_(uchar_v) simd_cast( float_v a,  float_v b,  float_v c);
+Vc_CAST_(uchar_v) simd_cast(   int_v a,    int_v b,    int_v c);
+Vc_CAST_(uchar_v) simd_cast(  uint_v a,   uint_v b,   uint_v c);
 
 // 4 SSE::Vector to 1 SSE::Vector {{{2
 Vc_SIMD_CAST_4(double_v,  short_v);
 Vc_SIMD_CAST_4(double_v, ushort_v);
+Vc_SIMD_CAST_4(   int_v,  schar_v);
+Vc_SIMD_CAST_4(  uint_v,  schar_v);
+Vc_SIMD_CAST_4( float_v,  schar_v);
+Vc_SIMD_CAST_4(double_v,  schar_v);
+Vc_SIMD_CAST_4(   int_v,  uchar_v);
+Vc_SIMD_CAST_4(  uint_v,  uchar_v);
+Vc_SIMD_CAST_4( float_v,  uchar_v);
+Vc_SIMD_CAST_4(double_v,  uchar_v);
+
+// 5-7 SSE::Vector to 1 SSE::Vector {{{2
+Vc_CAST_(schar_v) simd_cast(double_v a, double_v b, double_v c, double_v d, double_v e);
+Vc_CAST_(schar_v) simd_cast(double_v a, double_v b, double_v c, double_v d, double_v e,
+                            double_v f);
+Vc_CAST_(schar_v) simd_cast(double_v a, double_v b, double_v c, double_v d, double_v e,
+                            double_v f, double_v g);
+Vc_CAST_(uchar_v) simd_cast(double_v a, double_v b, double_v c, double_v d, double_v e);
+Vc_CAST_(uchar_v) simd_cast(double_v a, double_v b, double_v c, double_v d, double_v e,
+                            double_v f);
+Vc_CAST_(uchar_v) simd_cast(double_v a, double_v b, double_v c, double_v d, double_v e,
+                            double_v f, double_v g);
+
+// 8 SSE::Vector to 1 SSE::Vector {{{2
+Vc_SIMD_CAST_8(double_v,  schar_v);
+Vc_SIMD_CAST_8(double_v,  uchar_v);
+
+// from/to 64-bit integer vectors {{{2
+// These are shared between long, long long, and their unsigned variants. Casts to the
+// 8- and 16-bit types go through int_v.
+template <typename T> struct is_int64_vector : public std::false_type {};
+template <typename T>
+struct is_int64_vector<Vc::Vector<T, VectorAbi::Sse>> : public Detail::is_int64<T> {};
+
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To simd_cast(
+    SSE::Vector<T> x,
+    enable_if<is_vector<To>::value && !std::is_same<To, SSE::Vector<T>>::value &&
+              (is_int64_vector<To>::value ||
+               (Detail::is_int64<T>::value && sizeof(typename To::EntryType) >= 4))> =
+        nullarg);
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To simd_cast(
+    SSE::Vector<T> x,
+    enable_if<Detail::is_int64<T>::value && is_vector<To>::value &&
+              sizeof(typename To::EntryType) < 4> = nullarg);
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To simd_cast(
+    SSE::Vector<T> x0, SSE::Vector<T> x1,
+    enable_if<Detail::is_int64<T>::value && is_vector<To>::value && (To::Size >= 4)> =
+        nullarg);
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To simd_cast(
+    SSE::Vector<T> x0, SSE::Vector<T> x1, SSE::Vector<T> x2,
+    enable_if<Detail::is_int64<T>::value && is_vector<To>::value && (To::Size >= 8)> =
+        nullarg);
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To simd_cast(
+    SSE::Vector<T> x0, SSE::Vector<T> x1, SSE::Vector<T> x2, SSE::Vector<T> x3,
+    enable_if<Detail::is_int64<T>::value && is_vector<To>::value && (To::Size >= 8)> =
+        nullarg);
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(SSE::Vector<T> x0, SSE::Vector<T> x1, SSE::Vector<T> x2, SSE::Vector<T> x3,
+          SSE::Vector<T> x4,
+          enable_if<Detail::is_int64<T>::value && is_vector<To>::value && (To::Size >= 16)> =
+              nullarg);
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(SSE::Vector<T> x0, SSE::Vector<T> x1, SSE::Vector<T> x2, SSE::Vector<T> x3,
+          SSE::Vector<T> x4, SSE::Vector<T> x5,
+          enable_if<Detail::is_int64<T>::value && is_vector<To>::value && (To::Size >= 16)> =
+              nullarg);
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(SSE::Vector<T> x0, SSE::Vector<T> x1, SSE::Vector<T> x2, SSE::Vector<T> x3,
+          SSE::Vector<T> x4, SSE::Vector<T> x5, SSE::Vector<T> x6,
+          enable_if<Detail::is_int64<T>::value && is_vector<To>::value && (To::Size >= 16)> =
+              nullarg);
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(SSE::Vector<T> x0, SSE::Vector<T> x1, SSE::Vector<T> x2, SSE::Vector<T> x3,
+          SSE::Vector<T> x4, SSE::Vector<T> x5, SSE::Vector<T> x6, SSE::Vector<T> x7,
+          enable_if<Detail::is_int64<T>::value && is_vector<To>::value && (To::Size >= 16)> =
+              nullarg);
 //}}}2
 }  // namespace SSE
 using SSE::simd_cast;
@@ -151,6 +280,10 @@ template <typename Return, typename T>
 Vc_INTRINSIC Vc_CONST Return
 simd_cast(Scalar::Vector<T> x,
           enable_if<std::is_same<Return, SSE::ushort_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x,
+          enable_if<SSE::is_int64_vector<Return>::value> = nullarg);
 
 // 2 Scalar::Vector to 1 SSE::Vector {{{2
 template <typename Return, typename T>
@@ -177,6 +310,10 @@ template <typename Return, typename T>
 Vc_INTRINSIC Vc_CONST Return
 simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
           enable_if<std::is_same<Return, SSE::ushort_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
+          enable_if<SSE::is_int64_vector<Return>::value> = nullarg);
 
 // 3 Scalar::Vector to 1 SSE::Vector {{{2
 template <typename Return, typename T>
@@ -372,6 +509,33 @@ Vc_SIMD_CAST_1(  uint_v, ushort_v) { return SSE::convert_int32_to_int16(x.data()
 Vc_SIMD_CAST_1( float_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x)); }
 Vc_SIMD_CAST_1(double_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x)); }
 Vc_SIMD_CAST_1( short_v, ushort_v) { return x.data(); }
+// from/to schar_v and uchar_v {{{3
+Vc_SIMD_CAST_1( schar_v,    int_v) { return convert< schar,    int>(x.data()); }
+Vc_SIMD_CAST_1( schar_v,   uint_v) { return convert< schar,   uint>(x.data()); }
+Vc_SIMD_CAST_1( schar_v,  float_v) { return convert< schar,  float>(x.data()); }
+Vc_SIMD_CAST_1( schar_v, double_v) { return convert< schar, double>(x.data()); }
+Vc_SIMD_CAST_1( schar_v,  short_v) { return convert< schar,  short>(x.data()); }
+Vc_SIMD_CAST_1( schar_v, ushort_v) { return convert< schar, ushort>(x.data()); }
+Vc_SIMD_CAST_1( uchar_v,    int_v) { return convert< uchar,    int>(x.data()); }
+Vc_SIMD_CAST_1( uchar_v,   uint_v) { return convert< uchar,   uint>(x.data()); }
+Vc_SIMD_CAST_1( uchar_v,  float_v) { return convert< uchar,  float>(x.data()); }
+Vc_SIMD_CAST_1( uchar_v, double_v) { return convert< uchar, double>(x.data()); }
+Vc_SIMD_CAST_1( uchar_v,  short_v) { return convert< uchar,  short>(x.data()); }
+Vc_SIMD_CAST_1( uchar_v, ushort_v) { return convert< uchar, ushort>(x.data()); }
+Vc_SIMD_CAST_1(   int_v,  schar_v) { return convert<   int,  schar>(x.data()); }
+Vc_SIMD_CAST_1(  uint_v,  schar_v) { return convert<  uint,  schar>(x.data()); }
+Vc_SIMD_CAST_1( float_v,  schar_v) { return convert< float,  schar>(x.data()); }
+Vc_SIMD_CAST_1(double_v,  schar_v) { return convert<double,  schar>(x.data()); }
+Vc_SIMD_CAST_1( short_v,  schar_v) { return convert< short,  schar>(x.data()); }
+Vc_SIMD_CAST_1(ushort_v,  schar_v) { return convert<ushort,  schar>(x.data()); }
+Vc_SIMD_CAST_1( uchar_v,  schar_v) { return convert< uchar,  schar>(x.data()); }
+Vc_SIMD_CAST_1(   int_v,  uchar_v) { return convert<   int,  uchar>(x.data()); }
+Vc_SIMD_CAST_1(  uint_v,  uchar_v) { return convert<  uint,  uchar>(x.data()); }
+Vc_SIMD_CAST_1( float_v,  uchar_v) { return convert< float,  uchar>(x.data()); }
+Vc_SIMD_CAST_1(double_v,  uchar_v) { return convert<double,  uchar>(x.data()); }
+Vc_SIMD_CAST_1( short_v,  uchar_v) { return convert< short,  uchar>(x.data()); }
+Vc_SIMD_CAST_1(ushort_v,  uchar_v) { return convert<ushort,  uchar>(x.data()); }
+Vc_SIMD_CAST_1( schar_v,  uchar_v) { return convert< schar,  uchar>(x.data()); }
 // 2 SSE::Vector to 1 SSE::Vector {{{2
 Vc_SIMD_CAST_2(double_v,    int_v) {
 #ifdef Vc_IMPL_AVX
@@ -405,6 +569,102 @@ Vc_SIMD_CAST_2(  uint_v, ushort_v) { return SSE::convert_int32_to_int16(x0.data(
 Vc_SIMD_CAST_2( float_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x0), simd_cast<SSE::int_v>(x1)); }
 Vc_SIMD_CAST_2(double_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x0, x1)); }
 
+Vc_SIMD_CAST_2(   int_v,  schar_v) { return convert<short, schar>(SSE::convert_int32_to_int16(x0.data(), x1.data())); }
+Vc_SIMD_CAST_2(  uint_v,  schar_v) { return convert<short, schar>(SSE::convert_int32_to_int16(x0.data(), x1.data())); }
+Vc_SIMD_CAST_2( float_v,  schar_v) { return simd_cast<SSE::schar_v>(simd_cast<SSE::int_v>(x0), simd_cast<SSE::int_v>(x1)); }
+Vc_SIMD_CAST_2(double_v,  schar_v) { return simd_cast<SSE::schar_v>(simd_cast<SSE::int_v>(x0, x1)); }
+Vc_SIMD_CAST_2( short_v,  schar_v) { return VectorHelper<schar>::concat(x0.data(), x1.data()); }
+Vc_SIMD_CAST_2(ushort_v,  schar_v) { return VectorHelper<schar>::concat(x0.data(), x1.data()); }
+
+Vc_SIMD_CAST_2(   int_v,  uchar_v) { return simd_cast<SSE::schar_v>(x0, x1).data(); }
+Vc_SIMD_CAST_2(  uint_v,  uchar_v) { return simd_cast<SSE::schar_v>(x0, x1).data(); }
+Vc_SIMD_CAST_2( float_v,  uchar_v) { return simd_cast<SSE::schar_v>(x0, x1).data(); }
+Vc_SIMD_CAST_2(double_v,  uchar_v) { return simd_cast<SSE::schar_v>(x0, x1).data(); }
+Vc_SIMD_CAST_2( short_v,  uchar_v) { return VectorHelper<uchar>::concat(x0.data(), x1.data()); }
+Vc_SIMD_CAST_2(ushort_v,  uchar_v) { return VectorHelper<uchar>::concat(x0.data(), x1.data()); }
+
+// from/to 64-bit integer vectors {{{2
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To simd_cast(
+    SSE::Vector<T> x,
+    enable_if<is_vector<To>::value && !std::is_same<To, SSE::Vector<T>>::value &&
+              (is_int64_vector<To>::value ||
+               (Detail::is_int64<T>::value && sizeof(typename To::EntryType) >= 4))>)
+{
+    return convert<T, typename To::EntryType>(x.data());
+}
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To simd_cast(
+    SSE::Vector<T> x,
+    enable_if<Detail::is_int64<T>::value && is_vector<To>::value &&
+              sizeof(typename To::EntryType) < 4>)
+{
+    return simd_cast<To>(simd_cast<SSE::int_v>(x));
+}
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To simd_cast(
+    SSE::Vector<T> x0, SSE::Vector<T> x1,
+    enable_if<Detail::is_int64<T>::value && is_vector<To>::value && (To::Size >= 4)>)
+{
+    // convert to float_v or int_v, which hold the entries of both arguments
+    using U = typename std::conditional<std::is_floating_point<typename To::EntryType>::value,
+                                        float, int>::type;
+    using VT = typename SSE::Vector<U>::VectorType;
+    return simd_cast<To>(SSE::Vector<U>(sse_cast<VT>(
+        _mm_unpacklo_epi64(sse_cast<__m128i>(convert<T, U>(x0.data())),
+                           sse_cast<__m128i>(convert<T, U>(x1.data()))))));
+}
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To simd_cast(
+    SSE::Vector<T> x0, SSE::Vector<T> x1, SSE::Vector<T> x2,
+    enable_if<Detail::is_int64<T>::value && is_vector<To>::value && (To::Size >= 8)>)
+{
+    return simd_cast<To>(simd_cast<SSE::int_v>(x0, x1), simd_cast<SSE::int_v>(x2));
+}
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To simd_cast(
+    SSE::Vector<T> x0, SSE::Vector<T> x1, SSE::Vector<T> x2, SSE::Vector<T> x3,
+    enable_if<Detail::is_int64<T>::value && is_vector<To>::value && (To::Size >= 8)>)
+{
+    return simd_cast<To>(simd_cast<SSE::int_v>(x0, x1), simd_cast<SSE::int_v>(x2, x3));
+}
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(SSE::Vector<T> x0, SSE::Vector<T> x1, SSE::Vector<T> x2, SSE::Vector<T> x3,
+          SSE::Vector<T> x4,
+          enable_if<Detail::is_int64<T>::value && is_vector<To>::value && (To::Size >= 16)>)
+{
+    return simd_cast<To>(simd_cast<SSE::int_v>(x0, x1), simd_cast<SSE::int_v>(x2, x3),
+                         simd_cast<SSE::int_v>(x4));
+}
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(SSE::Vector<T> x0, SSE::Vector<T> x1, SSE::Vector<T> x2, SSE::Vector<T> x3,
+          SSE::Vector<T> x4, SSE::Vector<T> x5,
+          enable_if<Detail::is_int64<T>::value && is_vector<To>::value && (To::Size >= 16)>)
+{
+    return simd_cast<To>(simd_cast<SSE::int_v>(x0, x1), simd_cast<SSE::int_v>(x2, x3),
+                         simd_cast<SSE::int_v>(x4, x5));
+}
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(SSE::Vector<T> x0, SSE::Vector<T> x1, SSE::Vector<T> x2, SSE::Vector<T> x3,
+          SSE::Vector<T> x4, SSE::Vector<T> x5, SSE::Vector<T> x6,
+          enable_if<Detail::is_int64<T>::value && is_vector<To>::value && (To::Size >= 16)>)
+{
+    return simd_cast<To>(simd_cast<SSE::int_v>(x0, x1), simd_cast<SSE::int_v>(x2, x3),
+                         simd_cast<SSE::int_v>(x4, x5), simd_cast<SSE::int_v>(x6));
+}
+template <typename To, typename T>
+Vc_INTRINSIC Vc_CONST To
+simd_cast(SSE::Vector<T> x0, SSE::Vector<T> x1, SSE::Vector<T> x2, SSE::Vector<T> x3,
+          SSE::Vector<T> x4, SSE::Vector<T> x5, SSE::Vector<T> x6, SSE::Vector<T> x7,
+          enable_if<Detail::is_int64<T>::value && is_vector<To>::value && (To::Size >= 16)>)
+{
+    return simd_cast<To>(simd_cast<SSE::int_v>(x0, x1), simd_cast<SSE::int_v>(x2, x3),
+                         simd_cast<SSE::int_v>(x4, x5), simd_cast<SSE::int_v>(x6, x7));
+}
+
 // 3 SSE::Vector to 1 SSE::Vector {{{2
 Vc_CAST_(short_v) simd_cast(double_v a, double_v b, double_v c)
 {
@@ -414,11 +674,92 @@ Vc_CAST_(ushort_v) simd_cast(double_v a, double_v b, double_v c)
 {
     return simd_cast<ushort_v>(simd_cast<int_v>(a, b), simd_cast<int_v>(c));
 }
-#undef Vc_CAST_
+Vc_CAST_(schar_v) simd_cast(double_v a, double_v b, double_v c)
+{
+    return simd_cast<schar_v>(simd_cast<int_v>(a, b), simd_cast<int_v>(c));
+}
+Vc_CAST_(schar_v) simd_cast(float_v a, float_v b, float_v c)
+{
+    return simd_cast<schar_v>(a, b, c, float_v::Zero());
+}
+Vc_CAST_(schar_v) simd_cast(int_v a, int_v b, int_v c)
+{
+    return simd_cast<schar_v>(a, b, c, int_v::Zero());
+}
+Vc_CAST_(schar_v) simd_cast(uint_v a, uint_v b, uint_v c)
+{
+    return simd_cast<schar_v>(a, b, c, uint_v::Zero());
+}
+Vc_CAST_(uchar_v) simd_cast(double_v a, double_v b, double_v c)
+{
+    return simd_cast<schar_v>(a, b, c).data();
+}
+Vc_CAST_(uchar_v) simd_cast(float_v a, float_v b, float_v c)
+{
+    return simd_cast<schar_v>(a, b, c).data();
+}
+Vc_CAST_(uchar_v) simd_cast(int_v a, int_v b, int_v c)
+{
+    return simd_cast<schar_v>(a, b, c).data();
+}
+Vc_CAST_(uchar_v) simd_cast(uint_v a, uint_v b, uint_v c)
+{
+    return simd_cast<schar_v>(a, b, c).data();
+}
 
 // 4 SSE::Vector to 1 SSE::Vector {{{2
 Vc_SIMD_CAST_4(double_v,  short_v) { return _mm_packs_epi32(simd_cast<SSE::int_v>(x0, x1).data(), simd_cast<SSE::int_v>(x2, x3).data()); }
 Vc_SIMD_CAST_4(double_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x0, x1), simd_cast<SSE::int_v>(x2, x3)); }
+
+Vc_SIMD_CAST_4(   int_v,  schar_v) { return VectorHelper<schar>::concat(simd_cast<SSE::short_v>(x0, x1).data(), simd_cast<SSE::short_v>(x2, x3).data()); }
+Vc_SIMD_CAST_4(  uint_v,  schar_v) { return VectorHelper<schar>::concat(simd_cast<SSE::short_v>(x0, x1).data(), simd_cast<SSE::short_v>(x2, x3).data()); }
+Vc_SIMD_CAST_4( float_v,  schar_v) { return simd_cast<SSE::schar_v>(simd_cast<SSE::int_v>(x0), simd_cast<SSE::int_v>(x1), simd_cast<SSE::int_v>(x2), simd_cast<SSE::int_v>(x3)); }
+Vc_SIMD_CAST_4(double_v,  schar_v) { return simd_cast<SSE::schar_v>(simd_cast<SSE::int_v>(x0, x1), simd_cast<SSE::int_v>(x2, x3)); }
+Vc_SIMD_CAST_4(   int_v,  uchar_v) { return simd_cast<SSE::schar_v>(x0, x1, x2, x3).data(); }
+Vc_SIMD_CAST_4(  uint_v,  uchar_v) { return simd_cast<SSE::schar_v>(x0, x1, x2, x3).data(); }
+Vc_SIMD_CAST_4( float_v,  uchar_v) { return simd_cast<SSE::schar_v>(x0, x1, x2, x3).data(); }
+Vc_SIMD_CAST_4(double_v,  uchar_v) { return simd_cast<SSE::schar_v>(x0, x1, x2, x3).data(); }
+
+// 5-7 SSE::Vector to 1 SSE::Vector {{{2
+Vc_CAST_(schar_v) simd_cast(double_v a, double_v b, double_v c, double_v d, double_v e)
+{
+    return simd_cast<schar_v>(simd_cast<int_v>(a, b), simd_cast<int_v>(c, d),
+                              simd_cast<int_v>(e));
+}
+Vc_CAST_(schar_v) simd_cast(double_v a, double_v b, double_v c, double_v d, double_v e,
+                            double_v f)
+{
+    return simd_cast<schar_v>(simd_cast<int_v>(a, b), simd_cast<int_v>(c, d),
+                              simd_cast<int_v>(e, f));
+}
+Vc_CAST_(schar_v) simd_cast(double_v a, double_v b, double_v c, double_v d, double_v e,
+                            double_v f, double_v g)
+{
+    return simd_cast<schar_v>(simd_cast<int_v>(a, b), simd_cast<int_v>(c, d),
+                              simd_cast<int_v>(e, f), simd_cast<int_v>(g));
+}
+Vc_CAST_(uchar_v) simd_cast(double_v a, double_v b, double_v c, double_v d, double_v e)
+{
+    return simd_cast<schar_v>(a, b, c, d, e).data();
+}
+Vc_CAST_(uchar_v) simd_cast(double_v a, double_v b, double_v c, double_v d, double_v e,
+                            double_v f)
+{
+    return simd_cast<schar_v>(a, b, c, d, e, f).data();
+}
+Vc_CAST_(uchar_v) simd_cast(double_v a, double_v b, double_v c, double_v d, double_v e,
+                            double_v f, double_v g)
+{
+    return simd_cast<schar_v>(a, b, c, d, e, f, g).data();
+}
+#undef Vc_CAST_
+
+// 8 SSE::Vector to 1 SSE::Vector {{{2
+Vc_SIMD_CAST_8(double_v,  schar_v) {
+    return simd_cast<SSE::schar_v>(simd_cast<SSE::int_v>(x0, x1), simd_cast<SSE::int_v>(x2, x3),
+                                   simd_cast<SSE::int_v>(x4, x5), simd_cast<SSE::int_v>(x6, x7));
+}
+Vc_SIMD_CAST_8(double_v,  uchar_v) { return simd_cast<SSE::schar_v>(x0, x1, x2, x3, x4, x5, x6, x7).data(); }
 }  // namespace SSE
 
 // 1 Scalar::Vector to 1 SSE::Vector {{{2
@@ -466,6 +807,13 @@ Vc_INTRINSIC Vc_CONST Return
     return _mm_setr_epi16(
         x.data(), 0, 0, 0, 0, 0, 0, 0);  // FIXME: use register-register mov
 }
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+    simd_cast(Scalar::Vector<T> x,
+              enable_if<SSE::is_int64_vector<Return>::value> )
+{
+    return _mm_set_epi64x(0, static_cast<typename Return::EntryType>(x.data()));
+}
 
 // 2 Scalar::Vector to 1 SSE::Vector {{{2
 template <typename Return, typename T>
@@ -519,6 +867,15 @@ Vc_INTRINSIC Vc_CONST Return
     return _mm_setr_epi16(
         x0.data(), x1.data(), 0, 0, 0, 0, 0, 0);  // FIXME: use register-register mov
 }
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+    simd_cast(Scalar::Vector<T> x0,
+              Scalar::Vector<T> x1,
+              enable_if<SSE::is_int64_vector<Return>::value> )
+{
+    return _mm_set_epi64x(static_cast<typename Return::EntryType>(x1.data()),
+                          static_cast<typename Return::EntryType>(x0.data()));
+}
 
 // 3 Scalar::Vector to 1 SSE::Vector {{{2
 template <typename Return, typename T>
@@ -752,6 +1109,16 @@ Vc_INTRINSIC Vc_CONST Return simd_cast(
     return SSE::sse_cast<__m128>(
         _mm_packs_epi16(_mm_packs_epi16(x0.dataI(), x1.dataI()), _mm_setzero_si128()));
 }
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return simd_cast(
+    SSE::Mask<T> x0,
+    SSE::Mask<T> x1,
+    enable_if<SSE::is_mask<Return>::value && Mask<T, VectorAbi::Sse>::Size * 8 == Return::Size> = nullarg)
+{
+    return SSE::sse_cast<__m128>(_mm_packs_epi16(
+        _mm_packs_epi16(_mm_packs_epi16(x0.dataI(), x1.dataI()), _mm_setzero_si128()),
+        _mm_setzero_si128()));
+}
 // 4 SSE Masks to 1 SSE Mask {{{2
 template <typename Return, typename T>
 Vc_INTRINSIC Vc_CONST Return simd_cast(
@@ -764,6 +1131,19 @@ Vc_INTRINSIC Vc_CONST Return simd_cast(
     return SSE::sse_cast<__m128>(_mm_packs_epi16(_mm_packs_epi16(x0.dataI(), x1.dataI()),
                                                  _mm_packs_epi16(x2.dataI(), x3.dataI())));
 }
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return simd_cast(
+    SSE::Mask<T> x0,
+    SSE::Mask<T> x1,
+    SSE::Mask<T> x2,
+    SSE::Mask<T> x3,
+    enable_if<SSE::is_mask<Return>::value && Mask<T, VectorAbi::Sse>::Size * 8 == Return::Size> = nullarg)
+{
+    return SSE::sse_cast<__m128>(_mm_packs_epi16(
+        _mm_packs_epi16(_mm_packs_epi16(x0.dataI(), x1.dataI()),
+                        _mm_packs_epi16(x2.dataI(), x3.dataI())),
+        _mm_setzero_si128()));
+}
 
 // 1 Scalar Mask to 1 SSE Mask {{{2
 template <typename Return, typename T>
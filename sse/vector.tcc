@@ -45,6 +45,8 @@ Vc_INTRINSIC SSE::   int_m operator==(SSE::   int_v a, SSE::   int_v b) { return
 Vc_INTRINSIC SSE::  uint_m operator==(SSE::  uint_v a, SSE::  uint_v b) { return _mm_cmpeq_epi32(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: short_m operator==(SSE:: short_v a, SSE:: short_v b) { return _mm_cmpeq_epi16(a.data(), b.data()); }
 Vc_INTRINSIC SSE::ushort_m operator==(SSE::ushort_v a, SSE::ushort_v b) { return _mm_cmpeq_epi16(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: schar_m operator==(SSE:: schar_v a, SSE:: schar_v b) { return _mm_cmpeq_epi8(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: uchar_m operator==(SSE:: uchar_v a, SSE:: uchar_v b) { return _mm_cmpeq_epi8(a.data(), b.data()); }
 
 Vc_INTRINSIC SSE::double_m operator!=(SSE::double_v a, SSE::double_v b) { return _mm_cmpneq_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator!=(SSE:: float_v a, SSE:: float_v b) { return _mm_cmpneq_ps(a.data(), b.data()); }
@@ -52,6 +54,8 @@ Vc_INTRINSIC SSE::   int_m operator!=(SSE::   int_v a, SSE::   int_v b) { return
 Vc_INTRINSIC SSE::  uint_m operator!=(SSE::  uint_v a, SSE::  uint_v b) { return not_(_mm_cmpeq_epi32(a.data(), b.data())); }
 Vc_INTRINSIC SSE:: short_m operator!=(SSE:: short_v a, SSE:: short_v b) { return not_(_mm_cmpeq_epi16(a.data(), b.data())); }
 Vc_INTRINSIC SSE::ushort_m operator!=(SSE::ushort_v a, SSE::ushort_v b) { return not_(_mm_cmpeq_epi16(a.data(), b.data())); }
+Vc_INTRINSIC SSE:: schar_m operator!=(SSE:: schar_v a, SSE:: schar_v b) { return not_(_mm_cmpeq_epi8(a.data(), b.data())); }
+Vc_INTRINSIC SSE:: uchar_m operator!=(SSE:: uchar_v a, SSE:: uchar_v b) { return not_(_mm_cmpeq_epi8(a.data(), b.data())); }
 
 Vc_INTRINSIC SSE::double_m operator> (SSE::double_v a, SSE::double_v b) { return _mm_cmpgt_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator> (SSE:: float_v a, SSE:: float_v b) { return _mm_cmpgt_ps(a.data(), b.data()); }
@@ -71,6 +75,8 @@ Vc_INTRINSIC SSE::ushort_m operator> (SSE::ushort_v a, SSE::ushort_v b) {
     return _mm_cmpgt_epi16(a.data(), b.data());
 #endif
 }
+Vc_INTRINSIC SSE:: schar_m operator> (SSE:: schar_v a, SSE:: schar_v b) { return _mm_cmpgt_epi8(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: uchar_m operator> (SSE:: uchar_v a, SSE:: uchar_v b) { return SSE::cmpgt_epu8(a.data(), b.data()); }
 
 Vc_INTRINSIC SSE::double_m operator< (SSE::double_v a, SSE::double_v b) { return _mm_cmplt_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator< (SSE:: float_v a, SSE:: float_v b) { return _mm_cmplt_ps(a.data(), b.data()); }
@@ -90,6 +96,8 @@ Vc_INTRINSIC SSE::ushort_m operator< (SSE::ushort_v a, SSE::ushort_v b) {
     return _mm_cmplt_epi16(a.data(), b.data());
 #endif
 }
+Vc_INTRINSIC SSE:: schar_m operator< (SSE:: schar_v a, SSE:: schar_v b) { return _mm_cmplt_epi8(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: uchar_m operator< (SSE:: uchar_v a, SSE:: uchar_v b) { return SSE::cmplt_epu8(a.data(), b.data()); }
 
 Vc_INTRINSIC SSE::double_m operator>=(SSE::double_v a, SSE::double_v b) { return _mm_cmpnlt_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator>=(SSE:: float_v a, SSE:: float_v b) { return _mm_cmpnlt_ps(a.data(), b.data()); }
@@ -97,6 +105,8 @@ Vc_INTRINSIC SSE::   int_m operator>=(SSE::   int_v a, SSE::   int_v b) { return
 Vc_INTRINSIC SSE::  uint_m operator>=(SSE::  uint_v a, SSE::  uint_v b) { return !(a < b); }
 Vc_INTRINSIC SSE:: short_m operator>=(SSE:: short_v a, SSE:: short_v b) { return !(a < b); }
 Vc_INTRINSIC SSE::ushort_m operator>=(SSE::ushort_v a, SSE::ushort_v b) { return !(a < b); }
+Vc_INTRINSIC SSE:: schar_m operator>=(SSE:: schar_v a, SSE:: schar_v b) { return !(a < b); }
+Vc_INTRINSIC SSE:: uchar_m operator>=(SSE:: uchar_v a, SSE:: uchar_v b) { return !(a < b); }
 
 Vc_INTRINSIC SSE::double_m operator<=(SSE::double_v a, SSE::double_v b) { return _mm_cmple_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator<=(SSE:: float_v a, SSE:: float_v b) { return _mm_cmple_ps(a.data(), b.data()); }
@@ -104,6 +114,40 @@ Vc_INTRINSIC SSE::   int_m operator<=(SSE::   int_v a, SSE::   int_v b) { return
 Vc_INTRINSIC SSE::  uint_m operator<=(SSE::  uint_v a, SSE::  uint_v b) { return !(a > b); }
 Vc_INTRINSIC SSE:: short_m operator<=(SSE:: short_v a, SSE:: short_v b) { return !(a > b); }
 Vc_INTRINSIC SSE::ushort_m operator<=(SSE::ushort_v a, SSE::ushort_v b) { return !(a > b); }
+Vc_INTRINSIC SSE:: schar_m operator<=(SSE:: schar_v a, SSE:: schar_v b) { return !(a > b); }
+Vc_INTRINSIC SSE:: uchar_m operator<=(SSE:: uchar_v a, SSE:: uchar_v b) { return !(a > b); }
+
+template <typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, SSE::Mask<T>> operator==(SSE::Vector<T> a, SSE::Vector<T> b)
+{
+    return SSE::cmpeq_epi64(a.data(), b.data());
+}
+template <typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, SSE::Mask<T>> operator!=(SSE::Vector<T> a, SSE::Vector<T> b)
+{
+    return not_(SSE::cmpeq_epi64(a.data(), b.data()));
+}
+template <typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, SSE::Mask<T>> operator> (SSE::Vector<T> a, SSE::Vector<T> b)
+{
+    return std::is_signed<T>::value ? SSE::cmpgt_epi64(a.data(), b.data())
+                                    : SSE::cmpgt_epu64(a.data(), b.data());
+}
+template <typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, SSE::Mask<T>> operator< (SSE::Vector<T> a, SSE::Vector<T> b)
+{
+    return b > a;
+}
+template <typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, SSE::Mask<T>> operator>=(SSE::Vector<T> a, SSE::Vector<T> b)
+{
+    return !(b > a);
+}
+template <typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, SSE::Mask<T>> operator<=(SSE::Vector<T> a, SSE::Vector<T> b)
+{
+    return !(a > b);
+}
 
 // bitwise operators {{{1
 template <typename T>
@@ -151,6 +195,12 @@ Vc_INTRINSIC
     return SSE::Vector<T>::generate([&](int i) { return a[i] / b[i]; });
 }
 template <typename T>
+Vc_INTRINSIC enable_if<is_int64<T>::value, SSE::Vector<T>> operator/(SSE::Vector<T> a,
+                                                                     SSE::Vector<T> b)
+{
+    return SSE::Vector<T>::generate([&](int i) { return a[i] / b[i]; });
+}
+template <typename T>
 Vc_INTRINSIC enable_if<std::is_same<short, T>::value || std::is_same<ushort, T>::value,
                        SSE::Vector<T>>
 operator/(SSE::Vector<T> a, SSE::Vector<T> b)
@@ -163,6 +213,17 @@ operator/(SSE::Vector<T> a, SSE::Vector<T> b)
     return HT::concat(_mm_cvttps_epi32(lo), _mm_cvttps_epi32(hi));
 }
 template <typename T>
+Vc_INTRINSIC enable_if<std::is_same<schar, T>::value || std::is_same<uchar, T>::value,
+                       SSE::Vector<T>>
+operator/(SSE::Vector<T> a, SSE::Vector<T> b)
+{
+    // divide as 16-bit integers, which in turn divide in single precision
+    using HT = SSE::VectorHelper<T>;
+    using W = SSE::Vector<typename std::conditional<std::is_signed<T>::value, short, ushort>::type>;
+    return HT::concat((W(HT::expand0(a.data())) / W(HT::expand0(b.data()))).data(),
+                      (W(HT::expand1(a.data())) / W(HT::expand1(b.data()))).data());
+}
+template <typename T>
 Vc_INTRINSIC enable_if<std::is_integral<T>::value, SSE::Vector<T>> operator%(
     SSE::Vector<T> a, SSE::Vector<T> b)
 {
@@ -271,6 +332,16 @@ Vc_INTRINSIC void Vector<T, VectorAbi::Sse>::store(U *mem, Mask mask, Flags flag
     HV::template store<Flags>(mem, data(), sse_cast<VectorType>(mask.data()));
 }
 
+template <typename T>
+template <typename Flags, typename>
+Vc_INTRINSIC void Vector<T, VectorAbi::Sse>::store(half *mem, Flags flags) const
+{
+    static_assert(std::is_same<T, float>::value, "only float vectors convert to half");
+    Common::handleStorePrefetches(mem, flags);
+    // 8 bytes: no aligned or streaming variant
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(mem), SSE::cvtps_ph(data()));
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////
 // operator- {{{1
 template<typename T> Vc_ALWAYS_INLINE Vc_PURE Vector<T, VectorAbi::Sse> Vector<T, VectorAbi::Sse>::operator-() const
@@ -368,6 +439,35 @@ Vc_ALWAYS_INLINE void SSE::ushort_v::gatherImplementation(const MT *mem, IT &&in
                     mem[indexes[4]], mem[indexes[5]], mem[indexes[6]], mem[indexes[7]]);
 }
 
+#define Vc_INT64_GATHER_(T_)                                                             \
+    template <>                                                                          \
+    template <typename MT, typename IT>                                                  \
+    Vc_ALWAYS_INLINE void SSE::Vector<T_>::gatherImplementation(const MT *mem,           \
+                                                                IT &&indexes)            \
+    {                                                                                    \
+        d.v() = _mm_set_epi64x(mem[indexes[1]], mem[indexes[0]]);                        \
+    }
+Vc_INT64_GATHER_(long long)
+Vc_INT64_GATHER_(unsigned long long)
+#if defined __LP64__ || defined _LP64
+Vc_INT64_GATHER_(long)
+Vc_INT64_GATHER_(unsigned long)
+#endif
+#undef Vc_INT64_GATHER_
+
+#define Vc_INT8_GATHER_(T_)                                                              \
+    template <>                                                                          \
+    template <typename MT, typename IT>                                                  \
+    Vc_ALWAYS_INLINE void SSE::Vector<T_>::gatherImplementation(const MT *mem,           \
+                                                                IT &&indexes)            \
+    {                                                                                    \
+        Common::unrolled_loop<std::size_t, 0, Size>(                                     \
+            [&](std::size_t i) { d.set(i, mem[indexes[i]]); });                          \
+    }
+Vc_INT8_GATHER_(signed char)
+Vc_INT8_GATHER_(unsigned char)
+#undef Vc_INT8_GATHER_
+
 template <typename T>
 template <typename MT, typename IT>
 inline void Vector<T, VectorAbi::Sse>::gatherImplementation(const MT *mem, IT &&indexes, MaskArgument mask)
@@ -498,43 +598,9 @@ Vc_INTRINSIC Vc_CONST SSE::double_v exponent(SSE::double_v x)
 }
 // }}}1
 // Random {{{1
-static void _doRandomStep(SSE::uint_v &state0,
-        SSE::uint_v &state1)
-{
-    using SSE::uint_v;
-    using Detail::operator+;
-    using Detail::operator*;
-    state0.load(&Common::RandomState[0]);
-    state1.load(&Common::RandomState[uint_v::Size]);
-    (state1 * uint_v(0xdeece66du) + uint_v(11)).store(&Common::RandomState[uint_v::Size]);
-    uint_v(_mm_xor_si128((state0 * uint_v(0xdeece66du) + uint_v(11)).data(),
-                         _mm_srli_epi32(state1.data(), 16)))
-        .store(&Common::RandomState[0]);
-}
-
 template<typename T> Vc_ALWAYS_INLINE Vector<T, VectorAbi::Sse> Vector<T, VectorAbi::Sse>::Random()
 {
-    SSE::uint_v state0, state1;
-    _doRandomStep(state0, state1);
-    return state0.data();
-}
-
-template<> Vc_ALWAYS_INLINE SSE::float_v SSE::float_v::Random()
-{
-    SSE::uint_v state0, state1;
-    _doRandomStep(state0, state1);
-    return _mm_sub_ps(_mm_or_ps(_mm_castsi128_ps(_mm_srli_epi32(state0.data(), 2)), HT::one()), HT::one());
-}
-
-template<> Vc_ALWAYS_INLINE SSE::double_v SSE::double_v::Random()
-{
-    typedef unsigned long long uint64 Vc_MAY_ALIAS;
-    uint64 state0 = *reinterpret_cast<const uint64 *>(&Common::RandomState[8]);
-    uint64 state1 = *reinterpret_cast<const uint64 *>(&Common::RandomState[10]);
-    const __m128i state = _mm_load_si128(reinterpret_cast<const __m128i *>(&Common::RandomState[8]));
-    *reinterpret_cast<uint64 *>(&Common::RandomState[ 8]) = (state0 * 0x5deece66dull + 11);
-    *reinterpret_cast<uint64 *>(&Common::RandomState[10]) = (state1 * 0x5deece66dull + 11);
-    return _mm_sub_pd(_mm_or_pd(_mm_castsi128_pd(_mm_srli_epi64(state, 12)), HT::one()), HT::one());
+    return Common::randomVector<Vector>();
 }
 // shifted / rotated {{{1
 template<typename T> Vc_INTRINSIC Vc_PURE Vector<T, VectorAbi::Sse> Vector<T, VectorAbi::Sse>::shifted(int amount) const
@@ -658,6 +724,10 @@ template <> Vc_INTRINSIC  SSE::short_v  SSE::short_v::interleaveLow ( SSE::short
 template <> Vc_INTRINSIC  SSE::short_v  SSE::short_v::interleaveHigh( SSE::short_v x) const { return _mm_unpackhi_epi16(data(), x.data()); }
 template <> Vc_INTRINSIC SSE::ushort_v SSE::ushort_v::interleaveLow (SSE::ushort_v x) const { return _mm_unpacklo_epi16(data(), x.data()); }
 template <> Vc_INTRINSIC SSE::ushort_v SSE::ushort_v::interleaveHigh(SSE::ushort_v x) const { return _mm_unpackhi_epi16(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::schar_v  SSE::schar_v::interleaveLow ( SSE::schar_v x) const { return _mm_unpacklo_epi8(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::schar_v  SSE::schar_v::interleaveHigh( SSE::schar_v x) const { return _mm_unpackhi_epi8(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::uchar_v  SSE::uchar_v::interleaveLow ( SSE::uchar_v x) const { return _mm_unpacklo_epi8(data(), x.data()); }
+template <> Vc_INTRINSIC  SSE::uchar_v  SSE::uchar_v::interleaveHigh( SSE::uchar_v x) const { return _mm_unpackhi_epi8(data(), x.data()); }
 // }}}1
 // generate {{{1
 template <> template <typename G> Vc_INTRINSIC SSE::double_v SSE::double_v::generate(G gen)
@@ -714,6 +784,48 @@ template <> template <typename G> Vc_INTRINSIC SSE::ushort_v SSE::ushort_v::gene
     const auto tmp7 = gen(7);
     return _mm_setr_epi16(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7);
 }
+template <> template <typename G> Vc_INTRINSIC SSE::schar_v SSE::schar_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    const auto tmp4 = gen(4);
+    const auto tmp5 = gen(5);
+    const auto tmp6 = gen(6);
+    const auto tmp7 = gen(7);
+    const auto tmp8 = gen(8);
+    const auto tmp9 = gen(9);
+    const auto tmp10 = gen(10);
+    const auto tmp11 = gen(11);
+    const auto tmp12 = gen(12);
+    const auto tmp13 = gen(13);
+    const auto tmp14 = gen(14);
+    const auto tmp15 = gen(15);
+    return _mm_setr_epi8(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9,
+                         tmp10, tmp11, tmp12, tmp13, tmp14, tmp15);
+}
+template <> template <typename G> Vc_INTRINSIC SSE::uchar_v SSE::uchar_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    const auto tmp4 = gen(4);
+    const auto tmp5 = gen(5);
+    const auto tmp6 = gen(6);
+    const auto tmp7 = gen(7);
+    const auto tmp8 = gen(8);
+    const auto tmp9 = gen(9);
+    const auto tmp10 = gen(10);
+    const auto tmp11 = gen(11);
+    const auto tmp12 = gen(12);
+    const auto tmp13 = gen(13);
+    const auto tmp14 = gen(14);
+    const auto tmp15 = gen(15);
+    return _mm_setr_epi8(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9,
+                         tmp10, tmp11, tmp12, tmp13, tmp14, tmp15);
+}
 // }}}1
 // reversed {{{1
 template <> Vc_INTRINSIC Vc_PURE SSE::double_v SSE::double_v::reversed() const
@@ -744,6 +856,64 @@ template <> Vc_INTRINSIC Vc_PURE SSE::ushort_v SSE::ushort_v::reversed() const
         Mem::shuffle<X1, Y0>(sse_cast<__m128d>(Mem::permuteHi<X7, X6, X5, X4>(d.v())),
                              sse_cast<__m128d>(Mem::permuteLo<X3, X2, X1, X0>(d.v()))));
 }
+template <> Vc_INTRINSIC Vc_PURE SSE::schar_v SSE::schar_v::reversed() const
+{
+#ifdef Vc_IMPL_SSSE3
+    return _mm_shuffle_epi8(
+        d.v(), _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+#else
+    // reverse the 16-bit words and then swap the bytes within each word
+    const __m128i tmp = sse_cast<__m128i>(
+        Mem::shuffle<X1, Y0>(sse_cast<__m128d>(Mem::permuteHi<X7, X6, X5, X4>(d.v())),
+                             sse_cast<__m128d>(Mem::permuteLo<X3, X2, X1, X0>(d.v()))));
+    return _mm_or_si128(_mm_slli_epi16(tmp, 8), _mm_srli_epi16(tmp, 8));
+#endif
+}
+template <> Vc_INTRINSIC Vc_PURE SSE::uchar_v SSE::uchar_v::reversed() const
+{
+#ifdef Vc_IMPL_SSSE3
+    return _mm_shuffle_epi8(
+        d.v(), _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+#else
+    // reverse the 16-bit words and then swap the bytes within each word
+    const __m128i tmp = sse_cast<__m128i>(
+        Mem::shuffle<X1, Y0>(sse_cast<__m128d>(Mem::permuteHi<X7, X6, X5, X4>(d.v())),
+                             sse_cast<__m128d>(Mem::permuteLo<X3, X2, X1, X0>(d.v()))));
+    return _mm_or_si128(_mm_slli_epi16(tmp, 8), _mm_srli_epi16(tmp, 8));
+#endif
+}
+// }}}1
+// interleaveLow/-High, generate, and reversed for 64-bit integers {{{1
+#define Vc_INT64_SPECIALIZATIONS_(T_)                                                    \
+    template <> Vc_INTRINSIC SSE::Vector<T_> SSE::Vector<T_>::interleaveLow(             \
+        SSE::Vector<T_> x) const                                                         \
+    {                                                                                    \
+        return _mm_unpacklo_epi64(data(), x.data());                                     \
+    }                                                                                    \
+    template <> Vc_INTRINSIC SSE::Vector<T_> SSE::Vector<T_>::interleaveHigh(            \
+        SSE::Vector<T_> x) const                                                         \
+    {                                                                                    \
+        return _mm_unpackhi_epi64(data(), x.data());                                     \
+    }                                                                                    \
+    template <>                                                                          \
+    template <typename G>                                                                \
+    Vc_INTRINSIC SSE::Vector<T_> SSE::Vector<T_>::generate(G gen)                        \
+    {                                                                                    \
+        const auto tmp0 = gen(0);                                                        \
+        const auto tmp1 = gen(1);                                                        \
+        return _mm_set_epi64x(tmp1, tmp0);                                               \
+    }                                                                                    \
+    template <> Vc_INTRINSIC Vc_PURE SSE::Vector<T_> SSE::Vector<T_>::reversed() const  \
+    {                                                                                    \
+        return _mm_shuffle_epi32(d.v(), 0x4e);                                           \
+    }
+Vc_INT64_SPECIALIZATIONS_(long long)
+Vc_INT64_SPECIALIZATIONS_(unsigned long long)
+#if defined __LP64__ || defined _LP64
+Vc_INT64_SPECIALIZATIONS_(long)
+Vc_INT64_SPECIALIZATIONS_(unsigned long)
+#endif
+#undef Vc_INT64_SPECIALIZATIONS_
 // }}}1
 // permutation via operator[] {{{1
 template <>
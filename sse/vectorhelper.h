@@ -611,6 +611,227 @@ namespace SSE
 #undef Vc_SUFFIX
             static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
         };
+        template<> struct VectorHelper<signed char> {
+            typedef _M128I VectorType;
+            typedef signed char EntryType;
+#define Vc_SUFFIX si128
+
+            Vc_OP_(or_) Vc_OP_(and_) Vc_OP_(xor_)
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType zero() { return Vc_CAT2(_mm_setzero_, Vc_SUFFIX)(); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType notMaskedToZero(VectorType a, _M128 mask) { return Vc_CAT2(_mm_and_, Vc_SUFFIX)(_mm_castps_si128(mask), a); }
+            // truncating, like the conversion of int to signed char
+            static Vc_ALWAYS_INLINE Vc_CONST _M128I concat(_M128I a, _M128I b) {
+                const _M128I lo8 = _mm_srli_epi16(_mm_setallone_si128(), 8);
+                return _mm_packus_epi16(_mm_and_si128(a, lo8), _mm_and_si128(b, lo8));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST _M128I expand0(_M128I x) { return _mm_srai_epi16(_mm_unpacklo_epi8(x, x), 8); }
+            static Vc_ALWAYS_INLINE Vc_CONST _M128I expand1(_M128I x) { return _mm_srai_epi16(_mm_unpackhi_epi8(x, x), 8); }
+
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epi8
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType one() { return Vc_CAT2(_mm_setone_, Vc_SUFFIX)(); }
+
+            // there are no 8-bit shift instructions: shift 16-bit words and mask off the
+            // bits that crossed into the neighboring byte
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftLeft(VectorType a, int shift) {
+                return _mm_and_si128(_mm_slli_epi16(a, shift), _mm_set1_epi8(char(0xff << shift)));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftRight(VectorType a, int shift) {
+                const VectorType hi = _mm_srai_epi16(a, shift);
+                const VectorType lo = _mm_srai_epi16(_mm_slli_epi16(a, 8), shift);
+                return _mm_or_si128(_mm_andnot_si128(_mm_srli_epi16(_mm_setallone_si128(), 8), hi),
+                                    _mm_srli_epi16(lo, 8));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a) { return Vc_CAT2(_mm_set1_, Vc_SUFFIX)(a); }
+
+            static Vc_ALWAYS_INLINE void fma(VectorType &v1, VectorType v2, VectorType v3) {
+                v1 = add(mul(v1, v2), v3); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType abs(const VectorType a) { return abs_epi8(a); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType mul(VectorType a, VectorType b) {
+                // the low byte of each 16-bit product is exact, odd bytes are multiplied
+                // separately after shifting them down
+                const VectorType even = _mm_mullo_epi16(a, b);
+                const VectorType odd = _mm_mullo_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+                return _mm_or_si128(_mm_and_si128(even, _mm_srli_epi16(_mm_setallone_si128(), 8)),
+                                    _mm_slli_epi16(odd, 8));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType min(VectorType a, VectorType b) { return min_epi8(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType max(VectorType a, VectorType b) { return max_epi8(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType min(VectorType a) {
+                a = min(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)));
+                a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)));
+                a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)));
+                a = min(a, _mm_srli_epi16(a, 8));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType max(VectorType a) {
+                a = max(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)));
+                a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)));
+                a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)));
+                a = max(a, _mm_srli_epi16(a, 8));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType mul(VectorType a) {
+                a = mul(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)));
+                a = mul(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)));
+                a = mul(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)));
+                a = mul(a, _mm_srli_epi16(a, 8));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType add(VectorType a) {
+                // psadbw sums the bytes of each half; the sum modulo 256 is the same for
+                // signed and unsigned interpretation
+                a = _mm_sad_epu8(a, _mm_setzero_si128());
+                return _mm_cvtsi128_si32(_mm_add_epi32(a, _mm_unpackhi_epi64(a, a)));
+            }
+
+            Vc_OP(add) Vc_OP(sub)
+#undef Vc_SUFFIX
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
+        };
+
+        template<> struct VectorHelper<unsigned char> {
+            typedef _M128I VectorType;
+            typedef unsigned char EntryType;
+#define Vc_SUFFIX si128
+            Vc_OP_CAST_(or_) Vc_OP_CAST_(and_) Vc_OP_CAST_(xor_)
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType zero() { return Vc_CAT2(_mm_setzero_, Vc_SUFFIX)(); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType notMaskedToZero(VectorType a, _M128 mask) { return Vc_CAT2(_mm_and_, Vc_SUFFIX)(_mm_castps_si128(mask), a); }
+            static Vc_ALWAYS_INLINE Vc_CONST _M128I concat(_M128I a, _M128I b) { return VectorHelper<signed char>::concat(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST _M128I expand0(_M128I x) { return _mm_unpacklo_epi8(x, _mm_setzero_si128()); }
+            static Vc_ALWAYS_INLINE Vc_CONST _M128I expand1(_M128I x) { return _mm_unpackhi_epi8(x, _mm_setzero_si128()); }
+
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epu8
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType one() { return Vc_CAT2(_mm_setone_, Vc_SUFFIX)(); }
+
+            Vc_MINMAX
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType min(VectorType a) {
+                a = min(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)));
+                a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)));
+                a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)));
+                a = min(a, _mm_srli_epi16(a, 8));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType max(VectorType a) {
+                a = max(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)));
+                a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)));
+                a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)));
+                a = max(a, _mm_srli_epi16(a, 8));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType mul(VectorType a) { return VectorHelper<signed char>::mul(a); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType add(VectorType a) { return VectorHelper<signed char>::add(a); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType mul(const VectorType a, const VectorType b) {
+                return VectorHelper<signed char>::mul(a, b);
+            }
+
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epi8
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftLeft(VectorType a, int shift) {
+                return VectorHelper<signed char>::shiftLeft(a, shift);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftRight(VectorType a, int shift) {
+                return _mm_and_si128(_mm_srli_epi16(a, shift), _mm_set1_epi8(char(0xff >> shift)));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a) { return Vc_CAT2(_mm_set1_, Vc_SUFFIX)(a); }
+
+            static Vc_ALWAYS_INLINE void fma(VectorType &v1, VectorType v2, VectorType v3) { v1 = add(mul(v1, v2), v3); }
+
+            Vc_OP(add) Vc_OP(sub)
+#undef Vc_SUFFIX
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
+        };
+        template<> struct VectorHelper<long long> {
+            typedef _M128I VectorType;
+            typedef long long EntryType;
+#define Vc_SUFFIX si128
+
+            Vc_OP_(or_) Vc_OP_(and_) Vc_OP_(xor_)
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType zero() { return Vc_CAT2(_mm_setzero_, Vc_SUFFIX)(); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType notMaskedToZero(VectorType a, _M128 mask) { return Vc_CAT2(_mm_and_, Vc_SUFFIX)(_mm_castps_si128(mask), a); }
+
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epi64
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType one() { return _mm_set1_epi64x(1); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftLeft(VectorType a, int shift) {
+                return Vc_CAT2(_mm_slli_, Vc_SUFFIX)(a, shift);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftRight(VectorType a, int shift) {
+                return sra_epi64(a, shift);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a) { return _mm_set1_epi64x(a); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a, const EntryType b) { return _mm_set_epi64x(a, b); }
+
+            static Vc_ALWAYS_INLINE void fma(VectorType &v1, VectorType v2, VectorType v3) { v1 = add(mul(v1, v2), v3); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType mul(VectorType a, VectorType b) { return mullo_epi64(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType min(VectorType a, VectorType b) { return min_epi64(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType max(VectorType a, VectorType b) { return max_epi64(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType min(VectorType a) {
+                return _mm_cvtsi128_si64(min(a, _mm_unpackhi_epi64(a, a)));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType max(VectorType a) {
+                return _mm_cvtsi128_si64(max(a, _mm_unpackhi_epi64(a, a)));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType mul(VectorType a) {
+                return _mm_cvtsi128_si64(a) * _mm_cvtsi128_si64(_mm_unpackhi_epi64(a, a));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType add(VectorType a) {
+                return _mm_cvtsi128_si64(add(a, _mm_unpackhi_epi64(a, a)));
+            }
+
+            Vc_OP(add) Vc_OP(sub)
+#undef Vc_SUFFIX
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
+        };
+
+        template<> struct VectorHelper<unsigned long long> {
+            typedef _M128I VectorType;
+            typedef unsigned long long EntryType;
+#define Vc_SUFFIX si128
+            Vc_OP_CAST_(or_) Vc_OP_CAST_(and_) Vc_OP_CAST_(xor_)
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType zero() { return Vc_CAT2(_mm_setzero_, Vc_SUFFIX)(); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType notMaskedToZero(VectorType a, _M128 mask) { return Vc_CAT2(_mm_and_, Vc_SUFFIX)(_mm_castps_si128(mask), a); }
+
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epi64
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType one() { return _mm_set1_epi64x(1); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftLeft(VectorType a, int shift) {
+                return Vc_CAT2(_mm_slli_, Vc_SUFFIX)(a, shift);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftRight(VectorType a, int shift) {
+                return Vc_CAT2(_mm_srli_, Vc_SUFFIX)(a, shift);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a) { return _mm_set1_epi64x(a); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a, const EntryType b) { return _mm_set_epi64x(a, b); }
+
+            static Vc_ALWAYS_INLINE void fma(VectorType &v1, VectorType v2, VectorType v3) { v1 = add(mul(v1, v2), v3); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType mul(VectorType a, VectorType b) { return mullo_epi64(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType min(VectorType a, VectorType b) { return min_epu64(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType max(VectorType a, VectorType b) { return max_epu64(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType min(VectorType a) {
+                return _mm_cvtsi128_si64(min(a, _mm_unpackhi_epi64(a, a)));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType max(VectorType a) {
+                return _mm_cvtsi128_si64(max(a, _mm_unpackhi_epi64(a, a)));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType mul(VectorType a) { return VectorHelper<long long>::mul(a); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType add(VectorType a) { return VectorHelper<long long>::add(a); }
+
+            Vc_OP(add) Vc_OP(sub)
+#undef Vc_SUFFIX
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
+        };
+
+        // Vector<long> is only supported where long is 64 bits wide
+        template<> struct VectorHelper<long> : public VectorHelper<long long> {};
+        template<> struct VectorHelper<unsigned long> : public VectorHelper<unsigned long long> {};
 #undef Vc_OP1
 #undef Vc_OP
 #undef Vc_OP_
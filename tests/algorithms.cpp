@@ -0,0 +1,210 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/execution>
+#include <numeric>
+#include <typeinfo>
+
+#ifdef Vc_CXX14
+// the tests start at data.begin() + 1 to exercise the unaligned prologue
+
+// simdTransform{{{1
+TEST_TYPES(V, simdTransform, (ALL_VECTORS))
+{
+    typedef typename V::EntryType T;
+    for (std::size_t size : {1u, 2u, 17u, 100u, 100003u}) {
+        std::vector<T> data(size + 1);
+        std::iota(data.begin(), data.end(), T(0));
+        std::vector<T> out(size);
+        auto &&op = [](auto x) { return x * 2 + 1; };
+        auto &&check = [&](const char *variant) {
+            for (std::size_t i = 0; i < size; ++i) {
+                COMPARE(out[i], T(data[i + 1] * 2 + 1)) << variant << ", i = " << i;
+            }
+        };
+
+        COMPARE(Vc::simd_transform(data.begin() + 1, data.end(), out.begin(), op), out.end());
+        check("sequential");
+        std::fill(out.begin(), out.end(), T(0));
+        COMPARE(Vc::simd_transform(Vc::par_simd, data.begin() + 1, data.end(), out.begin(), op),
+                out.end());
+        check("par_simd");
+    }
+}
+
+// simdTransformReduce{{{1
+TEST_TYPES(V, simdTransformReduce, (ALL_VECTORS))
+{
+    typedef typename V::EntryType T;
+    for (std::size_t size : {0u, 1u, 17u, 100u, 60001u}) {
+        std::vector<T> data(size + 1);
+        for (std::size_t i = 0; i < data.size(); ++i) {
+            data[i] = T(i % 5);
+        }
+        T sum = 1;
+        T maximum = 0;
+        for (std::size_t i = 1; i < data.size(); ++i) {
+            sum += data[i] == 4 ? 1 : 0;
+            maximum = std::max(maximum, T(data[i] * 3));
+        }
+        auto &&plus = [](auto a, auto b) { return a + b; };
+        auto &&isFour = [](auto x) { return iif(x == 4, decltype(x)(1), decltype(x)(0)); };
+        auto &&max = [](auto a, auto b) { return Vc::max(a, b); };
+        auto &&triple = [](auto x) { return x * 3; };
+
+        COMPARE(Vc::simd_transform_reduce(data.begin() + 1, data.end(), T(1), plus, isFour),
+                sum);
+        COMPARE(Vc::simd_transform_reduce(Vc::par_simd, data.begin() + 1, data.end(), T(1),
+                                          plus, isFour),
+                sum);
+        COMPARE(Vc::simd_transform_reduce(data.begin() + 1, data.end(), T(0), max, triple),
+                maximum);
+        COMPARE(Vc::simd_transform_reduce(Vc::par_simd, data.begin() + 1, data.end(), T(0),
+                                          max, triple),
+                maximum);
+    }
+}
+
+// simdCountIf{{{1
+TEST_TYPES(V, simdCountIf, (ALL_VECTORS))
+{
+    typedef typename V::EntryType T;
+    for (std::size_t size : {0u, 1u, 17u, 100u, 100003u}) {
+        std::vector<T> data(size + 1);
+        for (std::size_t i = 0; i < data.size(); ++i) {
+            data[i] = T(i % 7);
+        }
+        const auto reference = std::count_if(data.begin() + 1, data.end(),
+                                             [](T x) { return x > 3; });
+        auto &&pred = [](auto x) { return x > 3; };
+        COMPARE(Vc::simd_count_if(data.begin() + 1, data.end(), pred), reference);
+        COMPARE(Vc::simd_count_if(Vc::par_simd, data.begin() + 1, data.end(), pred),
+                reference);
+    }
+}
+
+// simdCopyIf{{{1
+TEST_TYPES(V, simdCopyIf, (ALL_VECTORS))
+{
+    typedef typename V::EntryType T;
+    for (std::size_t size : {0u, 1u, 17u, 100u, 100003u}) {
+        std::vector<T> data(size + 1);
+        for (std::size_t i = 0; i < data.size(); ++i) {
+            data[i] = T((i * 7) % 11);
+        }
+        for (T threshold : {T(0), T(3), T(5), T(11)}) {
+            auto &&pred = [&](auto x) { return x >= threshold; };
+            std::vector<T> reference;
+            std::copy_if(data.begin() + 1, data.end(), std::back_inserter(reference),
+                         [&](T x) { return x >= threshold; });
+
+            // the output is exactly as large as the result, so writing too much is
+            // detected by the sanitizers
+            std::vector<T> out(reference.size());
+            COMPARE(Vc::simd_copy_if(data.begin() + 1, data.end(), out.begin(), pred),
+                    out.end());
+            COMPARE(out, reference) << "threshold = " << threshold;
+
+            std::vector<T> inplace(data);
+            const auto end = Vc::simd_remove_if(inplace.begin() + 1, inplace.end(),
+                                                [&](auto x) { return x < threshold; });
+            COMPARE(std::size_t(end - inplace.begin() - 1), reference.size());
+            COMPARE(std::vector<T>(inplace.begin() + 1, end), reference)
+                << "threshold = " << threshold;
+        }
+    }
+}
+
+// maskedEpilogue{{{1
+TEST_TYPES(V, maskedEpilogue, (ALL_VECTORS))
+{
+    typedef typename V::EntryType T;
+    std::vector<T> data(3 * V::Size + 2);
+    for (std::size_t offset = 0; offset <= V::Size; ++offset) {
+        for (std::size_t size = 0; offset + size + 1 < data.size(); ++size) {
+            std::iota(data.begin(), data.end(), T(1));
+            const auto first = data.begin() + offset;
+            int calls = 0;
+            auto &&test = [&](auto &x) {
+                COMPARE(typeid(x), typeid(V));
+                ++calls;
+                x += 1;
+            };
+            Vc::simd_for_each(Vc::MaskedEpilogue, first, first + size, test);
+            for (std::size_t i = 0; i < data.size(); ++i) {
+                const bool inRange = i >= offset && i < offset + size;
+                COMPARE(data[i], T(i + 1 + (inRange ? 1 : 0)))
+                    << "i = " << i << ", offset = " << offset << ", size = " << size;
+            }
+            VERIFY(calls <= int((size + V::Size - 1) / V::Size + 1)) << calls;
+
+            // immutable functors see zeros in the lanes outside of the range
+            T sum = 0;
+            Vc::simd_for_each_n(Vc::MaskedEpilogue, first, size,
+                                [&](const V &x) { sum += x.sum(); });
+            COMPARE(sum, std::accumulate(first, first + size, T(0)));
+        }
+    }
+}
+
+// parallelForEach{{{1
+TEST_TYPES(V, parallelForEach, (ALL_VECTORS))
+{
+    typedef typename V::EntryType T;
+    const std::size_t size = 100003;
+    std::vector<T> data(size + 1, T(1));
+    // every element must be visited exactly once
+    Vc::simd_for_each(Vc::par_simd, data.begin() + 1, data.end(), [](auto &x) { x += 1; });
+    Vc::simd_for_each_n(Vc::par_simd, data.begin() + 1, size, [](auto &x) { x += 2; });
+    COMPARE(data[0], T(1));
+    for (std::size_t i = 1; i < data.size(); ++i) {
+        COMPARE(data[i], T(4)) << "i = " << i;
+    }
+
+    std::atomic<std::size_t> visited(0);
+    Vc::simd_for_each(Vc::par_simd, data.begin(), data.end(),
+                      [&](const auto &x) { visited += x.Size; });
+    COMPARE(visited.load(), data.size());
+}
+
+// nestedParallelFor{{{1
+TEST(nestedParallelFor)
+{
+    std::vector<float> data(100000, 1.f);
+    std::atomic<int> count(0);
+    Vc::simd_for_each(Vc::par_simd, data.begin(), data.end(), [&](const auto &x) {
+        // a nested invocation must not deadlock
+        count += int(Vc::simd_count_if(Vc::par_simd, data.begin(), data.begin() + 10,
+                                       [](auto y) { return y > 0.f; }) *
+                     x.Size);
+    });
+    COMPARE(count.load(), 1000000);
+}
+#endif
+
+// vim: foldmethod=marker
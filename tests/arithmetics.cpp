@@ -34,7 +34,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 using namespace Vc;
 
-#define ALL_TYPES (ALL_VECTORS)
+#define ALL_TYPES (ALL_VECTORS, EXTRA_INT_VECTORS)
 #if 0
 #define ALL_TYPES                                                                                  \
     (SIMD_ARRAYS(32),                                                                              \
@@ -90,14 +90,14 @@ TEST_TYPES(Vec, testCmp, ALL_TYPES)
     {
         const T max = static_cast<T>(std::numeric_limits<T>::max() * 0.95);
         const T min = 0;
-        const T step = max / 200;
+        const T step = std::max<T>(1, max / 200);  // 8-bit types have fewer values
         T j = min;
         VERIFY(all_of(Vec(Zero) == Vec(j)));
         VERIFY(none_of(Vec(Zero) < Vec(j)));
         VERIFY(none_of(Vec(Zero) > Vec(j)));
         VERIFY(none_of(Vec(Zero) != Vec(j)));
         j += step;
-        for (int i = 0; i < 200; ++i, j += step) {
+        for (int i = 0; i < 200 && j <= max; ++i, j += step) {
             if(all_of(Vec(Zero) >= Vec(j))) {
                 std::cout << j << " " << Vec(j) << " " << (Vec(Zero) >= Vec(j)) << std::endl;
             }
@@ -112,9 +112,9 @@ TEST_TYPES(Vec, testCmp, ALL_TYPES)
         if (min == 0) {
             return;
         }
-        const T step = min / T(-201);
+        const T step = std::max<T>(1, min / T(-201));
         T j = min;
-        for (int i = 0; i < 200; ++i, j += step) {
+        for (int i = 0; i < 200 && j < 0; ++i, j += step) {
             VERIFY(all_of(Vec(j) < Vec(Zero)));
             VERIFY(all_of(Vec(Zero) > Vec(j)));
             VERIFY(none_of(Vec(Zero) <= Vec(j)));
@@ -281,16 +281,20 @@ TEST_TYPES(Vec, testDiv, ALL_TYPES)
 }
 
 // testModulo{{{1
-TEST_TYPES(V, testModulo, (SIMD_INT_ARRAYS(32), SIMD_INT_ODD_ARRAYS(31), INT_VECTORS))
+TEST_TYPES(V, testModulo, (SIMD_INT_ARRAYS(32), SIMD_INT_ODD_ARRAYS(31), INT_VECTORS,
+                            EXTRA_INT_VECTORS))
 {
     using T = typename V::EntryType;
+    // -1024 and 256 wrap to 0 in 8-bit entries
+    const T nonzero = sizeof(T) == 1 ? T(-64) : T(-1024);
+    const int modulus = sizeof(T) == 1 ? 64 : 256;
     alignas(static_cast<size_t>(V::MemoryAlignment)) T x_mem[V::size()];
     alignas(static_cast<size_t>(V::MemoryAlignment)) T y_mem[V::size()];
     for (int repetition = 0; repetition < 1000; ++repetition) {
         const V x = V::Random();
         x.store(x_mem, Vc::Aligned);
         V y = (V::Random() & 2047) - 1023;
-        y(y == 0) = -1024;
+        y(y == 0) = nonzero;
         y.store(y_mem, Vc::Aligned);
         {
             const V z = x % y;
@@ -301,27 +305,32 @@ TEST_TYPES(V, testModulo, (SIMD_INT_ARRAYS(32), SIMD_INT_ODD_ARRAYS(31), INT_VEC
             COMPARE(y % y, V::Zero());
         }
         {
-            const V z = x % 256;
-            const V reference = V::generate([&](size_t i) { return x_mem[i] % 256; });
+            const V z = x % modulus;
+            const V reference =
+                V::generate([&](size_t i) { return x_mem[i] % modulus; });
             COMPARE(z, reference) << ", x: " << x;
         }
     }
 }
 
 // testAnd{{{1
-TEST_TYPES(Vec, testAnd, (int_v, ushort_v, uint_v, short_v))
+TEST_TYPES(Vec, testAnd, (INT_VECTORS, EXTRA_INT_VECTORS))
 {
     Vec a(0x7fff);
     Vec b(0xf);
     COMPARE((a & 0xf), b);
     Vec c(IndexesFromZero);
-    COMPARE(c, (c & 0xf));
-    const typename Vec::EntryType zero = 0;
-    COMPARE((c & 0x7ff0), Vec(zero));
+    if (Vec::Size <= 16) {
+        COMPARE(c, (c & 0xf));
+        const typename Vec::EntryType zero = 0;
+        COMPARE((c & 0x7ff0), Vec(zero));
+    } else {  // 32 entries of 8 bits
+        COMPARE((c & 0xf), c - (c & 0x70));
+    }
 }
 
 // testShift{{{1
-TEST_TYPES(Vec, testShift, (int_v, ushort_v, uint_v, short_v))
+TEST_TYPES(Vec, testShift, (INT_VECTORS, EXTRA_INT_VECTORS))
 {
     typedef typename Vec::EntryType T;
     const T step = std::max<T>(1, std::numeric_limits<T>::max() / 1000);
@@ -375,7 +384,8 @@ TEST_TYPES(Vec, testShift, (int_v, ushort_v, uint_v, short_v))
 }
 
 // testOnesComplement{{{1
-TEST_TYPES(Vec, testOnesComplement, (INT_VECTORS, SIMD_INT_ODD_ARRAYS(17)))
+TEST_TYPES(Vec, testOnesComplement,
+           (INT_VECTORS, EXTRA_INT_VECTORS, SIMD_INT_ODD_ARRAYS(17)))
 {
     Vec a(One);
     Vec b = ~a;
@@ -416,6 +426,14 @@ template<> const int NegateRangeHelper<short>::Start = -0x7fff;
 template<> const int NegateRangeHelper<short>::End = 0x7fff - 0xee;
 template<> const int NegateRangeHelper<unsigned short>::Start = 0;
 template<> const int NegateRangeHelper<unsigned short>::End = 0xffff - 0xee;
+template<> const int NegateRangeHelper<signed char>::Start = -0x7f;
+template<> const int NegateRangeHelper<signed char>::End = 0x7f;
+template<> const int NegateRangeHelper<unsigned char>::Start = 0;
+template<> const int NegateRangeHelper<unsigned char>::End = 0xff;
+template<> const int NegateRangeHelper<std::int64_t>::Start = -0x7fffffff;
+template<> const int NegateRangeHelper<std::int64_t>::End = 0x7fffffff - 0xee;
+template<> const int NegateRangeHelper<std::uint64_t>::Start = 0;
+template<> const int NegateRangeHelper<std::uint64_t>::End = 0x7fffffff - 0xee;
 
 TEST_TYPES(Vec, testNegate, ALL_TYPES)
 {
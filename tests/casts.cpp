@@ -34,6 +34,12 @@ using namespace Vc;
 // EXTRA_IMPL_VECTORS {{{1
 #ifdef Vc_IMPL_Scalar
 #define EXTRA_IMPL_VECTORS
+#elif defined Vc_IMPL_AVX512
+#define EXTRA_IMPL_VECTORS                                                               \
+    Vc::Scalar::int_v, Vc::Scalar::ushort_v, Vc::Scalar::double_v, Vc::Scalar::uint_v,   \
+        Vc::Scalar::short_v, Vc::Scalar::float_v, Vc::SSE::int_v, Vc::SSE::ushort_v,     \
+        Vc::SSE::double_v, Vc::SSE::uint_v, Vc::SSE::short_v, Vc::SSE::float_v,          \
+        Vc::AVX2::int_v, Vc::AVX2::double_v, Vc::AVX2::uint_v, Vc::AVX2::float_v
 #elif defined Vc_IMPL_AVX2
 #define EXTRA_IMPL_VECTORS                                                               \
     Vc::Scalar::int_v, Vc::Scalar::ushort_v, Vc::Scalar::double_v, Vc::Scalar::uint_v,   \
@@ -59,6 +65,10 @@ using AllTestTypes = outer_product<Typelist<ALL_VECTORS>, Typelist<ALL_VECTORS>>
 using AllTestTypes =
     concat<outer_product<Typelist<ALL_VECTORS>, Typelist<EXTRA_IMPL_VECTORS>>,
            outer_product<Typelist<EXTRA_IMPL_VECTORS>, Typelist<ALL_VECTORS>>>;
+#elif defined Vc_EXTRA_INT_TYPES
+using AllTestTypes = concat<
+    outer_product<Typelist<EXTRA_INT_VECTORS>, Typelist<ALL_VECTORS, EXTRA_INT_VECTORS>>,
+    outer_product<Typelist<ALL_VECTORS>, Typelist<EXTRA_INT_VECTORS>>>;
 #elif defined Vc_FROM_N
 #ifdef Vc_TO_N
 using AllTestTypes =
@@ -0,0 +1,166 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <complex>
+
+using namespace Vc;
+
+#define ALL_TYPES                                                                        \
+    (float_v, double_v, SimdArray<float, 8>, SimdArray<float, 3>, SimdArray<double, 5>)
+
+template <typename V> complex<V> testValues(int seed)
+{
+    using T = typename V::EntryType;
+    return {V::generate([&](int i) { return T((i * 7 + seed * 13) % 23 - 11) * T(0.25); }),
+            V::generate([&](int i) { return T((i * 5 + seed * 3) % 17 - 7) * T(0.5); })};
+}
+
+// relative error of a computed complex value against the double precision reference
+template <typename T> double relativeError(std::complex<T> x, std::complex<double> ref)
+{
+    const double d = std::abs(std::complex<double>(x.real(), x.imag()) - ref);
+    return std::abs(ref) == 0 ? d : d / std::abs(ref);
+}
+
+template <typename T> double tolerance() { return sizeof(T) == 4 ? 1e-5 : 1e-13; }
+
+#define COMPARE_COMPLEX(x_, ref_)                                                        \
+    VERIFY(relativeError(x_, ref_) <= tolerance<T>()) << "got " << x_ << ", expected "   \
+                                                      << ref_
+
+// loadStore{{{1
+TEST_TYPES(V, loadStore, ALL_TYPES)
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t N = V::Size;
+    alignas(static_cast<std::size_t>(V::MemoryAlignment)) std::complex<T> mem[3 * N + 1];
+    for (std::size_t i = 0; i < 3 * N + 1; ++i) {
+        mem[i] = {T(i), T(-2 * int(i))};
+    }
+    complex<V> zero;
+    COMPARE(zero.real(), V::Zero());
+    COMPARE(zero.imag(), V::Zero());
+    complex<V> z(mem, Vc::Aligned);
+    for (std::size_t i = 0; i < N; ++i) {
+        COMPARE(z[i], mem[i]);
+        COMPARE(z.real()[i], T(i));
+        COMPARE(z.imag()[i], T(-2 * int(i)));
+    }
+    z.load(&mem[1], Vc::Unaligned);
+    for (std::size_t i = 0; i < N; ++i) {
+        COMPARE(z[i], mem[i + 1]);
+    }
+
+    z = testValues<V>(1);
+    z.store(&mem[N], Vc::Aligned);
+    for (std::size_t i = 0; i < N; ++i) {
+        COMPARE(mem[N + i], z[i]);
+    }
+    COMPARE(mem[2 * N], std::complex<T>(T(2 * N), T(-4 * int(N))));
+    z.store(&mem[1], Vc::Unaligned);
+    COMPARE(mem[0], std::complex<T>());
+    for (std::size_t i = 0; i < N; ++i) {
+        COMPARE(mem[1 + i], z[i]);
+    }
+    COMPARE(all_of(complex<V>(&mem[1], Vc::Unaligned) == z), true);
+
+    COMPARE(all_of(complex<V>() == complex<V>(V::Zero(), V::Zero())), true);
+    const complex<V> b(std::complex<T>(T(1), T(2)));
+    for (std::size_t i = 0; i < N; ++i) {
+        COMPARE(b[i], std::complex<T>(T(1), T(2)));
+    }
+}
+
+// arithmetics{{{1
+TEST_TYPES(V, arithmetics, ALL_TYPES)
+{
+    using T = typename V::EntryType;
+    using C = std::complex<double>;
+    for (int seed = 0; seed < 20; ++seed) {
+        const complex<V> a = testValues<V>(seed);
+        complex<V> b = testValues<V>(seed + 7);
+        b.real(b.real() + T(0.125));  // no zero divisors
+        const V s = V::generate([&](int i) { return T(i + seed) * T(0.5) + T(1); });
+        const complex<V> sum = a + b, diff = a - b, prod = a * b, quot = a / b,
+                         neg = -a, conjProd = mul_conj(a, b);
+        const complex<V> sumS = a + s, diffS = s - a, prodS = a * s, quotS = a / s,
+                         quotS2 = s / b;
+        complex<V> acc = a;
+        acc *= b;
+        acc += s;
+        acc /= b;
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            const C x(a.real()[i], a.imag()[i]), y(b.real()[i], b.imag()[i]);
+            const double z = s[i];
+            COMPARE(sum[i], std::complex<T>(x + y));
+            COMPARE(diff[i], std::complex<T>(x - y));
+            COMPARE(neg[i], std::complex<T>(-x));
+            COMPARE_COMPLEX(prod[i], x * y);
+            COMPARE_COMPLEX(quot[i], x / y);
+            COMPARE_COMPLEX(conjProd[i], x * std::conj(y));
+            COMPARE(sumS[i], std::complex<T>(x + z));
+            COMPARE(diffS[i], std::complex<T>(z - x));
+            COMPARE_COMPLEX(prodS[i], x * z);
+            COMPARE_COMPLEX(quotS[i], x / z);
+            COMPARE_COMPLEX(quotS2[i], z / y);
+            COMPARE_COMPLEX(acc[i], (x * y + z) / y);
+        }
+        COMPARE(all_of(a == a), true);
+        COMPARE(any_of(a != a), false);
+        COMPARE(all_of(a + T(1) != a), true);
+    }
+}
+
+// functions{{{1
+TEST_TYPES(V, functions, ALL_TYPES)
+{
+    using T = typename V::EntryType;
+    using C = std::complex<double>;
+    for (int seed = 0; seed < 20; ++seed) {
+        const complex<V> a = testValues<V>(seed);
+        const complex<V> c = conj(a), e = exp(a);
+        const V n = norm(a), m = abs(a), phi = arg(a);
+        const complex<V> p = polar(m, phi);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            const C x(a.real()[i], a.imag()[i]);
+            COMPARE(real(a)[i], a.real()[i]);
+            COMPARE(imag(a)[i], a.imag()[i]);
+            COMPARE(c[i], std::complex<T>(std::conj(x)));
+            COMPARE_COMPLEX(e[i], std::exp(x));
+            COMPARE_COMPLEX(p[i], x);
+            FUZZY_COMPARE(n[i], T(std::norm(x)));
+            FUZZY_COMPARE(m[i], T(std::abs(x)));
+            if (std::abs(x) != 0) {
+                VERIFY(std::abs(phi[i] - std::arg(x)) <= 4 * tolerance<T>())
+                    << phi[i] << " vs. " << std::arg(x);
+            }
+        }
+    }
+}
+
+// vim: foldmethod=marker
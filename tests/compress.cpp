@@ -0,0 +1,98 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+
+#define ALL_TYPES (ALL_VECTORS, SIMD_ARRAY_LIST)
+
+// calls f for all masks of V, or for random ones if there are too many
+template <typename V, typename F> void forMasks(F &&f)
+{
+    if (V::Size <= 12) {
+        for (std::size_t i = 0; i < (std::size_t(1) << V::Size); ++i) {
+            f(UnitTest::allMasks<V>(i));
+        }
+    } else {
+        UnitTest::withRandomMask<V, 5000>(f);
+    }
+}
+
+// compressStore{{{1
+TEST_TYPES(V, compressStore, ALL_TYPES)
+{
+    using T = typename V::EntryType;
+    using M = typename V::Mask;
+    const V x = V::IndexesFromZero() + 1;
+    forMasks<V>([&](const M &k) {
+        T mem[2 * V::Size + 1];
+        std::fill_n(mem, 2 * V::Size + 1, T(-1));
+        const std::size_t n = x.compressStore(mem + 1, k);
+        COMPARE(n, std::size_t(k.count())) << k;
+        COMPARE(mem[0], T(-1));
+        std::size_t j = 1;
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            if (k[i]) {
+                COMPARE(mem[j], x[i]) << "i = " << i << ", mask = " << k;
+                ++j;
+            }
+        }
+        for (; j < 2 * V::Size + 1; ++j) {
+            COMPARE(mem[j], T(-1)) << "wrote beyond the selected values, mask = " << k;
+        }
+    });
+}
+
+// expandLoad{{{1
+TEST_TYPES(V, expandLoad, ALL_TYPES)
+{
+    using T = typename V::EntryType;
+    using M = typename V::Mask;
+    T mem[V::Size + 1];
+    for (std::size_t i = 0; i < V::Size + 1; ++i) {
+        mem[i] = T(i + 1);
+    }
+    forMasks<V>([&](const M &k) {
+        const V x = Vc::expandLoad(mem + 1, k);
+        std::size_t j = 1;
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            if (k[i]) {
+                COMPARE(x[i], mem[j]) << "i = " << i << ", mask = " << k;
+                ++j;
+            } else {
+                COMPARE(x[i], T(0)) << "i = " << i << ", mask = " << k;
+            }
+        }
+
+        // expandLoad is the inverse of compressStore
+        T tmp[V::Size];
+        const V y = V::IndexesFromZero() + 1;
+        y.compressStore(tmp, k);
+        COMPARE(Vc::expandLoad(tmp, k), iif(k, y, V(0))) << k;
+    });
+}
+
+// vim: foldmethod=marker
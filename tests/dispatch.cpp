@@ -0,0 +1,77 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/dispatch>
+#include "dispatch_kernels.h"
+
+TEST(resolveOnce)
+{
+    const auto f = Vc::resolve<Scale>();
+    VERIFY(f != nullptr);
+    COMPARE(Vc::resolve<Scale>(), f);
+}
+
+TEST(bestSupported)
+{
+    const unsigned int features = Vc::dispatch<CompiledFor>();
+    const auto impl = static_cast<Vc::Implementation>(features & Vc::ImplementationMask);
+    VERIFY(Vc::isImplementationSupported(impl)) << impl;
+    const unsigned int extra = features & Vc::ExtraInstructionsMask;
+    COMPARE(extra & Vc::extraInstructionsSupported(), extra);
+
+    // the kernels are compiled for Scalar, SSE2, SSE4.1, AVX, AVX2+FMA+BMI2, and
+    // AVX512+FMA+BMI2; the dispatcher must pick the best of them the CPU supports
+    const bool fmaBmi2 = (Vc::extraInstructionsSupported() &
+                          (Vc::FmaInstructions | Vc::Bmi2Instructions)) ==
+                         (Vc::FmaInstructions | Vc::Bmi2Instructions);
+    Vc::Implementation expected = Vc::ScalarImpl;
+    if (fmaBmi2 && Vc::isImplementationSupported(Vc::AVX512Impl)) {
+        expected = Vc::AVX512Impl;
+    } else if (fmaBmi2 && Vc::isImplementationSupported(Vc::AVX2Impl)) {
+        expected = Vc::AVX2Impl;
+    } else if (Vc::isImplementationSupported(Vc::AVXImpl)) {
+        expected = Vc::AVXImpl;
+    } else if (Vc::isImplementationSupported(Vc::SSE41Impl)) {
+        expected = Vc::SSE41Impl;
+    } else if (Vc::isImplementationSupported(Vc::SSE2Impl)) {
+        expected = Vc::SSE2Impl;
+    }
+    COMPARE(impl, expected);
+}
+
+TEST(callKernel)
+{
+    float data[37];
+    for (int i = 0; i < 37; ++i) {
+        data[i] = i;
+    }
+    Vc::dispatch<Scale>(2.f, &data[0], 37u);
+    for (int i = 0; i < 37; ++i) {
+        COMPARE(data[i], 2.f * i);
+    }
+}
@@ -0,0 +1,127 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <limits>
+
+using namespace Vc;
+
+#define INT_TYPES (int_v, uint_v, short_v, ushort_v)
+
+template <typename T> struct Bits : std::integral_constant<int, 8 * sizeof(T)> {};
+
+template <typename V> void checkDivisor(const V &n, typename V::EntryType d)
+{
+    typedef typename V::EntryType T;
+    const divider<V> div(d);
+    COMPARE(div.divisor(), d);
+    const V q = n / div, r = n % div;
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        if (std::is_signed<T>::value && d == T(-1) && n[i] == std::numeric_limits<T>::min()) {
+            continue;  // undefined
+        }
+        COMPARE(q[i], T(n[i] / d)) << "n = " << n[i] << ", d = " << d;
+        COMPARE(r[i], T(n[i] % d)) << "n = " << n[i] << ", d = " << d;
+    }
+}
+
+// interesting numerators and divisors: around 0, powers of two, and the limits
+template <typename T> std::vector<T> specialValues()
+{
+    std::vector<T> v;
+    for (int i = 0; i < Bits<T>::value; ++i) {
+        const T p = T(T(1) << i);
+        for (T x : {T(p - 1), p, T(p + 1)}) {
+            v.push_back(x);
+            if (std::is_signed<T>::value) {
+                v.push_back(T(-x));
+            }
+        }
+    }
+    for (T x : {T(0), T(3), T(7), T(10), T(641), std::numeric_limits<T>::min(),
+                std::numeric_limits<T>::max(), T(std::numeric_limits<T>::max() - 1),
+                T(std::numeric_limits<T>::min() + 1)}) {
+        v.push_back(x);
+    }
+    return v;
+}
+
+// special{{{1
+TEST_TYPES(V, special, INT_TYPES)
+{
+    typedef typename V::EntryType T;
+    const auto values = specialValues<T>();
+    for (T d : values) {
+        if (d == 0) {
+            continue;
+        }
+        for (std::size_t i = 0; i < values.size(); i += V::Size) {
+            checkDivisor(V::generate([&](std::size_t j) { return values[(i + j) % values.size()]; }), d);
+        }
+    }
+}
+
+// random{{{1
+TEST_TYPES(V, random, INT_TYPES)
+{
+    typedef typename V::EntryType T;
+    for (int repetition = 0; repetition < 10000; ++repetition) {
+        T d = V::Random()[0];
+        if (repetition % 3 == 0) {
+            d >>= repetition % Bits<T>::value;  // small divisors
+        }
+        if (d == 0) {
+            continue;
+        }
+        checkDivisor(V::Random(), d);
+    }
+}
+
+// exhaustive16{{{1
+TEST_TYPES(V, exhaustive16, (short_v, ushort_v))
+{
+    // every divisor with a sample of the numerators
+    typedef typename V::EntryType T;
+    for (int d = std::numeric_limits<T>::min(); d <= std::numeric_limits<T>::max(); ++d) {
+        if (d == 0) {
+            continue;
+        }
+        const divider<V> div{T(d)};
+        for (int n0 = std::numeric_limits<T>::min(); n0 <= std::numeric_limits<T>::max();
+             n0 += 251 * int(V::Size)) {
+            const V n = V::generate([&](int i) { return T(n0 + 251 * i); });
+            const V q = n / div;
+            const V ref = V::generate([&](int i) {
+                return d == -1 ? T(-int(n[i])) : T(n[i] / T(d));
+            });
+            COMPARE(q, ref) << "d = " << d;
+        }
+    }
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,124 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+/*includes {{{*/
+#include "unittest.h"
+#include <cmath>
+/*}}}*/
+using namespace Vc;
+
+using RealTypes = concat<RealVectors, RealSimdArrays>;
+
+// The fuzzyness values are the maximal ulp distances measured over 2·10⁶ random inputs
+// (SSE and AVX2, rounded up). Bits12 must stay within a relative error of 2⁻¹². The
+// measured relative errors are about 2⁻¹³ (exp), 2⁻¹⁵ (log), and 2⁻¹⁴ (sin, cos).
+
+// relativeErrorBelow{{{1
+template <typename V> bool relativeErrorBelow(V x, V reference, int bits)
+{
+    using T = typename V::EntryType;
+    return all_of(Vc::abs(x - reference) <= Vc::abs(reference) * T(std::ldexp(1., -bits)));
+}
+
+TEST_TYPES(V, testExp, (RealTypes)) //{{{1
+{
+    UnitTest::setFuzzyness<float>(3);
+    UnitTest::setFuzzyness<double>(3);
+    typedef typename V::EntryType T;
+    // all results are normal
+    const T limit = std::is_same<T, float>::value ? 87 : 708;
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        const V x = (V::Random() - T(.5)) * T(2 * limit);
+        const V reference = x.apply([](T _x) { return std::exp(_x); });
+        FUZZY_COMPARE(Vc::fast::exp(x), reference) << ", x = " << x << ", i = " << i;
+        VERIFY(relativeErrorBelow(Vc::fast::exp<Vc::fast::Bits12>(x), reference, 12))
+            << "x = " << x << ", i = " << i;
+    }
+    COMPARE(Vc::fast::exp(V::Zero()), V::One());
+}
+
+TEST_TYPES(V, testLog, (RealTypes)) //{{{1
+{
+    UnitTest::setFuzzyness<float>(1);
+    UnitTest::setFuzzyness<double>(1);
+    typedef typename V::EntryType T;
+    typedef std::numeric_limits<T> L;
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        // all positive normal numbers
+        V x = Vc::exp2(V::Random() * T(L::max_exponent - L::min_exponent) +
+                       T(L::min_exponent));
+        V reference = x.apply([](T _x) { return std::log(_x); });
+        FUZZY_COMPARE(Vc::fast::log(x), reference) << ", x = " << x << ", i = " << i;
+        VERIFY(relativeErrorBelow(Vc::fast::log<Vc::fast::Bits12>(x), reference, 12))
+            << "x = " << x << ", i = " << i;
+        // close to 1
+        x = V::Random() + T(.5);
+        reference = x.apply([](T _x) { return std::log(_x); });
+        FUZZY_COMPARE(Vc::fast::log(x), reference) << ", x = " << x << ", i = " << i;
+        VERIFY(relativeErrorBelow(Vc::fast::log<Vc::fast::Bits12>(x), reference, 12))
+            << "x = " << x << ", i = " << i;
+    }
+    COMPARE(Vc::fast::log(V::One()), V::Zero());
+}
+
+TEST_TYPES(V, testSinCos, (RealTypes)) //{{{1
+{
+    UnitTest::setFuzzyness<float>(2);
+    UnitTest::setFuzzyness<double>(2);
+    typedef typename V::EntryType T;
+    typedef std::numeric_limits<T> L;
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        // the relative error bound holds for |x| ≤ π
+        V x = (V::Random() - T(.5)) * T(2 * 3.14159);
+        V reference = x.apply([](T _x) { return std::sin(_x); });
+        FUZZY_COMPARE(Vc::fast::sin(x), reference) << ", x = " << x << ", i = " << i;
+        VERIFY(relativeErrorBelow(Vc::fast::sin<Vc::fast::Bits12>(x), reference, 12))
+            << "x = " << x << ", i = " << i;
+        reference = x.apply([](T _x) { return std::cos(_x); });
+        FUZZY_COMPARE(Vc::fast::cos(x), reference) << ", x = " << x << ", i = " << i;
+        VERIFY(relativeErrorBelow(Vc::fast::cos<Vc::fast::Bits12>(x), reference, 12))
+            << "x = " << x << ", i = " << i;
+
+        // and the absolute error bound up to the end of the supported range
+        x = (V::Random() - T(.5)) * T(2 * 4095);
+        reference = x.apply([](T _x) { return std::sin(_x); });
+        VERIFY(all_of(Vc::abs(Vc::fast::sin(x) - reference) <= L::epsilon()))
+            << "x = " << x << ", i = " << i;
+        VERIFY(all_of(Vc::abs(Vc::fast::sin<Vc::fast::Bits12>(x) - reference) <=
+                      T(std::ldexp(1., -12))))
+            << "x = " << x << ", i = " << i;
+        reference = x.apply([](T _x) { return std::cos(_x); });
+        VERIFY(all_of(Vc::abs(Vc::fast::cos(x) - reference) <= L::epsilon()))
+            << "x = " << x << ", i = " << i;
+        VERIFY(all_of(Vc::abs(Vc::fast::cos<Vc::fast::Bits12>(x) - reference) <=
+                      T(std::ldexp(1., -12))))
+            << "x = " << x << ", i = " << i;
+    }
+    COMPARE(Vc::fast::sin(V::Zero()), V::Zero());
+    COMPARE(Vc::fast::cos(V::Zero()), V::One());
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,188 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <Vc/fft>
+#include <complex>
+#include <vector>
+
+using namespace Vc;
+
+typedef std::complex<double> C;
+
+template <typename T> double tolerance() { return sizeof(T) == 4 ? 2e-6 : 1e-14; }
+
+// a deterministic, non-symmetric test signal
+template <typename T> std::vector<std::complex<T>> testSignal(std::size_t n)
+{
+    std::vector<std::complex<T>> x(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        x[i] = {T(std::sin(0.37 * i) + (i % 7) * 0.25), T(std::cos(1.3 * i) - (i % 3) * 0.5)};
+    }
+    return x;
+}
+
+// the DFT coefficient k of x, computed directly in double precision
+template <typename T> C referenceCoefficient(const std::vector<std::complex<T>> &x, std::size_t k)
+{
+    const std::size_t n = x.size();
+    C sum = 0;
+    for (std::size_t j = 0; j < n; ++j) {
+        const double angle = -2 * 3.14159265358979323846 * double(j * k % n) / double(n);
+        sum += C(x[j].real(), x[j].imag()) * C(std::cos(angle), std::sin(angle));
+    }
+    return sum;
+}
+
+// max |a - b| relative to max |b|
+template <typename T>
+double maxError(const std::vector<std::complex<T>> &a, const std::vector<C> &b)
+{
+    double err = 0, scale = 0;
+    for (std::size_t i = 0; i < b.size(); ++i) {
+        err = std::max(err, std::abs(C(a[i].real(), a[i].imag()) - b[i]));
+        scale = std::max(scale, std::abs(b[i]));
+    }
+    return err / scale;
+}
+
+// complex transforms{{{1
+TEST_TYPES(T, complexForward, (float, double))
+{
+    for (std::size_t n = 1; n <= 2048; n *= 2) {
+        fft::plan<T> p(n);
+        COMPARE(p.size(), n);
+        const auto x = testSignal<T>(n);
+        std::vector<C> ref(n);
+        for (std::size_t k = 0; k < n; ++k) {
+            ref[k] = referenceCoefficient(x, k);
+        }
+        std::vector<std::complex<T>> y(n);
+        p.forward(x.data(), y.data());
+        VERIFY(maxError(y, ref) <= tolerance<T>()) << "n = " << n;
+
+        // in-place gives the same result
+        auto z = x;
+        p.forward(z.data());
+        COMPARE(z, y) << "n = " << n;
+    }
+}
+
+TEST_TYPES(T, complexInverse, (float, double))
+{
+    for (std::size_t n = 1; n <= 2048; n *= 2) {
+        fft::plan<T> p(n);
+        const auto x = testSignal<T>(n);
+        // the inverse transform is the forward transform with conjugated twiddles
+        std::vector<C> ref(n);
+        for (std::size_t k = 0; k < n; ++k) {
+            ref[k] = referenceCoefficient(x, (n - k) % n);
+        }
+        std::vector<std::complex<T>> y(n);
+        p.inverse(x.data(), y.data());
+        VERIFY(maxError(y, ref) <= tolerance<T>()) << "n = " << n;
+    }
+}
+
+TEST_TYPES(T, complexRoundTrip, (float, double))
+{
+    for (std::size_t n : {256, 4096, 65536}) {
+        fft::plan<T> p(n);
+        const auto x = testSignal<T>(n);
+        auto y = x;
+        p.forward(y.data());
+        // spot-check a few coefficients against the direct sum
+        for (std::size_t k : {std::size_t(0), std::size_t(1), n / 3, n - 1}) {
+            const C ref = referenceCoefficient(x, k);
+            VERIFY(std::abs(C(y[k].real(), y[k].imag()) - ref) <=
+                   tolerance<T>() * 4 * double(n))
+                << "n = " << n << ", k = " << k << ": " << y[k] << " vs. " << ref;
+        }
+        p.inverse(y.data());
+        std::vector<C> ref(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            ref[i] = C(x[i].real(), x[i].imag()) * double(n);
+        }
+        VERIFY(maxError(y, ref) <= 4 * tolerance<T>()) << "n = " << n;
+    }
+}
+
+// real transforms{{{1
+TEST_TYPES(T, realForward, (float, double))
+{
+    for (std::size_t n = 2; n <= 4096; n *= 2) {
+        fft::real_plan<T> p(n);
+        COMPARE(p.size(), n);
+        const auto signal = testSignal<T>(n);
+        std::vector<T> x(n);
+        std::vector<std::complex<T>> xc(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            x[i] = signal[i].real();
+            xc[i] = x[i];
+        }
+        std::vector<C> ref(n / 2 + 1);
+        for (std::size_t k = 0; k <= n / 2; ++k) {
+            ref[k] = referenceCoefficient(xc, k);
+        }
+        std::vector<std::complex<T>> y(n / 2 + 1);
+        p.forward(x.data(), y.data());
+        VERIFY(maxError(y, ref) <= tolerance<T>()) << "n = " << n;
+
+        std::vector<T> back(n);
+        p.inverse(y.data(), back.data());
+        for (std::size_t i = 0; i < n; ++i) {
+            VERIFY(std::abs(back[i] / T(n) - x[i]) <= 32 * tolerance<T>())
+                << "n = " << n << ", i = " << i << ": " << back[i] / T(n) << " vs. " << x[i];
+        }
+    }
+}
+
+TEST_TYPES(T, realInverse, (float, double))
+{
+    for (std::size_t n = 2; n <= 4096; n *= 2) {
+        fft::real_plan<T> p(n);
+        // a Hermitian spectrum: X[0] and X[n/2] real
+        auto spectrum = testSignal<T>(n / 2 + 1);
+        spectrum[0].imag(0);
+        spectrum[n / 2].imag(0);
+        std::vector<std::complex<T>> full(n);
+        for (std::size_t k = 0; k < n; ++k) {
+            full[k] = k <= n / 2 ? spectrum[k] : std::conj(spectrum[n - k]);
+        }
+        std::vector<T> x(n);
+        p.inverse(spectrum.data(), x.data());
+        std::vector<std::complex<T>> xc(x.begin(), x.end());
+        std::vector<C> ref(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            ref[i] = referenceCoefficient(full, (n - i) % n);
+        }
+        VERIFY(maxError(xc, ref) <= tolerance<T>()) << "n = " << n;
+    }
+}
+
+// vim: foldmethod=marker
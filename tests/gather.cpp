@@ -29,7 +29,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <iostream>
 #include <Vc/array>
 
-#define ALL_TYPES (ALL_VECTORS, SimdArray<int, 7>)
+#define ALL_TYPES (ALL_VECTORS, EXTRA_INT_VECTORS, SimdArray<int, 7>)
 
 using namespace Vc;
 
@@ -47,7 +47,7 @@ TEST_TYPES(Vec, maskedGatherArray, ALL_TYPES)
     alignas(static_cast<std::size_t>(It::MemoryAlignment))
         std::array<typename It::EntryType, It::size()> indexArray;
     indexes.store(&indexArray[0], Vc::Aligned);
-    for_all_masks(Vec, m) {
+    UnitTest::withAllMasks<Vec>([&](const typename Vec::Mask &m) {
         const Vec a(mem, indexes, m);
         for (size_t i = 0; i < Vec::Size; ++i) {
             COMPARE(a[i], m[i] ? mem[i] : 0) << " i = " << i << ", m = " << m;
@@ -71,7 +71,7 @@ TEST_TYPES(Vec, maskedGatherArray, ALL_TYPES)
         for (size_t i = 0; i < Vec::Size; ++i) {
             COMPARE(b[i], m[i] ? mem[i] : x) << " i = " << i << ", m = " << m;
         }
-    }
+    });
 }
 
 template <typename Vec>
@@ -252,3 +252,36 @@ TEST_TYPES(Vec, gather2dim, ALL_TYPES)
         }
     }
 }
+
+TEST_TYPES(Vec, gatherUnsignedIndexes, ALL_TYPES)
+{
+    typedef typename Vec::EntryType T;
+    typedef Vc::SimdArray<unsigned int, Vec::Size> It;
+
+    T mem[256];
+    for (int i = 0; i < 256; ++i) {
+        mem[i] = T(i);
+    }
+    const It idx = It::IndexesFromZero() * 37u % 256u;
+    const Vec reference = simd_cast<Vec>(idx);
+
+    // indexes above 2^31 relative to a base pointer that lies before the array; the
+    // gather instructions would sign-extend them and read below the base pointer. The
+    // offset is read from a volatile so that the compiler cannot prove the accesses to lie
+    // outside the array.
+    volatile unsigned int volatileOffset = (1u << 31) + 5u;
+    const unsigned int offset = volatileOffset;
+    const T *base = reinterpret_cast<const T *>(reinterpret_cast<std::uintptr_t>(mem) -
+                                                std::uintptr_t(offset) * sizeof(T));
+    const It bigIdx = idx + offset;
+
+    Vec a;
+    a.gather(base, bigIdx);
+    COMPARE(a, reference) << "idx = " << bigIdx;
+
+    UnitTest::withAllMasks<Vec>([&](const typename Vec::Mask &m) {
+        Vec b = T(1);
+        b.gather(base, bigIdx, m);
+        COMPARE(b, iif(m, reference, Vec(T(1)))) << "m = " << m;
+    });
+}
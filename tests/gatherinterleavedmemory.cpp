@@ -27,6 +27,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include "unittest.h"
+#include <vector>
 
 using namespace Vc;
 
@@ -209,4 +210,127 @@ TEST_TYPES(Param, testDeinterleaveGather,
     }
 }
 
+// structs with more than 8 members {{{1
+template <typename V, std::size_t... J> void testLargeStruct(Vc::index_sequence<J...>)
+{
+    typedef typename V::EntryType T;
+    typedef typename V::IndexType I;
+    constexpr std::size_t StructSize = sizeof...(J);
+    typedef SomeStruct<T, StructSize> S;
+    const size_t N = 64;
+    const size_t NMask = createNMask(N);
+
+    S *data = Vc::malloc<S, Vc::AlignOnVector>(N);
+    for (size_t i = 0; i < N; ++i) {
+        for (size_t j = 0; j < StructSize; ++j) {
+            data[i].d[j] = i * StructSize + j;
+        }
+    }
+    const Vc::InterleavedMemoryWrapper<S, V> data_v(data);
+
+    V v[StructSize];
+    for (int retest = 0; retest < 100; ++retest) {
+        const I indexes = (I::Random() >> 10) & I(NMask);
+        tie(v[J]...) = data_v[indexes];
+        const V reference = Vc::simd_cast<V>(indexes) * V(StructSize);
+        for (size_t j = 0; j < StructSize; ++j) {
+            COMPARE(v[j], reference + T(j)) << "j = " << j << ", indexes: " << indexes;
+        }
+    }
+    for (size_t i = 0; i <= N - V::Size; ++i) {
+        data_v[i].deinterleave(v[J]...);
+        const V reference = Vc::simd_cast<V>(int(i) + I::IndexesFromZero()) * T(StructSize);
+        for (size_t j = 0; j < StructSize; ++j) {
+            COMPARE(v[j], reference + T(j)) << "j = " << j << ", i = " << i;
+        }
+    }
+    Vc::free(data);
+}
+
+TEST_TYPES(Param, testDeinterleaveLargeStructs,
+           (outer_product<Typelist<ALL_VECTORS>,
+                          Typelist<std::integral_constant<std::size_t, 9>,
+                                   std::integral_constant<std::size_t, 12>,
+                                   std::integral_constant<std::size_t, 16>>>))
+{
+    typedef typename Param::template at<0> V;
+    testLargeStruct<V>(Vc::make_index_sequence<Param::template at<1>::value>());
+}
+
+// structs with float and int members {{{1
+struct SensorRecord5 {
+    float t;
+    int id;
+    float x, y;
+    int flags;
+};
+struct SensorRecord12 {
+    float t;
+    int id;
+    float x, y, z;
+    int flags;
+    float vx, vy, vz;
+    int count;
+    float min, max;
+};
+// int_v only matches float_v in size where both use the same register width
+typedef typename std::conditional<int_v::Size == float_v::Size, int_v,
+                                  SimdArray<int, float_v::Size>>::type int_for_float_v;
+
+TEST(deinterleaveMixedTypes)
+{
+    typedef float_v::IndexType I;
+    typedef int_for_float_v IV;
+    const int N = 64;
+    std::vector<SensorRecord5> data5(N);
+    std::vector<SensorRecord12> data12(N);
+    for (int i = 0; i < N; ++i) {
+        data5[i] = {i * 0.5f, i * 3, -float(i), float(i * i), ~i};
+        data12[i] = {i * 0.5f, i * 3,  -float(i), float(i * i), 1.f - i, ~i,
+                     i * 2.f,  i + 1.f, i - 1.f,  -i,           -i * 4.f, i * 4.f};
+    }
+    const Vc::InterleavedMemoryWrapper<const SensorRecord5, float_v> data5_v(&data5[0]);
+    const Vc::InterleavedMemoryWrapper<const SensorRecord12, float_v> data12_v(&data12[0]);
+
+    float_v t, x, y, z, vx, vy, vz, min, max;
+    IV id, flags, count;
+    for (int retest = 0; retest < 100; ++retest) {
+        const I indexes = (I::Random() >> 10) & I(N - 1);
+        const float_v fi = Vc::simd_cast<float_v>(indexes);
+        const IV ii = Vc::simd_cast<IV>(indexes);
+
+        data5_v[indexes].deinterleave(t, id, x, y, flags);
+        COMPARE(t, fi * 0.5f);
+        COMPARE(id, ii * 3);
+        COMPARE(x, -fi);
+        COMPARE(y, fi * fi);
+        COMPARE(flags, ~ii);
+
+        data12_v[indexes].deinterleave(t, id, x, y, z, flags, vx, vy, vz, count, min, max);
+        COMPARE(t, fi * 0.5f);
+        COMPARE(id, ii * 3);
+        COMPARE(x, -fi);
+        COMPARE(y, fi * fi);
+        COMPARE(z, 1.f - fi);
+        COMPARE(flags, ~ii);
+        COMPARE(vx, fi * 2.f);
+        COMPARE(vy, fi + 1.f);
+        COMPARE(vz, fi - 1.f);
+        COMPARE(count, -ii);
+        COMPARE(min, fi * -4.f);
+        COMPARE(max, fi * 4.f);
+    }
+    for (int i = 0; i <= N - int(float_v::Size); ++i) {
+        const float_v fi = float_v::IndexesFromZero() + float(i);
+        const IV ii = IV::IndexesFromZero() + i;
+        data12_v[size_t(i)].deinterleave(t, id, x, y, z, flags);
+        COMPARE(t, fi * 0.5f);
+        COMPARE(id, ii * 3);
+        COMPARE(x, -fi);
+        COMPARE(y, fi * fi);
+        COMPARE(z, 1.f - fi);
+        COMPARE(flags, ~ii);
+    }
+}
+
 // vim: foldmethod=marker
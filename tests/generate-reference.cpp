@@ -0,0 +1,88 @@
+#include <cmath>
+#include <cstdio>
+
+// Writes the reference data for the functions that have no upstream test data. The
+// reference values are computed in long double and rounded once to the tested type.
+
+template<typename T> struct Reference
+{
+    T x, ref;
+};
+
+namespace Function {
+    enum Function {
+        tan, sinh, cosh, tanh, erf, erfc
+    };
+}
+template<typename T, Function::Function F> static inline const char *filenameOut();
+template<> inline const char *filenameOut<float , Function::tan >() { return "reference-tan-sp.dat"; }
+template<> inline const char *filenameOut<double, Function::tan >() { return "reference-tan-dp.dat"; }
+template<> inline const char *filenameOut<float , Function::sinh>() { return "reference-sinh-sp.dat"; }
+template<> inline const char *filenameOut<double, Function::sinh>() { return "reference-sinh-dp.dat"; }
+template<> inline const char *filenameOut<float , Function::cosh>() { return "reference-cosh-sp.dat"; }
+template<> inline const char *filenameOut<double, Function::cosh>() { return "reference-cosh-dp.dat"; }
+template<> inline const char *filenameOut<float , Function::tanh>() { return "reference-tanh-sp.dat"; }
+template<> inline const char *filenameOut<double, Function::tanh>() { return "reference-tanh-dp.dat"; }
+template<> inline const char *filenameOut<float , Function::erf >() { return "reference-erf-sp.dat"; }
+template<> inline const char *filenameOut<double, Function::erf >() { return "reference-erf-dp.dat"; }
+template<> inline const char *filenameOut<float , Function::erfc>() { return "reference-erfc-sp.dat"; }
+template<> inline const char *filenameOut<double, Function::erfc>() { return "reference-erfc-dp.dat"; }
+
+template<Function::Function F> static long double reference(long double x);
+template<> long double reference<Function::tan >(long double x) { return std::tan(x); }
+template<> long double reference<Function::sinh>(long double x) { return std::sinh(x); }
+template<> long double reference<Function::cosh>(long double x) { return std::cosh(x); }
+template<> long double reference<Function::tanh>(long double x) { return std::tanh(x); }
+template<> long double reference<Function::erf >(long double x) { return std::erf(x); }
+template<> long double reference<Function::erfc>(long double x) { return std::erfc(x); }
+
+// deterministic uniform numbers in [0, 1[ (so that the data does not depend on the libc)
+static double uniform()
+{
+    static unsigned long long state = 0x853c49e6748fea9bull;
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    return (state >> 11) * (1. / 9007199254740992.);
+}
+
+static const int Count = 50000;
+
+template<typename T, Function::Function F>
+static void write(T lo, T hi)
+{
+    FILE *file = fopen(filenameOut<T, F>(), "wb");
+    for (int i = 0; i < Count; ++i) {
+        // uniformly distributed in [lo, hi]
+        const T x = lo + T(uniform() * (double(hi) - double(lo)));
+        const Reference<T> r = {x, T(reference<F>(x))};
+        fwrite(&r, sizeof(Reference<T>), 1, file);
+    }
+    for (int i = 0; i < Count; ++i) {
+        // uniformly distributed exponents for |x| in [2^-24, 1[
+        const T x = T(std::ldexp(1. + uniform(), -1 - int(uniform() * 24.)) *
+                      (uniform() < .5 ? -1 : 1));
+        if (x >= lo && x <= hi) {
+            const Reference<T> r = {x, T(reference<F>(x))};
+            fwrite(&r, sizeof(Reference<T>), 1, file);
+        }
+    }
+    fclose(file);
+}
+
+template<typename T>
+static void generate(T expLimit, T erfcLimit)
+{
+    write<T, Function::tan >(-100, 100);
+    write<T, Function::sinh>(-expLimit, expLimit);
+    write<T, Function::cosh>(-expLimit, expLimit);
+    write<T, Function::tanh>(-20, 20);
+    write<T, Function::erf >(-6, 6);
+    write<T, Function::erfc>(-6, erfcLimit);
+}
+
+int main()
+{
+    // sinh and cosh overflow beyond ln(max) + ln(2); erfc(x) is subnormal for x > erfcLimit
+    generate<float >(89.f, 9.f);
+    generate<double>(710., 26.);
+    return 0;
+}
@@ -0,0 +1,178 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+using namespace Vc;
+
+#define FLOAT_TYPES (float_v, SimdArray<float, 16>, SimdArray<float, 7>, SimdArray<float, 1>)
+
+static float referenceValue(unsigned short h)
+{
+    const int exponent = (h >> 10) & 0x1f;
+    const int mantissa = h & 0x3ff;
+    const float sign = (h & 0x8000) ? -1.f : 1.f;
+    if (exponent == 0x1f) {
+        return mantissa == 0 ? sign * std::numeric_limits<float>::infinity()
+                             : std::numeric_limits<float>::quiet_NaN();
+    } else if (exponent == 0) {
+        return sign * std::ldexp(float(mantissa), -24);
+    }
+    return sign * std::ldexp(float(0x400 + mantissa), exponent - 25);
+}
+
+static bool isNanBits(unsigned short h) { return (h & 0x7c00) == 0x7c00 && (h & 0x3ff); }
+
+static float floatFromBits(unsigned int bits)
+{
+    float f;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+// scalar{{{1
+TEST(halfToFloat)
+{
+    for (unsigned int b = 0; b < 0x10000; ++b) {
+        const unsigned short h = b;
+        const float f = half::fromBits(h);
+        if (isNanBits(h)) {
+            VERIFY(std::isnan(f)) << "h = " << b;
+        } else {
+            COMPARE(f, referenceValue(h)) << "h = " << b;
+            // every half is exactly representable, so the round trip is the identity
+            COMPARE(half(f).toBits(), h) << "h = " << b;
+        }
+    }
+}
+
+TEST(floatToHalf)
+{
+    COMPARE(half(0.f).toBits(), 0x0000);
+    COMPARE(half(-0.f).toBits(), 0x8000);
+    COMPARE(half(1.f).toBits(), 0x3c00);
+    COMPARE(half(-2.f).toBits(), 0xc000);
+    COMPARE(half(65504.f).toBits(), 0x7bff);
+    // rounding to nearest, ties to even
+    COMPARE(half(65519.f).toBits(), 0x7bff);
+    COMPARE(half(65520.f).toBits(), 0x7c00);
+    COMPARE(half(1.f + std::ldexp(1.f, -11)).toBits(), 0x3c00);
+    COMPARE(half(1.f + 3 * std::ldexp(1.f, -11)).toBits(), 0x3c02);
+    COMPARE(half(1.f + std::ldexp(1.f, -11) + std::ldexp(1.f, -20)).toBits(), 0x3c01);
+    // subnormals
+    COMPARE(half(std::ldexp(1.f, -24)).toBits(), 0x0001);
+    COMPARE(half(std::ldexp(1.f, -25)).toBits(), 0x0000);
+    COMPARE(half(3 * std::ldexp(1.f, -25)).toBits(), 0x0002);
+    COMPARE(half(std::ldexp(1023.f, -24)).toBits(), 0x03ff);
+    COMPARE(half(std::ldexp(2047.f, -25)).toBits(), 0x0400);
+    COMPARE(half(std::ldexp(1.f, -14)).toBits(), 0x0400);
+    COMPARE(half(std::numeric_limits<float>::denorm_min()).toBits(), 0x0000);
+    // overflow, inf, and NaN
+    COMPARE(half(1e10f).toBits(), 0x7c00);
+    COMPARE(half(-std::numeric_limits<float>::infinity()).toBits(), 0xfc00);
+    VERIFY(isNanBits(half(std::numeric_limits<float>::quiet_NaN()).toBits()));
+    VERIFY(isNanBits(half(floatFromBits(0x7f800001u)).toBits()));
+}
+
+// vector loads and stores{{{1
+TEST_TYPES(V, loadHalf, FLOAT_TYPES)
+{
+    std::vector<half> mem(0x10000 + V::Size);
+    for (unsigned int b = 0; b < mem.size(); ++b) {
+        mem[b] = half::fromBits(b);
+    }
+    for (std::size_t offset : {0, 1}) {
+        for (std::size_t i = offset; i + V::Size <= mem.size(); i += V::Size) {
+            const V x(&mem[i], Vc::Unaligned);
+            for (std::size_t j = 0; j < V::Size; ++j) {
+                const unsigned short h = mem[i + j].toBits();
+                if (isNanBits(h)) {
+                    VERIFY(std::isnan(x[j])) << "h = " << h;
+                } else {
+                    COMPARE(x[j], float(mem[i + j])) << "h = " << h;
+                }
+            }
+        }
+    }
+
+    alignas(static_cast<std::size_t>(V::MemoryAlignment)) half aligned[V::Size];
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        aligned[i] = float(i) * 0.25f;
+    }
+    V x;
+    x.load(aligned, Vc::Aligned);
+    COMPARE(x, V::IndexesFromZero() * 0.25f);
+}
+
+TEST_TYPES(V, storeHalf, FLOAT_TYPES)
+{
+    alignas(static_cast<std::size_t>(V::MemoryAlignment)) half mem[V::Size + 1];
+    for (unsigned int n = 0; n < 100000; ++n) {
+        const V x = V::generate([&](int i) {
+            // walk through all exponents, including subnormals, inf, and NaN
+            return floatFromBits((n * V::Size + i) * 0x9e3779b1u);
+        });
+        x.store(&mem[1], Vc::Unaligned);
+        for (std::size_t j = 0; j < V::Size; ++j) {
+            const float f = x[j];
+            if (std::isnan(f)) {
+                VERIFY(isNanBits(mem[j + 1].toBits())) << "f = " << f;
+            } else {
+                COMPARE(mem[j + 1].toBits(), half(f).toBits()) << "f = " << f;
+            }
+        }
+    }
+    const V y = V::IndexesFromZero() * 0.5f;
+    y.store(mem, Vc::Aligned);
+    COMPARE(V(mem, Vc::Aligned), y);
+}
+
+// bulk conversion{{{1
+TEST(convertArrays)
+{
+    for (std::size_t n : {0, 1, 7, 16, 61, 1000}) {
+        std::vector<float> src(n);
+        std::vector<half> h(n);
+        std::vector<float> dst(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            src[i] = (float(i) - 500.f) * 1.3f;
+        }
+        convert(src.data(), h.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(h[i].toBits(), half(src[i]).toBits()) << "i = " << i;
+        }
+        convert(h.data(), dst.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(dst[i], float(h[i])) << "i = " << i;
+        }
+    }
+}
+
+// vim: foldmethod=marker
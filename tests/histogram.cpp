@@ -0,0 +1,114 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+/*includes {{{*/
+#include "unittest.h"
+#include <Vc/execution>
+#include <random>
+#include <vector>
+/*}}}*/
+using namespace Vc;
+
+using AllTypes = concat<AllVectors, AllSimdArrays>;
+
+// few bins, so that almost every vector contains duplicate indexes
+constexpr int BinCount = 5;
+
+TEST_TYPES(V, scatterAdd, (AllTypes)) //{{{1
+{
+    using T = typename V::EntryType;
+    using I = typename V::IndexType;
+    using M = typename V::MaskType;
+    std::default_random_engine rne;
+    std::uniform_int_distribution<int> dist(0, BinCount - 1);
+    for (int repetition = 0; repetition < 1000; ++repetition) {
+        const I indexes = I::generate([&](int) { return dist(rne); });
+        const V values = V::generate([&](int i) { return T(i + 1); });
+        const M mask = simd_cast<M>(I::generate([&](int) { return dist(rne); }) > 1);
+
+        T mem[BinCount] = {};
+        T reference[BinCount] = {};
+        scatter_add(mem, indexes, values);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            reference[indexes[i]] += values[i];
+        }
+        for (int b = 0; b < BinCount; ++b) {
+            COMPARE(mem[b], reference[b]) << "b = " << b << ", indexes = " << indexes;
+        }
+
+        scatter_add(mem, indexes, values, mask);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            if (mask[i]) {
+                reference[indexes[i]] += values[i];
+            }
+        }
+        for (int b = 0; b < BinCount; ++b) {
+            COMPARE(mem[b], reference[b]) << "b = " << b << ", indexes = " << indexes
+                                          << ", mask = " << mask;
+        }
+    }
+}
+
+TEST_TYPES(V, histogramVector, (AllTypes)) //{{{1
+{
+    using T = typename V::EntryType;
+    using I = typename V::IndexType;
+    T bins[BinCount] = {};
+    // all entries in the same bin
+    histogram(bins, I::Zero());
+    COMPARE(bins[0], T(V::Size));
+    histogram(bins, I::IndexesFromZero() % BinCount, I::IndexesFromZero() < 2);
+    COMPARE(bins[0], T(V::Size + 1));
+    COMPARE(bins[1], T(V::Size > 1 ? 1 : 0));
+    COMPARE(bins[2], T(0));
+}
+
+TEST_TYPES(T, histogramRange, (float, double, int, unsigned int, short, unsigned short)) //{{{1
+{
+    std::default_random_engine rne;
+    std::uniform_int_distribution<int> dist(0, 99);
+    std::vector<int> indexes(100003);
+    for (auto &i : indexes) {
+        i = dist(rne);
+    }
+    std::vector<T> reference(100, T(1));
+    for (int i : indexes) {
+        ++reference[i];
+    }
+    std::vector<T> bins(100, T(1));
+    histogram(bins.data(), indexes.begin(), indexes.end());
+    for (int b = 0; b < 100; ++b) {
+        COMPARE(bins[b], reference[b]) << "b = " << b;
+    }
+
+    std::fill(bins.begin(), bins.end(), T(1));
+    histogram(par_simd, bins.data(), bins.size(), indexes.begin(), indexes.end());
+    for (int b = 0; b < 100; ++b) {
+        COMPARE(bins[b], reference[b]) << "b = " << b;
+    }
+}
+
+// vim: foldmethod=marker
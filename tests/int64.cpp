@@ -0,0 +1,146 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+
+using namespace Vc;
+
+// negative entries (and their unsigned counterparts) exercise the high 32 bits, while the
+// magnitudes still permit products without overflow
+template <typename V> V testValues(int seed)
+{
+    using T = typename V::EntryType;
+    return V::generate([&](int i) {
+        // wrap in unsigned arithmetic; the values are also used for 32-bit vectors
+        return T(std::uint64_t(i * 37 + seed * 101 + (i * i) % 13) * 1000003u - 200000000u);
+    });
+}
+
+// arithmetics{{{1
+TEST_TYPES(V, multiplyWrapsAround, (INT64_VECTORS))
+{
+    using T = typename V::EntryType;
+    using U = typename std::make_unsigned<T>::type;
+    const U big = 0x9e3779b97f4a7c15ull;
+    const V a = V::generate([&](int i) { return T(big * U(i + 1)); });
+    const V b = V::generate([&](int i) { return T(big >> (i + 3)); });
+    const V r = a * b;
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        COMPARE(r[i], T(U(a[i]) * U(b[i]))) << "a = " << a << ", b = " << b;
+    }
+}
+
+// casts{{{1
+TEST_TYPES(V, castDouble, (INT64_VECTORS))
+{
+    using T = typename V::EntryType;
+    for (int seed = 0; seed < 10; ++seed) {
+        // the upper entries are not representable in double and must round like the
+        // scalar conversion
+        const V x = testValues<V>(seed) ^ (V::IndexesFromZero() << 56);
+        const double_v d = simd_cast<double_v>(x);
+        for (std::size_t i = 0; i < double_v::Size; ++i) {
+            COMPARE(d[i], i < V::Size ? double(x[i]) : 0.) << "x = " << x;
+        }
+        // 50-bit values convert exactly in both directions
+        const V z = testValues<V>(seed) & T(0x3ffffffffffffull);
+        const V y = simd_cast<V>(simd_cast<double_v>(z));
+        for (std::size_t i = 0; i < std::min(V::Size, double_v::Size); ++i) {
+            COMPARE(y[i], z[i]) << "z = " << z;
+        }
+    }
+    const double_v rounded = simd_cast<double_v>(V(T(1) << 53) + T(1));
+    for (std::size_t i = 0; i < std::min(V::Size, double_v::Size); ++i) {
+        COMPARE(rounded[i], 9007199254740992.);
+    }
+}
+
+TEST_TYPES(V, castInt, (INT64_VECTORS))
+{
+    using T = typename V::EntryType;
+    using I = Vector<typename std::conditional<std::is_signed<T>::value, int, uint>::type>;
+    for (int seed = 0; seed < 10; ++seed) {
+        const I c = testValues<I>(seed);
+        const V x = simd_cast<V>(c);
+        for (std::size_t i = 0; i < std::min(V::Size, I::Size); ++i) {
+            COMPARE(x[i], T(c[i])) << "c = " << c;
+        }
+        const I r = simd_cast<I>(testValues<V>(seed));
+        for (std::size_t i = 0; i < I::Size; ++i) {
+            COMPARE(r[i], typename I::EntryType(i < V::Size ? testValues<V>(seed)[i] : 0));
+        }
+        const SimdArray<T, I::Size> wide = simd_cast<SimdArray<T, I::Size>>(c);
+        for (std::size_t i = 0; i < I::Size; ++i) {
+            COMPARE(wide[i], T(c[i])) << "c = " << c;
+        }
+        COMPARE(simd_cast<I>(wide), c);
+    }
+}
+
+// gathers{{{1
+TEST_TYPES(V, gather64BitIndexes, (double_v, float_v, int_v, SimdArray<double, 7>))
+{
+    using T = typename V::EntryType;
+    using IV = SimdArray<std::int64_t, V::Size>;
+    T mem[256];
+    for (int i = 0; i < 256; ++i) {
+        mem[i] = T(i);
+    }
+    const IV idx = IV::IndexesFromZero() * std::int64_t(37) % std::int64_t(256);
+    V x;
+    x.gather(mem, idx);
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        COMPARE(x[i], T(idx[i])) << "idx = " << idx;
+    }
+    T out[256] = {};
+    x.scatter(out, idx);
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        COMPARE(out[idx[i]], T(idx[i]));
+    }
+
+    // indexes above 2^32 relative to a base pointer that lies before the array; the low
+    // 32 bits of the indexes would address the wrong memory. The offset is read from a
+    // volatile so that the compiler cannot prove the accesses to lie outside the arrays.
+    volatile std::int64_t volatileOffset = (std::int64_t(1) << 32) + 3;
+    const std::int64_t offset = volatileOffset;
+    const auto rebase = [&](T *p) {
+        return reinterpret_cast<T *>(reinterpret_cast<std::uintptr_t>(p) -
+                                     std::uintptr_t(offset) * sizeof(T));
+    };
+    const IV bigIdx = idx + offset;
+    V y;
+    y.gather(rebase(mem), bigIdx);
+    COMPARE(y, x) << "idx = " << bigIdx;
+    T bigOut[256] = {};
+    y.scatter(rebase(bigOut), bigIdx);
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        COMPARE(bigOut[idx[i]], T(idx[i]));
+    }
+}
+
+// vim: foldmethod=marker
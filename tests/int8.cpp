@@ -0,0 +1,178 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+
+using namespace Vc;
+
+template <typename V> V testValues(int seed)
+{
+    using T = typename V::EntryType;
+    return V::generate([&](int i) { return T(i * 37 + seed * 101 + (i * i) % 13); });
+}
+
+// saturation{{{1
+template <typename V, typename F, typename G> void compareBinary(F &&vectorOp, G &&scalarOp)
+{
+    using T = typename V::EntryType;
+    for (int seed = 0; seed < 20; ++seed) {
+        const V a = testValues<V>(seed);
+        const V b = testValues<V>(seed * 3 + 1);
+        const V r = vectorOp(a, b);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            COMPARE(r[i], T(scalarOp(a[i], b[i])))
+                << "a = " << a << ", b = " << b << ", i = " << i;
+        }
+    }
+}
+
+template <typename T> T saturate(int x)
+{
+    return T(std::max<int>(std::numeric_limits<T>::min(),
+                           std::min<int>(std::numeric_limits<T>::max(), x)));
+}
+
+TEST_TYPES(V, saturation, (INT8_VECTORS))
+{
+    using T = typename V::EntryType;
+    compareBinary<V>([](V a, V b) { return saturated_add(a, b); },
+                     [](T a, T b) { return saturate<T>(int(a) + int(b)); });
+    compareBinary<V>([](V a, V b) { return saturated_sub(a, b); },
+                     [](T a, T b) { return saturate<T>(int(a) - int(b)); });
+    compareBinary<V>([](V a, V b) { return average(a, b); },
+                     [](T a, T b) { return T((int(a) + int(b) + 1) >> 1); });
+    const V lo = std::numeric_limits<T>::min();
+    const V hi = std::numeric_limits<T>::max();
+    COMPARE(saturated_add(hi, V::One()), hi);
+    COMPARE(saturated_sub(lo, V::One()), lo);
+    COMPARE(average(hi, hi), hi);
+}
+
+TEST(multiplyAddPairs)
+{
+    for (int seed = 0; seed < 20; ++seed) {
+        const uchar_v a = testValues<uchar_v>(seed);
+        const schar_v b = testValues<schar_v>(seed * 3 + 1);
+        const short_v r = multiply_add_pairs(a, b);
+        COMPARE(r.size(), std::max<std::size_t>(1, a.size() / 2));
+        for (std::size_t i = 0; i < r.size(); ++i) {
+            const int odd = 2 * i + 1 < a.size() ? a[2 * i + 1] * b[2 * i + 1] : 0;
+            COMPARE(r[i], saturate<short>(a[2 * i] * b[2 * i] + odd))
+                << "a = " << a << ", b = " << b << ", i = " << i;
+        }
+    }
+    if (uchar_v::Size > 1) {
+        const uchar_v a = 255;
+        COMPARE(multiply_add_pairs(a, schar_v(127)), short_v(32767));
+        COMPARE(multiply_add_pairs(a, schar_v(-128)), short_v(-32768));
+    }
+}
+
+// casts{{{1
+template <typename To, typename From, std::size_t Offset>
+void testWidening(const From &, std::false_type)
+{
+    // e.g. the Scalar implementation has no second chunk
+}
+template <typename To, typename From, std::size_t Offset>
+void testWidening(const From &x, std::true_type)
+{
+    using T = typename To::EntryType;
+    const To r = simd_cast<To, Offset>(x);
+    for (std::size_t i = 0; i < To::Size; ++i) {
+        COMPARE(r[i], T(x[i + Offset * To::Size])) << "x = " << x << ", Offset = " << Offset;
+    }
+}
+template <typename To, typename From, std::size_t Offset> void testWidening(const From &x)
+{
+    testWidening<To, From, Offset>(
+        x, std::integral_constant<bool, ((Offset + 1) * To::Size <= From::Size)>());
+}
+
+TEST_TYPES(V, widening, (INT8_VECTORS))
+{
+    using T = typename V::EntryType;
+    using W = Vector<typename std::conditional<std::is_signed<T>::value, short, ushort>::type>;
+    using I = Vector<typename std::conditional<std::is_signed<T>::value, int, uint>::type>;
+    for (int seed = 0; seed < 10; ++seed) {
+        const V x = testValues<V>(seed);
+        testWidening<W, V, 0>(x);
+        testWidening<W, V, 1>(x);
+        testWidening<short_v, V, 0>(x);
+        testWidening<I, V, 0>(x);
+        testWidening<int_v, V, 1>(x);
+        testWidening<float_v, V, 0>(x);
+        testWidening<float_v, V, 2>(x);
+        testWidening<double_v, V, 0>(x);
+        testWidening<double_v, V, 3>(x);
+    }
+}
+
+template <typename V> void testNarrowingPair(int, std::false_type) {}
+template <typename V> void testNarrowingPair(int seed, std::true_type)
+{
+    using T = typename V::EntryType;
+    const short_v a = testValues<short_v>(seed) * short(41);
+    const short_v b = testValues<short_v>(seed + 1) * short(43);
+    const V r = simd_cast<V>(a, b);
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        const short s = i < short_v::Size ? a[i] : b[i - short_v::Size];
+        COMPARE(r[i], T(s)) << "a = " << a << ", b = " << b;
+    }
+}
+
+TEST_TYPES(V, narrowing, (INT8_VECTORS))
+{
+    using T = typename V::EntryType;
+    using HasPair = std::integral_constant<bool, (V::Size > short_v::Size)>;
+    for (int seed = 0; seed < 10; ++seed) {
+        testNarrowingPair<V>(seed, HasPair());
+        const int_v c = testValues<int_v>(seed) * 997;
+        const V r2 = simd_cast<V>(c);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            COMPARE(r2[i], T(i < int_v::Size ? c[i] : 0)) << "c = " << c;
+        }
+    }
+}
+
+TEST_TYPES(V, simdArrayCasts, (INT8_VECTORS))
+{
+    using T = typename V::EntryType;
+    const V x = testValues<V>(7);
+    const SimdArray<short, V::Size> wide = simd_cast<SimdArray<short, V::Size>>(x);
+    const SimdArray<float, V::Size> f = simd_cast<SimdArray<float, V::Size>>(x);
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        COMPARE(wide[i], short(x[i]));
+        COMPARE(f[i], float(x[i]));
+    }
+    COMPARE(simd_cast<V>(wide), x);
+    COMPARE(simd_cast<V>(f), x);
+    const SimdArray<T, V::Size> y(x);
+    COMPARE(simd_cast<V>(y + y), x + x);
+}
+
+// vim: foldmethod=marker
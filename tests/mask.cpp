@@ -40,7 +40,7 @@ using Vc::ushort_m;
 template<typename T> T two() { return T(2); }
 template<typename T> T three() { return T(3); }
 
-#define ALL_TYPES (ALL_VECTORS)
+#define ALL_TYPES (ALL_VECTORS, EXTRA_INT_VECTORS)
 //, SIMD_ARRAYS(33), SIMD_ARRAYS(32), SIMD_ARRAYS(31), SIMD_ARRAYS(16), SIMD_ARRAYS(8), SIMD_ARRAYS(7), SIMD_ARRAYS(4), SIMD_ARRAYS(3), SIMD_ARRAYS(2), SIMD_ARRAYS(1))
 
 TEST_TYPES(Vec, testInc, ALL_TYPES) /*{{{*/
@@ -461,8 +461,7 @@ TEST_TYPES(V, testCompareOperators, ALL_TYPES) /*{{{*/
     VERIFY(a != b);
     VERIFY(b != a);
 
-    for_all_masks(V, k)
-    {
+    UnitTest::withAllMasks<V>([](const M &k) {
         M randomMask;
         do {
             randomMask = V::Random() < V::Random();
@@ -478,7 +477,7 @@ TEST_TYPES(V, testCompareOperators, ALL_TYPES) /*{{{*/
         VERIFY( (k  != k2)) << k << k2;
         VERIFY( (k2 != k )) << k << k2;
         VERIFY(!(k2 != k2)) << k << k2;
-    }
+    });
 }
 /*}}}*/
 
@@ -114,6 +114,184 @@ TEST_TYPES(V, testExp, (RealTypes)) //{{{1
     COMPARE(Vc::exp(V::Zero()), V::One());
 }
 
+TEST_TYPES(V, testExp2, (RealTypes)) //{{{1
+{
+    UnitTest::setFuzzyness<float>(1);
+    UnitTest::setFuzzyness<double>(1);
+    typedef typename V::EntryType T;
+    typedef std::numeric_limits<T> L;
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        // all normal results and overflow
+        V x = V::Random() * T(L::max_exponent - L::min_exponent + 9) + T(L::min_exponent - 1);
+        V reference = x.apply([](T _x) { return std::exp2(_x); });
+        FUZZY_COMPARE(Vc::exp2(x), reference) << ", x = " << x << ", i = " << i;
+        // subnormal results and underflow
+        x = V::Random() * T(-L::digits - 1) + T(L::min_exponent - 1);
+        reference = x.apply([](T _x) { return std::exp2(_x); });
+        VERIFY(all_of(Vc::abs(Vc::exp2(x) - reference) <= L::denorm_min())) << ", x = " << x;
+    }
+    for (int k = L::min_exponent - L::digits; k < L::max_exponent; ++k) {
+        COMPARE(Vc::exp2(V(T(k))), V(std::ldexp(T(1), k))) << k;
+    }
+    COMPARE(Vc::exp2(V(L::infinity())), V(L::infinity()));
+    COMPARE(Vc::exp2(V(-L::infinity())), V::Zero());
+    VERIFY(all_of(Vc::isnan(Vc::exp2(V(L::quiet_NaN())))));
+}
+
+TEST_TYPES(V, testExp10, (RealTypes)) //{{{1
+{
+    UnitTest::setFuzzyness<float>(1);
+    UnitTest::setFuzzyness<double>(2);
+    typedef typename V::EntryType T;
+    typedef std::numeric_limits<T> L;
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        const V x = V::Random() * T(L::max_exponent10 - L::min_exponent10 + 1) +
+                    T(L::min_exponent10);
+        const V reference = x.apply([](T _x) { return T(std::pow(10., double(_x))); });
+        FUZZY_COMPARE(Vc::exp10(x), reference) << ", x = " << x << ", i = " << i;
+    }
+    for (int k = 0; k <= L::max_exponent10; ++k) {
+        FUZZY_COMPARE(Vc::exp10(V(T(k))), V(T(std::pow(10., k)))) << k;
+    }
+    COMPARE(Vc::exp10(V(L::infinity())), V(L::infinity()));
+    COMPARE(Vc::exp10(V(-L::infinity())), V::Zero());
+    VERIFY(all_of(Vc::isnan(Vc::exp10(V(L::quiet_NaN())))));
+}
+
+TEST_TYPES(V, testExpm1, (RealTypes)) //{{{1
+{
+    UnitTest::setFuzzyness<float>(2);
+    UnitTest::setFuzzyness<double>(2);
+    typedef typename V::EntryType T;
+    typedef std::numeric_limits<T> L;
+    const T maxLog = std::log(L::max());
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        V x = (V::Random() - T(0.5)) * T(4);
+        V reference = x.apply([](T _x) { return std::expm1(_x); });
+        FUZZY_COMPARE(Vc::expm1(x), reference) << ", x = " << x << ", i = " << i;
+
+        x = (V::Random() - T(0.5)) * T(1e-5);
+        reference = x.apply([](T _x) { return std::expm1(_x); });
+        FUZZY_COMPARE(Vc::expm1(x), reference) << ", x = " << x << ", i = " << i;
+
+        x = V::Random() * (maxLog + T(60)) - T(60);
+        reference = x.apply([](T _x) { return std::expm1(_x); });
+        FUZZY_COMPARE(Vc::expm1(x), reference) << ", x = " << x << ", i = " << i;
+    }
+    COMPARE(Vc::expm1(V::Zero()), V::Zero());
+    VERIFY(all_of(isnegative(Vc::expm1(-V::Zero()))));
+    COMPARE(Vc::expm1(V(L::infinity())), V(L::infinity()));
+    COMPARE(Vc::expm1(V(-L::infinity())), V(T(-1)));
+    VERIFY(all_of(Vc::isnan(Vc::expm1(V(L::quiet_NaN())))));
+}
+
+TEST_TYPES(V, testLog1p, (RealTypes)) //{{{1
+{
+    UnitTest::setFuzzyness<float>(2);
+    UnitTest::setFuzzyness<double>(2);
+    typedef typename V::EntryType T;
+    typedef std::numeric_limits<T> L;
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        V x = V::Random() * T(3) - T(1);
+        V reference = x.apply([](T _x) { return std::log1p(_x); });
+        FUZZY_COMPARE(Vc::log1p(x), reference) << ", x = " << x << ", i = " << i;
+
+        x = (V::Random() - T(0.5)) * T(1e-5);
+        reference = x.apply([](T _x) { return std::log1p(_x); });
+        FUZZY_COMPARE(Vc::log1p(x), reference) << ", x = " << x << ", i = " << i;
+
+        x = V::Random() * T(1e30);
+        reference = x.apply([](T _x) { return std::log1p(_x); });
+        FUZZY_COMPARE(Vc::log1p(x), reference) << ", x = " << x << ", i = " << i;
+    }
+    COMPARE(Vc::log1p(V::Zero()), V::Zero());
+    VERIFY(all_of(isnegative(Vc::log1p(-V::Zero()))));
+    COMPARE(Vc::log1p(V(T(-1))), V(-L::infinity()));
+    COMPARE(Vc::log1p(V(L::infinity())), V(L::infinity()));
+    VERIFY(all_of(Vc::isnan(Vc::log1p(V(T(-2))))));
+    VERIFY(all_of(Vc::isnan(Vc::log1p(V(L::quiet_NaN())))));
+}
+
+TEST_TYPES(V, testCbrt, (RealTypes)) //{{{1
+{
+    UnitTest::setFuzzyness<float>(1);
+    // Scalar (and thus the scalar parts of SimdArray) uses std::cbrt, which is off by up to
+    // 3 ulp for some subnormal arguments
+    UnitTest::setFuzzyness<double>(3);
+    typedef typename V::EntryType T;
+    typedef std::numeric_limits<T> L;
+    for (int k = L::min_exponent - L::digits; k < L::max_exponent; ++k) {
+        for (size_t i = 0; i < 1000 / V::Size; ++i) {
+            const V x = (V::Random() - T(0.5)) * std::ldexp(T(1), k);
+            const V reference =
+                x.apply([](T _x) { return T(std::cbrt(static_cast<long double>(_x))); });
+            FUZZY_COMPARE(Vc::cbrt(x), reference) << ", x = " << x << ", k = " << k;
+        }
+    }
+    FUZZY_COMPARE(Vc::cbrt(V(T(27))), V(T(3)));
+    FUZZY_COMPARE(Vc::cbrt(V(T(-0.125))), V(T(-0.5)));
+    COMPARE(Vc::cbrt(V::Zero()), V::Zero());
+    VERIFY(all_of(isnegative(Vc::cbrt(-V::Zero()))));
+    COMPARE(Vc::cbrt(V(-L::infinity())), V(-L::infinity()));
+    VERIFY(all_of(Vc::isnan(Vc::cbrt(V(L::quiet_NaN())))));
+}
+
+TEST_TYPES(V, testPow, (RealTypes)) //{{{1
+{
+    UnitTest::setFuzzyness<float>(1);
+    UnitTest::setFuzzyness<double>(2);
+    typedef typename V::EntryType T;
+    typedef std::numeric_limits<T> L;
+    const auto pow = [](T x, T y) { return std::pow(x, y); };
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        // 8^y covers the whole range of normal results
+        V x = V::Random() * T(7.5) + T(0.5);
+        V y = (V::Random() - T(0.5)) * T(L::max_exponent * 2 / 3 - 2);
+        V reference = V::generate([&](int k) { return pow(x[k], y[k]); });
+        FUZZY_COMPARE(Vc::pow(x, y), reference) << ", x = " << x << ", y = " << y;
+
+        // x close to 1 and large y
+        x = (V::Random() - T(0.5)) * T(1. / 1024) + T(1);
+        y = (V::Random() - T(0.5)) * T(1 << 16);
+        reference = V::generate([&](int k) { return pow(x[k], y[k]); });
+        FUZZY_COMPARE(Vc::pow(x, y), reference) << ", x = " << x << ", y = " << y;
+
+        // negative x and integral y
+        x = -(V::Random() * T(4) + T(0.25));
+        y = Vc::round((V::Random() - T(0.5)) * T(60));
+        reference = V::generate([&](int k) { return pow(x[k], y[k]); });
+        FUZZY_COMPARE(Vc::pow(x, y), reference) << ", x = " << x << ", y = " << y;
+    }
+}
+
+TEST_TYPES(V, testPowSpecialCases, (RealTypes)) //{{{1
+{
+    UnitTest::setFuzzyness<float>(1);
+    UnitTest::setFuzzyness<double>(2);
+    typedef typename V::EntryType T;
+    typedef std::numeric_limits<T> L;
+    const T values[] = {T(0),  T(-0.), T(1),  T(-1),  T(0.5),          T(-0.5),
+                        T(2),  T(-2),  T(3),  T(-3),  T(2.5),          T(-2.5),
+                        L::infinity(), -L::infinity(), L::quiet_NaN(), L::denorm_min()};
+    for (T x : values) {
+        for (T y : values) {
+            const T reference = std::pow(x, y);
+            const V result = Vc::pow(V(x), V(y));
+            for (size_t k = 0; k < V::Size; ++k) {
+                if (std::isnan(reference)) {
+                    VERIFY(std::isnan(result[k])) << "pow(" << x << ", " << y << ") = " << result[k];
+                } else {
+                    COMPARE(std::signbit(result[k]), std::signbit(reference))
+                        << "pow(" << x << ", " << y << ")";
+                }
+            }
+            if (!std::isnan(reference)) {
+                FUZZY_COMPARE(result, V(reference)) << "pow(" << x << ", " << y << ")";
+            }
+        }
+    }
+}
+
 TEST_TYPES(V, testMax, (AllTypes)) //{{{1
 {
     typedef typename V::EntryType T;
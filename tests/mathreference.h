@@ -52,7 +52,7 @@ template<typename T> struct StaticDeleter
 };
 
 enum Function {
-    Sincos, Atan, Asin, Acos, Log, Log2, Log10
+    Sincos, Atan, Asin, Acos, Log, Log2, Log10, Tan, Sinh, Cosh, Tanh, Erf, Erfc
 };
 template<typename T, Function F> static inline const char *filename();
 template<> inline const char *filename<float , Sincos>() { return "reference-sincos-sp.dat"; }
@@ -61,14 +61,26 @@ template<> inline const char *filename<float , Atan  >() { return "reference-ata
 template<> inline const char *filename<double, Atan  >() { return "reference-atan-dp.dat"; }
 template<> inline const char *filename<float , Asin  >() { return "reference-asin-sp.dat"; }
 template<> inline const char *filename<double, Asin  >() { return "reference-asin-dp.dat"; }
-// template<> inline const char *filename<float , Acos  >() { return "reference-acos-sp.dat"; }
-// template<> inline const char *filename<double, Acos  >() { return "reference-acos-dp.dat"; }
+template<> inline const char *filename<float , Acos  >() { return "reference-acos-sp.dat"; }
+template<> inline const char *filename<double, Acos  >() { return "reference-acos-dp.dat"; }
 template<> inline const char *filename<float , Log   >() { return "reference-ln-sp.dat"; }
 template<> inline const char *filename<double, Log   >() { return "reference-ln-dp.dat"; }
 template<> inline const char *filename<float , Log2  >() { return "reference-log2-sp.dat"; }
 template<> inline const char *filename<double, Log2  >() { return "reference-log2-dp.dat"; }
 template<> inline const char *filename<float , Log10 >() { return "reference-log10-sp.dat"; }
 template<> inline const char *filename<double, Log10 >() { return "reference-log10-dp.dat"; }
+template<> inline const char *filename<float , Tan   >() { return "reference-tan-sp.dat"; }
+template<> inline const char *filename<double, Tan   >() { return "reference-tan-dp.dat"; }
+template<> inline const char *filename<float , Sinh  >() { return "reference-sinh-sp.dat"; }
+template<> inline const char *filename<double, Sinh  >() { return "reference-sinh-dp.dat"; }
+template<> inline const char *filename<float , Cosh  >() { return "reference-cosh-sp.dat"; }
+template<> inline const char *filename<double, Cosh  >() { return "reference-cosh-dp.dat"; }
+template<> inline const char *filename<float , Tanh  >() { return "reference-tanh-sp.dat"; }
+template<> inline const char *filename<double, Tanh  >() { return "reference-tanh-dp.dat"; }
+template<> inline const char *filename<float , Erf   >() { return "reference-erf-sp.dat"; }
+template<> inline const char *filename<double, Erf   >() { return "reference-erf-dp.dat"; }
+template<> inline const char *filename<float , Erfc  >() { return "reference-erfc-sp.dat"; }
+template<> inline const char *filename<double, Erfc  >() { return "reference-erfc-dp.dat"; }
 
 #ifdef Vc_IMPL_MIC
 extern "C" {
@@ -96,6 +108,30 @@ extern const Reference<double> _binary_reference_log2_dp_dat_start;
 extern const Reference<double> _binary_reference_log2_dp_dat_end;
 extern const Reference<float > _binary_reference_log2_sp_dat_start;
 extern const Reference<float > _binary_reference_log2_sp_dat_end;
+extern const Reference<double> _binary_reference_cosh_dp_dat_start;
+extern const Reference<double> _binary_reference_cosh_dp_dat_end;
+extern const Reference<float > _binary_reference_cosh_sp_dat_start;
+extern const Reference<float > _binary_reference_cosh_sp_dat_end;
+extern const Reference<double> _binary_reference_erf_dp_dat_start;
+extern const Reference<double> _binary_reference_erf_dp_dat_end;
+extern const Reference<float > _binary_reference_erf_sp_dat_start;
+extern const Reference<float > _binary_reference_erf_sp_dat_end;
+extern const Reference<double> _binary_reference_erfc_dp_dat_start;
+extern const Reference<double> _binary_reference_erfc_dp_dat_end;
+extern const Reference<float > _binary_reference_erfc_sp_dat_start;
+extern const Reference<float > _binary_reference_erfc_sp_dat_end;
+extern const Reference<double> _binary_reference_sinh_dp_dat_start;
+extern const Reference<double> _binary_reference_sinh_dp_dat_end;
+extern const Reference<float > _binary_reference_sinh_sp_dat_start;
+extern const Reference<float > _binary_reference_sinh_sp_dat_end;
+extern const Reference<double> _binary_reference_tan_dp_dat_start;
+extern const Reference<double> _binary_reference_tan_dp_dat_end;
+extern const Reference<float > _binary_reference_tan_sp_dat_start;
+extern const Reference<float > _binary_reference_tan_sp_dat_end;
+extern const Reference<double> _binary_reference_tanh_dp_dat_start;
+extern const Reference<double> _binary_reference_tanh_dp_dat_end;
+extern const Reference<float > _binary_reference_tanh_sp_dat_start;
+extern const Reference<float > _binary_reference_tanh_sp_dat_end;
 extern const SincosReference<double> _binary_reference_sincos_dp_dat_start;
 extern const SincosReference<double> _binary_reference_sincos_dp_dat_end;
 extern const SincosReference<float > _binary_reference_sincos_sp_dat_start;
@@ -203,6 +239,90 @@ binary<Reference<double>, Log10>()
     return std::make_pair(&_binary_reference_log10_dp_dat_start,
                           &_binary_reference_log10_dp_dat_end);
 }
+template <>
+inline std::pair<const Reference<float> *, const Reference<float> *>
+binary<Reference<float>, Tan>()
+{
+    return std::make_pair(&_binary_reference_tan_sp_dat_start,
+                          &_binary_reference_tan_sp_dat_end);
+}
+template <>
+inline std::pair<const Reference<double> *, const Reference<double> *>
+binary<Reference<double>, Tan>()
+{
+    return std::make_pair(&_binary_reference_tan_dp_dat_start,
+                          &_binary_reference_tan_dp_dat_end);
+}
+template <>
+inline std::pair<const Reference<float> *, const Reference<float> *>
+binary<Reference<float>, Sinh>()
+{
+    return std::make_pair(&_binary_reference_sinh_sp_dat_start,
+                          &_binary_reference_sinh_sp_dat_end);
+}
+template <>
+inline std::pair<const Reference<double> *, const Reference<double> *>
+binary<Reference<double>, Sinh>()
+{
+    return std::make_pair(&_binary_reference_sinh_dp_dat_start,
+                          &_binary_reference_sinh_dp_dat_end);
+}
+template <>
+inline std::pair<const Reference<float> *, const Reference<float> *>
+binary<Reference<float>, Cosh>()
+{
+    return std::make_pair(&_binary_reference_cosh_sp_dat_start,
+                          &_binary_reference_cosh_sp_dat_end);
+}
+template <>
+inline std::pair<const Reference<double> *, const Reference<double> *>
+binary<Reference<double>, Cosh>()
+{
+    return std::make_pair(&_binary_reference_cosh_dp_dat_start,
+                          &_binary_reference_cosh_dp_dat_end);
+}
+template <>
+inline std::pair<const Reference<float> *, const Reference<float> *>
+binary<Reference<float>, Tanh>()
+{
+    return std::make_pair(&_binary_reference_tanh_sp_dat_start,
+                          &_binary_reference_tanh_sp_dat_end);
+}
+template <>
+inline std::pair<const Reference<double> *, const Reference<double> *>
+binary<Reference<double>, Tanh>()
+{
+    return std::make_pair(&_binary_reference_tanh_dp_dat_start,
+                          &_binary_reference_tanh_dp_dat_end);
+}
+template <>
+inline std::pair<const Reference<float> *, const Reference<float> *>
+binary<Reference<float>, Erf>()
+{
+    return std::make_pair(&_binary_reference_erf_sp_dat_start,
+                          &_binary_reference_erf_sp_dat_end);
+}
+template <>
+inline std::pair<const Reference<double> *, const Reference<double> *>
+binary<Reference<double>, Erf>()
+{
+    return std::make_pair(&_binary_reference_erf_dp_dat_start,
+                          &_binary_reference_erf_dp_dat_end);
+}
+template <>
+inline std::pair<const Reference<float> *, const Reference<float> *>
+binary<Reference<float>, Erfc>()
+{
+    return std::make_pair(&_binary_reference_erfc_sp_dat_start,
+                          &_binary_reference_erfc_sp_dat_end);
+}
+template <>
+inline std::pair<const Reference<double> *, const Reference<double> *>
+binary<Reference<double>, Erfc>()
+{
+    return std::make_pair(&_binary_reference_erfc_dp_dat_start,
+                          &_binary_reference_erfc_dp_dat_end);
+}
 #endif
 
 template<typename T>
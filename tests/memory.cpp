@@ -319,3 +319,127 @@ TEST_TYPES(V, testCopyAssignment, (ALL_VECTORS))
         COMPARE(m1[i], T(1));
     }
 }
+
+template <typename V> void verifyZeroPadding(const Memory<V> &m)
+{
+    using T = typename V::EntryType;
+    COMPARE(m.vectorsCount(), (m.entriesCount() + V::Size - 1) / V::Size);
+    VERIFY(m.capacity() >= m.vectorsCount() * V::Size);
+    for (size_t i = m.entriesCount(); i < m.vectorsCount() * V::Size; ++i) {
+        COMPARE(m.entries()[i], T(0)) << "i = " << i << ", size = " << m.entriesCount();
+    }
+}
+
+TEST_TYPES(V, resize, (ALL_VECTORS))
+{
+    using T = typename V::EntryType;
+    Memory<V> m;
+    COMPARE(m.entriesCount(), 0u);
+    COMPARE(m.vectorsCount(), 0u);
+    for (size_t n : {1, 7, 33, 100, 3, 0, 50}) {
+        const size_t oldSize = m.entriesCount();
+        for (size_t i = 0; i < oldSize; ++i) {
+            m[i] = T(i + 1);
+        }
+        m.resize(n);
+        COMPARE(m.entriesCount(), n);
+        for (size_t i = 0; i < n; ++i) {
+            COMPARE(m[i], i < oldSize ? T(i + 1) : T(0)) << "i = " << i << ", n = " << n;
+        }
+        verifyZeroPadding(m);
+    }
+
+}
+
+TEST_TYPES(V, reserveAndShrink, (ALL_VECTORS))
+{
+    using T = typename V::EntryType;
+    Memory<V> m(5);
+    for (size_t i = 0; i < 5; ++i) {
+        m[i] = T(i + 1);
+    }
+    m.reserve(1000);
+    VERIFY(m.capacity() >= 1000u);
+    COMPARE(m.entriesCount(), 5u);
+    const T *data = m.entries();
+    m.resize(1000);
+    COMPARE(m.entries(), data);  // no reallocation within the capacity
+    m.resize(5);
+    m.shrink_to_fit();
+    COMPARE(m.capacity(), m.vectorsCount() * V::Size);
+    for (size_t i = 0; i < 5; ++i) {
+        COMPARE(m[i], T(i + 1));
+    }
+    verifyZeroPadding(m);
+}
+
+TEST_TYPES(V, pushBack, (ALL_VECTORS))
+{
+    using T = typename V::EntryType;
+    Memory<V> m;
+    size_t reallocations = 0;
+    const T *data = m.entries();
+    for (int n = 0; n < 200; ++n) {
+        m.push_back(V::IndexesFromZero() + T(n));
+        if (m.entries() != data) {
+            ++reallocations;
+            data = m.entries();
+        }
+        COMPARE(m.entriesCount(), (n + 1) * V::Size);
+    }
+    VERIFY(reallocations <= 10) << reallocations;  // geometric growth
+    for (size_t i = 0; i < m.vectorsCount(); ++i) {
+        for (size_t j = 0; j < V::Size; ++j) {
+            COMPARE(m[i * V::Size + j], T(i + j));
+        }
+    }
+
+    // appending to a partially filled last vector
+    Memory<V> m2(1);
+    m2[0] = T(7);
+    m2.push_back(V(T(3)));
+    m2.push_back(T(5));
+    COMPARE(m2.entriesCount(), V::Size + 2);
+    COMPARE(m2[0], T(7));
+    for (size_t i = 1; i <= V::Size; ++i) {
+        COMPARE(m2[i], T(3));
+    }
+    COMPARE(m2[V::Size + 1], T(5));
+    verifyZeroPadding(m2);
+}
+
+TEST_TYPES(V, copyAssignmentResizes, (ALL_VECTORS))
+{
+    using T = typename V::EntryType;
+    Memory<V> src(37);
+    for (size_t i = 0; i < src.entriesCount(); ++i) {
+        src[i] = T(i + 1);
+    }
+
+    Memory<V> m;
+    m = src;  // grows
+    COMPARE(m.entriesCount(), src.entriesCount());
+    for (size_t i = 0; i < m.entriesCount(); ++i) {
+        COMPARE(m[i], T(i + 1)) << "i = " << i;
+    }
+    verifyZeroPadding(m);
+
+    Memory<V> small(3);
+    for (size_t i = 0; i < 3; ++i) {
+        small[i] = T(i + 5);
+    }
+    m = small;  // shrinks
+    COMPARE(m.entriesCount(), 3u);
+    for (size_t i = 0; i < 3; ++i) {
+        COMPARE(m[i], T(i + 5));
+    }
+    verifyZeroPadding(m);
+
+    Memory<V, 11> fixed;
+    fixed.setZero();
+    fixed[10] = T(9);
+    m = fixed;  // from a fixed-size Memory
+    COMPARE(m.entriesCount(), 11u);
+    COMPARE(m[10], T(9));
+    verifyZeroPadding(m);
+}
@@ -0,0 +1,199 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <cmath>
+
+using namespace Vc;
+
+#define ALL_TYPES (float_v, double_v, int_v, SimdArray<float, 8>)
+#define FLOAT_TYPES (float_v, double_v, SimdArray<float, 8>)
+
+template <typename T> T testValue(std::size_t i, int seed)
+{
+    return T(int((i * 7 + seed * 13) % 23) - 11) * T(0.5) + T(seed);
+}
+
+template <typename M> void fill(M &m, int seed)
+{
+    typedef typename M::EntryType T;
+    for (std::size_t i = 0; i < m.entriesCount(); ++i) {
+        m[i] = testValue<T>(i, seed);
+    }
+}
+
+// operator[] of a 2D Memory returns a row
+template <typename M> void fill2D(M &m, int seed)
+{
+    for (std::size_t r = 0; r < m.rowsCount(); ++r) {
+        fill(m[r], seed + int(r));
+    }
+}
+
+// arithmetics{{{1
+TEST_TYPES(V, arithmetics, ALL_TYPES)
+{
+    using T = typename V::EntryType;
+    for (std::size_t n : {1, 7, 64, 101}) {
+        Memory<V> a(n), b(n), c(n), d(n);
+        fill(b, 1);
+        fill(c, 2);
+        fill(d, 3);
+        a = b * c + d;
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(a[i], T(b[i] * c[i] + d[i])) << "i = " << i;
+        }
+        a = T(2) * b - (c + T(1)) * d;
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(a[i], T(T(2) * b[i] - (c[i] + T(1)) * d[i])) << "i = " << i;
+        }
+        a = -b + c;
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(a[i], T(-b[i] + c[i])) << "i = " << i;
+        }
+        a = b;
+        a = a * a + c;  // the destination may be an operand
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(a[i], T(b[i] * b[i] + c[i])) << "i = " << i;
+        }
+        a = Vc::min(b, c * T(2));
+        d = Vc::max(b, T(1));
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(a[i], std::min(b[i], T(c[i] * T(2)))) << "i = " << i;
+            COMPARE(d[i], std::max(b[i], T(1))) << "i = " << i;
+        }
+    }
+}
+
+// compound{{{1
+TEST_TYPES(V, compoundAssignment, ALL_TYPES)
+{
+    using T = typename V::EntryType;
+    const std::size_t n = 3 * V::Size + 1;
+    Memory<V> a(n), b(n), c(n);
+    fill(a, 1);
+    fill(b, 2);
+    fill(c, 3);
+    Memory<V> ref(n);
+    ref = a;
+    a += b * c;
+    for (std::size_t i = 0; i < n; ++i) {
+        COMPARE(a[i], T(ref[i] + b[i] * c[i])) << "i = " << i;
+    }
+    ref = a;
+    a -= b + c;
+    for (std::size_t i = 0; i < n; ++i) {
+        COMPARE(a[i], T(ref[i] - (b[i] + c[i]))) << "i = " << i;
+    }
+    ref = a;
+    a *= b - T(1);
+    for (std::size_t i = 0; i < n; ++i) {
+        COMPARE(a[i], T(ref[i] * (b[i] - T(1)))) << "i = " << i;
+    }
+
+    // the comparison of two arrays keeps its meaning
+    static_assert(std::is_same<decltype(a == b), bool>::value, "");
+    static_assert(std::is_same<decltype(a < b), bool>::value, "");
+}
+
+// functions{{{1
+TEST_TYPES(V, functions, FLOAT_TYPES)
+{
+    using T = typename V::EntryType;
+    const std::size_t n = 50;
+    Memory<V> a(n), b(n), c(n);
+    fill(b, 20);
+    fill(c, 2);
+    a = Vc::sqrt(b * b + c * c);
+    for (std::size_t i = 0; i < n; ++i) {
+        FUZZY_COMPARE(a[i], std::sqrt(b[i] * b[i] + c[i] * c[i])) << "i = " << i;
+    }
+    a = Vc::exp(-Vc::abs(c)) + Vc::log(b);
+    for (std::size_t i = 0; i < n; ++i) {
+        FUZZY_COMPARE(a[i], std::exp(-std::abs(c[i])) + std::log(b[i])) << "i = " << i;
+    }
+    a = Vc::floor(c * T(0.3)) - Vc::ceil(c * T(0.3));
+    for (std::size_t i = 0; i < n; ++i) {
+        COMPARE(a[i], std::floor(c[i] * T(0.3)) - std::ceil(c[i] * T(0.3))) << "i = " << i;
+    }
+}
+
+// select{{{1
+TEST_TYPES(V, select, ALL_TYPES)
+{
+    using T = typename V::EntryType;
+    const std::size_t n = 5 * V::Size + 3;
+    Memory<V> a(n), b(n), c(n);
+    fill(b, 1);
+    fill(c, 2);
+    a = Vc::iif(b - c > T(0), b - c, T(0));
+    for (std::size_t i = 0; i < n; ++i) {
+        COMPARE(a[i], b[i] > c[i] ? T(b[i] - c[i]) : T(0)) << "i = " << i;
+    }
+    a = Vc::iif(b > T(0) && c < T(3), b, c * T(2));
+    for (std::size_t i = 0; i < n; ++i) {
+        COMPARE(a[i], b[i] > T(0) && c[i] < T(3) ? b[i] : T(c[i] * T(2))) << "i = " << i;
+    }
+
+    Memory<V> ref(n);
+    ref = a;
+    Vc::where(a < T(0), a) = -a;
+    for (std::size_t i = 0; i < n; ++i) {
+        COMPARE(a[i], ref[i] < T(0) ? T(-ref[i]) : ref[i]) << "i = " << i;
+    }
+    ref = a;
+    Vc::where(!(b == c * T(2)) || b < T(-1), a) += b * c;
+    for (std::size_t i = 0; i < n; ++i) {
+        COMPARE(a[i], b[i] != c[i] * T(2) || b[i] < T(-1) ? T(ref[i] + b[i] * c[i]) : ref[i])
+            << "i = " << i;
+    }
+}
+
+// fixed size{{{1
+TEST_TYPES(V, fixedSize, ALL_TYPES)
+{
+    using T = typename V::EntryType;
+    Memory<V, 35> a, b, c;
+    fill(b, 1);
+    fill(c, 2);
+    a = b * c - T(1);
+    for (std::size_t i = 0; i < a.entriesCount(); ++i) {
+        COMPARE(a[i], T(b[i] * c[i] - T(1))) << "i = " << i;
+    }
+
+    Memory<V, 4, 13> x, y;
+    fill2D(y, 4);
+    x = y + y * y;
+    for (std::size_t r = 0; r < x.rowsCount(); ++r) {
+        for (std::size_t i = 0; i < x[r].entriesCount(); ++i) {
+            COMPARE(x[r][i], T(y[r][i] + y[r][i] * y[r][i])) << r << ", " << i;
+        }
+    }
+}
+
+// vim: foldmethod=marker
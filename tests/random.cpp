@@ -26,6 +26,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 }}}*/
 
 #include "unittest.h"
+#include <Vc/random>
+#include <thread>
 
 #ifdef _WIN32
 void bzero(void *p, size_t n) { memset(p, 0, n); }
@@ -133,4 +135,112 @@ template <> void Random_<double_v>::run()
 }
 }  // namespace Tests
 
+TEST_TYPES(V, engineIsReproducible, (ALL_VECTORS, SIMD_ARRAYS(3)))
+{
+    Vc::RandomEngine<V> a(1234, 5), b(1234, 5), otherStream(1234, 6), otherSeed(1235, 5);
+    V first[16];
+    bool differentStream = false, differentSeed = false;
+    for (int i = 0; i < 16; ++i) {
+        first[i] = a();
+        COMPARE(b(), first[i]);
+        differentStream = differentStream || any_of(otherStream() != first[i]);
+        differentSeed = differentSeed || any_of(otherSeed() != first[i]);
+    }
+    VERIFY(differentStream);
+    VERIFY(differentSeed);
+
+    a.seed(1234, 5);
+    for (int i = 0; i < 16; ++i) {
+        COMPARE(a(), first[i]);
+    }
+}
+
+TEST(engineStreamsDoNotOverlapAcrossSizes)
+{
+    // with lane seeds derived from stream * Size + lane, both engines would share all
+    // four lanes of b
+    Vc::RandomEngine<SimdArray<unsigned int, 8>> a(1234, 1);
+    Vc::RandomEngine<SimdArray<unsigned int, 4>> b(1234, 2);
+    const auto x = a.bits();
+    const auto y = b.bits();
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        for (std::size_t j = 0; j < y.size(); ++j) {
+            VERIFY(x[i] != y[j]) << "i = " << i << ", j = " << j;
+        }
+    }
+}
+
+TEST_TYPES(V, engineLanesDiffer, (ALL_VECTORS))
+{
+    if (V::Size == 1) {
+        return;
+    }
+    Vc::RandomEngine<V> rng;
+    int equalLanes = 0;
+    for (int i = 0; i < 64; ++i) {
+        const V x = rng();
+        equalLanes += (x == x[0]).count() - 1;
+    }
+    VERIFY(equalLanes < 8) << equalLanes;
+}
+
+template <typename V> void checkMoments(const char *name, double expectedMean,
+                                        double expectedVariance, V (*draw)(Vc::RandomEngine<V> &))
+{
+    Vc::RandomEngine<V> rng(42);
+    const int N = 1 << 16;
+    double sum = 0, sum2 = 0;
+    for (int i = 0; i < N; ++i) {
+        const V x = draw(rng);
+        for (std::size_t k = 0; k < V::Size; ++k) {
+            sum += x[k];
+            sum2 += double(x[k]) * x[k];
+        }
+    }
+    const double n = double(N) * V::Size;
+    const double mean = sum / n;
+    const double variance = sum2 / n - mean * mean;
+    VERIFY(std::abs(mean - expectedMean) < 0.01) << name << " mean: " << mean;
+    VERIFY(std::abs(variance - expectedVariance) < 0.02) << name << " variance: " << variance;
+}
+
+TEST_TYPES(V, engineDistributions, (REAL_VECTORS, SIMD_REAL_ARRAYS(3)))
+{
+    using T = typename V::EntryType;
+    checkMoments<V>("uniform", 0.5, 1. / 12, [](Vc::RandomEngine<V> &rng) { return rng(); });
+    checkMoments<V>("uniform(-1, 3)", 1., 16. / 12,
+                    [](Vc::RandomEngine<V> &rng) { return rng.uniform(T(-1), T(3)); });
+    checkMoments<V>("normal", 0., 1., [](Vc::RandomEngine<V> &rng) { return rng.normal(); });
+    checkMoments<V>("normal(2, .5)", 2., .25,
+                    [](Vc::RandomEngine<V> &rng) { return rng.normal(T(2), T(.5)); });
+    checkMoments<V>("exponential(2)", .5, .25,
+                    [](Vc::RandomEngine<V> &rng) { return rng.exponential(T(2)); });
+
+    Vc::RandomEngine<V> rng;
+    for (int i = 0; i < 10000; ++i) {
+        const V x = rng();
+        VERIFY(all_of(x >= V::Zero() && x < V::One())) << x;
+        const V y = rng.uniform(T(-2), T(-1));
+        VERIFY(all_of(y >= T(-2) && y < T(-1))) << y;
+        const V z = rng.exponential();
+        VERIFY(all_of(z >= V::Zero() && Vc::isfinite(z))) << z;
+    }
+}
+
+TEST_TYPES(V, randomPerThread, (ALL_VECTORS))
+{
+    V inThread[8];
+    std::thread t([&]() {
+        for (auto &x : inThread) {
+            x = V::Random();
+        }
+    });
+    t.join();
+    bool different = false;
+    for (const auto &x : inThread) {
+        different = different || any_of(V::Random() != x);
+    }
+    VERIFY(different);
+}
+
 // vim: foldmethod=marker
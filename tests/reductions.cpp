@@ -28,7 +28,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "unittest.h"
 #include "vectormemoryhelper.h"
 
-TEST_TYPES(Vec, testReduceMin, (ALL_VECTORS, SIMD_ARRAY_LIST)) //{{{1
+#define ALL_TYPES                                                                        \
+    (ALL_VECTORS, EXTRA_INT_VECTORS, SIMD_ARRAY_LIST, SIMD_EXTRA_INT_ARRAYS(19))
+
+TEST_TYPES(Vec, testReduceMin, ALL_TYPES) //{{{1
 {
     typedef typename Vec::EntryType T;
     const T one = 1;
@@ -44,7 +47,7 @@ TEST_TYPES(Vec, testReduceMin, (ALL_VECTORS, SIMD_ARRAY_LIST)) //{{{1
     }
 }
 
-TEST_TYPES(Vec, testReduceMax, (ALL_VECTORS, SIMD_ARRAY_LIST)) //{{{1
+TEST_TYPES(Vec, testReduceMax, ALL_TYPES) //{{{1
 {
     typedef typename Vec::EntryType T;
     const T max = Vec::Size + 1;
@@ -60,7 +63,7 @@ TEST_TYPES(Vec, testReduceMax, (ALL_VECTORS, SIMD_ARRAY_LIST)) //{{{1
     }
 }
 
-TEST_TYPES(V, testReduceProduct, (ALL_VECTORS, SIMD_ARRAY_LIST)) //{{{1
+TEST_TYPES(V, testReduceProduct, ALL_TYPES) //{{{1
 {
     using T = typename V::EntryType;
     V test = 0;
@@ -84,7 +87,7 @@ TEST_TYPES(V, testReduceProduct, (ALL_VECTORS, SIMD_ARRAY_LIST)) //{{{1
     }
 }
 
-TEST_TYPES(Vec, testReduceSum, (ALL_VECTORS, SIMD_ARRAY_LIST)) //{{{1
+TEST_TYPES(Vec, testReduceSum, ALL_TYPES) //{{{1
 {
     typedef typename Vec::EntryType T;
     int _sum = 1;
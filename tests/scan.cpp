@@ -0,0 +1,188 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "unittest.h"
+#include <Vc/Memory>
+#include <Vc/execution>
+#include <numeric>
+#include <vector>
+
+using namespace Vc;
+
+#define TYPES (float, double, int, unsigned int, short, unsigned short)
+
+struct Plus {
+    template <typename V> V operator()(const V &a, const V &b) const { return a + b; }
+};
+
+struct Max {
+    template <typename V> V operator()(const V &a, const V &b) const { return Vc::max(a, b); }
+};
+
+// associative, but not commutative: op(a, b) == a
+struct First {
+    template <typename V> V operator()(const V &a, const V &) const { return a; }
+};
+
+template <typename T> std::vector<T> testData(std::size_t n)
+{
+    std::vector<T> x(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        x[i] = T((i * 7 + 3) % 13);  // integral values keep float sums exact
+    }
+    return x;
+}
+
+// inclusive{{{1
+TEST_TYPES(T, inclusive, TYPES)
+{
+    for (std::size_t n : {0, 1, 3, 16, 17, 63, 100, 1000}) {
+        const auto data = testData<T>(n + 3);
+        for (std::size_t offset = 0; offset < 3; ++offset) {
+            const auto first = data.begin() + offset, last = first + n;
+            std::vector<T> ref(n), out(n + 1, T(99));
+            std::partial_sum(first, last, ref.begin());
+            COMPARE(inclusive_scan(first, last, out.begin()), out.begin() + n);
+            COMPARE(std::vector<T>(out.begin(), out.begin() + n), ref) << "n = " << n;
+            COMPARE(out[n], T(99));
+
+            std::partial_sum(first, last, ref.begin(),
+                             [](T a, T b) { return std::max(a, b); });
+            inclusive_scan(first, last, out.begin(), Max());
+            COMPARE(std::vector<T>(out.begin(), out.begin() + n), ref) << "n = " << n;
+
+            inclusive_scan(first, last, out.begin(), First());
+            for (std::size_t i = 0; i < n; ++i) {
+                COMPARE(out[i], *first) << "i = " << i;
+            }
+
+            // with an initial value; in-place
+            std::vector<T> inout(first, last);
+            inclusive_scan(inout.begin(), inout.end(), inout.begin(), Plus(), T(5));
+            std::partial_sum(first, last, ref.begin());
+            for (std::size_t i = 0; i < n; ++i) {
+                COMPARE(inout[i], T(ref[i] + 5)) << "i = " << i;
+            }
+        }
+    }
+}
+
+// exclusive{{{1
+TEST_TYPES(T, exclusive, TYPES)
+{
+    for (std::size_t n : {0, 1, 3, 16, 17, 63, 100, 1000}) {
+        const auto data = testData<T>(n + 3);
+        for (std::size_t offset = 0; offset < 3; ++offset) {
+            const auto first = data.begin() + offset, last = first + n;
+            std::vector<T> ref(n), out(n + 1, T(99));
+            T sum = 2;
+            for (std::size_t i = 0; i < n; ++i) {
+                ref[i] = sum;
+                sum += first[i];
+            }
+            COMPARE(exclusive_scan(first, last, out.begin(), T(2)), out.begin() + n);
+            COMPARE(std::vector<T>(out.begin(), out.begin() + n), ref) << "n = " << n;
+            COMPARE(out[n], T(99));
+
+            std::vector<T> inout(first, last);
+            exclusive_scan(inout.begin(), inout.end(), inout.begin(), T(2));
+            COMPARE(inout, ref) << "n = " << n;
+
+            exclusive_scan(first, last, out.begin(), T(1), First());
+            for (std::size_t i = 0; i < n; ++i) {
+                COMPARE(out[i], T(1)) << "i = " << i;
+            }
+            exclusive_scan(first, last, out.begin(), T(4), Max());
+            T m = 4;
+            for (std::size_t i = 0; i < n; ++i) {
+                COMPARE(out[i], m) << "i = " << i;
+                m = std::max(m, first[i]);
+            }
+        }
+    }
+}
+
+// memory{{{1
+TEST_TYPES(V, memory, (float_v, int_v, double_v))
+{
+    typedef typename V::EntryType T;
+    Memory<V, 100> in;
+    Memory<V> out(100);
+    for (std::size_t i = 0; i < 100; ++i) {
+        in[i] = T(i % 5);
+    }
+    inclusive_scan(in, out);
+    T sum = 0;
+    for (std::size_t i = 0; i < 100; ++i) {
+        sum += T(i % 5);
+        COMPARE(out[i], sum);
+    }
+    exclusive_scan(in, out, T(1));
+    sum = 1;
+    for (std::size_t i = 0; i < 100; ++i) {
+        COMPARE(out[i], sum);
+        sum += T(i % 5);
+    }
+    inclusive_scan(in, in, Max());
+    for (std::size_t i = 0; i < 100; ++i) {
+        COMPARE(in[i], T(std::min<std::size_t>(i, 4)));
+    }
+}
+
+// parallel{{{1
+TEST_TYPES(T, parallel, (float, int, unsigned short))
+{
+    for (std::size_t n : {10, 5000, 100000, 1000003}) {
+        const auto data = testData<T>(n + 1);
+        const auto first = data.begin() + 1, last = first + n;
+        std::vector<T> ref(n), out(n);
+        std::partial_sum(first, last, ref.begin());
+        inclusive_scan(par_simd, first, last, out.begin());
+        COMPARE(out, ref) << "n = " << n;
+
+        std::vector<T> inout(first, last);
+        exclusive_scan(par_simd, inout.begin(), inout.end(), inout.begin(), T(3));
+        COMPARE(inout[0], T(3));
+        for (std::size_t i = 1; i < n; ++i) {
+            COMPARE(inout[i], T(ref[i - 1] + T(3))) << "i = " << i;
+        }
+
+        inclusive_scan(par_simd, first, last, out.begin(), First());
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i], *first) << "i = " << i;
+        }
+        exclusive_scan(par_simd, first, last, out.begin(), T(1), Max());
+        T m = 1;
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i], m) << "i = " << i;
+            m = std::max(m, first[i]);
+        }
+    }
+}
+
+// vim: foldmethod=marker
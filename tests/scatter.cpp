@@ -32,7 +32,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 using namespace Vc;
 
-#define ALL_TYPES SIMD_ARRAY_LIST, ALL_VECTORS
+#define ALL_TYPES SIMD_ARRAY_LIST, ALL_VECTORS, EXTRA_INT_VECTORS
 
 TEST_TYPES(Vec, scatterArray, (ALL_TYPES)) //{{{1
 {
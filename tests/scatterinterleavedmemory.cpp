@@ -26,6 +26,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 }}}*/
 
 #include "unittest.h"
+#include <vector>
 
 using namespace Vc;
 
@@ -170,4 +171,99 @@ TEST_TYPES(Param, testInterleavingScatter,
     }
 }
 
+template <typename V, std::size_t... J> void testLargeStruct(Vc::index_sequence<J...>)
+{
+    typedef typename V::IndexType I;
+    constexpr std::size_t StructSize = sizeof...(J);
+    typedef SomeStruct<typename V::EntryType, StructSize> S;
+    const size_t N = 64;
+    const size_t NMask = createNMask(N);
+
+    S *data = Vc::malloc<S, Vc::AlignOnVector>(N);
+    std::memset(data, 0, sizeof(S) * N);
+    Vc::InterleavedMemoryWrapper<S, V> data_v(data);
+
+    for (int retest = 0; retest < 100; ++retest) {
+        I indexes = (I::Random() >> 10) & I(NMask);
+        if (I::Size != 1) {
+            while (any_of(indexes.sorted() == rotate(indexes.sorted()))) {
+                indexes = (I::Random() >> 10) & I(NMask);
+            }
+        }
+        const std::array<V, StructSize> reference = {{((void)J, V::Random())...}};
+        data_v[indexes] = tie(reference[J]...);
+        std::array<V, StructSize> t = data_v[indexes];
+        COMPARE(t, reference) << "indexes: " << indexes;
+        for (size_t k = 0; k < V::Size; ++k) {
+            for (size_t j = 0; j < StructSize; ++j) {
+                COMPARE(data[indexes[k]].d[j], reference[j][k]);
+            }
+        }
+    }
+    for (size_t i = 0; i <= N - V::Size; ++i) {
+        const std::array<V, StructSize> reference = {{((void)J, V::Random())...}};
+        data_v[i].interleave(reference[J]...);
+        std::array<V, StructSize> t = data_v[i];
+        COMPARE(t, reference) << "i: " << i;
+    }
+    Vc::free(data);
+}
+
+TEST_TYPES(Param, testInterleavingScatterLargeStructs,
+           (outer_product<Typelist<ALL_VECTORS>,
+                          Typelist<std::integral_constant<std::size_t, 9>,
+                                   std::integral_constant<std::size_t, 12>,
+                                   std::integral_constant<std::size_t, 16>>>))
+{
+    typedef typename Param::template at<0> V;
+    testLargeStruct<V>(Vc::make_index_sequence<Param::template at<1>::value>());
+}
+
+struct SensorRecord {
+    float t;
+    int id;
+    float x, y, z;
+    int flags;
+    float v;
+};
+// int_v only matches float_v in size where both use the same register width
+typedef typename std::conditional<int_v::Size == float_v::Size, int_v,
+                                  SimdArray<int, float_v::Size>>::type int_for_float_v;
+
+TEST(interleaveMixedTypes)
+{
+    typedef int_for_float_v IV;
+    const int N = 64;
+    std::vector<SensorRecord> data(N);
+    Vc::InterleavedMemoryWrapper<SensorRecord, float_v> data_v(&data[0]);
+    for (int i = 0; i <= N - int(float_v::Size); i += float_v::Size) {
+        const float_v fi = float_v::IndexesFromZero() + float(i);
+        const IV ii = IV::IndexesFromZero() + i;
+        data_v[size_t(i)].interleave(fi * 0.5f, ii * 3, -fi, fi * fi, fi + 1.f, ~ii, fi * 2.f);
+    }
+    for (int i = 0; i < N / int(float_v::Size) * int(float_v::Size); ++i) {
+        COMPARE(data[i].t, i * 0.5f);
+        COMPARE(data[i].id, i * 3);
+        COMPARE(data[i].x, -float(i));
+        COMPARE(data[i].y, float(i * i));
+        COMPARE(data[i].z, i + 1.f);
+        COMPARE(data[i].flags, ~i);
+        COMPARE(data[i].v, i * 2.f);
+    }
+
+    float_v t, x;
+    IV id;
+    for (int retest = 0; retest < 100; ++retest) {
+        const float_v::IndexType indexes =
+            float_v::IndexType::IndexesFromZero() * 3 + retest % 7;
+        const IV ii = Vc::simd_cast<IV>(indexes) + retest;
+        const float_v r = float_v::Random();
+        data_v[indexes].interleave(r, ii, r * 2.f);
+        data_v[indexes].deinterleave(t, id, x);
+        COMPARE(t, r);
+        COMPARE(id, ii);
+        COMPARE(x, r * 2.f);
+    }
+}
+
 // vim: foldmethod=marker
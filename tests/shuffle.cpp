@@ -0,0 +1,135 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+/*includes {{{*/
+#include "unittest.h"
+/*}}}*/
+using namespace Vc;
+
+using AllTypes = concat<AllVectors, AllSimdArrays>;
+
+// Every pattern maps entry i of a vector with N entries to an index in [-1, 2 * N).
+// Indexes >= N are only used with two sources.
+// patterns {{{1
+struct Identity { static constexpr int index(int i, int) { return i; } };
+struct Reverse { static constexpr int index(int i, int N) { return N - 1 - i; } };
+struct Rotate { static constexpr int index(int i, int N) { return (i + 1) % N; } };
+struct SwapPairs { static constexpr int index(int i, int N) { return (i ^ 1) < N ? i ^ 1 : i; } };
+struct Broadcast { static constexpr int index(int, int N) { return N / 2; } };
+struct ZeroOdd { static constexpr int index(int i, int) { return i % 2 ? -1 : i; } };
+struct Scramble { static constexpr int index(int i, int N) { return (i * 7 + 3) % N; } };
+struct SwapHalves { static constexpr int index(int i, int N) { return (i + N / 2) % N; } };
+struct ScrambleZero
+{
+    static constexpr int index(int i, int N) { return i % 3 == 1 ? -1 : (i * 5 + 2) % N; }
+};
+// two sources
+struct Blend { static constexpr int index(int i, int N) { return i % 2 ? i + N : i; } };
+struct Interleave { static constexpr int index(int i, int N) { return i / 2 + (i % 2) * N; } };
+struct Concat { static constexpr int index(int i, int N) { return i + N / 2; } };
+struct SecondOnly { static constexpr int index(int i, int N) { return N + (N - 1 - i); } };
+struct Unpack
+{
+    static constexpr int index(int i, int N) { return (i * 3 + (i % 4)) % (2 * N); }
+};
+struct TwoZero
+{
+    static constexpr int index(int i, int N) { return i % 4 == 3 ? -1 : (i * 5 + 1) % (2 * N); }
+};
+
+// helpers {{{1
+template <typename P, typename V, std::size_t... I>
+V shuffle1(const V &x, Vc::index_sequence<I...>)
+{
+    return Vc::shuffle<P::index(I, V::Size)...>(x);
+}
+template <typename P, typename V, std::size_t... I>
+V shuffle2(const V &a, const V &b, Vc::index_sequence<I...>)
+{
+    return Vc::shuffle<P::index(I, V::Size)...>(a, b);
+}
+template <typename P, typename V> V reference(const V &a, const V &b)
+{
+    using T = typename V::EntryType;
+    return V::generate([&](int i) {
+        const int j = P::index(i, V::Size);
+        return j < 0 ? T(0) : j < int(V::Size) ? a[j] : b[j - V::Size];
+    });
+}
+template <typename V> V testVector(int offset)
+{
+    using T = typename V::EntryType;
+    return V::generate([&](int i) { return T(i + offset); });
+}
+
+template <typename V, typename P> void testOne()
+{
+    const V a = testVector<V>(1);
+    COMPARE((shuffle1<P>(a, Vc::make_index_sequence<V::Size>())), (reference<P>(a, a)))
+        << typeid(P).name();
+}
+template <typename V, typename P> void testTwo()
+{
+    const V a = testVector<V>(1);
+    const V b = testVector<V>(101);
+    COMPARE((shuffle2<P>(a, b, Vc::make_index_sequence<V::Size>())), (reference<P>(a, b)))
+        << typeid(P).name();
+}
+
+TEST_TYPES(V, oneSource, (AllTypes)) //{{{1
+{
+    testOne<V, Identity>();
+    testOne<V, Reverse>();
+    testOne<V, Rotate>();
+    testOne<V, SwapPairs>();
+    testOne<V, Broadcast>();
+    testOne<V, ZeroOdd>();
+    testOne<V, Scramble>();
+    testOne<V, SwapHalves>();
+    testOne<V, ScrambleZero>();
+}
+
+TEST_TYPES(V, twoSources, (AllTypes)) //{{{1
+{
+    testTwo<V, Identity>();
+    testTwo<V, Blend>();
+    testTwo<V, Interleave>();
+    testTwo<V, Concat>();
+    testTwo<V, SecondOnly>();
+    testTwo<V, Unpack>();
+    testTwo<V, TwoZero>();
+    testTwo<V, ZeroOdd>();
+    testTwo<V, Scramble>();
+}
+
+TEST_TYPES(V, usage, (AllVectors)) //{{{1
+{
+    // the same result as the existing reversed()
+    const V x = testVector<V>(1);
+    COMPARE((shuffle1<Reverse>(x, Vc::make_index_sequence<V::Size>())), x.reversed());
+}
+
+// vim: foldmethod=marker
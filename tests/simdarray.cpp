@@ -184,6 +184,12 @@ TEST_TYPES(V, load, (SIMD_ARRAY_LIST))
 
     b = decltype(b)(&data[2], Vc::Unaligned | Vc::Streaming);
     COMPARE(a, b - 1);
+
+    // an lvalue pointer must not be taken as a broadcast argument
+    T *ptr = &data[1];
+    const auto flags = Vc::Unaligned;
+    b = V(ptr, flags);
+    COMPARE(a, b);
 }
 
 TEST_TYPES(A,
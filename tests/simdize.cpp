@@ -27,6 +27,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "unittest.h"
 #include <list>
+#include <deque>
 
 using Vc::simdize;
 using Vc::float_v;
@@ -455,6 +456,58 @@ TEST(vector_iterator_vectorization)
     }
 }
 
+template <typename T> struct Point3 {
+    T x, y, z;
+    Vc_SIMDIZE_INTERFACE((x, y, z));
+    Point3() = default;
+    Point3(T xx, T yy, T zz) : x(xx), y(yy), z(zz) {}
+};
+
+template <typename L> void testStructIteration()
+{
+    using Vc::SimdizeDetail::get_dispatcher;
+    using S = typename L::value_type;
+    using T = Vc::Traits::decay<decltype(get_dispatcher<0>(std::declval<S &>()))>;
+    using V = simdize<S>;
+    using VT = simdize<T, V::size()>;
+    using LIV = simdize<typename L::iterator>;
+    L list;
+    for (int i = 0; i < int(16 * V::size()); ++i) {
+        list.push_back(S(T(i), T(2 * i), T(3 * i)));
+    }
+    const VT iota = VT::IndexesFromZero();
+    int offset = 0;
+    for (LIV b = list.begin(); b != LIV(list.end()); ++b, offset += int(V::size())) {
+        const V x = *b;
+        COMPARE(get_dispatcher<0>(x), iota + T(offset));
+        COMPARE(get_dispatcher<1>(x), (iota + T(offset)) * T(2));
+        COMPARE(get_dispatcher<2>(x), (iota + T(offset)) * T(3));
+        *b = V(get_dispatcher<2>(x), get_dispatcher<0>(x), get_dispatcher<1>(x) + T(1));
+    }
+    int i = 0;
+    for (const S &s : list) {
+        COMPARE(get_dispatcher<0>(s), T(3 * i));
+        COMPARE(get_dispatcher<1>(s), T(i));
+        COMPARE(get_dispatcher<2>(s), T(2 * i + 1));
+        ++i;
+    }
+}
+
+TEST_TYPES(T, struct_iterator_vectorization, (float, double, int, unsigned short))
+{
+    using namespace Vc::SimdizeDetail::IteratorDetails;
+    using P = Point3<T>;
+    static_assert(InterleavedAccess<P *, simdize<P>>::value,
+                  "Point3<T> must support interleaved loads and stores");
+    static_assert(is_contiguous_iterator<typename std::vector<P>::iterator>::value, "");
+    static_assert(!is_contiguous_iterator<typename std::deque<P>::iterator>::value, "");
+    testStructIteration<std::vector<P>>();
+    testStructIteration<std::deque<P>>();
+    testStructIteration<std::list<P>>();
+    // std::tuple may store its members in reverse order
+    testStructIteration<std::vector<std::tuple<T, T, T>>>();
+}
+
 TEST(shifted)
 {
     using T = std::tuple<float, int>;
@@ -0,0 +1,161 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/soa_vector>
+
+using Vc::simdize;
+using Vc::soa_vector;
+
+template <typename T> struct Particle {
+    T x, y, mass;
+    Vc_SIMDIZE_INTERFACE((x, y, mass));
+    Particle(T xx, T yy, T m) : x(xx), y(yy), mass(m) {}
+};
+
+template <typename T, typename U> struct Mixed {
+    T a;
+    U b;
+    Vc_SIMDIZE_INTERFACE((a, b));
+    Mixed(T aa, U bb) : a(aa), b(bb) {}
+};
+
+// scalarAccess{{{1
+TEST(scalarAccess)
+{
+    using P = Particle<float>;
+    soa_vector<P> v;
+    COMPARE(v.size(), 0u);
+    VERIFY(v.empty());
+    for (int i = 0; i < 37; ++i) {
+        v.push_back(P(float(i), float(2 * i), float(i) * 0.5f));
+        COMPARE(v.size(), std::size_t(i + 1));
+    }
+    for (std::size_t i = 0; i < v.size(); ++i) {
+        const P p = v.scalar(i);
+        COMPARE(p.x, float(i));
+        COMPARE(p.y, float(2 * i));
+        COMPARE(p.mass, float(i) * 0.5f);
+    }
+    v.scalar(5) = P(-1.f, -2.f, -3.f);
+    COMPARE(static_cast<const P &>(P(v.scalar(5))).y, -2.f);
+    COMPARE(v.data<2>()[5], -3.f);
+    v.scalar(6) = v.scalar(5);
+    COMPARE(v.data<0>()[6], -1.f);
+
+    // padding is zero
+    const std::size_t W = simdize<P>::Size;
+    COMPARE(v.vectorsCount(), (37 + W - 1) / W);
+    for (std::size_t i = v.size(); i < v.vectorsCount() * W; ++i) {
+        COMPARE(v.data<0>()[i], 0.f);
+        COMPARE(v.data<1>()[i], 0.f);
+        COMPARE(v.data<2>()[i], 0.f);
+    }
+}
+
+// vectorAccess{{{1
+TEST(vectorAccess)
+{
+    using P = Particle<float>;
+    using PV = simdize<P>;
+    const std::size_t n = 101;
+    soa_vector<P> v(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        v.scalar(i) = P(float(i), 1.f, float(i % 7));
+    }
+    const auto &cv = v;
+    for (std::size_t i = 0; i < v.vectorsCount(); ++i) {
+        PV p = v[i];
+        const PV q = cv[i];
+        COMPARE(p.x, q.x);
+        for (std::size_t k = 0; k < PV::Size; ++k) {
+            const std::size_t j = i * PV::Size + k;
+            COMPARE(p.x[k], j < n ? float(j) : 0.f);
+            COMPARE(p.y[k], j < n ? 1.f : 0.f);
+        }
+        p.x += p.y * p.mass;
+        v[i] = p;
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        const P p = cv.scalar(i);
+        COMPARE(p.x, float(i) + float(i % 7));
+        COMPARE(p.y, 1.f);
+    }
+    v[1] = v[0];
+    COMPARE(v.data<0>()[PV::Size], 0.f);
+}
+
+// mixedTypes{{{1
+TEST(mixedTypes)
+{
+    using M = Mixed<double, int>;
+    using MV = simdize<M>;
+    soa_vector<M> v(20);
+    for (int i = 0; i < 20; ++i) {
+        v.scalar(i) = M(i * 0.25, -i);
+    }
+    for (std::size_t i = 0; i < v.vectorsCount(); ++i) {
+        MV m = v[i];
+        m.a = m.a * 2.;
+        m.b = m.b + 1;
+        v[i] = m;
+    }
+    for (int i = 0; i < 20; ++i) {
+        const M m = v.scalar(i);
+        COMPARE(m.a, i * 0.5);
+        COMPARE(m.b, 1 - i);
+    }
+
+    // explicit width
+    soa_vector<M, 3> v3(7);
+    COMPARE(v3.vectorsCount(), 3u);
+    v3.scalar(6) = M(1.5, 2);
+    const simdize<M, 3> last = v3[2];
+    COMPARE(last.a[0], 1.5);
+    COMPARE(last.b[0], 2);
+    COMPARE(last.b[1], 0);
+}
+
+// resize{{{1
+TEST(resize)
+{
+    using P = Particle<float>;
+    soa_vector<P> v(50);
+    for (std::size_t i = 0; i < v.size(); ++i) {
+        v.scalar(i) = P(1.f, 2.f, 3.f);
+    }
+    v.resize(3);
+    v.resize(60);
+    for (std::size_t i = 0; i < v.vectorsCount() * simdize<P>::Size; ++i) {
+        COMPARE(v.data<1>()[i], i < 3 ? 2.f : 0.f) << "i = " << i;
+    }
+    v.clear();
+    COMPARE(v.size(), 0u);
+    COMPARE(v.vectorsCount(), 0u);
+}
+
+// vim: foldmethod=marker
@@ -26,6 +26,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 }}}*/
 
 #include "unittest.h"
+#include <numeric>
 
 TEST_TYPES(Vec, testSort, (ALL_VECTORS, SIMD_ARRAYS(15), SIMD_ARRAYS(8), SIMD_ARRAYS(3), SIMD_ARRAYS(1)))
 {
@@ -89,4 +90,63 @@ TEST_TYPES(Vec, testSort, (ALL_VECTORS, SIMD_ARRAYS(15), SIMD_ARRAYS(8), SIMD_AR
     }
 }
 
+template <typename T> std::vector<T> sortInput(std::size_t size, int variant)
+{
+    std::vector<T> data(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        const T r = Vc::Scalar::Vector<T>::Random()[0];
+        switch (variant) {
+        case 0: data[i] = r; break;
+        case 1: data[i] = T(int(r) % 7); break;  // many duplicates
+        case 2: data[i] = T(size - i); break;    // reversed
+        default:
+            // duplicates of the largest value, which must not be confused with padding
+            data[i] = i % 3 == 0 ? std::numeric_limits<T>::max() : r;
+            break;
+        }
+    }
+    return data;
+}
+
+TEST_TYPES(Vec, sortArray, (ALL_VECTORS))
+{
+    using T = typename Vec::EntryType;
+    for (std::size_t size : {0u, 1u, 2u, 3u, 5u, 8u, 15u, 16u, 17u, 31u, 33u, 64u, 65u, 100u,
+                             1000u, 5003u, 100003u}) {
+        for (int variant = 0; variant < 4; ++variant) {
+            std::vector<T> data = sortInput<T>(size, variant);
+            std::vector<T> reference = data;
+            std::sort(reference.begin(), reference.end());
+            Vc::sort(data.begin(), data.end());
+            COMPARE(data, reference) << "size: " << size << ", variant: " << variant;
+        }
+    }
+}
+
+TEST_TYPES(Vec, sortByKey, (ALL_VECTORS))
+{
+    using T = typename Vec::EntryType;
+    for (std::size_t size : {0u, 1u, 2u, 3u, 5u, 8u, 15u, 16u, 17u, 31u, 33u, 64u, 65u, 100u,
+                             1000u, 5003u, 100003u}) {
+        for (int variant = 0; variant < 4; ++variant) {
+            const std::vector<T> input = sortInput<T>(size, variant);
+            std::vector<T> keys = input;
+            std::vector<std::size_t> values(size);
+            std::iota(values.begin(), values.end(), std::size_t(0));
+            Vc::sort_by_key(keys.begin(), keys.end(), values.begin());
+
+            std::vector<T> reference = input;
+            std::sort(reference.begin(), reference.end());
+            COMPARE(keys, reference) << "size: " << size << ", variant: " << variant;
+            std::vector<bool> seen(size, false);
+            for (std::size_t i = 0; i < size; ++i) {
+                VERIFY(values[i] < size);
+                VERIFY(!seen[values[i]]) << "value " << values[i] << " appears twice";
+                seen[values[i]] = true;
+                COMPARE(input[values[i]], keys[i]) << "i: " << i;
+            }
+        }
+    }
+}
+
 // vim: foldmethod=marker
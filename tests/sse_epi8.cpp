@@ -0,0 +1,94 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2016 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+// GCC and clang implement the vertical 8-bit multiplication with the builtin vector
+// operators. Test the intrinsics fallback that the other compilers use instead.
+#include <Vc/global.h>
+#undef Vc_USE_BUILTIN_VECTOR_TYPES
+
+#include "unittest.h"
+
+using Vc::schar;
+using Vc::uchar;
+
+template <typename T> struct Bytes {
+    alignas(16) T data[16];
+    Bytes(T first, int step)
+    {
+        for (int i = 0; i < 16; ++i) {
+            data[i] = T(first + i * step);
+        }
+    }
+    Bytes(__m128i v) { _mm_store_si128(reinterpret_cast<__m128i *>(data), v); }
+    __m128i load() const { return _mm_load_si128(reinterpret_cast<const __m128i *>(data)); }
+};
+
+template <typename T> void testVerticalMul()
+{
+    for (int first = -128; first < 128; first += 7) {
+        for (int step = 1; step < 40; step += 5) {
+            const Bytes<T> a(T(first), step);
+            const Bytes<T> b(T(first * 3 + 1), -step);
+            const Bytes<T> r(Vc::Detail::mul(a.load(), b.load(), T()));
+            for (int i = 0; i < 16; ++i) {
+                COMPARE(r.data[i], T(a.data[i] * b.data[i])) << "i: " << i;
+            }
+        }
+    }
+}
+
+TEST(mulEpi8)
+{
+    testVerticalMul<schar>();
+    testVerticalMul<uchar>();
+}
+
+template <typename T> void testHorizontal()
+{
+    for (int first = -128; first < 128; first += 3) {
+        for (int step = 1; step < 40; step += 3) {
+            const Bytes<T> a(T(first), step);
+            T product = 1;
+            T min = a.data[0];
+            T max = a.data[0];
+            for (int i = 0; i < 16; ++i) {
+                product = T(product * a.data[i]);
+                min = std::min(min, a.data[i]);
+                max = std::max(max, a.data[i]);
+            }
+            COMPARE(Vc::Detail::mul(a.load(), T()), product);
+            COMPARE(Vc::Detail::min(a.load(), T()), min);
+            COMPARE(Vc::Detail::max(a.load(), T()), max);
+        }
+    }
+}
+
+TEST(reduceEpi8)
+{
+    testHorizontal<schar>();
+    testHorizontal<uchar>();
+}
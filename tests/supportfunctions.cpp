@@ -43,6 +43,14 @@ void testIsSupported()
     COMPARE(Vc::isImplementationSupported(Vc::SSE42Impl), CpuId::hasSse42());
     COMPARE(Vc::isImplementationSupported(Vc::AVXImpl  ), CpuId::hasOsxsave() && CpuId::hasAvx());
     COMPARE(Vc::isImplementationSupported(Vc::AVX2Impl ), CpuId::hasOsxsave() && CpuId::hasAvx2());
+    if (!CpuId::hasAvx512f() || !CpuId::hasAvx512bw() || !CpuId::hasAvx512dq() ||
+        !CpuId::hasAvx512vl()) {
+        VERIFY(!Vc::isImplementationSupported(Vc::AVX512Impl));
+    }
+#ifdef Vc_IMPL_AVX512
+    // this test executes, thus the CPU and OS support AVX-512
+    VERIFY(Vc::isImplementationSupported(Vc::AVX512Impl));
+#endif
 }
 
 void testBestImplementation()
@@ -231,5 +231,158 @@ TEST_TYPES(V, testAtan2, (REAL_VECTORS, SIMD_REAL_ARRAY_LIST)) //{{{1
     }
 }
 
+TEST_TYPES(V, testTan, (REAL_VECTORS, SIMD_REAL_ARRAY_LIST)) //{{{1
+{
+    typedef typename V::EntryType T;
+    UnitTest::setFuzzyness<float>(3);
+    UnitTest::setFuzzyness<double>(3);
+    Array<Reference<T> > reference = referenceData<T, Tan>();
+    for (size_t i = 0; i + V::Size - 1 < reference.size; i += V::Size) {
+        V x, ref;
+        for (size_t j = 0; j < V::Size; ++j) {
+            x[j] = reference.data[i + j].x;
+            ref[j] = reference.data[i + j].ref;
+        }
+        FUZZY_COMPARE(Vc::tan(x), ref) << " x = " << x << ", i = " << i;
+        FUZZY_COMPARE(Vc::tan(-x), -ref) << " -x = " << -x << ", i = " << i;
+    }
+}
+
+TEST_TYPES(V, testAcos, (REAL_VECTORS, SIMD_REAL_ARRAY_LIST)) //{{{1
+{
+    typedef typename V::EntryType T;
+    UnitTest::setFuzzyness<float>(2);
+    UnitTest::setFuzzyness<double>(2);
+
+    COMPARE(Vc::acos(V::One()), V::Zero());
+    COMPARE(Vc::acos(-V::One()), V(T(doubleConstant<1, 0x921fb54442d18ull, 1>())));
+    VERIFY(all_of(Vc::isnan(Vc::acos(V(T(1.5))))));
+
+    Array<Reference<T> > reference = referenceData<T, Acos>();
+    for (size_t i = 0; i + V::Size - 1 < reference.size; i += V::Size) {
+        V x, ref;
+        for (size_t j = 0; j < V::Size; ++j) {
+            x[j] = reference.data[i + j].x;
+            ref[j] = reference.data[i + j].ref;
+        }
+        FUZZY_COMPARE(Vc::acos(x), ref) << " x = " << x << ", i = " << i;
+    }
+}
+
+TEST_TYPES(V, testSinh, (REAL_VECTORS, SIMD_REAL_ARRAY_LIST)) //{{{1
+{
+    typedef typename V::EntryType T;
+    UnitTest::setFuzzyness<float>(2);
+    UnitTest::setFuzzyness<double>(3);
+
+    const V inf = std::numeric_limits<T>::infinity();
+    COMPARE(Vc::sinh(inf), inf);
+    COMPARE(Vc::sinh(-inf), -inf);
+    VERIFY(all_of(Vc::isnan(Vc::sinh(V(std::numeric_limits<T>::quiet_NaN())))));
+
+    Array<Reference<T> > reference = referenceData<T, Sinh>();
+    for (size_t i = 0; i + V::Size - 1 < reference.size; i += V::Size) {
+        V x, ref;
+        for (size_t j = 0; j < V::Size; ++j) {
+            x[j] = reference.data[i + j].x;
+            ref[j] = reference.data[i + j].ref;
+        }
+        FUZZY_COMPARE(Vc::sinh(x), ref) << " x = " << x << ", i = " << i;
+        FUZZY_COMPARE(Vc::sinh(-x), -ref) << " -x = " << -x << ", i = " << i;
+    }
+}
+
+TEST_TYPES(V, testCosh, (REAL_VECTORS, SIMD_REAL_ARRAY_LIST)) //{{{1
+{
+    typedef typename V::EntryType T;
+    UnitTest::setFuzzyness<float>(2);
+    UnitTest::setFuzzyness<double>(3);
+
+    const V inf = std::numeric_limits<T>::infinity();
+    COMPARE(Vc::cosh(V::Zero()), V::One());
+    COMPARE(Vc::cosh(inf), inf);
+    COMPARE(Vc::cosh(-inf), inf);
+    VERIFY(all_of(Vc::isnan(Vc::cosh(V(std::numeric_limits<T>::quiet_NaN())))));
+
+    Array<Reference<T> > reference = referenceData<T, Cosh>();
+    for (size_t i = 0; i + V::Size - 1 < reference.size; i += V::Size) {
+        V x, ref;
+        for (size_t j = 0; j < V::Size; ++j) {
+            x[j] = reference.data[i + j].x;
+            ref[j] = reference.data[i + j].ref;
+        }
+        FUZZY_COMPARE(Vc::cosh(x), ref) << " x = " << x << ", i = " << i;
+        FUZZY_COMPARE(Vc::cosh(-x), ref) << " -x = " << -x << ", i = " << i;
+    }
+}
+
+TEST_TYPES(V, testTanh, (REAL_VECTORS, SIMD_REAL_ARRAY_LIST)) //{{{1
+{
+    typedef typename V::EntryType T;
+    UnitTest::setFuzzyness<float>(2);
+    UnitTest::setFuzzyness<double>(2);
+
+    const V inf = std::numeric_limits<T>::infinity();
+    COMPARE(Vc::tanh(inf), V::One());
+    COMPARE(Vc::tanh(-inf), -V::One());
+    VERIFY(all_of(Vc::isnan(Vc::tanh(V(std::numeric_limits<T>::quiet_NaN())))));
+
+    Array<Reference<T> > reference = referenceData<T, Tanh>();
+    for (size_t i = 0; i + V::Size - 1 < reference.size; i += V::Size) {
+        V x, ref;
+        for (size_t j = 0; j < V::Size; ++j) {
+            x[j] = reference.data[i + j].x;
+            ref[j] = reference.data[i + j].ref;
+        }
+        FUZZY_COMPARE(Vc::tanh(x), ref) << " x = " << x << ", i = " << i;
+        FUZZY_COMPARE(Vc::tanh(-x), -ref) << " -x = " << -x << ", i = " << i;
+    }
+}
+
+TEST_TYPES(V, testErf, (REAL_VECTORS, SIMD_REAL_ARRAY_LIST)) //{{{1
+{
+    typedef typename V::EntryType T;
+    UnitTest::setFuzzyness<float>(2);
+    UnitTest::setFuzzyness<double>(2);
+
+    const V inf = std::numeric_limits<T>::infinity();
+    COMPARE(Vc::erf(inf), V::One());
+    COMPARE(Vc::erf(-inf), -V::One());
+    VERIFY(all_of(Vc::isnan(Vc::erf(V(std::numeric_limits<T>::quiet_NaN())))));
+
+    Array<Reference<T> > reference = referenceData<T, Erf>();
+    for (size_t i = 0; i + V::Size - 1 < reference.size; i += V::Size) {
+        V x, ref;
+        for (size_t j = 0; j < V::Size; ++j) {
+            x[j] = reference.data[i + j].x;
+            ref[j] = reference.data[i + j].ref;
+        }
+        FUZZY_COMPARE(Vc::erf(x), ref) << " x = " << x << ", i = " << i;
+        FUZZY_COMPARE(Vc::erf(-x), -ref) << " -x = " << -x << ", i = " << i;
+    }
+}
+
+TEST_TYPES(V, testErfc, (REAL_VECTORS, SIMD_REAL_ARRAY_LIST)) //{{{1
+{
+    typedef typename V::EntryType T;
+    UnitTest::setFuzzyness<float>(5);
+    UnitTest::setFuzzyness<double>(5);
+
+    const V inf = std::numeric_limits<T>::infinity();
+    COMPARE(Vc::erfc(inf), V::Zero());
+    COMPARE(Vc::erfc(-inf), V(T(2)));
+    VERIFY(all_of(Vc::isnan(Vc::erfc(V(std::numeric_limits<T>::quiet_NaN())))));
+
+    Array<Reference<T> > reference = referenceData<T, Erfc>();
+    for (size_t i = 0; i + V::Size - 1 < reference.size; i += V::Size) {
+        V x, ref;
+        for (size_t j = 0; j < V::Size; ++j) {
+            x[j] = reference.data[i + j].x;
+            ref[j] = reference.data[i + j].ref;
+        }
+        FUZZY_COMPARE(Vc::erfc(x), ref) << " x = " << x << ", i = " << i;
+    }
+}
+
 //}}}1
 // vim: foldmethod=marker
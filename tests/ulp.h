@@ -95,7 +95,11 @@ static V ulpDiffToReference(const V &_val, const V &_ref)
 
     typename V::IndexType exp;
     frexp(ref, &exp);
-    diff += ldexp(abs(ref - val), std::numeric_limits<T>::digits - exp);
+    // the ulp of ref is 2^(exp - digits), which is subnormal for small ref. Vc::ldexp
+    // only works for normal arguments and results, thus it is built in two exact steps.
+    const V ulp = ldexp(V::One(), exp - 1) *
+                  V(std::ldexp(T(1), 1 - std::numeric_limits<T>::digits));
+    diff += abs(ref - val) / ulp;
     diff.setZero(_val == _ref || (isnan(_val) && isnan(_ref)));
     return diff;
 }
@@ -1214,6 +1214,20 @@ template <typename V, int Repetitions = 10000, typename F> void withRandomMask(F
     }
 }
 
+// calls f with every mask of V, or with random masks if there are too many of them
+template <typename V, typename F> void withAllMasks(F &&f, std::true_type)
+{
+    for_all_masks(V, k) { f(k); }
+}
+template <typename V, typename F> void withAllMasks(F &&f, std::false_type)
+{
+    withRandomMask<V>(f);
+}
+template <typename V, typename F> void withAllMasks(F &&f)
+{
+    withAllMasks<V>(f, std::integral_constant<bool, (V::Size <= 16)>());
+}
+
 // typeToString {{{1
 template <typename T> inline std::string typeToString();
 // std::array<T, N> {{{2
@@ -1285,6 +1299,8 @@ inline std::string typeToString_impl(
         s << "SSE::";
     } else if (std::is_same<V, Vc::AVX::Vector<T>>::value) {
         s << "AVX::";
+    } else if (std::is_same<V, Vc::Vector<T, Vc::VectorAbi::Avx512>>::value) {
+        s << "AVX512::";
     } else if (std::is_same<V, Vc::MIC::Vector<T>>::value) {
         s << "MIC::";
     }
@@ -1303,6 +1319,8 @@ inline std::string typeToString_impl(
         s << "SSE::";
     } else if (std::is_same<V, Vc::AVX::Mask<T>>::value) {
         s << "AVX::";
+    } else if (std::is_same<V, Vc::Mask<T, Vc::VectorAbi::Avx512>>::value) {
+        s << "AVX512::";
     } else if (std::is_same<V, Vc::MIC::Mask<T>>::value) {
         s << "MIC::";
     }
@@ -1436,10 +1454,17 @@ template <typename... Ts> Typelist<Ts...> hackTypelist(void (*)(Typelist<Ts...>)
     Vc::int_v, Vc::ushort_v, Vc::uint_v, Vc::short_v
 #define ALL_VECTORS REAL_VECTORS, INT_VECTORS
 #define ALL_MASKS Vc::double_m, Vc::float_m, Vc::int_m, Vc::short_m
+#define INT8_VECTORS Vc::schar_v, Vc::uchar_v
+#define INT64_VECTORS Vc::int64_v, Vc::uint64_v
+#define EXTRA_INT_VECTORS INT8_VECTORS, INT64_VECTORS
 #define SIMD_REAL_ARRAYS(N_) Vc::SimdArray<double, N_>, Vc::SimdArray<float, N_>
 #define SIMD_INT_ARRAYS(N_)                                                              \
     Vc::SimdArray<int, N_>, Vc::SimdArray<unsigned short, N_>,                           \
         Vc::SimdArray<unsigned int, N_>, Vc::SimdArray<short, N_>
+#define SIMD_INT8_ARRAYS(N_) Vc::SimdArray<signed char, N_>, Vc::SimdArray<unsigned char, N_>
+#define SIMD_INT64_ARRAYS(N_)                                                            \
+    Vc::SimdArray<std::int64_t, N_>, Vc::SimdArray<std::uint64_t, N_>
+#define SIMD_EXTRA_INT_ARRAYS(N_) SIMD_INT8_ARRAYS(N_), SIMD_INT64_ARRAYS(N_)
 #if defined Vc_IMPL_MIC
 #define SIMD_INT_ODD_ARRAYS(N_) Vc::SimdArray<int, N_>, Vc::SimdArray<unsigned int, N_>
 #else
@@ -35,11 +35,17 @@ namespace Traits
 template <typename T> struct is_load_store_flag;
 
 template <typename... Args> struct is_load_arguments : public std::false_type {};
-template <typename U> struct is_load_arguments<U> : public std::is_pointer<U> {};
+// the arguments are deduced as forwarding references, thus U may be an lvalue reference to
+// a pointer
+template <typename U>
+struct is_load_arguments<U> : public std::is_pointer<typename std::remove_reference<U>::type>
+{
+};
 template <typename U, typename F>
-struct is_load_arguments<U, F> : public std::integral_constant<
-                                     bool,
-                                     std::is_pointer<U>::value&& is_load_store_flag<F>::value>
+struct is_load_arguments<U, F>
+    : public std::integral_constant<
+          bool, std::is_pointer<typename std::remove_reference<U>::type>::value &&
+                    is_load_store_flag<F>::value>
 {
 };
 }  // namespace Traits